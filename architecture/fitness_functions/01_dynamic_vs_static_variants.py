@@ -135,37 +135,41 @@ def check_capacity_field_usage(src_content: str, file_path: Path) -> Tuple[bool,
     # Look for assignments to capacity field (e.g., "array->capacity = " or "->capacity=")
     capacity_assignment = re.compile(r'->capacity\s*=\s*[^=]')
 
-    # Find the d_InitStaticArray function bounds
+    # Find the init function bounds. d_InitStaticArray forwards to
+    # d_InitStaticArrayWithAllocator, which is where the struct is built,
+    # so both count as init.
     init_func_pattern = re.compile(
-        r'dStaticArray_t\*\s+d_InitStaticArray\s*\([^)]*\)\s*\{',
+        r'dStaticArray_t\*\s+d_InitStaticArray(?:WithAllocator)?\s*\([^)]*\)\s*\{',
         re.MULTILINE
     )
 
-    match = init_func_pattern.search(src_content)
-    if not match:
-        # Can't verify if we can't find the init function
-        return True, issues
+    init_ranges = []
+    for match in init_func_pattern.finditer(src_content):
+        init_start = match.end()
+        brace_depth = 1
+        init_end = init_start
+
+        while init_end < len(src_content) and brace_depth > 0:
+            if src_content[init_end] == '{':
+                brace_depth += 1
+            elif src_content[init_end] == '}':
+                brace_depth -= 1
+            init_end += 1
 
-    # Find the end of the init function
-    init_start = match.end()
-    brace_depth = 1
-    init_end = init_start
+        init_ranges.append((init_start, init_end))
 
-    while init_end < len(src_content) and brace_depth > 0:
-        if src_content[init_end] == '{':
-            brace_depth += 1
-        elif src_content[init_end] == '}':
-            brace_depth -= 1
-        init_end += 1
+    if not init_ranges:
+        # Can't verify if we can't find the init function
+        return True, issues
 
-    # Look for capacity assignments outside the init function
+    # Look for capacity assignments outside the init functions
     capacity_assignment = re.compile(r'->capacity\s*=\s*[^=]')
 
     for match in capacity_assignment.finditer(src_content):
         pos = match.start()
 
-        # Skip if inside init function
-        if init_start <= pos < init_end:
+        # Skip if inside an init function
+        if any(start <= pos < end for start, end in init_ranges):
             continue
 
         line_num = src_content[:pos].count('\n') + 1
@@ -151,6 +151,8 @@ typedef struct _dLinkedList_t
   void *data;                      /**< A generic pointer to the actual data stored in this node. */
   char buffer[MAX_FILENAME_LENGTH];/**< A fixed-size buffer, often used for filenames or small strings. */
   struct _dLinkedList_t *next;     /**< Pointer to the next node in the linked list. NULL if this is the last node. */
+  struct dPool_t *pool;            /**< Pool this node was taken from, or NULL if it came from `allocator`. */
+  const struct dAllocator_t *allocator; /**< Allocator for `data`, and for this node unless `pool` is set. */
 } dLinkedList_t;
 
 /**
@@ -164,9 +166,108 @@ typedef struct _dQuadTree_t
   float rect[4];             /**< The bounding rectangle of this quadtree node, typically [x, y, width, height]. */
   int capacity;              /**< The maximum number of objects this node can hold before subdividing. */
   dLinkedList_t *objects;    /**< A linked list of objects contained within this quadtree node. */
+  const struct dAllocator_t *allocator; /**< Allocator this node was created with. */
 } dQuadTree_t;
 
 
+// -- Allocator Structures ---
+
+
+/**
+ * @brief Pluggable memory allocator: three callbacks plus the context they share.
+ *
+ * Every container records the allocator it was created with in its `allocator` field
+ * and sends all of its own allocations through it, so one container can live in an
+ * arena, another on huge pages, and a third in a counting wrapper. Containers that
+ * take no allocator argument use d_GetDefaultAllocator() at creation time.
+ *
+ * @note `realloc_func` and `free_func` receive no size. An allocator that needs the
+ * size of a block (an arena copying on realloc, a byte counter) must record it itself.
+ */
+typedef struct dAllocator_t
+{
+    void* (*alloc_func)(void* context, size_t size);              /**< Returns `size` bytes (maximally aligned, like malloc), or NULL. */
+    void* (*realloc_func)(void* context, void* ptr, size_t size); /**< Resizes `ptr` (NULL acts as alloc), keeping its contents; NULL on failure. */
+    void (*free_func)(void* context, void* ptr);                  /**< Releases `ptr`; called with NULL never. */
+    void* context;                                                /**< Passed to every callback. */
+} dAllocator_t;
+
+/**
+ * @brief One block of arena memory; allocations are carved from just past this header.
+ */
+typedef struct dArenaChunk_t
+{
+    struct dArenaChunk_t* next; /**< Following chunk; chunks past `current` are kept for reuse. */
+    size_t capacity;            /**< Usable bytes after the header. */
+    size_t used;                /**< Bytes handed out so far (only meaningful up to `current`). */
+} dArenaChunk_t;
+
+/**
+ * @brief Linear (bump) allocator: allocation is a pointer bump, freeing is a reset.
+ *
+ * Memory comes from a chain of chunks. When the current chunk fills up, the arena
+ * moves to the next kept chunk or allocates a new one of `chunk_size` bytes (larger
+ * for oversized requests). d_ArenaReset() rewinds to the first chunk in O(1) and
+ * keeps every chunk, so a frame loop stops allocating once it reaches its high-water
+ * mark. Markers rewind part of the arena, for nested scratch work.
+ *
+ * @note Pass d_ArenaGetAllocator() to a d_*WithAllocator() call to place a container
+ *       in the arena. Its frees are no-ops except for the most recent block, which is
+ *       rolled back, and a realloc of that block grows in place when the chunk has room.
+ * @note Not thread-safe; use one arena per thread.
+ */
+typedef struct dArena_t
+{
+    dAllocator_t allocator;       /**< dAllocator_t view of this arena; `context` points back here. */
+    const dAllocator_t* backing;  /**< Allocator for the struct and chunks, fixed at creation. */
+    dArenaChunk_t* first;         /**< Oldest chunk, where a reset starts over. */
+    dArenaChunk_t* current;       /**< Chunk new allocations are carved from. */
+    size_t chunk_size;            /**< Capacity of ordinary chunks. */
+    size_t chunk_count;           /**< Chunks owned, including kept ones past `current`. */
+    size_t reserved;              /**< Total capacity of all chunks, in bytes. */
+} dArena_t;
+
+/**
+ * @brief A position in an arena, taken by d_ArenaGetMarker() and rewound to by d_ArenaRestore().
+ */
+typedef struct dArenaMarker_t
+{
+    dArenaChunk_t* chunk; /**< Chunk that was current. */
+    size_t used;          /**< Its fill level at the time. */
+} dArenaMarker_t;
+
+/**
+ * @brief Fixed-size block allocator: every block is `block_size` bytes, carved from slabs.
+ *
+ * Freed blocks go onto a free list and allocation pops one, so churning small nodes
+ * costs a pointer swap and never fragments the backing heap. Each thread keeps a
+ * small cache of free blocks and takes the pool's spin lock only to move blocks in
+ * batches. d_PoolReset() releases every block at once and d_PoolDestroy() returns
+ * whole slabs without visiting individual blocks.
+ *
+ * @note d_PoolAlloc() and d_PoolFree() are thread-safe; d_PoolReset() and
+ *       d_PoolDestroy() must not race with any other use of the pool.
+ * @note Up to 64 threads hold a cache at once; others use the locked free list. When a
+ *       thread exits, its cached blocks go back to every pool and its cache slot is
+ *       handed to the next thread (on pthreads platforms).
+ */
+typedef struct dPool_t
+{
+    dAllocator_t allocator;       /**< dAllocator_t view of this pool; requests above `block_size` fail. */
+    const dAllocator_t* backing;  /**< Allocator for the struct, slabs and caches, fixed at creation. */
+    size_t block_size;            /**< Bytes per block, rounded up to a multiple of 16. */
+    size_t blocks_per_slab;       /**< Blocks carved from each slab. */
+    size_t slab_count;            /**< Slabs owned, including ones kept by a reset. */
+    void* slabs;                  /**< First slab; slabs are linked through their headers. */
+    void* carve_slab;             /**< Slab whose never-used blocks are handed out next. */
+    size_t carve_next;            /**< Index of the next never-used block in `carve_slab`. */
+    void* free_list;              /**< Shared free blocks, linked through their first word. */
+    void* caches;                 /**< Per-thread free-block caches, one cache line each. */
+    int lock;                     /**< Spin lock guarding the shared fields above. */
+    void* registry_next;          /**< Next live pool; exiting threads flush their cache in each. */
+} dPool_t;
+
+
 // -- Array Structures ---
 
 
@@ -186,6 +287,7 @@ typedef struct          // dArray_t
   size_t count;         /**< The current number of active elements stored in the array. */
   size_t element_size;  /**< The size in bytes of each individual element stored in the array. */
   void* data;           /**< A pointer to the dynamically allocated contiguous memory block holding the elements. */
+  const dAllocator_t* allocator; /**< Allocator for the struct and `data`, fixed at initialization. */
 } dArray_t;
 
 /**
@@ -207,8 +309,136 @@ typedef struct          // dStaticArray_t
   size_t count;         /**< The current number of active elements stored in the array. */
   size_t element_size;  /**< The size in bytes of each individual element stored in the array. */
   void* data;           /**< A pointer to the fixed-size contiguous memory block holding the elements. */
+  const dAllocator_t* allocator; /**< Allocator for the struct and `data`, fixed at initialization. */
 } dStaticArray_t;
 
+/**
+ * @brief Stable reference to an element of a dSlotMap_t.
+ *
+ * The low 32 bits are the slot index and the high 32 bits the slot's generation.
+ * Removing an element bumps its slot's generation, so every handle to it goes
+ * stale and is rejected in O(1). Generations start at 1, so `D_SLOT_HANDLE_NULL`
+ * never refers to an element.
+ */
+typedef uint64_t dSlotHandle_t;
+
+#define D_SLOT_HANDLE_NULL ((dSlotHandle_t)0)
+
+/**
+ * @brief Densely stored elements addressed through generational handles.
+ *
+ * Elements live packed in `dense`, so iteration is a linear scan over contiguous
+ * memory. `slots` maps each handle's index to its element's dense position; removal
+ * moves the last element into the hole (swap-and-pop) and patches its slot, so
+ * insert, lookup and remove are all O(1) and outstanding handles stay valid.
+ *
+ * @note Create with d_SlotMapInit() and free with d_SlotMapDestroy().
+ * @warning Pointers into `dense` are invalidated by any insert or remove; keep handles instead.
+ */
+typedef struct          // dSlotMap_t
+{
+  dArray_t* dense;      /**< The elements, packed at indices `[0, count)`. */
+  dArray_t* dense_slot; /**< `uint32_t` slot index owning each dense element. */
+  dArray_t* slots;      /**< `{ dense index or next free slot, generation }` pairs of `uint32_t`. */
+  uint32_t free_head;   /**< First free slot, or UINT32_MAX when every slot is in use. */
+  const dAllocator_t* allocator; /**< Allocator for the struct and its three arrays. */
+} dSlotMap_t;
+
+/**
+ * @brief Describes one field (column) of a dSoA_t.
+ */
+typedef struct          // dSoAField_t
+{
+  size_t size;          /**< Size in bytes of one value of this field, e.g. `sizeof(dVec3_t)`. */
+  size_t alignment;     /**< Required alignment (power of two), or 0 for D_SOA_COLUMN_ALIGNMENT; never less. */
+} dSoAField_t;
+
+/**
+ * @brief Struct-of-arrays container: one contiguous column per field, sharing one count.
+ *
+ * Each column starts on a `D_SOA_COLUMN_ALIGNMENT` boundary, so a pass that touches
+ * only a few fields streams just those columns through the cache and can feed
+ * them straight to SIMD loads. All columns live in a single allocation.
+ *
+ * @note Create with d_SoAInit() and free with d_SoADestroy().
+ * @warning Column pointers are invalidated whenever the container grows.
+ */
+typedef struct          // dSoA_t
+{
+  size_t field_count;   /**< Number of fields (columns). */
+  size_t* field_sizes;  /**< Size in bytes of one value of each field. */
+  size_t* field_aligns; /**< Column alignment of each field (at least D_SOA_COLUMN_ALIGNMENT). */
+  void** columns;       /**< Start of each field's column inside `storage`. */
+  void* storage;        /**< The single block holding every column, or NULL at capacity 0. */
+  size_t count;         /**< Number of rows in use. */
+  size_t capacity;      /**< Number of rows every column has room for. */
+  const dAllocator_t* allocator; /**< Allocator for the struct, its tables and `storage`. */
+} dSoA_t;
+
+#define D_SOA_COLUMN_ALIGNMENT 64
+
+/**
+ * @brief Concurrency contract of a dRingBuffer_t.
+ */
+typedef enum {
+  D_RING_BUFFER_SPSC,   /**< One producer thread and one consumer thread; wait-free. */
+  D_RING_BUFFER_MPMC    /**< Any number of producers and consumers; lock-free via per-slot sequence numbers. */
+} dRingBufferMode_t;
+
+#define D_RING_BUFFER_PAD 64
+
+/**
+ * @brief Bounded lock-free queue over a power-of-two dStaticArray_t.
+ *
+ * The enqueue position (`head`) and dequeue position (`tail`) each sit on their own
+ * cache line, apart from the read-only fields, so producers and consumers never
+ * write to a line the other side is reading. In SPSC mode each side also keeps a
+ * cached copy of the other side's position and only reloads it when the queue
+ * looks full or empty. In MPMC mode every slot carries a sequence number that says
+ * which lap of the ring may write or read it next, so positions are claimed with a
+ * single compare-and-swap and slots are published without a lock.
+ *
+ * @note Create with d_RingBufferInit() and free with d_RingBufferDestroy().
+ */
+typedef struct          // dRingBuffer_t
+{
+  dStaticArray_t* slots;        /**< `capacity` slots; in MPMC mode each slot is a sequence number followed by the element. */
+  size_t mask;                  /**< `capacity - 1`; capacity is a power of two. */
+  size_t element_size;          /**< Size in bytes of each element. */
+  size_t element_offset;        /**< Byte offset of the element within a slot (0 in SPSC mode). */
+  dRingBufferMode_t mode;       /**< SPSC or MPMC. */
+  const dAllocator_t* allocator; /**< Allocator for the struct and its slots. */
+  unsigned char pad0[D_RING_BUFFER_PAD];
+  size_t head;                  /**< Next position to enqueue; written by producers. */
+  size_t cached_tail;           /**< SPSC: producer's last view of `tail`. */
+  unsigned char pad1[D_RING_BUFFER_PAD];
+  size_t tail;                  /**< Next position to dequeue; written by consumers. */
+  size_t cached_head;           /**< SPSC: consumer's last view of `head`. */
+  unsigned char pad2[D_RING_BUFFER_PAD];
+} dRingBuffer_t;
+
+#define D_CHUNKED_ARRAY_DEFAULT_CHUNK_BYTES 65536  // Chunk size used when none is given
+
+/**
+ * @brief Growable array of fixed-size chunks whose elements never move.
+ *
+ * Elements live in power-of-two sized chunks, so element `i` is at offset `i & chunk_mask`
+ * of chunk `i >> chunk_shift`. Growing allocates one new chunk and only ever reallocates
+ * the small table of chunk pointers, so pointers to elements stay valid until the element
+ * is removed and no append copies existing elements.
+ *
+ * @note Create with d_ChunkedArrayInit() and free with d_ChunkedArrayDestroy().
+ */
+typedef struct          // dChunkedArray_t
+{
+  dArray_t* chunks;     /**< `void*` pointers to the allocated chunks, in order. */
+  size_t count;         /**< Number of elements in use. */
+  size_t element_size;  /**< Size in bytes of each element. */
+  size_t chunk_shift;   /**< log2 of the elements per chunk. */
+  size_t chunk_mask;    /**< Elements per chunk minus one. */
+  const dAllocator_t* allocator; /**< Allocator for the struct, its chunks and the chunk table. */
+} dChunkedArray_t;
+
 
 // -- Table Structures --
 
@@ -276,8 +506,21 @@ typedef struct
 {
     void* key_data;    /**< A pointer to the internally managed copy of the key data. */
     void* value_data;  /**< A pointer to the internally managed copy of the value data. */
+    size_t hash;       /**< The full hash of the key, cached so lookups skip mismatched compares and rehashing never re-hashes. */
 } dTableEntry_t;
 
+/**
+ * @brief Selects the storage engine used by a dTable_t.
+ *
+ * Every public d_Table* function works with every mode; the mode only changes
+ * how entries are laid out in memory.
+ */
+typedef enum {
+    D_TABLE_MODE_CHAINED = 0, /**< Separate chaining: one heap entry and `dLinkedList_t` node per key (default). */
+    D_TABLE_MODE_FLAT,        /**< Open addressing: keys and values stored inline in one contiguous slot array. */
+    D_TABLE_MODE_COMPACT      /**< Compact dict: dense insertion-ordered entry array plus a small sparse index. */
+} dTableMode_t;
+
 /**
  * @brief Represents a hash table (or dictionary) that stores key-value pairs.
  *
@@ -285,6 +528,24 @@ typedef struct
  * lookup, insertion, and deletion of elements. It uses chaining with `dLinkedList_t`
  * to handle collisions and automatically resizes its internal storage to maintain performance.
  *
+ * @note In `D_TABLE_MODE_FLAT` the `buckets` array is unused (NULL). Entries live in
+ * `slots`, one per slot, with a parallel `ctrl` byte array recording whether each slot
+ * is empty, deleted, or full (plus 7 bits of the key's hash to skip most compares).
+ * `num_buckets` then holds the slot count, which is always a power of two.
+ *
+ * @note In `D_TABLE_MODE_COMPACT` (the CPython 3.6+ dict layout) `slots` is a dense
+ * array of entries in insertion order, with `ctrl` marking removed entries and
+ * `slot_hashes` holding each entry's hash. `index` is the open-addressed hash index
+ * of `num_buckets` slots, each `index_width` bytes (1, 2, 4 or 8, chosen from the
+ * entry capacity) and holding an entry number. Iteration walks `slots` linearly,
+ * so it follows insertion order and never touches the index.
+ *
+ * @note When incremental rehashing is enabled (`rehash_step > 0`, CHAINED mode only),
+ * growth swaps in a doubled `buckets` array and keeps the previous one in `old_buckets`.
+ * Every Set and Remove then migrates up to `rehash_step` old buckets before doing its
+ * own work, as does d_TableRehashStep(); lookups never migrate, and consult both arrays
+ * until `old_buckets` is drained and freed.
+ *
  * @note This structure is designed to be initialized via `d_TableInit()`, which sets
  * up its internal buckets and function pointers.
  * @note Keys and values are copied internally. The user is responsible for managing
@@ -303,8 +564,34 @@ typedef struct          // dTable_t
     dTableHashFunc hash_func;     /**< Pointer to the function used for hashing keys. */
     dTableCompareFunc compare_func; /**< Pointer to the function used for comparing keys. */
     float load_factor_threshold; /**< The ratio of `count` to `num_buckets` at which the table will automatically rehash and grow. */
+    dTableMode_t mode;      /**< The storage engine selected at initialization. */
+    uint8_t* ctrl;          /**< FLAT mode: one control byte per slot (empty, deleted, or 7 hash bits). COMPACT mode: per entry, deleted or live. */
+    void* slots;            /**< FLAT/COMPACT mode: contiguous slot array; each slot holds the key followed by the value. */
+    size_t slot_size;       /**< FLAT/COMPACT mode: size in bytes of one slot, including alignment padding. */
+    size_t value_offset;    /**< FLAT/COMPACT mode: byte offset of the value within a slot. */
+    size_t tombstones;      /**< FLAT mode: deleted slots still lengthening probe sequences. COMPACT mode: removed entries not yet compacted away. */
+    size_t* slot_hashes;    /**< FLAT/COMPACT mode: full mixed hash of each slot's key, reused when resizing. */
+    void* index;            /**< COMPACT mode: sparse hash index of `num_buckets` entry numbers. */
+    size_t index_width;     /**< COMPACT mode: bytes per index slot (1, 2, 4 or 8). */
+    size_t entries_used;    /**< COMPACT mode: entries appended so far, including removed ones. */
+    size_t entries_capacity; /**< COMPACT mode: entries that fit before the table must resize (2/3 of `num_buckets`). */
+    dArray_t* old_buckets;  /**< CHAINED mode: bucket array still being drained by an incremental rehash, or NULL. */
+    size_t old_num_buckets; /**< CHAINED mode: number of buckets in `old_buckets`. */
+    size_t rehash_index;    /**< CHAINED mode: next bucket of `old_buckets` to migrate. */
+    size_t rehash_step;     /**< CHAINED mode: old buckets migrated per operation (0 = rehash all at once). */
+    size_t version;         /**< Bumped whenever entries are added, removed or moved; checked by cursors. */
+    const dAllocator_t* allocator; /**< Allocator for the struct and every internal array and entry, fixed at initialization. */
+    dPool_t* node_pool;     /**< CHAINED mode: pool owned by the table that every per-key block comes from, or NULL. */
 } dTable_t;
 
+/**
+ * @brief Selects the storage layout used by a dStaticTable_t.
+ */
+typedef enum {
+    D_STATIC_TABLE_MODE_CHAINED = 0, /**< Modulo buckets with `dLinkedList_t` chains (d_InitStaticTable). */
+    D_STATIC_TABLE_MODE_PERFECT      /**< Minimal perfect hash into a flat slot array (d_InitStaticTablePerfect). */
+} dStaticTableMode_t;
+
 /**
  * @brief Represents a fixed-structure hash table with immutable key set and size.
  *
@@ -319,19 +606,325 @@ typedef struct          // dTable_t
  * @note This structure provides O(1) value lookups and updates for a known, fixed set of keys.
  * @warning Keys cannot be added or removed after initialization. The structure is optimized
  * for use cases where the complete key set is known beforehand.
+ *
+ * @note In `D_STATIC_TABLE_MODE_PERFECT` the `buckets` array is unused (NULL). Entries live
+ * in `slots`, exactly `num_keys` of them, placed by a minimal perfect hash: the key's mixed
+ * hash picks one of `num_buckets` pilot buckets, and that bucket's entry in `pilots`
+ * selects the slot. Every key therefore owns a distinct slot and a lookup is one probe.
  */
 typedef struct          // dStaticTable_t  
 {
     dArray_t* buckets;            /**< An array of `dLinkedList_t` pointers for collision resolution (same as dTable_t). */
-    size_t num_buckets;           /**< The fixed total number of buckets in the hash table. */
+    size_t num_buckets;           /**< The fixed total number of buckets in the hash table (PERFECT mode: pilot buckets). */
     size_t num_keys;              /**< The fixed number of keys in the table (immutable after init). */
     size_t key_size;              /**< The size in bytes of each key. */
     size_t value_size;            /**< The size in bytes of each value. */
     dTableHashFunc hash_func;     /**< Pointer to the function used for hashing keys. */
     dTableCompareFunc compare_func; /**< Pointer to the function used for comparing keys. */
     bool is_initialized;          /**< Flag indicating whether the table has been fully initialized with its fixed key set. */
+    size_t version;               /**< Bumped when the entries are cleared; checked by cursors. */
+    dStaticTableMode_t mode;      /**< The storage layout selected at initialization. */
+    void* slots;                  /**< PERFECT mode: `num_keys` slots; each slot holds the key followed by the value. */
+    size_t slot_size;             /**< PERFECT mode: size in bytes of one slot, including alignment padding. */
+    size_t value_offset;          /**< PERFECT mode: byte offset of the value within a slot. */
+    size_t* slot_hashes;          /**< PERFECT mode: hash of each slot's key, reused by d_RebucketStaticTable(). */
+    uint32_t* pilots;             /**< PERFECT mode: per-bucket displacement chosen at build time (`num_buckets` entries). */
+    uint32_t* seqs;               /**< Concurrent mode: seqlock counter per bucket (CHAINED) or per slot (PERFECT), odd while a value is being written; NULL when off. */
+    void* mapping;                /**< PERFECT mode: read-only file mapping the arrays point into (d_MapStaticTableFromFile), or NULL. */
+    size_t mapping_size;          /**< PERFECT mode: size in bytes of `mapping`. */
+    void* slabs;                  /**< CHAINED mode: blocks holding every chain node, entry, key and value, one per build partition, linked through their first word. */
+    const dAllocator_t* allocator; /**< Allocator for the struct and every internal array and entry, fixed at initialization. */
 } dStaticTable_t;
 
+/**
+ * @brief Cursor over the entries of a dTable_t or dStaticTable_t.
+ *
+ * Created on the stack by d_TableIterBegin() or d_StaticTableIterBegin() and advanced
+ * with the matching Next call. Advancing allocates nothing and yields pointers straight
+ * into the table's own storage.
+ *
+ * @note Unless NDEBUG is defined, Next aborts if the table was structurally modified
+ * (insert of a new key, remove, rehash, clear) after the cursor was created.
+ */
+typedef struct
+{
+    const void* table;      /**< The dTable_t or dStaticTable_t being walked. */
+    size_t position;        /**< Next bucket, slot or entry to examine. */
+    dLinkedList_t* node;    /**< Chained storage: next node of the current bucket, or NULL. */
+    size_t version;         /**< The table's `version` when the cursor was created. */
+} dTableIter_t;
+
+/**
+ * @brief Represents a thread-safe hash table partitioned into independently locked shards.
+ *
+ * Each key is owned by exactly one shard, selected by the high bits of its (mixed) hash.
+ * Every shard is an ordinary FLAT-mode dTable_t guarded by its own reader/writer lock, so
+ * readers on different shards never contend and readers on the same shard share the lock.
+ * Growth rehashes only the shard being written; the rest of the table stays available.
+ *
+ * @note Create with d_ConcurrentTableInit() and free with d_ConcurrentTableDestroy().
+ * @note Values are copied out by d_ConcurrentTableGet(); pointers into a shard are never
+ * handed out, since another thread may rehash it at any moment.
+ */
+typedef struct          // dConcurrentTable_t
+{
+    void* shards;                 /**< Opaque array of `num_shards` lock/table pairs, each padded to a cache line. */
+    size_t num_shards;            /**< Number of shards (always a power of two). */
+    unsigned int shard_bits;      /**< log2(num_shards): how many high hash bits select the shard. */
+    size_t key_size;              /**< The size in bytes of each key. */
+    size_t value_size;            /**< The size in bytes of each value. */
+    dTableHashFunc hash_func;     /**< Pointer to the function used for hashing keys. */
+    dTableCompareFunc compare_func; /**< Pointer to the function used for comparing keys. */
+    const dAllocator_t* allocator; /**< Allocator for the struct and shard array; shard tables record it too. */
+} dConcurrentTable_t;
+
+/**
+ * @brief Callback invoked for every value that leaves a dLRUCache_t.
+ *
+ * Runs on eviction, explicit removal, replacement by a newer value, clear and destroy,
+ * so resources owned by cached values (textures, heap buffers) can be released.
+ *
+ * @warning The callback must not call back into the same cache.
+ */
+typedef void (*dLRUEvictFunc)(const void* key, const void* value, void* user_data);
+
+/**
+ * @brief Represents a bounded least-recently-used cache of fixed-size key-value pairs.
+ *
+ * A FLAT-mode dTable_t maps each key to a node number. Nodes live in one growable array
+ * and are threaded onto an intrusive doubly linked recency list by index, so get, put
+ * and evict are all O(1) and reuse freed nodes without further allocation.
+ *
+ * @note Create with d_LRUCacheInit() and free with d_LRUCacheDestroy().
+ * @note Either limit may be 0 (unbounded); with both set, whichever is hit first evicts.
+ */
+typedef struct          // dLRUCache_t
+{
+    dTable_t* index;              /**< FLAT table mapping key -> node number. */
+    void* nodes;                  /**< Node array; each node holds links, cost, key and value. */
+    size_t node_size;             /**< Size in bytes of one node, including alignment padding. */
+    size_t key_offset;            /**< Byte offset of the key within a node. */
+    size_t value_offset;          /**< Byte offset of the value within a node. */
+    size_t node_capacity;         /**< Nodes allocated in `nodes`. */
+    size_t nodes_used;            /**< Nodes ever handed out (high-water mark). */
+    size_t free_head;             /**< First node of the free list, or SIZE_MAX. */
+    size_t head;                  /**< Most recently used node, or SIZE_MAX when empty. */
+    size_t tail;                  /**< Least recently used node, or SIZE_MAX when empty. */
+    size_t count;                 /**< Number of cached entries. */
+    size_t key_size;              /**< The size in bytes of each key. */
+    size_t value_size;            /**< The size in bytes of each value. */
+    size_t max_entries;           /**< Entry limit (0 = unlimited). */
+    size_t max_bytes;             /**< Cost limit in bytes (0 = unlimited). */
+    size_t total_bytes;           /**< Sum of the costs of all cached entries. */
+    dLRUEvictFunc on_evict;       /**< Called for every value leaving the cache, or NULL. */
+    void* evict_user_data;        /**< Passed through to `on_evict`. */
+    size_t hits;                  /**< d_LRUCacheGet calls that found their key. */
+    size_t misses;                /**< d_LRUCacheGet calls that did not. */
+    size_t evictions;             /**< Entries dropped to stay within the limits. */
+    const dAllocator_t* allocator; /**< Allocator for the struct, its index table and its node array. */
+} dLRUCache_t;
+
+
+// -- File Writer Structures ---
+
+
+/**
+ * @brief Running 64-bit checksum over a byte stream.
+ *
+ * Feeding the same bytes gives the same result however they are split across
+ * d_ChecksumUpdate() calls. dFileWriter_t appends it to every file it writes.
+ */
+typedef struct          // dChecksum_t
+{
+    uint64_t state;         /**< Mixed state over every complete 8-byte word so far. */
+    uint64_t pending;       /**< Bytes of the current, incomplete word. */
+    size_t pending_bytes;   /**< Number of bytes held in `pending` (0-7). */
+    uint64_t length;        /**< Total bytes fed in. */
+} dChecksum_t;
+
+/**
+ * @brief Buffered binary writer that replaces its target file atomically.
+ *
+ * Output goes to `<path>.<pid>.<n>.tmp`, a temp file unique to this writer, through one
+ * large buffer; writes at least as large as the buffer skip it and go straight to the file. Committing appends a dChecksum_t trailer
+ * over everything written, syncs the file, renames it over `path` and syncs the parent
+ * directory, so readers see either the old file or the complete new one, never a torn mix.
+ *
+ * @note Create with d_FileWriterOpen(); finish with d_FileWriterCommit() or d_FileWriterAbort().
+ */
+typedef struct          // dFileWriter_t
+{
+    FILE* file;             /**< The temporary file being written (unbuffered; `buffer` replaces stdio's). */
+    char* buffer;           /**< Staging buffer for small writes. */
+    size_t buffer_size;     /**< Capacity of `buffer` in bytes. */
+    size_t used;            /**< Bytes currently staged in `buffer`. */
+    uint64_t offset;        /**< Bytes written so far, staged ones included, excluding the trailer. */
+    dChecksum_t checksum;   /**< Checksum of every byte written so far. */
+    char* path;             /**< Final file path. */
+    char* temp_path;        /**< `path` with ".<pid>.<n>.tmp" appended. */
+    bool failed;            /**< Set by the first failed write; later writes and the commit fail. */
+    const dAllocator_t* allocator; /**< Allocator for the writer, its buffer and paths. */
+} dFileWriter_t;
+
+/**
+ * @brief State of a background save started with d_AsyncSaveStart().
+ */
+typedef enum
+{
+    D_ASYNC_SAVE_PENDING = 0,   /**< Still writing. */
+    D_ASYNC_SAVE_DONE,          /**< The file was committed. */
+    D_ASYNC_SAVE_FAILED         /**< The save failed; any previous file is untouched. */
+} dAsyncSaveStatus_t;
+
+/**
+ * @brief Writes a snapshot to `filename` on the background thread; returns 0 on success, 1 on failure.
+ */
+typedef int (*dAsyncSaveWriteFunc)(const char* filename, void* snapshot);
+
+/**
+ * @brief Frees a snapshot once its save has finished.
+ */
+typedef void (*dAsyncSaveFreeFunc)(void* snapshot);
+
+/**
+ * @brief Called once a background save finishes, with 0 on success and 1 on failure.
+ *
+ * @warning Runs on the background thread, not the thread that started the save.
+ */
+typedef void (*dAsyncSaveCallback)(const char* filename, int result, void* user_data);
+
+/**
+ * @brief Handle for a save running on a background thread.
+ *
+ * The caller takes a private snapshot of the data, which is cheap next to the
+ * serialization, checksum, fsync and rename, and those run on a worker thread.
+ * Poll with d_AsyncSavePoll() or block with d_AsyncSaveWait().
+ *
+ * @note Create with d_AsyncSaveStart() or one of the *SaveToFileAsync functions;
+ *       free with d_AsyncSaveDestroy(), which waits for the save to finish.
+ */
+typedef struct          // dAsyncSave_t
+{
+    void* thread;                   /**< Opaque worker thread handle; NULL once joined or if the save ran inline. */
+    char* filename;                 /**< Target file path (owned copy). */
+    void* snapshot;                 /**< Data being written; freed with `free_func` when the save ends. */
+    dAsyncSaveWriteFunc write_func; /**< Writes `snapshot` to `filename`. */
+    dAsyncSaveFreeFunc free_func;   /**< Frees `snapshot`. */
+    dAsyncSaveCallback callback;    /**< Optional completion callback. */
+    void* user_data;                /**< Passed to `callback`. */
+    int status;                     /**< dAsyncSaveStatus_t; published with release ordering by the worker. */
+    const dAllocator_t* allocator;  /**< Allocator for the handle and its copy of `filename`. */
+} dAsyncSave_t;
+
+
+// -- Job System Structures ---
+
+
+/**
+ * @brief Function run by a job; `data` is the pointer given at submission.
+ */
+typedef void (*dJobFunc)(void* data);
+
+/**
+ * @brief Callback run by the parallel-for helpers on one chunk of consecutive elements.
+ *
+ * @param elements Pointer to the first element of the chunk
+ * @param first Index of that element in the whole array
+ * @param count Number of elements in the chunk
+ * @param user_data Context pointer passed through from the caller
+ */
+typedef void (*dParallelForFunc)(void* elements, size_t first, size_t count, void* user_data);
+
+/**
+ * @brief Ordering comparator for the sort functions.
+ *
+ * @return Negative if `a` sorts before `b`, positive if after, 0 if they are equivalent
+ */
+typedef int (*dSortCompareFunc)(const void* a, const void* b, void* user_data);
+
+/**
+ * @brief Key extractor for the radix sorts.
+ *
+ * @return An unsigned key whose numeric order is the desired element order; see
+ *         d_SortKeyFromInt64() and friends for signed and floating-point keys
+ */
+typedef uint64_t (*dSortKeyFunc)(const void* element, void* user_data);
+
+/**
+ * @brief Counts unfinished jobs; doubles as a fence other jobs can depend on.
+ *
+ * Zero-initialize before first use (`dJobCounter_t done = {0};`). Every job submitted
+ * with the counter adds one and subtracts one when it finishes, so it reaches zero once
+ * all of them are done. Jobs submitted with the counter as their dependency are held
+ * back until then.
+ *
+ * @warning A counter must outlive every job that references it; d_JobSystemWait() on it
+ *          before it goes out of scope.
+ */
+typedef struct dJobCounter_t
+{
+    size_t pending;         /**< Jobs submitted with this counter that have not finished. */
+    int lock;               /**< Spin lock guarding `waiting` and the final decrement. */
+    void* waiting;          /**< Jobs held back until `pending` reaches zero. */
+} dJobCounter_t;
+
+/**
+ * @brief Pool of worker threads that share jobs through work-stealing deques.
+ *
+ * Each worker owns a Chase-Lev deque: it pushes and pops jobs at the bottom, while idle
+ * workers steal from the top. Jobs submitted from threads that are not workers go through
+ * a shared MPMC dRingBuffer_t instead. Threads that wait on a counter run queued jobs
+ * rather than block, and idle workers sleep until new work arrives.
+ *
+ * @note Create with d_JobSystemInit() and free with d_JobSystemDestroy().
+ * @note Without thread support (Emscripten, Windows builds) there are no workers and every
+ *       job runs on the submitting thread.
+ */
+typedef struct dJobSystem_t
+{
+    void* workers;                  /**< Opaque per-worker deques and thread handles. */
+    size_t worker_count;            /**< Number of worker threads. */
+    dRingBuffer_t* injection;       /**< Jobs submitted from threads that are not workers. */
+    dPool_t* job_pool;              /**< Storage for job records; workers keep their own free lists on top. */
+    void* sleep;                    /**< Opaque mutex and condition variable idle workers sleep on. */
+    size_t signal;                  /**< Bumped on every submission so sleeping workers notice new work. */
+    size_t sleepers;                /**< Workers currently asleep. */
+    int shutdown;                   /**< Set once d_JobSystemDestroy() starts. */
+    const dAllocator_t* allocator;  /**< Allocator for the system, its queues and its pool. */
+} dJobSystem_t;
+
+
+// -- Priority Queue Structures ---
+
+
+/**
+ * @brief Min-priority queue over a dArray_t, ordered by a dSortCompareFunc.
+ *
+ * The element that sorts first is on top. Every pushed element gets a generational
+ * dSlotHandle_t that stays valid while the element is queued, so its key can be
+ * lowered (d_HeapDecreaseKey()) or it can be removed without searching the heap.
+ *
+ * `arity` picks the layout: 2 is a classic binary heap; 4 puts four children side by
+ * side, halving the tree depth and keeping each sift-down comparison in one or two
+ * cache lines, which pays off for large queues.
+ *
+ * @note Create with d_HeapInit() or d_HeapInitFromArray() and free with d_HeapDestroy().
+ * @warning Pointers returned by d_HeapPeek() and d_HeapGet() are invalidated by any change to the heap.
+ */
+typedef struct          // dHeap_t
+{
+  dArray_t* nodes;      /**< The elements in heap order; `nodes[0]` is the top. */
+  dArray_t* node_slot;  /**< `uint32_t` handle slot owning each node. */
+  dArray_t* slots;      /**< `{ node index or next free slot, generation }` pairs of `uint32_t`. */
+  uint32_t free_head;   /**< First free slot, or UINT32_MAX when every slot is in use. */
+  unsigned arity;       /**< Children per node: 2 or 4. */
+  dSortCompareFunc compare; /**< Ordering; the element sorting first is on top. */
+  void* user_data;      /**< Passed to `compare`. */
+  void* hole;           /**< One element of scratch for the element being sifted. */
+  const dAllocator_t* allocator; /**< Allocator for the struct and its arrays. */
+} dHeap_t;
+
+
 
 // -- String Structures ---
 
@@ -353,6 +946,7 @@ typedef struct          // dString_t
     char* str;          /**< A pointer to the dynamically allocated character buffer containing the string. */
     size_t alloced;     /**< The total number of bytes currently allocated for the string buffer, including the null terminator. */
     size_t len;         /**< The current length of the string in characters, excluding the null terminator. */
+    const dAllocator_t* allocator; /**< Allocator for the struct and `str`, fixed at initialization. */
 } dString_t;
 
 // =============================================================================
@@ -392,6 +986,8 @@ typedef struct dDUFValue_t {
     char* value_string;           /**< String value (D_DUF_STRING) or NULL */
     int64_t value_int;            /**< Integer value (D_DUF_INT) */
     double value_double;          /**< Float value (D_DUF_FLOAT) */
+    const dAllocator_t* allocator; /**< Allocator for `key` and `value_string`, and for this node unless `pool` is set. */
+    dPool_t* pool;                /**< Pool this node was taken from (see d_DUFSetNodePool()), or NULL. */
 } dDUFValue_t;
 
 /**
@@ -404,6 +1000,7 @@ typedef struct {
     int line;              /**< Line number where error occurred (1-indexed) */
     int column;            /**< Column number where error occurred (1-indexed) */
     dString_t* message;    /**< Human-readable error message */
+    const dAllocator_t* allocator; /**< Allocator this error was created with; d_DUFErrorFree() frees through it. */
 } dDUFError_t;
 
 /**
@@ -508,6 +1105,7 @@ typedef struct {
     dString_t* format_buffer;       // Thread-local format buffer
     void* mutex;                    // Optional mutex for thread safety
     bool is_global;                 // Is this the global logger
+    const dAllocator_t* allocator;  // Allocator for the logger, its mutex and buffers
 } dLogger_t;
 
 // Log context for hierarchical logging
@@ -579,69 +1177,277 @@ void d_MatrixZXf( dMat4x4_t output, const dVec3_t origin, const dVec3_t point0,
 void d_MatrixZYf( dMat4x4_t output, const dVec3_t origin, const dVec3_t point0, const dVec3_t point1 );
 
 
-// -- Linked Lists Functions --
+// =============================================================================
+// ALLOCATOR FUNCTIONS
+// =============================================================================
 
+/**
+ * @brief Get the allocator that wraps the C library's malloc, realloc and free.
+ */
+const dAllocator_t* d_GetHeapAllocator(void);
 
 /**
- * @brief Initializes a new linked list with its first node.
+ * @brief Get the allocator used by containers created without an explicit one.
  *
- * This function allocates memory for the head node of a new `dLinkedList_t` and copies
- * the provided data and name into it. This newly created node serves as the starting
- * point of the linked list.
+ * Starts out as d_GetHeapAllocator().
+ */
+const dAllocator_t* d_GetDefaultAllocator(void);
+
+/**
+ * @brief Replace the default allocator; NULL restores d_GetHeapAllocator().
  *
- * @param data A pointer to the data to be stored in the first node. The data
- * will be copied by `size` bytes.
- * @param name A C-string (char array) representing the name to be associated
- * with this initial node. This name will be copied into the node's internal buffer.
- * @param size The size in bytes of the data to be copied from `data`.
+ * Containers capture the default when they are created and keep using it, so
+ * changing it never affects containers that already exist. Setting it around a
+ * group of d_Init* calls places all of them, internal arrays included, on one
+ * allocator. `allocator` must outlive every container created with it.
  *
- * @return A pointer to the head of the new `dLinkedList_t`, or `NULL` if
- * memory allocation fails.
+ * Example:
+ * `d_SetDefaultAllocator(d_ArenaGetAllocator(level_arena)); load_level(); d_SetDefaultAllocator(NULL);`
  *
- * @note The `data` and `name` are copied into the node; the original pointers
- * do not need to remain valid after the function returns.
- * @note To add more elements, use functions like `d_PushBackToLinkedList` or `d_PushFrontToLinkedList`.
- * @note The returned list must be eventually freed using `d_ClearLinkedList` to prevent memory leaks.
+ * @note Linked list nodes, quadtrees, DUF lexer tokens and DUF errors also record the
+ *       default current when each one is created, and are freed through it later.
+ */
+void d_SetDefaultAllocator(const dAllocator_t* allocator);
+
+/**
+ * @brief Allocate `size` bytes from `allocator` (NULL means the default allocator).
+ */
+void* d_Alloc(const dAllocator_t* allocator, size_t size);
+
+/**
+ * @brief Allocate `count * size` zeroed bytes from `allocator`; NULL on overflow.
+ */
+void* d_Calloc(const dAllocator_t* allocator, size_t count, size_t size);
+
+/**
+ * @brief Resize a block obtained from the same `allocator`; NULL `ptr` allocates.
+ */
+void* d_Realloc(const dAllocator_t* allocator, void* ptr, size_t size);
+
+/**
+ * @brief Return a block to the `allocator` it came from; NULL `ptr` is ignored.
+ */
+void d_Free(const dAllocator_t* allocator, void* ptr);
+
+/**
+ * @brief Copy a NUL-terminated string into memory from `allocator`.
+ */
+char* d_StrDup(const dAllocator_t* allocator, const char* str);
+
+/**
+ * @brief Create an arena whose chunks hold `chunk_size` bytes (0 = 64 KiB).
+ *
+ * The first chunk is allocated up front from the current default allocator.
  *
  * Example:
- * `int my_int = 42;`
- * `dLinkedList_t* myList = d_InitLinkedList(&my_int, "first_item", sizeof(int));`
- * `if (myList == NULL) { d_LogError("Failed to initialize linked list!"); }`
+ * `dArena_t* frame = d_ArenaCreate(1 << 20);`
  */
-dLinkedList_t* d_InitLinkedList( void *data, char *name, size_t size );
+dArena_t* d_ArenaCreate(size_t chunk_size);
 
 /**
- * @brief Destroys a linked list and frees all its associated memory.
+ * @brief Free every chunk and the arena itself.
  *
- * This function iterates through the entire linked list, freeing the `data`
- * pointer within each node and then freeing the node itself.
- * The `head` pointer passed by the caller will be set to `NULL` to prevent
- * dangling pointers after destruction.
+ * @param arena Pointer to the arena pointer (set to NULL after destruction)
  *
- * @param head A pointer to the pointer of the head of the linked list (`dLinkedList_t**`).
- * This allows the function to set the caller's head pointer to `NULL`.
+ * @return 0 on success, 1 on failure
+ */
+int d_ArenaDestroy(dArena_t** arena);
+
+/**
+ * @brief Carve `size` bytes, aligned for any type, from the arena.
  *
- * @return 0 on success, 1 on failure (e.g., if head pointer is NULL).
+ * @return The block, or NULL if a new chunk was needed and could not be allocated
  *
- * @note After this function returns, the `dLinkedList_t*` pointer held by the caller
- * that was passed as `*head` will be `NULL`.
- * @note This function handles freeing the `data` stored inside each node,
- * assuming the data was allocated via `malloc` and is owned by the node.
- * If `data` points to external, unowned memory, it should not be freed here.
+ * @note Blocks are released only by d_ArenaReset() or d_ArenaRestore(); they must not
+ *       be passed to the arena's `allocator.realloc_func` or `allocator.free_func`.
+ */
+void* d_ArenaAlloc(dArena_t* arena, size_t size);
+
+/**
+ * @brief Get the dAllocator_t that places a container's memory in `arena`.
  *
  * Example:
- * `dLinkedList_t* myList = d_InitLinkedList(...);`
- * `// ... use myList ...`
- * `d_DestroyLinkedList(&myList);`
- * `// myList is now NULL`
+ * `dString_t* line = d_StringInitWithAllocator(d_ArenaGetAllocator(frame));`
  */
-int d_DestroyLinkedList( dLinkedList_t **head );
+const dAllocator_t* d_ArenaGetAllocator(dArena_t* arena);
 
 /**
- * @brief Retrieves a pointer to the data stored in a linked list node at a specific index.
+ * @brief Record the arena's current position.
+ */
+dArenaMarker_t d_ArenaGetMarker(const dArena_t* arena);
+
+/**
+ * @brief Release everything allocated since `marker` was taken.
  *
- * This function traverses the linked list from the head and returns a pointer
- * to the data of the node found at the specified zero-based index.
+ * @note The marker must come from this arena, after its most recent reset and any
+ *       earlier position restored since.
+ */
+void d_ArenaRestore(dArena_t* arena, dArenaMarker_t marker);
+
+/**
+ * @brief Release every allocation at once in O(1), keeping all chunks for reuse.
+ *
+ * @warning Containers placed in the arena are not destroyed; drop them before resetting.
+ */
+void d_ArenaReset(dArena_t* arena);
+
+/**
+ * @brief Return the chunks kept past the current one to the backing allocator.
+ *
+ * Call after a reset to shrink an arena whose high-water mark was a one-off.
+ */
+void d_ArenaTrim(dArena_t* arena);
+
+/**
+ * @brief Count the bytes handed out since the last reset, alignment padding included.
+ */
+size_t d_ArenaGetUsed(const dArena_t* arena);
+
+/**
+ * @brief Create a pool of `block_size`-byte blocks, `blocks_per_slab` per slab (0 = about 64 KiB).
+ *
+ * The struct, slabs and thread caches come from the current default allocator.
+ * No slab is allocated until the first block is requested.
+ *
+ * Example:
+ * `dPool_t* nodes = d_PoolCreate(sizeof(dLinkedList_t), 0);`
+ */
+dPool_t* d_PoolCreate(size_t block_size, size_t blocks_per_slab);
+
+/**
+ * @brief Create a pool like d_PoolCreate() whose struct, slabs and caches come from `allocator`.
+ */
+dPool_t* d_PoolCreateWithAllocator(size_t block_size, size_t blocks_per_slab, const dAllocator_t* allocator);
+
+/**
+ * @brief Free every slab and the pool itself; outstanding blocks become invalid.
+ *
+ * @param pool Pointer to the pool pointer (set to NULL after destruction)
+ *
+ * @return 0 on success, 1 on failure
+ */
+int d_PoolDestroy(dPool_t** pool);
+
+/**
+ * @brief Take one block from the pool, aligned for any type.
+ *
+ * @return The block (contents undefined), or NULL if a new slab could not be allocated
+ */
+void* d_PoolAlloc(dPool_t* pool);
+
+/**
+ * @brief Return a block to the pool it came from; NULL is ignored.
+ */
+void d_PoolFree(dPool_t* pool, void* block);
+
+/**
+ * @brief Take up to `count` blocks under the pool lock, bypassing the thread caches.
+ *
+ * The blocks are linked through their first word (`*(void**)block` is the next one,
+ * NULL after the last). For callers that keep their own per-thread free lists, so
+ * their threads never claim one of the pool's shared cache slots.
+ *
+ * @param head Receives the first block, or NULL if none could be taken
+ *
+ * @return Number of blocks taken; fewer than `count` only if a new slab could not be allocated
+ */
+size_t d_PoolAllocBatch(dPool_t* pool, void** head, size_t count);
+
+/**
+ * @brief Return a NULL-terminated list of blocks, linked through their first word, under the pool lock.
+ *
+ * The counterpart of d_PoolAllocBatch(); it does not touch the calling thread's cache.
+ */
+void d_PoolFreeBatch(dPool_t* pool, void* head);
+
+/**
+ * @brief Release every block at once, keeping the slabs for reuse.
+ */
+void d_PoolReset(dPool_t* pool);
+
+/**
+ * @brief Get the dAllocator_t view of `pool`, for callers that only need blocks up to `block_size`.
+ */
+const dAllocator_t* d_PoolGetAllocator(dPool_t* pool);
+
+
+// -- Linked Lists Functions --
+
+
+/**
+ * @brief Take the nodes of linked lists created from now on from `pool` (NULL = default allocator).
+ *
+ * Only the fixed-size nodes are pooled; each node's copied `data` still comes from the
+ * default allocator. A node records its pool, so it is returned there wherever it is
+ * freed; the pool must outlive every node taken from it.
+ *
+ * @param pool Pool with blocks of at least sizeof(dLinkedList_t) bytes, or NULL
+ *
+ * Example:
+ * `dPool_t* nodes = d_PoolCreate(sizeof(dLinkedList_t), 0); d_LinkedListSetNodePool(nodes);`
+ */
+void d_LinkedListSetNodePool( dPool_t* pool );
+
+/**
+ * @brief Initializes a new linked list with its first node.
+ *
+ * This function allocates memory for the head node of a new `dLinkedList_t` and copies
+ * the provided data and name into it. This newly created node serves as the starting
+ * point of the linked list.
+ *
+ * @param data A pointer to the data to be stored in the first node. The data
+ * will be copied by `size` bytes.
+ * @param name A C-string (char array) representing the name to be associated
+ * with this initial node. This name will be copied into the node's internal buffer.
+ * @param size The size in bytes of the data to be copied from `data`.
+ *
+ * @return A pointer to the head of the new `dLinkedList_t`, or `NULL` if
+ * memory allocation fails.
+ *
+ * @note The `data` and `name` are copied into the node; the original pointers
+ * do not need to remain valid after the function returns.
+ * @note To add more elements, use functions like `d_PushBackToLinkedList` or `d_PushFrontToLinkedList`.
+ * @note The returned list must be eventually freed using `d_ClearLinkedList` to prevent memory leaks.
+ *
+ * Example:
+ * `int my_int = 42;`
+ * `dLinkedList_t* myList = d_InitLinkedList(&my_int, "first_item", sizeof(int));`
+ * `if (myList == NULL) { d_LogError("Failed to initialize linked list!"); }`
+ */
+dLinkedList_t* d_InitLinkedList( void *data, char *name, size_t size );
+
+/**
+ * @brief Destroys a linked list and frees all its associated memory.
+ *
+ * This function iterates through the entire linked list, freeing the `data`
+ * pointer within each node and then freeing the node itself.
+ * The `head` pointer passed by the caller will be set to `NULL` to prevent
+ * dangling pointers after destruction.
+ *
+ * @param head A pointer to the pointer of the head of the linked list (`dLinkedList_t**`).
+ * This allows the function to set the caller's head pointer to `NULL`.
+ *
+ * @return 0 on success, 1 on failure (e.g., if head pointer is NULL).
+ *
+ * @note After this function returns, the `dLinkedList_t*` pointer held by the caller
+ * that was passed as `*head` will be `NULL`.
+ * @note This function handles freeing the `data` stored inside each node,
+ * assuming the data was allocated via `malloc` and is owned by the node.
+ * If `data` points to external, unowned memory, it should not be freed here.
+ *
+ * Example:
+ * `dLinkedList_t* myList = d_InitLinkedList(...);`
+ * `// ... use myList ...`
+ * `d_DestroyLinkedList(&myList);`
+ * `// myList is now NULL`
+ */
+int d_DestroyLinkedList( dLinkedList_t **head );
+
+/**
+ * @brief Retrieves a pointer to the data stored in a linked list node at a specific index.
+ *
+ * This function traverses the linked list from the head and returns a pointer
+ * to the data of the node found at the specified zero-based index.
  *
  * @param head A pointer to the head node of the linked list.
  * @param index The zero-based index of the node whose data is to be retrieved.
@@ -800,12 +1606,13 @@ int d_PushFrontToLinkedList( dLinkedList_t **head, void *data, char *name, size_
  * the list is empty or an error occurs.
  *
  * @note The memory for the removed node itself (and its internal `data` buffer)
- * is freed by this function. The caller is responsible for managing the returned
- * `void* data` if they need it after this function call.
+ * is freed by this function. The caller owns the returned `void* data`, which
+ * came from the default allocator current when the node was pushed; release it
+ * through that allocator (`d_Free(NULL, data)` if the default has not changed).
  *
  * Example:
  * `int* last_int_ptr = (int*)d_PopBackFromLinkedList(&myList);`
- * `if (last_int_ptr) { printf("Popped: %d\n", *last_int_ptr); free(last_int_ptr); }`
+ * `if (last_int_ptr) { printf("Popped: %d\n", *last_int_ptr); d_Free(NULL, last_int_ptr); }`
  * `else { d_LogWarning("List was empty or pop failed."); }`
  */
 void* d_PopBackFromLinkedList( dLinkedList_t **head );
@@ -825,12 +1632,13 @@ void* d_PopBackFromLinkedList( dLinkedList_t **head );
  * the list is empty or an error occurs.
  *
  * @note The memory for the removed node itself (and its internal `data` buffer)
- * is freed by this function. The caller is responsible for managing the returned
- * `void* data` if they need it after this function call.
+ * is freed by this function. The caller owns the returned `void* data`, which
+ * came from the default allocator current when the node was pushed; release it
+ * through that allocator (`d_Free(NULL, data)` if the default has not changed).
  *
  * Example:
  * `char* first_name_ptr = (char*)d_PopFrontFromLinkedList(&myList);`
- * `if (first_name_ptr) { printf("Popped: %s\n", first_name_ptr); free(first_name_ptr); }`
+ * `if (first_name_ptr) { printf("Popped: %s\n", first_name_ptr); d_Free(NULL, first_name_ptr); }`
  * `else { d_LogWarning("List was empty or pop failed."); }`
  */
 void* d_PopFrontFromLinkedList( dLinkedList_t **head );
@@ -985,6 +1793,55 @@ dTable_t* d_TableInit(size_t key_size, size_t value_size, dTableHashFunc hash_fu
                       dTableCompareFunc compare_func, size_t initial_num_buckets
                       );
 
+/**
+ * @brief Initialize a new hash table using a specific storage engine.
+ *
+ * Behaves like d_TableInit() but lets the caller pick how entries are stored.
+ * `D_TABLE_MODE_FLAT` keeps every key and value inline in a single slot array
+ * addressed by linear probing, so a lookup touches one control byte line and
+ * one slot line instead of walking heap-allocated chain nodes.
+ * `D_TABLE_MODE_COMPACT` stores entries densely in insertion order behind a
+ * small index, so iteration is deterministic and scans memory linearly.
+ *
+ * @param key_size The size in bytes of the keys that will be stored
+ * @param value_size The size in bytes of the values that will be stored
+ * @param hash_func A pointer to the user-provided hashing function
+ * @param compare_func A pointer to the user-provided key comparison function
+ * @param initial_capacity Initial bucket count (CHAINED), slot count (FLAT) or index size (COMPACT);
+ *                         FLAT and COMPACT round up to a power of two
+ * @param mode The storage engine to use
+ *
+ * @return A pointer to the newly initialized dTable_t instance, or NULL on failure
+ *
+ * @note In FLAT mode the pointer returned by d_TableGet() is only valid until the
+ *       next insertion or rehash, because growing the table moves the slot array.
+ * @note FLAT mode defaults to a load factor threshold of 0.875 (7/8).
+ * @note COMPACT mode holds up to 2/3 of its index size in entries. d_TableGet()
+ *       pointers are invalidated by growth as in FLAT mode. Updating an existing
+ *       key keeps its position; removing and re-adding moves it to the end.
+ *
+ * Example:
+ * `dTable_t* table = d_TableInitWithMode(sizeof(int), sizeof(float), d_HashInt, d_CompareInt, 64, D_TABLE_MODE_FLAT);`
+ */
+dTable_t* d_TableInitWithMode(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                              dTableCompareFunc compare_func, size_t initial_capacity,
+                              dTableMode_t mode);
+
+/**
+ * @brief Initialize a hash table whose memory comes from `allocator`.
+ *
+ * Behaves like d_TableInitWithMode(). The table struct, its slot or bucket arrays
+ * and, in CHAINED mode, every entry and chain node come from `allocator`.
+ *
+ * @param allocator Allocator to use for the table's lifetime (NULL = current default)
+ *
+ * Example:
+ * `dTable_t* t = d_TableInitWithAllocator(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 64, D_TABLE_MODE_FLAT, arena);`
+ */
+dTable_t* d_TableInitWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                   dTableCompareFunc compare_func, size_t initial_capacity,
+                                   dTableMode_t mode, const dAllocator_t* allocator);
+
 // macro wrapper for proper error handling
 #define d_TableDestroy(table) \
     _d_TableDestroy_impl(table, __FILE__, __LINE__, __func__)
@@ -1100,9 +1957,9 @@ size_t d_TableGetCount(const dTable_t* table);
  * @return 0 on success, 1 on failure
  *
  * Example:
- * `d_ClearTable(table); // Table is now empty but ready for reuse`
+ * `d_TableClear(table); // Table is now empty but ready for reuse`
  */
-int d_ClearTable(dTable_t* table);
+int d_TableClear(dTable_t* table);
 
 /**
  * @brief Rehash the table with a new number of buckets to optimize performance.
@@ -1126,6 +1983,156 @@ int d_ClearTable(dTable_t* table);
  */
 int d_TableRehash(dTable_t* table, size_t new_num_buckets);
 
+/**
+ * @brief Spread automatic growth of a chained table over subsequent operations.
+ *
+ * With a non-zero step, crossing the load factor no longer rebuilds the table inside
+ * the triggering d_TableSet. Instead a doubled bucket array is installed and each
+ * following Set and Remove migrates up to `buckets_per_step` non-empty buckets
+ * from the old array, bounding the latency of any single operation.
+ *
+ * @param table A pointer to a CHAINED-mode hash table
+ * @param buckets_per_step Old buckets migrated per operation (0 restores stop-the-world rehashing)
+ *
+ * @return 0 on success, 1 on failure (NULL table or FLAT-mode table)
+ *
+ * @note Setting the step to 0 while a migration is pending finishes it immediately.
+ * @note d_TableRehash, d_TableClear, and d_TableDestroy always complete or drop a pending migration.
+ * @note Pointers returned by d_TableGet stay valid across migration steps; entries are relinked, not copied.
+ * @note Lookups (Get, GetBatch, HasKey) search both arrays but never migrate, so they stay
+ *       legal while a cursor is open. A read-only phase can drain with d_TableRehashStep().
+ *
+ * Example:
+ * `d_TableSetIncrementalRehash(table, 4); // Migrate 4 buckets per operation`
+ */
+int d_TableSetIncrementalRehash(dTable_t* table, size_t buckets_per_step);
+
+/**
+ * @brief Serve a chained table's per-key blocks from a pool the table owns.
+ *
+ * Each key of a CHAINED table lives in one fixed-size block (chain node, entry,
+ * key and value). With pooling enabled those blocks are carved from slabs of
+ * `blocks_per_slab` (0 = about 64 KiB), removal pushes the block onto a free list
+ * for the next insert, and d_TableClear() / d_TableDestroy() release whole slabs
+ * instead of walking every chain. The slabs come from the table's allocator.
+ *
+ * @param table A CHAINED-mode hash table that is still empty
+ * @param blocks_per_slab Blocks per slab (0 = default)
+ *
+ * @return 0 on success (or if already enabled), 1 on failure
+ *
+ * Example:
+ * `d_TableEnablePool(entities, 4096);`
+ */
+int d_TableEnablePool(dTable_t* table, size_t blocks_per_slab);
+
+/**
+ * @brief Migrate part of a pending incremental rehash explicitly.
+ *
+ * Useful for draining the old bucket array during idle time (e.g. at the end of a frame)
+ * instead of on the next table operation.
+ *
+ * @param table A pointer to the hash table
+ * @param max_buckets Maximum number of non-empty old buckets to migrate (SIZE_MAX finishes it)
+ *
+ * @return 1 if old buckets remain to be migrated, 0 if no migration is pending
+ *
+ * Example:
+ * `while (d_TableRehashStep(table, 64)) { }`
+ */
+int d_TableRehashStep(dTable_t* table, size_t max_buckets);
+
+/**
+ * @brief Check whether an incremental rehash is still draining its old bucket array.
+ *
+ * @param table A pointer to the hash table
+ *
+ * @return true if a migration is in progress, false otherwise (including NULL table)
+ */
+bool d_TableIsRehashing(const dTable_t* table);
+
+/**
+ * @brief Look up many keys in one call, overlapping their memory latency.
+ *
+ * Keys are processed in small blocks: every key in a block is hashed first, the
+ * buckets (or slots) they map to are prefetched, and only then are the keys resolved.
+ * The cache misses of one key are therefore hidden behind the hashing and probing of
+ * the others, which a loop of d_TableGet calls cannot do.
+ *
+ * @param table A pointer to the hash table
+ * @param keys Contiguous array of `count` keys, each `key_size` bytes
+ * @param count Number of keys to look up
+ * @param out_values Receives `count` pointers; entry i is the value of key i, or NULL if absent
+ *
+ * @return Number of keys found
+ *
+ * @note Returned pointers follow the same lifetime rules as d_TableGet.
+ *
+ * Example:
+ * `int ids[256]; void* components[256];`
+ * `size_t hits = d_TableGetBatch(table, ids, 256, components);`
+ */
+size_t d_TableGetBatch(dTable_t* table, const void* keys, size_t count, void** out_values);
+
+/**
+ * @brief Insert or update many key-value pairs in one call.
+ *
+ * Grows the table once for the worst case (every key new) before inserting, then
+ * processes keys in hashed-and-prefetched blocks like d_TableGetBatch.
+ *
+ * @param table A pointer to the hash table
+ * @param keys Contiguous array of `count` keys, each `key_size` bytes
+ * @param values Contiguous array of `count` values, each `value_size` bytes
+ * @param count Number of pairs to store
+ *
+ * @return 0 on success, 1 if any insertion failed
+ *
+ * @note Later duplicates of a key within the batch overwrite earlier ones, as with d_TableSet.
+ */
+int d_TableSetBatch(dTable_t* table, const void* keys, const void* values, size_t count);
+
+/**
+ * @brief d_TableSet with the key's hash already computed.
+ *
+ * For callers that hash a key once and use the result more than once, such as a
+ * sharded table choosing the shard before touching it.
+ *
+ * @param table A pointer to the hash table
+ * @param key A pointer to the key data to set
+ * @param value A pointer to the value data to set
+ * @param hash Exactly `table->hash_func(key, table->key_size)`; any other value misplaces the key
+ *
+ * @return 0 on success, 1 on failure
+ */
+int d_TableSetHashed(dTable_t* table, const void* key, const void* value, size_t hash);
+
+/**
+ * @brief d_TableGet with the key's hash already computed.
+ *
+ * @param hash Exactly `table->hash_func(key, table->key_size)`
+ *
+ * @return The stored value, or NULL if not found
+ */
+void* d_TableGetHashed(dTable_t* table, const void* key, size_t hash);
+
+/**
+ * @brief d_TableRemove with the key's hash already computed.
+ *
+ * @param hash Exactly `table->hash_func(key, table->key_size)`
+ *
+ * @return 0 on success, 1 on failure/key not found
+ */
+int d_TableRemoveHashed(dTable_t* table, const void* key, size_t hash);
+
+/**
+ * @brief d_TableHasKey with the key's hash already computed.
+ *
+ * @param hash Exactly `table->hash_func(key, table->key_size)`
+ *
+ * @return 0 if the key exists, 1 if not found or error occurred
+ */
+int d_TableHasKeyHashed(const dTable_t* table, const void* key, size_t hash);
+
 /**
  * @brief Get an array containing copies of all keys currently stored in the hash table.
  *
@@ -1140,6 +2147,7 @@ int d_TableRehash(dTable_t* table, size_t new_num_buckets);
  * @note The caller is responsible for destroying the returned array with d_ArrayDestroy
  * @note The keys are copied into the array, not referenced
  * @note If the table is empty, returns an empty array (not NULL)
+ * @note D_TABLE_MODE_COMPACT tables return keys in insertion order
  *
  * Example:
  * `dArray_t* keys = d_TableGetAllKeys(table);`
@@ -1162,6 +2170,7 @@ dArray_t* d_TableGetAllKeys(const dTable_t* table);
  * @note The caller is responsible for destroying the returned array with d_ArrayDestroy
  * @note The values are copied into the array, not referenced
  * @note If the table is empty, returns an empty array (not NULL)
+ * @note D_TABLE_MODE_COMPACT tables return values in insertion order
  *
  * Example:
  * `dArray_t* values = d_TableGetAllValues(table);`
@@ -1174,7 +2183,8 @@ dArray_t* d_TableGetAllValues(const dTable_t* table);
  * @brief Iterate over all entries in a hash table
  *
  * Calls the provided callback function for each key-value pair stored in the table.
- * The iteration order is not guaranteed and depends on the internal hash distribution.
+ * The iteration order is not guaranteed and depends on the internal hash distribution,
+ * except in D_TABLE_MODE_COMPACT, which visits entries in insertion order.
  *
  * @param table The hash table to iterate over
  * @param callback Function pointer to call for each entry. Receives:
@@ -1202,6 +2212,42 @@ dArray_t* d_TableGetAllValues(const dTable_t* table);
  */
 void d_TableForEach(dTable_t* table, dTableIteratorFunc callback, void* user_data);
 
+/**
+ * @brief Create a cursor positioned before the first entry of a hash table.
+ *
+ * Unlike d_TableGetAllKeys()/d_TableGetAllValues(), cursor iteration copies nothing.
+ * The order matches d_TableForEach().
+ *
+ * @param table The hash table to walk (may be NULL, giving an empty cursor)
+ * @return The cursor, by value
+ *
+ * Example:
+ * `dTableIter_t it = d_TableIterBegin(table); const void* k; void* v;`
+ * `while (d_TableIterNext(&it, &k, &v)) { ... }`
+ */
+dTableIter_t d_TableIterBegin(const dTable_t* table);
+
+// Macro to capture file/line info for the modification check
+#define d_TableIterNext(iter, out_key, out_value) \
+    _d_TableIterNext_impl(iter, out_key, out_value, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Advance a cursor to the next entry.
+ *
+ * @param iter Cursor from d_TableIterBegin()
+ * @param out_key Receives a pointer to the entry's key (may be NULL)
+ * @param out_value Receives a pointer to the entry's value, writable in place (may be NULL)
+ *
+ * @return true if an entry was produced, false once the table is exhausted
+ *
+ * @warning Do not add or remove keys while a cursor is live. With an incremental rehash
+ * pending (CHAINED mode), Set, Remove and d_TableRehashStep() also move entries between
+ * bucket arrays. Debug builds abort on this. Lookups never move entries and are legal
+ * while a cursor is open, as is writing a value in place through `out_value`.
+ */
+bool _d_TableIterNext_impl(dTableIter_t* iter, const void** out_key, void** out_value,
+                           const char* file, int line, const char* func);
+
 /**
  * @brief Initialize a new static hash table with fixed key structure and initial data.
  *
@@ -1241,31 +2287,144 @@ dStaticTable_t* d_InitStaticTable(size_t key_size, size_t value_size, dTableHash
                                   const void** keys, const void** initial_values, size_t num_keys);
 
 /**
- * @brief Destroy a static hash table and free all associated memory.
- *
- * Deallocates all memory associated with a dStaticTable_t instance, including
- * all entries, buckets, and the structure itself.
+ * @brief Initialize a static hash table whose memory comes from `allocator`.
  *
- * @param table A pointer to the pointer of the static hash table to destroy
+ * Behaves like d_InitStaticTable(). The table struct, its bucket array and every
+ * entry and chain node come from `allocator`.
  *
- * @return 0 on success, 1 on failure
+ * @param allocator Allocator to use for the table's lifetime (NULL = current default)
  *
  * Example:
- * `d_StaticTableDestroy(&my_table); // my_table will be NULL after this`
+ * `dStaticTable_t* t = d_InitStaticTableWithAllocator(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,`
+ * `                                                   64, key_ptrs, value_ptrs, count, arena);`
  */
-int d_StaticTableDestroy(dStaticTable_t** table);
+dStaticTable_t* d_InitStaticTableWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                               dTableCompareFunc compare_func, size_t num_buckets,
+                                               const void** keys, const void** initial_values, size_t num_keys,
+                                               const dAllocator_t* allocator);
 
 /**
- * @brief Update the value associated with a key in the static table.
+ * @brief Initialize a static hash table like d_InitStaticTable(), building it on several threads.
  *
- * Updates the value for an existing key in the static table. Since the key set
- * is immutable, this function only allows value updates, not key insertion.
+ * Keys are hashed in parallel, grouped by bucket with one counting sort, and the buckets
+ * are then split into ranges of roughly equal key counts. Each thread checks for
+ * duplicates and builds the chains of its own range without locking. The result is
+ * identical to d_InitStaticTable() with the same arguments, chain order included.
  *
- * @param table A pointer to the static hash table
- * @param key A pointer to the key data to update
- * @param new_value A pointer to the new value data
+ * @param key_size The size in bytes of the keys that will be stored
+ * @param value_size The size in bytes of the values that will be stored
+ * @param hash_func A pointer to the user-provided hashing function (called from several threads)
+ * @param compare_func A pointer to the user-provided key comparison function (called from several threads)
+ * @param num_buckets The number of buckets for the table
+ * @param keys Array of key data to initialize with (must contain exactly num_keys elements)
+ * @param initial_values Array of initial value data (must contain exactly num_keys elements, parallel to keys)
+ * @param num_keys Number of elements in both keys and initial_values arrays
+ * @param num_threads Threads to use, or 0 for one per online CPU
  *
- * @return 0 on success, 1 on failure/key not found
+ * @return A pointer to the newly initialized dStaticTable_t instance, or NULL on failure
+ *
+ * @note Each thread is given at least a few thousand keys; smaller key sets, a thread
+ *       count of 1, and platforms without pthreads fall back to d_InitStaticTable().
+ * @note hash_func and compare_func must be safe to call concurrently.
+ * @note Every allocation happens on the calling thread: scratch space, and one block per
+ *       thread that holds the nodes, entries, keys and values of its bucket range. Any
+ *       allocator, including a non-thread-safe one such as an arena, can be used.
+ *
+ * Example:
+ * `dStaticTable_t* items = d_InitStaticTableParallel(sizeof(int), sizeof(item_t), d_HashInt, d_CompareInt,`
+ * `                                                  1 << 20, key_ptrs, value_ptrs, count, 0);`
+ */
+dStaticTable_t* d_InitStaticTableParallel(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                          dTableCompareFunc compare_func, size_t num_buckets,
+                                          const void** keys, const void** initial_values, size_t num_keys,
+                                          size_t num_threads);
+
+/**
+ * @brief Initialize a static hash table like d_InitStaticTableParallel(), with memory from `allocator`.
+ *
+ * Scratch space and the table come from `allocator`, which is only ever called from
+ * the calling thread (see d_InitStaticTableParallel()).
+ *
+ * @param allocator Allocator to use for the table's lifetime (NULL = current default)
+ */
+dStaticTable_t* d_InitStaticTableParallelWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                                       dTableCompareFunc compare_func, size_t num_buckets,
+                                                       const void** keys, const void** initial_values,
+                                                       size_t num_keys, size_t num_threads,
+                                                       const dAllocator_t* allocator);
+
+/**
+ * @brief Initialize a static hash table that resolves every key with a single probe.
+ *
+ * Builds a minimal perfect hash (PTHash-style hash-and-displace) over the fixed key set:
+ * keys are grouped into pilot buckets, and each bucket, largest first, searches for the
+ * smallest pilot that sends all its keys to free slots. The result is a flat slot array
+ * with exactly one slot per key, so d_StaticTableGet(), d_StaticTableSet() and
+ * d_StaticTableHasKey() do one hash, one slot access and at most one key compare.
+ *
+ * @param key_size The size in bytes of the keys that will be stored
+ * @param value_size The size in bytes of the values that will be stored
+ * @param hash_func A pointer to the user-provided hashing function
+ * @param compare_func A pointer to the user-provided key comparison function
+ * @param keys Array of key data to initialize with (must contain exactly num_keys elements)
+ * @param initial_values Array of initial value data (must contain exactly num_keys elements, parallel to keys)
+ * @param num_keys Number of elements in both keys and initial_values arrays
+ *
+ * @return A pointer to the newly initialized dStaticTable_t instance, or NULL on failure
+ *
+ * @note Building costs several hash evaluations per key; use it for tables that are
+ *       built once and queried often.
+ * @note Fails if two keys are equal, or if two different keys produce the same value
+ *       from `hash_func` (no perfect hash can separate them); use d_InitStaticTable()
+ *       for such key sets.
+ *
+ * Example:
+ * `dStaticTable_t* table = d_InitStaticTablePerfect(sizeof(int), sizeof(float), d_HashInt, d_CompareInt,`
+ * `                                                 (const void**)key_ptrs, (const void**)value_ptrs, count);`
+ */
+dStaticTable_t* d_InitStaticTablePerfect(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                         dTableCompareFunc compare_func,
+                                         const void** keys, const void** initial_values, size_t num_keys);
+
+/**
+ * @brief Initialize a perfect static hash table whose memory comes from `allocator`.
+ *
+ * Behaves like d_InitStaticTablePerfect(). The table struct, its pilot and slot arrays
+ * and the build's scratch space come from `allocator`.
+ *
+ * @param allocator Allocator to use for the table's lifetime (NULL = current default)
+ */
+dStaticTable_t* d_InitStaticTablePerfectWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                                      dTableCompareFunc compare_func,
+                                                      const void** keys, const void** initial_values, size_t num_keys,
+                                                      const dAllocator_t* allocator);
+
+/**
+ * @brief Destroy a static hash table and free all associated memory.
+ *
+ * Deallocates all memory associated with a dStaticTable_t instance, including
+ * all entries, buckets, and the structure itself.
+ *
+ * @param table A pointer to the pointer of the static hash table to destroy
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * Example:
+ * `d_StaticTableDestroy(&my_table); // my_table will be NULL after this`
+ */
+int d_StaticTableDestroy(dStaticTable_t** table);
+
+/**
+ * @brief Update the value associated with a key in the static table.
+ *
+ * Updates the value for an existing key in the static table. Since the key set
+ * is immutable, this function only allows value updates, not key insertion.
+ *
+ * @param table A pointer to the static hash table
+ * @param key A pointer to the key data to update
+ * @param new_value A pointer to the new value data
+ *
+ * @return 0 on success, 1 on failure/key not found
  *
  * Example:
  * `int key = 42; char* new_value = "updated"; d_StaticTableSet(table, &key, &new_value);`
@@ -1288,6 +2447,46 @@ int d_StaticTableSet(dStaticTable_t* table, const void* key, const void* new_val
  */
 void* d_StaticTableGet(const dStaticTable_t* table, const void* key);
 
+/**
+ * @brief Let readers and writers share the table without a lock.
+ *
+ * Gives every value a sequence counter (seqlock): one per slot in PERFECT mode and one
+ * per bucket in CHAINED mode. From then on d_StaticTableSet() marks the counter odd,
+ * updates the value in place and marks it even again, and d_StaticTableGetConcurrent()
+ * copies the value out between two counter reads, retrying if a write overlapped.
+ * Readers never block or write shared memory.
+ *
+ * @param table A pointer to the static hash table
+ *
+ * @return 0 on success (or if already enabled), 1 on failure
+ *
+ * @note Call before the table is shared between threads. Clear turns it off again.
+ * @note d_StaticTableGet() still returns a raw pointer with no protection; concurrent
+ *       readers must use d_StaticTableGetConcurrent().
+ * @note Clones and rebucketed copies start with concurrent mode off.
+ *
+ * Example:
+ * `d_StaticTableEnableConcurrent(tuning); // game thread: d_StaticTableSet, render thread: d_StaticTableGetConcurrent`
+ */
+int d_StaticTableEnableConcurrent(dStaticTable_t* table);
+
+/**
+ * @brief Copy the value for a key out of the table, consistent even while writers update it.
+ *
+ * Lock-free when concurrent mode is enabled (see d_StaticTableEnableConcurrent()):
+ * the copy is retried until no write overlapped it. Without concurrent mode it is a plain copy.
+ *
+ * @param table A pointer to the static hash table
+ * @param key A pointer to the key data to search for
+ * @param out_value Buffer of at least `value_size` bytes that receives the value
+ *
+ * @return 0 if the key was found and copied, 1 if not found or error occurred
+ *
+ * Example:
+ * `float gravity; if (d_StaticTableGetConcurrent(tuning, &key, &gravity) == 0) { ... }`
+ */
+int d_StaticTableGetConcurrent(const dStaticTable_t* table, const void* key, void* out_value);
+
 /**
  * @brief Check if a specific key exists in the static hash table.
  *
@@ -1358,6 +2557,7 @@ dArray_t* d_StaticTableGetAllValues(const dStaticTable_t* table);
  *
  * @note After this operation, the table will be in an uninitialized state
  * @note The bucket structure is preserved, only the entries are removed
+ * @note In PERFECT mode the slots and pilots are freed, since they only fit the old key set
  * @note To reuse the table, you must reinitialize it with keys
  *
  * Example:
@@ -1383,6 +2583,8 @@ int d_StaticTableClear(dStaticTable_t* table);
  * @note All output parameters are optional (can be NULL)
  * @note Average is calculated as a floating-point value
  * @note Useful for performance analysis and optimization
+ * @note In PERFECT mode every slot holds exactly one key, so min, max and avg are 1
+ *       and there are no empty slots
  *
  * Example:
  * `size_t min, max, empty; float avg;`
@@ -1407,6 +2609,7 @@ int d_StaticTableGetStats(const dStaticTable_t* table, size_t* min_entries,
  * @note All keys and values are copied to the new table
  * @note The caller is responsible for destroying both tables
  * @note Useful for performance optimization without modifying original table
+ * @note The new table is always in CHAINED mode, even when the source is PERFECT
  *
  * Example:
  * `dStaticTable_t* optimized = d_RebucketStaticTable(original, 64);`
@@ -1426,9 +2629,38 @@ dStaticTable_t* d_RebucketStaticTable(const dStaticTable_t* source_table, size_t
  * @return 0 on success, 1 on failure
  *
  * @note The hash and compare functions cannot be saved and must be provided when loading
+ * @note PERFECT tables are written in the page-aligned version 2 format, which
+ *       d_MapStaticTableFromFile() can use in place; CHAINED tables in version 3
+ * @note Written through a dFileWriter_t, so the file ends with a checksum and replaces
+ *       `filename` only once it is complete
  */
 int d_StaticTableSaveToFile(const char* filename, const dStaticTable_t* table);
 
+/**
+ * @brief Save a static hash table to a file on a background thread.
+ *
+ * Copies the table's contents on the calling thread and hands the copy to
+ * d_AsyncSaveStart(), which writes the same file d_StaticTableSaveToFile() would.
+ * For a PERFECT table the copy is three memcpys of its flat arrays. A CHAINED table
+ * keeps its entries in separate allocations, so its pairs are gathered into one
+ * block instead. The table may be modified or destroyed as soon as this returns.
+ *
+ * @param filename Path to the output file
+ * @param table Pointer to the static table to save
+ * @param callback Optional completion callback, run on the background thread
+ * @param user_data Passed to `callback`
+ *
+ * @return Save handle to poll, wait on and destroy, or NULL on failure
+ *
+ * @note With d_StaticTableEnableConcurrent(), call this from the thread that calls
+ *       d_StaticTableSet(); the copy does not take the seqlocks.
+ *
+ * Example:
+ * `dAsyncSave_t* save = d_StaticTableSaveToFileAsync("items.dst", items, NULL, NULL);`
+ */
+dAsyncSave_t* d_StaticTableSaveToFileAsync(const char* filename, const dStaticTable_t* table,
+                                           dAsyncSaveCallback callback, void* user_data);
+
 /**
  * @brief Load a static hash table from a binary file.
  *
@@ -1441,9 +2673,40 @@ int d_StaticTableSaveToFile(const char* filename, const dStaticTable_t* table);
  * @return Pointer to the loaded static table, or NULL on failure
  *
  * @note The caller is responsible for destroying the returned table
+ * @note Version 2 files load as a writable PERFECT table, one read per section
+ * @note Versions 2 and 3 are rejected if their checksum trailer does not match;
+ *       version 1 files (no checksum) are still accepted
  */
 dStaticTable_t* d_LoadStaticTableFromFile(const char* filename, dTableHashFunc hash_func, dTableCompareFunc compare_func);
 
+/**
+ * @brief Map a version 2 static table file and use it in place as a read-only table.
+ *
+ * Version 2 files are written by d_StaticTableSaveToFile() for PERFECT tables and hold
+ * the pilots, hashes and slots exactly as they sit in memory, each on its own page.
+ * The returned table points straight into a shared read-only mapping, so loading does
+ * no per-entry work, pages are faulted in on first use, and processes mapping the same
+ * file share its physical pages.
+ *
+ * @param filename Path to a version 2 static table file
+ * @param hash_func Hash function to use (must match the original table)
+ * @param compare_func Compare function to use (must match the original table)
+ *
+ * @return Pointer to the mapped static table, or NULL on failure
+ *
+ * @note d_StaticTableSet() fails on a mapped table, and values obtained from it must
+ *       not be written through. d_CloneStaticTable() makes a writable copy.
+ * @note The file must come from a build with the same word size and byte order.
+ * @note On platforms without mmap the file is read into one heap block instead.
+ * @note The checksum trailer is not verified here, since that would touch every page;
+ *       use d_LoadStaticTableFromFile() when the file may be damaged.
+ * @note The caller is responsible for destroying the returned table, which unmaps the file
+ *
+ * Example:
+ * `dStaticTable_t* items = d_MapStaticTableFromFile("items.dst", d_HashInt, d_CompareInt);`
+ */
+dStaticTable_t* d_MapStaticTableFromFile(const char* filename, dTableHashFunc hash_func, dTableCompareFunc compare_func);
+
 /**
  * @brief Iterate over all key-value pairs in a static hash table.
  *
@@ -1457,6 +2720,29 @@ dStaticTable_t* d_LoadStaticTableFromFile(const char* filename, dTableHashFunc h
  */
 int d_StaticTableIterate(const dStaticTable_t* table, dTableIteratorFunc callback, void* user_data);
 
+/**
+ * @brief Create a cursor positioned before the first entry of a static hash table.
+ *
+ * @param table The static table to walk (NULL or uninitialized gives an empty cursor)
+ * @return The cursor, by value
+ */
+dTableIter_t d_StaticTableIterBegin(const dStaticTable_t* table);
+
+// Macro to capture file/line info for the modification check
+#define d_StaticTableIterNext(iter, out_key, out_value) \
+    _d_StaticTableIterNext_impl(iter, out_key, out_value, __FILE__, __LINE__, __func__)
+
+/**
+ * @brief Advance a static table cursor to the next entry.
+ *
+ * Same contract as d_TableIterNext(). d_StaticTableSet() may be called while
+ * iterating; d_StaticTableClear() may not.
+ *
+ * @return true if an entry was produced, false once the table is exhausted
+ */
+bool _d_StaticTableIterNext_impl(dTableIter_t* iter, const void** out_key, void** out_value,
+                                 const char* file, int line, const char* func);
+
 /**
  * @brief Create a complete deep copy of a static hash table.
  *
@@ -1471,1501 +2757,2911 @@ int d_StaticTableIterate(const dStaticTable_t* table, dTableIteratorFunc callbac
 dStaticTable_t* d_CloneStaticTable(const dStaticTable_t* source_table);
 
 // =============================================================================
-// BUILT-IN HASH FUNCTIONS
+// CONCURRENT HASH TABLE FUNCTIONS
 // =============================================================================
 
 /**
- * @brief Hash function for 32-bit integers using Knuth's multiplicative method.
+ * @brief Create a sharded, thread-safe hash table.
  *
- * Uses Knuth's magic constant for excellent distribution with integer keys.
- * Suitable for most general-purpose integer hashing needs.
+ * @param key_size The size in bytes of each key
+ * @param value_size The size in bytes of each value
+ * @param hash_func Hash function for keys (same contract as dTable_t)
+ * @param compare_func Compare function for keys (same contract as dTable_t)
+ * @param num_shards Number of shards (rounded up to a power of two; 0 selects 16)
+ * @param initial_capacity_per_shard Initial slot count of each shard
  *
- * @param key Pointer to integer key
- * @param key_size Size of the key (should be sizeof(int))
- * @return Hash value
+ * @return Pointer to the new concurrent table, or NULL on failure
+ *
+ * @note Use a few shards per worker thread; more shards mean less contention on writes.
+ * @note Shards allocate from the default allocator captured here, concurrently from
+ *       every writing thread, so that allocator must be thread-safe; see
+ *       d_ConcurrentTableInitWithAllocator() to choose another.
  *
  * Example:
- * ```c
- * dTable_t* table = d_TableInit(sizeof(int), sizeof(char*), 
- *                               d_HashInt, d_CompareInt, 16, 0.75f);
- * ```
+ * `dConcurrentTable_t* t = d_ConcurrentTableInit(sizeof(int), sizeof(float), d_HashInt, d_CompareInt, 64, 16);`
  */
-size_t d_HashInt(const void* key, size_t key_size);
+dConcurrentTable_t* d_ConcurrentTableInit(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                          dTableCompareFunc compare_func, size_t num_shards,
+                                          size_t initial_capacity_per_shard);
 
 /**
- * @brief Hash function for null-terminated strings using FNV-1a algorithm.
- *
- * FNV-1a provides excellent distribution for string data with good performance.
- * Works with any null-terminated string regardless of the key_size parameter.
+ * @brief Create a concurrent table whose memory comes from `allocator`.
  *
- * @param key Pointer to null-terminated string
- * @param key_size Size parameter (can be 0 for null-terminated strings)
- * @return Hash value
+ * Behaves like d_ConcurrentTableInit(). `allocator` is called from every writing
+ * thread, so it must be thread-safe (an arena is not).
  *
- * Example:
- * ```c
- * dTable_t* table = d_TableInit(sizeof(char*), sizeof(int), 
- *                               d_HashString, d_CompareString, 16, 0.75f);
- * ```
+ * @param allocator Allocator to use for the table's lifetime (NULL = current default)
  */
-size_t d_HashString(const void* key, size_t key_size);
+dConcurrentTable_t* d_ConcurrentTableInitWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                                       dTableCompareFunc compare_func, size_t num_shards,
+                                                       size_t initial_capacity_per_shard,
+                                                       const dAllocator_t* allocator);
 
 /**
- * @brief Hash function for string literals (const char*).
+ * @brief Destroy a concurrent table and free all associated memory.
  *
- * Similar to d_HashString but expects the key to be a char* directly,
- * not a pointer to a char*. Useful for string literal keys.
+ * @param table Pointer to the concurrent table pointer (set to NULL after destruction)
  *
- * @param key Pointer to string (char*)
- * @param key_size Length of the string (can be 0 for null-terminated)
- * @return Hash value
+ * @return 0 on success, 1 on failure
+ *
+ * @warning No other thread may be using the table while it is destroyed.
  */
-size_t d_HashStringLiteral(const void* key, size_t key_size);
+int d_ConcurrentTableDestroy(dConcurrentTable_t** table);
 
 /**
- * @brief Hash function for floating-point numbers.
- *
- * Converts float to integer representation for hashing.
- * Note: Be careful with floating-point precision when using as keys.
- *
- * @param key Pointer to float value
- * @param key_size Size of the key (should be sizeof(float))
- * @return Hash value
+ * @brief Insert or update a key-value pair, locking only the owning shard for writing.
  *
- * Example:
- * ```c
- * dTable_t* table = d_TableInit(sizeof(float), sizeof(int), 
- *                               d_HashFloat, d_CompareFloat, 16, 0.75f);
- * ```
+ * @return 0 on success, 1 on failure
  */
-size_t d_HashFloat(const void* key, size_t key_size);
+int d_ConcurrentTableSet(dConcurrentTable_t* table, const void* key, const void* value);
 
 /**
- * @brief Hash function for double-precision floating-point numbers.
+ * @brief Copy the value stored for a key into `out_value`.
  *
- * Converts double to integer representation for hashing.
- * Note: Be careful with floating-point precision when using as keys.
+ * Takes the owning shard's lock in shared mode, so concurrent readers do not block each other.
  *
- * @param key Pointer to double value
- * @param key_size Size of the key (should be sizeof(double))
- * @return Hash value
+ * @param table Pointer to the concurrent table
+ * @param key Pointer to the key to look up
+ * @param out_value Buffer of at least `value_size` bytes receiving the value
+ *
+ * @return 0 if the key was found and copied, 1 if not found or on error
  */
-size_t d_HashDouble(const void* key, size_t key_size);
+int d_ConcurrentTableGet(dConcurrentTable_t* table, const void* key, void* out_value);
 
 /**
- * @brief General-purpose hash function for binary data using FNV-1a.
+ * @brief Remove a key-value pair, locking only the owning shard for writing.
  *
- * Can hash any binary data of specified length. Useful for structs,
- * arrays, or any fixed-size binary data.
+ * @return 0 on success, 1 if the key was not found or on error
+ */
+int d_ConcurrentTableRemove(dConcurrentTable_t* table, const void* key);
+
+/**
+ * @brief Check whether a key exists.
  *
- * @param key Pointer to binary data
- * @param key_size Size of the data in bytes
- * @return Hash value
+ * @return 0 if the key exists, 1 if it doesn't exist or on error (matches d_TableHasKey)
+ */
+int d_ConcurrentTableHasKey(dConcurrentTable_t* table, const void* key);
+
+/**
+ * @brief Get the number of entries across all shards.
  *
- * Example:
- * ```c
- * typedef struct { int x, y; } Point;
- * dTable_t* table = d_TableInit(sizeof(Point), sizeof(int), 
- *                               d_HashBinary, d_CompareBinary, 16, 0.75f);
- * ```
+ * @note Shards are counted one after another; under concurrent writes the result is
+ * approximate rather than a point-in-time snapshot.
  */
-size_t d_HashBinary(const void* key, size_t key_size);
+size_t d_ConcurrentTableGetCount(dConcurrentTable_t* table);
 
 /**
- * @brief Hash function for pointers (memory addresses).
+ * @brief Remove all entries from every shard.
  *
- * Hashes the pointer value itself, not the data it points to.
- * Useful when you want to use memory addresses as keys.
+ * @return 0 on success, 1 on failure
+ */
+int d_ConcurrentTableClear(dConcurrentTable_t* table);
+
+/**
+ * @brief Call `callback` for every entry, holding each shard's read lock in turn.
  *
- * @param key Pointer to pointer value
- * @param key_size Size of pointer (should be sizeof(void*))
- * @return Hash value
+ * @warning The callback must not call back into the same concurrent table's write functions.
  */
-size_t d_HashPointer(const void* key, size_t key_size);
+void d_ConcurrentTableForEach(dConcurrentTable_t* table, dTableIteratorFunc callback, void* user_data);
 
 // =============================================================================
-// BUILT-IN COMPARISON FUNCTIONS
+// LRU CACHE FUNCTIONS
 // =============================================================================
 
 /**
- * @brief Comparison function for 32-bit integers.
+ * @brief Create a bounded LRU cache.
  *
- * @param key1 Pointer to first integer
- * @param key2 Pointer to second integer
- * @param key_size Size of keys (should be sizeof(int))
- * @return 0 if equal, non-zero if different
+ * @param key_size The size in bytes of each key
+ * @param value_size The size in bytes of each value
+ * @param hash_func Hash function for keys (same contract as dTable_t)
+ * @param compare_func Compare function for keys (same contract as dTable_t)
+ * @param max_entries Maximum number of entries (0 = unlimited)
+ * @param max_bytes Maximum total cost in bytes (0 = unlimited); see d_LRUCachePutWithCost()
+ *
+ * @return Pointer to the new cache, or NULL on failure (including both limits 0)
+ *
+ * @note With `max_entries` set, every node is allocated up front and the cache never
+ *       allocates again.
+ *
+ * Example:
+ * `dLRUCache_t* sprites = d_LRUCacheInit(sizeof(int), sizeof(Sprite_t*), d_HashInt, d_CompareInt, 256, 0);`
  */
-int d_CompareInt(const void* key1, const void* key2, size_t key_size);
+dLRUCache_t* d_LRUCacheInit(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                            dTableCompareFunc compare_func, size_t max_entries, size_t max_bytes);
 
 /**
- * @brief Comparison function for null-terminated strings.
+ * @brief Create a bounded LRU cache whose memory comes from `allocator`.
  *
- * Compares strings pointed to by char** keys using strcmp.
+ * Behaves like d_LRUCacheInit(). The cache struct, its node storage and its index
+ * table come from `allocator`.
  *
- * @param key1 Pointer to first string pointer (char**)
- * @param key2 Pointer to second string pointer (char**)
- * @param key_size Size parameter (unused for null-terminated strings)
- * @return 0 if equal, non-zero if different
+ * @param allocator Allocator to use for the cache's lifetime (NULL = current default)
+ *
+ * Example:
+ * `dLRUCache_t* c = d_LRUCacheInitWithAllocator(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 64, 0, arena);`
  */
-int d_CompareString(const void* key1, const void* key2, size_t key_size);
+dLRUCache_t* d_LRUCacheInitWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                         dTableCompareFunc compare_func, size_t max_entries, size_t max_bytes,
+                                         const dAllocator_t* allocator);
 
 /**
- * @brief Comparison function for string literals (const char*).
+ * @brief Destroy a cache, passing every remaining entry to the evict callback first.
  *
- * Compares strings directly, expecting keys to be char* not char**.
+ * @param cache Pointer to the cache pointer (set to NULL after destruction)
  *
- * @param key1 Pointer to first string (char*)
- * @param key2 Pointer to second string (char*)
- * @param key_size Length to compare (0 for full null-terminated comparison)
- * @return 0 if equal, non-zero if different
+ * @return 0 on success, 1 on failure
  */
-int d_CompareStringLiteral(const void* key1, const void* key2, size_t key_size);
+int d_LRUCacheDestroy(dLRUCache_t** cache);
 
 /**
- * @brief Comparison function for floating-point numbers.
- *
- * Compares floats with exact equality. Be aware that floating-point
- * precision issues may cause problems with hash table lookups.
+ * @brief Install the callback run for every value leaving the cache.
  *
- * @param key1 Pointer to first float
- * @param key2 Pointer to second float
- * @param key_size Size of keys (should be sizeof(float))
- * @return 0 if equal, non-zero if different
+ * @param cache Pointer to the cache
+ * @param on_evict Callback, or NULL to disable
+ * @param user_data Context pointer passed to the callback
  */
-int d_CompareFloat(const void* key1, const void* key2, size_t key_size);
+void d_LRUCacheSetEvictCallback(dLRUCache_t* cache, dLRUEvictFunc on_evict, void* user_data);
 
 /**
- * @brief Comparison function for double-precision floating-point numbers.
+ * @brief Look up a key and mark it most recently used.
  *
- * Compares doubles with exact equality. Be aware that floating-point
- * precision issues may cause problems with hash table lookups.
+ * Counts a hit or a miss.
  *
- * @param key1 Pointer to first double
- * @param key2 Pointer to second double
- * @param key_size Size of keys (should be sizeof(double))
- * @return 0 if equal, non-zero if different
+ * @return Pointer to the cached value, or NULL if the key is not cached
+ *
+ * @note The pointer is valid until the entry leaves the cache or, in caches without
+ *       `max_entries`, until the next put grows the node array.
  */
-int d_CompareDouble(const void* key1, const void* key2, size_t key_size);
+void* d_LRUCacheGet(dLRUCache_t* cache, const void* key);
 
 /**
- * @brief Comparison function for binary data using memcmp.
+ * @brief Look up a key without touching recency or the hit/miss counters.
  *
- * Performs byte-by-byte comparison of binary data.
+ * @return Pointer to the cached value, or NULL if the key is not cached
+ */
+void* d_LRUCachePeek(const dLRUCache_t* cache, const void* key);
+
+/**
+ * @brief Insert or replace an entry, costing `key_size + value_size` bytes.
  *
- * @param key1 Pointer to first data block
- * @param key2 Pointer to second data block
- * @param key_size Size of data blocks in bytes
- * @return 0 if equal, non-zero if different
+ * @return 0 on success, 1 on failure
  */
-int d_CompareBinary(const void* key1, const void* key2, size_t key_size);
+int d_LRUCachePut(dLRUCache_t* cache, const void* key, const void* value);
 
 /**
- * @brief Comparison function for pointers (memory addresses).
+ * @brief Insert or replace an entry with an explicit cost toward `max_bytes`.
  *
- * Compares pointer values, not the data they point to.
+ * Use the real footprint when values refer to larger data, e.g. the pixel size of a
+ * decoded sprite. The entry becomes most recently used; least recently used entries
+ * are then evicted until both limits hold again.
  *
- * @param key1 Pointer to first pointer value
- * @param key2 Pointer to second pointer value
- * @param key_size Size of pointer (should be sizeof(void*))
- * @return 0 if equal, non-zero if different
+ * @return 0 on success, 1 on failure (including a cost larger than `max_bytes`)
  */
-int d_ComparePointer(const void* key1, const void* key2, size_t key_size);
+int d_LRUCachePutWithCost(dLRUCache_t* cache, const void* key, const void* value, size_t cost);
+
+/**
+ * @brief Remove an entry (the evict callback still runs; the eviction counter does not move).
+ *
+ * @return 0 if the key was removed, 1 if it was not cached or on error
+ */
+int d_LRUCacheRemove(dLRUCache_t* cache, const void* key);
+
+/**
+ * @brief Remove every entry, keeping the allocated nodes for reuse.
+ *
+ * @return 0 on success, 1 on failure
+ */
+int d_LRUCacheClear(dLRUCache_t* cache);
+
+/**
+ * @brief Get the number of cached entries.
+ */
+size_t d_LRUCacheGetCount(const dLRUCache_t* cache);
+
+/**
+ * @brief Read the hit, miss and eviction counters. Any output pointer may be NULL.
+ */
+void d_LRUCacheGetStats(const dLRUCache_t* cache, size_t* hits, size_t* misses, size_t* evictions);
 
 // =============================================================================
-// SPECIALIZED HASH FUNCTIONS FOR COMMON PATTERNS
+// FILE WRITER FUNCTIONS
 // =============================================================================
 
 /**
- * @brief Hash function optimized for small positive integers (0-999).
+ * @brief Reset a checksum to its starting state, ready for d_ChecksumUpdate().
+ */
+void d_ChecksumReset(dChecksum_t* checksum);
+
+/**
+ * @brief Feed `size` bytes into a running checksum.
+ */
+void d_ChecksumUpdate(dChecksum_t* checksum, const void* data, size_t size);
+
+/**
+ * @brief Get the checksum of every byte fed in so far (the running state is not changed).
+ */
+uint64_t d_ChecksumFinal(const dChecksum_t* checksum);
+
+/**
+ * @brief Open a buffered writer that will atomically replace `filename` on commit.
  *
- * Uses simple multiplication with good distribution for small integer ranges.
- * More efficient than general-purpose hashing for known small ranges.
+ * @param filename Final path of the file
+ * @param buffer_size Staging buffer size in bytes, or 0 for the default (1 MiB)
  *
- * @param key Pointer to integer key
- * @param key_size Size of the key (should be sizeof(int))
- * @return Hash value
+ * @return A new writer, or NULL if the temporary file cannot be created
+ *
+ * @note Allocates with d_GetHeapAllocator(), so it is safe to use from a save worker thread.
+ *
+ * Example:
+ * `dFileWriter_t* writer = d_FileWriterOpen("world.bin", 0);`
  */
-size_t d_HashSmallInt(const void* key, size_t key_size);
+dFileWriter_t* d_FileWriterOpen(const char* filename, size_t buffer_size);
 
 /**
- * @brief Hash function for case-insensitive strings.
+ * @brief Append `size` bytes to the file.
  *
- * Converts characters to lowercase before hashing for case-insensitive keys.
+ * @return 0 on success, 1 on failure (the writer is then failed and can only be aborted)
+ */
+int d_FileWriterWrite(dFileWriter_t* writer, const void* data, size_t size);
+
+/**
+ * @brief Append `size` zero bytes, e.g. to pad the next section to an alignment.
  *
- * @param key Pointer to string pointer (char**)
- * @param key_size Size parameter (unused for null-terminated strings)
- * @return Hash value
+ * @return 0 on success, 1 on failure
  */
-size_t d_HashStringCaseInsensitive(const void* key, size_t key_size);
+int d_FileWriterWriteZeros(dFileWriter_t* writer, size_t size);
 
 /**
- * @brief Comparison function for case-insensitive strings.
+ * @brief Get the number of bytes written so far, which is the offset of the next write.
+ */
+uint64_t d_FileWriterTell(const dFileWriter_t* writer);
+
+/**
+ * @brief Append the checksum trailer, sync the file and rename it over the target.
  *
- * Performs case-insensitive string comparison.
+ * The writer is freed and `*writer` set to NULL whether or not the commit succeeds.
+ * On failure the temporary file is removed and the previous target file, if any,
+ * is left untouched.
  *
- * @param key1 Pointer to first string pointer (char**)
- * @param key2 Pointer to second string pointer (char**)
- * @param key_size Size parameter (unused for null-terminated strings)
- * @return 0 if equal, non-zero if different
+ * @return 0 on success, 1 on failure
  */
-int d_CompareStringCaseInsensitive(const void* key1, const void* key2, size_t key_size);
+int d_FileWriterCommit(dFileWriter_t** writer);
 
 /**
- * @brief Comparison function for dStaticArray_t objects.
+ * @brief Discard everything written, remove the temporary file and free the writer.
+ */
+void d_FileWriterAbort(dFileWriter_t** writer);
+
+/**
+ * @brief Run `write_func(filename, snapshot)` on a background thread.
  *
- * Compares two static arrays element by element using binary comparison.
- * Arrays must have the same element_size to be comparable.
+ * Takes ownership of `snapshot`, which is freed with `free_func` once written, even
+ * if the save fails or cannot start. When the save ends `callback`, if not NULL,
+ * runs on the worker thread. Only after it returns does d_AsyncSavePoll() report
+ * the result. The handle, and any file writer the worker opens, are allocated with
+ * d_GetHeapAllocator(), never the default allocator; snapshots should be too.
  *
- * @param array1 Pointer to first dStaticArray_t* (pointer to dStaticArray_t pointer)
- * @param array2 Pointer to second dStaticArray_t* (pointer to dStaticArray_t pointer)
- * @param unused Size parameter (unused for arrays)
- * @return 0 if equal, non-zero if different
+ * @param filename Target file path (copied)
+ * @param snapshot Data to write; must not be shared with the caller
+ * @param write_func Writes the snapshot, returning 0 on success and 1 on failure
+ * @param free_func Frees the snapshot (may be NULL if nothing needs freeing)
+ * @param callback Optional completion callback
+ * @param user_data Passed to `callback`
  *
- * Example:
- * ```c
- * dStaticArray_t *arr1, *arr2;
- * if (d_CompareStaticArray(&arr1, &arr2, 0) == 0) {
- *     // Arrays are identical
- * }
- * ```
+ * @return Save handle, or NULL if the parameters are invalid or allocation fails
+ *
+ * @note Without threads (Emscripten, Windows), or if no thread can be started, the save
+ *       runs before this returns, so the handle is already complete.
  */
-int d_CompareStaticArray(const void* array1, const void* array2, size_t unused);
+dAsyncSave_t* d_AsyncSaveStart(const char* filename, void* snapshot, dAsyncSaveWriteFunc write_func,
+                               dAsyncSaveFreeFunc free_func, dAsyncSaveCallback callback, void* user_data);
 
 /**
- * @brief Comparison function for dArray_t objects.
+ * @brief Check a background save without blocking.
  *
- * Compares two dynamic arrays element by element using binary comparison.
- * Arrays must have the same element_size to be comparable.
+ * @return D_ASYNC_SAVE_PENDING, D_ASYNC_SAVE_DONE or D_ASYNC_SAVE_FAILED (also for NULL)
+ */
+dAsyncSaveStatus_t d_AsyncSavePoll(const dAsyncSave_t* save);
+
+/**
+ * @brief Block until a background save finishes.
  *
- * @param array1 Pointer to first dArray_t* (pointer to dArray_t pointer)
- * @param array2 Pointer to second dArray_t* (pointer to dArray_t pointer)
- * @param unused Size parameter (unused for arrays)
- * @return 0 if equal, non-zero if different
+ * @return 0 if the file was committed, 1 on failure
+ */
+int d_AsyncSaveWait(dAsyncSave_t* save);
+
+/**
+ * @brief Wait for a background save to finish, then free its handle and set `*save` to NULL.
+ */
+void d_AsyncSaveDestroy(dAsyncSave_t** save);
+
+// =============================================================================
+// JOB SYSTEM FUNCTIONS
+// =============================================================================
+
+/**
+ * @brief Start a job system.
  *
- * Example:
- * ```c
- * dArray_t *arr1, *arr2;
- * if (d_CompareDArray(&arr1, &arr2, 0) == 0) {
- *     // Arrays are identical
- * }
- * ```
+ * @param num_workers Number of worker threads (0 = one per online CPU)
+ *
+ * @return Pointer to the new job system, or NULL on failure
+ *
+ * Example: `dJobSystem_t* jobs = d_JobSystemInit(0);`
  */
-int d_CompareDArray(const void* array1, const void* array2, size_t unused);
+dJobSystem_t* d_JobSystemInit(size_t num_workers);
 
 /**
- * @brief Comparison function for dTable_t objects.
+ * @brief Start a job system whose memory comes from `allocator`.
  *
- * Compares two dynamic hash tables by comparing their structure and all key-value pairs.
- * Tables must have matching key_size, value_size, and identical contents to be equal.
+ * @param allocator Allocator for the system, its queues and job storage (NULL = current default)
  *
- * @param table1 Pointer to first dTable_t* (pointer to dTable_t pointer)
- * @param table2 Pointer to second dTable_t* (pointer to dTable_t pointer)
- * @param unused Size parameter (unused for tables)
- * @return 0 if equal, non-zero if different
+ * -- Behaves exactly like d_JobSystemInit otherwise
+ */
+dJobSystem_t* d_JobSystemInitWithAllocator(size_t num_workers, const dAllocator_t* allocator);
+
+/**
+ * @brief Stop the workers and free the job system.
  *
- * Example:
- * ```c
- * dTable_t *table1, *table2;
- * if (d_CompareTable(&table1, &table2, 0) == 0) {
- *     // Tables have identical structure and contents
- * }
- * ```
+ * @param jobs Pointer to the job system pointer (set to NULL after destruction)
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * -- Jobs still queued are run on the calling thread before it returns
  */
-int d_CompareTable(const void* table1, const void* table2, size_t unused);
+int d_JobSystemDestroy(dJobSystem_t** jobs);
 
 /**
- * @brief Comparison function for dStaticTable_t objects.
+ * @brief Queue a job.
  *
- * Compares two static hash tables by comparing their structure and all key-value pairs.
- * Tables must have matching key_size, value_size, num_keys, and identical contents to be equal.
+ * @param jobs The job system
+ * @param func Function to run
+ * @param data Passed to `func`
+ * @param counter Counter the job is added to and removed from when done, or NULL
+ * @param depends_on Counter that must reach zero before the job may start, or NULL
  *
- * @param table1 Pointer to first dStaticTable_t* (pointer to dStaticTable_t pointer)
- * @param table2 Pointer to second dStaticTable_t* (pointer to dStaticTable_t pointer)
- * @param unused Size parameter (unused for tables)
- * @return 0 if equal, non-zero if different
+ * @return 0 on success, 1 on invalid input or if the job could not be stored
  *
- * Example:
- * ```c
- * dStaticTable_t *table1, *table2;
- * if (d_CompareStaticTable(&table1, &table2, 0) == 0) {
- *     // Tables have identical structure and contents
- * }
- * ```
+ * -- Jobs submitted from a worker go to that worker's deque, others to the shared queue
+ * -- If a queue is full the job runs right away on the calling thread
+ *
+ * Example: `d_JobSystemSubmit(jobs, build_mesh, chunk, &meshes_done, &terrain_done);`
  */
-int d_CompareStaticTable(const void* table1, const void* table2, size_t unused);
+int d_JobSystemSubmit(dJobSystem_t* jobs, dJobFunc func, void* data, dJobCounter_t* counter,
+                      dJobCounter_t* depends_on);
 
 /**
- * @brief Comparison function for dString_t objects.
+ * @brief Wait until a counter reaches zero, running queued jobs meanwhile.
  *
- * @param key1 Pointer to first dString_t* (pointer to dString_t pointer)
- * @param key2 Pointer to second dString_t* (pointer to dString_t pointer)
- * @param key_size Size parameter (unused for dString_t)
- * @return 0 if equal, non-zero if different
+ * -- Safe to call from inside a job; the waiting worker keeps taking work
  */
-int d_CompareDString(const void* key1, const void* key2, size_t key_size);
+void d_JobSystemWait(dJobSystem_t* jobs, dJobCounter_t* counter);
 
-/* Quad Tree */
-dQuadTree_t *d_CreateQuadtree( float *rect, int capacity );
-void d_InsertObjectInQuadtree( dQuadTree_t *tree, void *object );
-void d_SubdivideQuadtree( dQuadTree_t *tree );
+/**
+ * @brief Check whether every job counted by `counter` has finished.
+ */
+bool d_JobCounterIsDone(const dJobCounter_t* counter);
 
-/* Kinematic Body 2D  */
-void d_CreateKinmaticBody( dKinematicBody_t *output, const dVec2_t position, const dVec2_t velocity, const dVec2_t acceleration, const float mass );
+/**
+ * @brief Get the number of worker threads.
+ */
+size_t d_JobSystemGetWorkerCount(const dJobSystem_t* jobs);
 
-/* Strings */
+/**
+ * @brief Run `func` over every element of a dynamic array, in parallel chunks.
+ *
+ * @param jobs Job system to spread the chunks over (NULL = run on the calling thread)
+ * @param array The array; must not be resized until the call returns
+ * @param chunk_size Elements per chunk (0 = pick one from the array and worker counts)
+ * @param func Called once per chunk with a pointer to its first element
+ * @param user_data Passed to `func`
+ *
+ * @return 0 on success, 1 on invalid input
+ *
+ * -- Chunks are rounded to whole cache lines, so no two chunks write to the same line
+ * -- Returns once every chunk has run; the calling thread processes chunks too
+ *
+ * Example: `d_ArrayParallelFor(jobs, entities, 0, update_entities, &frame);`
+ */
+int d_ArrayParallelFor(dJobSystem_t* jobs, dArray_t* array, size_t chunk_size, dParallelForFunc func,
+                       void* user_data);
 
 /**
- * @brief Checks if a dString_t is NULL, contains a NULL buffer, or is empty.
+ * @brief Run `func` over every element of a static array, in parallel chunks.
  *
- * @param s The dString_t pointer to validate.
- * @return true if the string is considered invalid or empty, otherwise false.
+ * -- Same contract as d_ArrayParallelFor
  */
-static inline bool d_IsStringInvalid(const dString_t* s)
-{
-    return (s == NULL || s->str == NULL || s->len == 0);
-}
+int d_StaticArrayParallelFor(dJobSystem_t* jobs, dStaticArray_t* array, size_t chunk_size,
+                             dParallelForFunc func, void* user_data);
+
+// =============================================================================
+// SORTING FUNCTIONS
+// =============================================================================
 
 /**
- * @brief Create a dString from the contents of a file
- * 
- * Reads the entire contents of a file into a newly allocated dString_t object.
- * The file is opened in binary mode to ensure accurate reading across all platforms,
- * including Windows where text mode performs newline translation.
- * 
- * @param filename Path to the file to read (must not be NULL)
- * 
- * @return A new dString_t* containing the file contents, or NULL if:
- *         - filename is NULL
- *         - file cannot be opened
- *         - memory allocation fails
- *         - file read operation fails
+ * @brief Map a signed integer to an unsigned radix key with the same order.
  */
-dString_t* d_StringCreateFromFile(const char *filename);
+static inline uint64_t d_SortKeyFromInt64(int64_t value)
+{
+    return (uint64_t)value ^ 0x8000000000000000ULL;
+}
 
 /**
- * @brief Create a new string builder.
+ * @brief Map a double to an unsigned radix key with the same order (-0.0 sorts before 0.0).
  *
- * @return A new string builder, or NULL on allocation failure.
+ * Flips every bit of negatives and only the sign bit of positives, so the key order is
+ * the numeric order. NaNs sort past the infinities of their sign.
  */
-dString_t *d_StringInit(void);
+static inline uint64_t d_SortKeyFromDouble(double value)
+{
+    union { double d; uint64_t u; } bits;
+    bits.d = value;
+    return (bits.u & 0x8000000000000000ULL) ? ~bits.u : bits.u | 0x8000000000000000ULL;
+}
 
-// Macro to capture file/line info for debugging
-#define d_StringDestroy(sb) \
-    _d_StringDestroy_impl(sb, __FILE__, __LINE__, __func__)
 /**
- * @brief Destroy a string builder and free its memory.
- * 
- * @param sb The string builder to destroy.
- * 
- * @return: Success/failure indicator.
+ * @brief Map a float to an unsigned radix key with the same order; see d_SortKeyFromDouble().
  */
-void _d_StringDestroy_impl(dString_t* sb, const char* file, int line, const char* func);
+static inline uint64_t d_SortKeyFromFloat(float value)
+{
+    union { float f; uint32_t u; } bits;
+    bits.f = value;
+    return (bits.u & 0x80000000u) ? (uint64_t)~bits.u & 0xFFFFFFFFu : (uint64_t)(bits.u | 0x80000000u);
+}
 
 /**
- * @brief Add a C string to the string builder. 
- * 
- * @param sb The string builder to append to.
- * @param str The string to append (must be null-terminated if len is 0).
- * @param len The length of string to append, or 0 to use strlen().
- * 
- * @return: Success/failure indicator.
+ * @brief Built-in key extractors for arrays of plain numbers (the key is the whole element).
+ *
+ * Example: `d_ArrayRadixSort(depths, d_SortKeyFloat, NULL);`
  */
-void d_StringAppend(dString_t* sb, const char* str, size_t len);
+uint64_t d_SortKeyInt32(const void* element, void* user_data);
+uint64_t d_SortKeyUInt32(const void* element, void* user_data);
+uint64_t d_SortKeyInt64(const void* element, void* user_data);
+uint64_t d_SortKeyUInt64(const void* element, void* user_data);
+uint64_t d_SortKeyFloat(const void* element, void* user_data);
+uint64_t d_SortKeyDouble(const void* element, void* user_data);
 
 /**
- * @brief Set the content of an existing dString_t to a new value.
+ * @brief Sort a dynamic array with a comparator.
  *
- * @param string: Pointer to existing dString_t structure.
- * @param content: C-string content to copy into the dString_t.
- * 
- * @return: Success/failure indicator.
+ * @param array The array to sort in place
+ * @param compare Ordering comparator
+ * @param user_data Passed to `compare`
+ *
+ * @return 0 on success, 1 on invalid input or if scratch space could not be allocated
+ *
+ * -- Stable merge sort: equivalent elements keep their order
+ * -- Needs scratch space for `count` elements from the array's allocator
+ *
+ * Example: `d_ArraySort(sprites, compare_by_layer, NULL);`
  */
-int d_StringSet(dString_t* string, const char* content);
+int d_ArraySort(dArray_t* array, dSortCompareFunc compare, void* user_data);
 
 /**
- * @brief Create a new string builder with the same content as another string.
+ * @brief Sort a dynamic array with a comparator, spreading the work over a job system.
  *
- * @param source The string to copy content from.
+ * @param jobs Job system to sort on (NULL = same as d_ArraySort)
  *
- * @return A new string builder with the same content as the source, or NULL on error.
+ * -- Each worker sorts a slice, then neighbouring slices are merged in parallel rounds
+ * -- Same result as d_ArraySort; small arrays are sorted on the calling thread
  */
-dString_t* d_StringClone(const dString_t* source);
+int d_ArraySortParallel(dJobSystem_t* jobs, dArray_t* array, dSortCompareFunc compare, void* user_data);
 
 /**
- * @brief Negatively Append, removing content from the end of the string.
- * 
- * @param sb The string builder to remove from.
- * @param count The number of characters to remove.
+ * @brief Sort a dynamic array by integer keys with an LSD radix sort.
+ *
+ * @param array The array to sort in place
+ * @param key_func Returns each element's key; called exactly once per element
+ * @param user_data Passed to `key_func`
+ *
+ * @return 0 on success, 1 on invalid input or if scratch space could not be allocated
+ *
+ * -- Stable; O(n) per key byte, and bytes that are equal in every key are skipped
+ * -- Needs scratch space for `count` elements plus two keys per element
+ *
+ * Example: `d_ArrayRadixSort(draw_calls, draw_call_key, NULL);`
  */
-void d_StringAppendN(dString_t* sb, const char* str, size_t max_len);
+int d_ArrayRadixSort(dArray_t* array, dSortKeyFunc key_func, void* user_data);
 
 /**
- * @brief Add a single character to the string builder.
- * 
- * @param sb The string builder to append to.
- * @param c The character to append.
+ * @brief Sort a static array with a comparator; see d_ArraySort().
  */
-void d_StringAppendChar(dString_t* sb, char c);
+int d_StaticArraySort(dStaticArray_t* array, dSortCompareFunc compare, void* user_data);
+
 /**
- * @brief Add an integer to the string builder as a decimal string.
- * 
- * @param sb The string builder to append to.
- * @param val The integer value to append.
- 
+ * @brief Sort a static array with a comparator on a job system; see d_ArraySortParallel().
  */
-void d_StringAppendInt(dString_t* sb, int val);
+int d_StaticArraySortParallel(dJobSystem_t* jobs, dStaticArray_t* array, dSortCompareFunc compare,
+                              void* user_data);
+
 /**
- * @brief Add a floating-point number to the string builder.
- * 
- * @param sb The string builder to append to.
- * @param val The floating-point value to append.
- * @param decimals The number of decimal places to show (0-10).
- * 
- * @return Success/failure indicator.
+ * @brief Sort a static array by integer keys; see d_ArrayRadixSort().
  */
-void d_StringAppendFloat(dString_t* sb, float val, int decimals);
+int d_StaticArrayRadixSort(dStaticArray_t* array, dSortKeyFunc key_func, void* user_data);
+
+// =============================================================================
+// BUILT-IN HASH FUNCTIONS
+// =============================================================================
+
 /**
- * @brief Clear the string builder content.
- * 
- * @param sb The string builder to clear.
- *
- * @return Success/failure indicator.
- */
-void d_StringClear(dString_t* sb);
-/*
- * Truncate the string builder to a specific length
- *
- * `sb` - Pointer to string builder
- * `len` - New length (must be <= current length)
- *
- * -- Does nothing if sb is NULL or len >= current length
- * -- Memory is not freed, only the length is reduced
- * -- The string remains null-terminated at the new length
- */
-void d_StringTruncate(dString_t* sb, size_t len);
-/*
- * Remove characters from the beginning of the string builder
+ * @brief Scramble a hash value so that every output bit depends on every input bit.
  *
- * `sb` - Pointer to string builder
- * `len` - Number of characters to remove from the beginning
- *
- * -- Does nothing if sb is NULL or len is 0
- * -- If len >= current length, the string builder is cleared completely
- * -- Uses memmove for safe overlapping memory operation
- */
-void d_StringDrop(dString_t* sb, size_t len);
-/*
- * Get the current length of the string builder content
- *
- * `sb` - Pointer to string builder
+ * Several built-in hashes (d_HashInt, d_HashFloat) only fill the low 32 bits and
+ * keep weak low-order bits. Containers that index with a power-of-two mask or pick
+ * shards from the high bits run the user hash through this finalizer first.
  *
- * `size_t` - Current length in characters, or 0 if sb is NULL
- *
- * -- Return value does not include the null terminator
- * -- Safe to call with NULL pointer (returns 0)
+ * @param hash Raw hash value from a dTableHashFunc
+ * @return Mixed hash value (SplitMix64 finalizer on 64-bit targets)
  */
-size_t d_StringGetLength(const dString_t* sb);
+static inline size_t d_HashMix(size_t hash)
+{
+    uint64_t x = (uint64_t)hash;
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return (size_t)x;
+}
 
-// User calls d_StringPeek(sb) - macro captures their location
-#define d_StringPeek(sb) \
-    _d_StringPeek_impl(sb, __FILE__, __LINE__, __func__)
-// Actual function declaration (note the underscore prefix)
 /**
- * @brief Get the internal C string without copying
- * 
- * @param sb String builder
- * 
- * @return Pointer to internal string, or NULL if sb is NULL
+ * @brief Knuth multiplicative hash of an int value; the body of d_HashInt.
+ *
+ * Exposed inline so D_TABLE_DEFINE tables hash without a function-pointer call.
  */
-const char* _d_StringPeek_impl(const dString_t* sb, const char* file, int line, const char* func);
+static inline size_t d_HashIntValue(int key)
+{
+    return (size_t)((unsigned int)key * 2654435761U); // Knuth's multiplicative constant
+}
 
 /**
- * @brief Dump the string builder content to a newly allocated C string.
- * 
- * @param sb String builder to dump
- * @param len Pointer to size_t to receive length of dumped string (excluding null terminator)
- * 
- * @return Newly allocated C string containing the content, or NULL on failure
- * 
+ * @brief FNV-1a hash of a null-terminated string; the body of d_HashString.
+ *
+ * @param str String to hash (NULL hashes to 0)
  */
-char *d_StringDump(const dString_t* sb, size_t* len);
+static inline size_t d_HashStringValue(const char* str)
+{
+    if (!str) return 0;
+
+    const unsigned char* data = (const unsigned char*)str;
+    size_t hash = 2166136261U; // FNV-1a offset basis
+    while (*data) {
+        hash ^= *data++;
+        hash *= 16777619U; // FNV-1a prime
+    }
+    return hash;
+}
 
 /**
- * @brief Append formatted text to string builder using printf-style format specifiers
- * 
- * @param sb String builder to append to
- * @param format Format string with %s, %d, %f, etc.
- * @param ... Variable arguments corresponding to format specifiers
+ * @brief Mix the bits of a pointer address; the body of d_HashPointer.
  */
-void d_StringFormat(dString_t* sb, const char* format, ...);
+static inline size_t d_HashPointerValue(const void* ptr)
+{
+    uintptr_t addr = (uintptr_t)ptr;
+
+    if (sizeof(void*) == 8) {
+        // 64-bit pointers
+        uint64_t hash_val = (uint64_t)addr;
+        hash_val ^= hash_val >> 33;
+        hash_val *= 0xff51afd7ed558ccdULL;
+        hash_val ^= hash_val >> 33;
+        return (size_t)hash_val;
+    }
+    // 32-bit pointers
+    return (size_t)(addr * 2654435761U);
+}
 
 /**
- * @brief Perform template string substitution replacing {key} placeholders with values
- * 
- * @param sb String builder to append result to
- * @param tmplt Template string containing {key} placeholders
- * @param keys Array of key strings to match
- * @param values Array of replacement values
- * @param count Number of key-value pairs
- */
-void d_StringTemplate(dString_t* sb, const char* tmplt, const char* keys[], const char* values[], int count);
-/*
- * Add an ASCII progress bar to the string builder
+ * @brief Hash function for 32-bit integers using Knuth's multiplicative method.
  *
- * `sb` - Pointer to string builder
- * `current` - Current progress value
- * `max` - Maximum progress value
- * `width` - Width of the progress bar (excluding brackets)
- * `fill_char` - Character to use for filled portions
- * `empty_char` - Character to use for empty portions
+ * Uses Knuth's magic constant for excellent distribution with integer keys.
+ * Suitable for most general-purpose integer hashing needs.
  *
- * -- Does nothing if sb is NULL, width <= 0, or max <= 0
- * -- Progress bar format: [████████----] where █ is fill_char and - is empty_char
- * -- If current > max, the bar is filled completely
- * -- If current < 0, the bar is empty
- * -- Total visual width is width + 2 (for brackets)
+ * @param key Pointer to integer key
+ * @param key_size Size of the key (should be sizeof(int))
+ * @return Hash value
+ *
+ * Example:
+ * ```c
+ * dTable_t* table = d_TableInit(sizeof(int), sizeof(char*), 
+ *                               d_HashInt, d_CompareInt, 16, 0.75f);
+ * ```
  */
-void d_StringAppendProgressBar(dString_t* sb, int current, int max, int width, char fill_char, char empty_char);
-/*
-  * Add text padded to the center with specified character to reach target width
-  *
-  * `sb` - Pointer to string builder
-  * `text` - Text to center (must be null-terminated)
-  * `width` - Target total width including padding
-  * `pad_char` - Character to use for padding
-  *
-  * -- Does nothing if sb or text is NULL
-  * -- If text length >= width, adds text without padding
-  * -- Text is centered with padding distributed evenly on both sides
-  * -- If padding cannot be evenly distributed, left side gets one less character
-  * -- Example: d_StringPadCenter(sb, "Hi", 6, '.') produces "..Hi.."
-  * -- Example: d_StringPadCenter(sb, "Hi", 7, '.') produces "..Hi..."
-  * -- Commonly used for centered headers and titles in ASCII interfaces
-  */
-void d_StringPadCenter(dString_t* sb, const char* text, int width, char pad_char);
-/*
-  * Add text padded to the left with specified character to reach target width
-  *
-  * `sb` - Pointer to string builder
-  * `text` - Text to pad (must be null-terminated)
-  * `width` - Target total width including padding
-  * `pad_char` - Character to use for padding
-  *
-  * -- Does nothing if sb or text is NULL
-  * -- If text length >= width, adds text without padding
-  * -- Padding is added to the left side of the text
-  * -- Example: d_StringPadLeft(sb, "Hi", 5, '.') produces "...Hi"
-  * -- Commonly used for right-aligned text in tables and menus
-  */
-void d_StringPadLeft(dString_t* sb, const char* text, int width, char pad_char);
-/*
-  * Add text padded to the right with specified character to reach target width
+size_t d_HashInt(const void* key, size_t key_size);
 
-  * `sb` - Pointer to string builder
-  * `text` - Text to pad (must be null-terminated)
-  * `width` - Target total width including padding
-  * `pad_char` - Character to use for padding
-  *
-  * -- Does nothing if sb or text is NULL
-  * -- If text length >= width, adds text without padding
-  * -- Padding is added to the right side of the text
-  * -- Example: d_StringPadRight(sb, "Hi", 5, '.') produces "Hi..."
-  * -- Commonly used for left-aligned text in tables and menus
-  */
-void d_StringPadRight(dString_t* sb, const char* text, int width, char pad_char);
-/*
- * Add repeated characters to the string builder
+/**
+ * @brief Hash function for null-terminated strings using FNV-1a algorithm.
  *
- * `sb` - Pointer to string builder
- * `character` - Character to repeat
- * `count` - Number of times to repeat the character
+ * FNV-1a provides excellent distribution for string data with good performance.
+ * Works with any null-terminated string regardless of the key_size parameter.
  *
- * -- Does nothing if sb is NULL or count <= 0
- * -- Efficiently adds multiple copies of the same character
- * -- Used internally by progress bar and padding functions
+ * @param key Pointer to null-terminated string
+ * @param key_size Size parameter (can be 0 for null-terminated strings)
+ * @return Hash value
+ *
+ * Example:
+ * ```c
+ * dTable_t* table = d_TableInit(sizeof(char*), sizeof(int), 
+ *                               d_HashString, d_CompareString, 16, 0.75f);
+ * ```
  */
-void d_StringRepeat(dString_t* sb, char character, int count);
-
-// Pythonic String Utils
-/*
-  * Join an array of strings with a separator (like Python's str.join())
-  *
-  * `sb` - Pointer to string builder
-  * `strings` - Array of string pointers to join
-  * `count` - Number of strings in the array
-  * `separator` - String to insert between each element
-  *
-  * -- Does nothing if sb is NULL or count <= 0
-  * -- If strings array is NULL, does nothing
-  * -- NULL strings in the array are treated as empty strings
-  * -- If separator is NULL, strings are joined without separation
-  * -- Example: d_StringJoin(sb, {"a", "b", "c"}, 3, ", ") produces "a, b, c"
-  * -- Commonly used for creating comma-separated lists, file paths, etc.
-  */
-void d_StringJoin(dString_t* sb, const char** strings, int count, const char* separator);
+size_t d_HashString(const void* key, size_t key_size);
 
 /**
- * @brief Slice text and append a substring slice with Python-style indexing
- * @param sb String builder to append result to
- * @param text Source text to slice
- * @param start Start index (negative counts from end)
- * @param end End index, exclusive (negative counts from end)
+ * @brief Hash function for string literals (const char*).
+ *
+ * Similar to d_HashString but expects the key to be a char* directly,
+ * not a pointer to a char*. Useful for string literal keys.
+ *
+ * @param key Pointer to string (char*)
+ * @param key_size Length of the string (can be 0 for null-terminated)
+ * @return Hash value
  */
-void d_StringSlice(dString_t* sb, const char* text, int start, int end);
+size_t d_HashStringLiteral(const void* key, size_t key_size);
 
-/*
- * Compare two dString_t objects lexicographically
+/**
+ * @brief Hash function for floating-point numbers.
  *
- * `str1` - The first Daedalus string object
- * `str2` - The second Daedalus string object
+ * Converts float to integer representation for hashing.
+ * Note: Be careful with floating-point precision when using as keys.
  *
- * `int` - An integer less than, equal to, or greater than zero if str1 is found,
- * respectively, to be less than, to match, or be greater than str2
+ * @param key Pointer to float value
+ * @param key_size Size of the key (should be sizeof(float))
+ * @return Hash value
  *
- * -- If both are the same kind of invalid, consider them equal
- * -- If one is invalid and the other is not, they are not equal
- * -- Invalid str1 is considered "less than" valid str2
- * -- Valid str1 is considered "greater than" invalid str2
- * -- Uses strcmp() for lexicographical comparison of valid strings
+ * Example:
+ * ```c
+ * dTable_t* table = d_TableInit(sizeof(float), sizeof(int), 
+ *                               d_HashFloat, d_CompareFloat, 16, 0.75f);
+ * ```
  */
-int d_StringCompare(const dString_t* str1, const dString_t* str2);
+size_t d_HashFloat(const void* key, size_t key_size);
 
-/*
- * Compare a dString_t with a standard C-string
+/**
+ * @brief Hash function for double-precision floating-point numbers.
  *
- * `d_str` - The Daedalus string object to compare
- * `c_str` - The standard null-terminated C-string to compare against
+ * Converts double to integer representation for hashing.
+ * Note: Be careful with floating-point precision when using as keys.
  *
- * `int` - An integer less than, equal to, or greater than zero if d_str is found,
- * respectively, to be less than, to match, or be greater than c_str
- *
- * -- An invalid dString and a NULL/empty C-string are considered "equal"
- * -- Invalid d_str is considered "less than" a valid c_str
- * -- Valid d_str is considered "greater than" a NULL c_str
- * -- Uses strcmp() for lexicographical comparison when both are valid
- * -- Avoids need to create temporary dString_t for comparison
- * -- Critical for performance when interfacing with external C-strings
+ * @param key Pointer to double value
+ * @param key_size Size of the key (should be sizeof(double))
+ * @return Hash value
  */
-int d_StringCompareToCString(const dString_t* d_str, const char* c_str);
-
+size_t d_HashDouble(const void* key, size_t key_size);
 
-/* Dynamic Arrays */
-/*
- * Create a new dynamic array with specified capacity and element size
+/**
+ * @brief General-purpose hash function for binary data using FNV-1a.
  *
- * `capacity` - Initial number of elements the array can hold
- * `element_size` - Size in bytes of each element (e.g., sizeof(int))
+ * Can hash any binary data of specified length. Useful for structs,
+ * arrays, or any fixed-size binary data.
  *
- * `dArray_t*` - Pointer to new dynamic array, or NULL on allocation failure
+ * @param key Pointer to binary data
+ * @param key_size Size of the data in bytes
+ * @return Hash value
  *
- * -- Must be destroyed with d_DestroyArray() to free memory
- * -- Initial count is 0 even though capacity may be larger
- * -- Elements can be any type as long as element_size is correct
- * -- Capacity of 0 is allowed but array cannot store elements until resized
+ * Example:
+ * ```c
+ * typedef struct { int x, y; } Point;
+ * dTable_t* table = d_TableInit(sizeof(Point), sizeof(int), 
+ *                               d_HashBinary, d_CompareBinary, 16, 0.75f);
+ * ```
  */
+size_t d_HashBinary(const void* key, size_t key_size);
 
- /* Logging System */
-
- // =============================================================================
- // CORE LOGGING FUNCTIONS
- // =============================================================================
+/**
+ * @brief Hash function for pointers (memory addresses).
+ *
+ * Hashes the pointer value itself, not the data it points to.
+ * Useful when you want to use memory addresses as keys.
+ *
+ * @param key Pointer to pointer value
+ * @param key_size Size of pointer (should be sizeof(void*))
+ * @return Hash value
+ */
+size_t d_HashPointer(const void* key, size_t key_size);
 
- /** @brief Log a message at the specified level
-  * @param level Log level (DEBUG, INFO, WARNING, ERROR, FATAL)
-  * @param message Message string to log
-  */
- void d_Log(dLogLevel_t level, const char* message);
+// =============================================================================
+// BUILT-IN COMPARISON FUNCTIONS
+// =============================================================================
 
- /** @brief Log a formatted message at the specified level (printf-style)
-  * @param level Log level (DEBUG, INFO, WARNING, ERROR, FATAL)
-  * @param format Printf-style format string
-  * @param ... Variable arguments for format specifiers
-  */
- void d_LogF(dLogLevel_t level, const char* format, ...);
+/**
+ * @brief Comparison function for 32-bit integers.
+ *
+ * @param key1 Pointer to first integer
+ * @param key2 Pointer to second integer
+ * @param key_size Size of keys (should be sizeof(int))
+ * @return 0 if equal, non-zero if different
+ */
+int d_CompareInt(const void* key1, const void* key2, size_t key_size);
 
- /** @brief Log with explicit file/line/function information
-  * @param level Log level
-  * @param file Source file path
-  * @param line Line number
-  * @param func Function name
-  * @param message Message to log
-  */
- void d_LogEx(dLogLevel_t level, const char* file, int line, const char* func, const char* message);
+/**
+ * @brief Comparison function for null-terminated strings.
+ *
+ * Compares strings pointed to by char** keys using strcmp.
+ *
+ * @param key1 Pointer to first string pointer (char**)
+ * @param key2 Pointer to second string pointer (char**)
+ * @param key_size Size parameter (unused for null-terminated strings)
+ * @return 0 if equal, non-zero if different
+ */
+int d_CompareString(const void* key1, const void* key2, size_t key_size);
 
- /** @brief Log with explicit file/line/function and formatting
-  * @param level Log level
-  * @param file Source file path
-  * @param line Line number
-  * @param func Function name
-  * @param format Printf-style format string
-  * @param ... Variable arguments
-  */
- void d_LogExF(dLogLevel_t level, const char* file, int line, const char* func, const char* format, ...);
+/**
+ * @brief Comparison function for string literals (const char*).
+ *
+ * Compares strings directly, expecting keys to be char* not char**.
+ *
+ * @param key1 Pointer to first string (char*)
+ * @param key2 Pointer to second string (char*)
+ * @param key_size Length to compare (0 for full null-terminated comparison)
+ * @return 0 if equal, non-zero if different
+ */
+int d_CompareStringLiteral(const void* key1, const void* key2, size_t key_size);
 
- // =============================================================================
- // CONVENIENCE LOGGING FUNCTIONS
- // =============================================================================
+/**
+ * @brief Comparison function for floating-point numbers.
+ *
+ * Compares floats with exact equality. Be aware that floating-point
+ * precision issues may cause problems with hash table lookups.
+ *
+ * @param key1 Pointer to first float
+ * @param key2 Pointer to second float
+ * @param key_size Size of keys (should be sizeof(float))
+ * @return 0 if equal, non-zero if different
+ */
+int d_CompareFloat(const void* key1, const void* key2, size_t key_size);
 
- /** @brief Log a debug message
-  * @param message Message to log
-  */
- void d_LogDebug(const char* message);
+/**
+ * @brief Comparison function for double-precision floating-point numbers.
+ *
+ * Compares doubles with exact equality. Be aware that floating-point
+ * precision issues may cause problems with hash table lookups.
+ *
+ * @param key1 Pointer to first double
+ * @param key2 Pointer to second double
+ * @param key_size Size of keys (should be sizeof(double))
+ * @return 0 if equal, non-zero if different
+ */
+int d_CompareDouble(const void* key1, const void* key2, size_t key_size);
 
- /** @brief Log an info message
-  * @param message Message to log
-  */
- void d_LogInfo(const char* message);
+/**
+ * @brief Comparison function for binary data using memcmp.
+ *
+ * Performs byte-by-byte comparison of binary data.
+ *
+ * @param key1 Pointer to first data block
+ * @param key2 Pointer to second data block
+ * @param key_size Size of data blocks in bytes
+ * @return 0 if equal, non-zero if different
+ */
+int d_CompareBinary(const void* key1, const void* key2, size_t key_size);
 
- /** @brief Log a warning message
-  * @param message Message to log
-  */
- void d_LogWarning(const char* message);
+/**
+ * @brief Comparison function for pointers (memory addresses).
+ *
+ * Compares pointer values, not the data they point to.
+ *
+ * @param key1 Pointer to first pointer value
+ * @param key2 Pointer to second pointer value
+ * @param key_size Size of pointer (should be sizeof(void*))
+ * @return 0 if equal, non-zero if different
+ */
+int d_ComparePointer(const void* key1, const void* key2, size_t key_size);
 
- /** @brief Log an error message
-  * @param message Message to log
-  */
- void d_LogError(const char* message);
+// =============================================================================
+// SPECIALIZED HASH FUNCTIONS FOR COMMON PATTERNS
+// =============================================================================
 
- /** @brief Log a fatal message
-  * @param message Message to log
-  */
- void d_LogFatal(const char* message);
+/**
+ * @brief Hash function optimized for small positive integers (0-999).
+ *
+ * Uses simple multiplication with good distribution for small integer ranges.
+ * More efficient than general-purpose hashing for known small ranges.
+ *
+ * @param key Pointer to integer key
+ * @param key_size Size of the key (should be sizeof(int))
+ * @return Hash value
+ */
+size_t d_HashSmallInt(const void* key, size_t key_size);
 
- /** @brief Log a formatted debug message
-  * @param format Printf-style format string
-  * @param ... Variable arguments
-  */
- void d_LogDebugF(const char* format, ...);
+/**
+ * @brief Hash function for case-insensitive strings.
+ *
+ * Converts characters to lowercase before hashing for case-insensitive keys.
+ *
+ * @param key Pointer to string pointer (char**)
+ * @param key_size Size parameter (unused for null-terminated strings)
+ * @return Hash value
+ */
+size_t d_HashStringCaseInsensitive(const void* key, size_t key_size);
 
- /** @brief Log a formatted info message
-  * @param format Printf-style format string
-  * @param ... Variable arguments
-  */
- void d_LogInfoF(const char* format, ...);
+/**
+ * @brief Comparison function for case-insensitive strings.
+ *
+ * Performs case-insensitive string comparison.
+ *
+ * @param key1 Pointer to first string pointer (char**)
+ * @param key2 Pointer to second string pointer (char**)
+ * @param key_size Size parameter (unused for null-terminated strings)
+ * @return 0 if equal, non-zero if different
+ */
+int d_CompareStringCaseInsensitive(const void* key1, const void* key2, size_t key_size);
 
- /** @brief Log a formatted warning message
-  * @param format Printf-style format string
-  * @param ... Variable arguments
-  */
- void d_LogWarningF(const char* format, ...);
+/**
+ * @brief Comparison function for dStaticArray_t objects.
+ *
+ * Compares two static arrays element by element using binary comparison.
+ * Arrays must have the same element_size to be comparable.
+ *
+ * @param array1 Pointer to first dStaticArray_t* (pointer to dStaticArray_t pointer)
+ * @param array2 Pointer to second dStaticArray_t* (pointer to dStaticArray_t pointer)
+ * @param unused Size parameter (unused for arrays)
+ * @return 0 if equal, non-zero if different
+ *
+ * Example:
+ * ```c
+ * dStaticArray_t *arr1, *arr2;
+ * if (d_CompareStaticArray(&arr1, &arr2, 0) == 0) {
+ *     // Arrays are identical
+ * }
+ * ```
+ */
+int d_CompareStaticArray(const void* array1, const void* array2, size_t unused);
 
- /** @brief Log a formatted error message
-  * @param format Printf-style format string
-  * @param ... Variable arguments
-  */
- void d_LogErrorF(const char* format, ...);
+/**
+ * @brief Comparison function for dArray_t objects.
+ *
+ * Compares two dynamic arrays element by element using binary comparison.
+ * Arrays must have the same element_size to be comparable.
+ *
+ * @param array1 Pointer to first dArray_t* (pointer to dArray_t pointer)
+ * @param array2 Pointer to second dArray_t* (pointer to dArray_t pointer)
+ * @param unused Size parameter (unused for arrays)
+ * @return 0 if equal, non-zero if different
+ *
+ * Example:
+ * ```c
+ * dArray_t *arr1, *arr2;
+ * if (d_CompareDArray(&arr1, &arr2, 0) == 0) {
+ *     // Arrays are identical
+ * }
+ * ```
+ */
+int d_CompareDArray(const void* array1, const void* array2, size_t unused);
 
- /** @brief Log a formatted fatal message
-  * @param format Printf-style format string
-  * @param ... Variable arguments
-  */
- void d_LogFatalF(const char* format, ...);
+/**
+ * @brief Comparison function for dTable_t objects.
+ *
+ * Compares two dynamic hash tables by comparing their structure and all key-value pairs.
+ * Tables must have matching key_size, value_size, and identical contents to be equal.
+ *
+ * @param table1 Pointer to first dTable_t* (pointer to dTable_t pointer)
+ * @param table2 Pointer to second dTable_t* (pointer to dTable_t pointer)
+ * @param unused Size parameter (unused for tables)
+ * @return 0 if equal, non-zero if different
+ *
+ * Example:
+ * ```c
+ * dTable_t *table1, *table2;
+ * if (d_CompareTable(&table1, &table2, 0) == 0) {
+ *     // Tables have identical structure and contents
+ * }
+ * ```
+ */
+int d_CompareTable(const void* table1, const void* table2, size_t unused);
 
- // =============================================================================
- // LOGGER MANAGEMENT
- // =============================================================================
+/**
+ * @brief Comparison function for dStaticTable_t objects.
+ *
+ * Compares two static hash tables by comparing their structure and all key-value pairs.
+ * Tables must have matching key_size, value_size, num_keys, and identical contents to be equal.
+ *
+ * @param table1 Pointer to first dStaticTable_t* (pointer to dStaticTable_t pointer)
+ * @param table2 Pointer to second dStaticTable_t* (pointer to dStaticTable_t pointer)
+ * @param unused Size parameter (unused for tables)
+ * @return 0 if equal, non-zero if different
+ *
+ * Example:
+ * ```c
+ * dStaticTable_t *table1, *table2;
+ * if (d_CompareStaticTable(&table1, &table2, 0) == 0) {
+ *     // Tables have identical structure and contents
+ * }
+ * ```
+ */
+int d_CompareStaticTable(const void* table1, const void* table2, size_t unused);
 
- /** @brief Create a new logger with the specified configuration
-  * @param config Logger configuration settings
-  * @return Pointer to new logger, or NULL on allocation failure
-  */
- dLogger_t* d_CreateLogger(dLogConfig_t config);
+/**
+ * @brief Comparison function for dString_t objects.
+ *
+ * @param key1 Pointer to first dString_t* (pointer to dString_t pointer)
+ * @param key2 Pointer to second dString_t* (pointer to dString_t pointer)
+ * @param key_size Size parameter (unused for dString_t)
+ * @return 0 if equal, non-zero if different
+ */
+int d_CompareDString(const void* key1, const void* key2, size_t key_size);
 
- /** @brief Destroy a logger and free all associated resources
-  * @param logger Pointer to logger to destroy
-  */
- void d_DestroyLogger(dLogger_t* logger);
+// =============================================================================
+// TYPE-SPECIALIZED HASH TABLES
+// =============================================================================
 
- /** @brief Set a logger as the global default logger
-  * @param logger Logger to set as global (can be NULL to disable)
-  */
- void d_SetGlobalLogger(dLogger_t* logger);
+// Control byte values shared by flat-mode dTable_t and D_TABLE_DEFINE tables. Full slots
+// store the low 7 bits of the mixed hash (0x00-0x7F), so the high bit alone tells
+// empty/deleted apart from occupied.
+#define D_TABLE_CTRL_EMPTY   ((uint8_t)0x80)
+#define D_TABLE_CTRL_DELETED ((uint8_t)0xFE)
+#define D_TABLE_CTRL_IS_FULL(c) (((c) & 0x80) == 0)
 
- /** @brief Get the current global logger
-  * @return Pointer to global logger, or NULL if none set
-  */
- dLogger_t* d_GetGlobalLogger(void);
+#define D_TABLE_TYPED_MIN_CAPACITY 8
 
- // =============================================================================
- // CONFIGURATION
- // =============================================================================
+// Ready-made hash and equality expressions for D_TABLE_DEFINE
+#define D_TABLE_HASH_INT(key)     d_HashIntValue(key)
+#define D_TABLE_HASH_STRING(key)  d_HashStringValue(key)
+#define D_TABLE_HASH_POINTER(key) d_HashPointerValue(key)
+#define D_TABLE_EQ_VALUE(a, b)    ((a) == (b))
+#define D_TABLE_EQ_STRING(a, b)   (strcmp((a), (b)) == 0)
 
- /** @brief Set the minimum log level for a logger
-  * @param logger Logger to configure (NULL for global logger)
-  * @param level Minimum level to log
-  */
- void d_SetLogLevel(dLogger_t* logger, dLogLevel_t level);
+/**
+ * @brief Generate a hash table specialized for one key type and one value type.
+ *
+ * Expands to the types `Name##Slot_t` and `Name##_t` plus static inline functions
+ * `Name##_Init`, `Name##_InitWithAllocator`, `Name##_Destroy`, `Name##_Set`, `Name##_Get`, `Name##_HasKey`,
+ * `Name##_Remove`, `Name##_Clear`, `Name##_Rehash` and `Name##_Count`. Keys and values
+ * are stored by value in the same open-addressing layout as D_TABLE_MODE_FLAT, but hash,
+ * compare and copies are plain expressions the compiler can inline.
+ *
+ * @param Name Prefix for the generated types and functions
+ * @param KeyType Key type, copied by assignment
+ * @param ValueType Value type, copied by assignment
+ * @param hash_expr Function or macro called as `hash_expr(key)`, returning size_t
+ * @param eq_expr Function or macro called as `eq_expr(a, b)`, true when keys are equal
+ *
+ * @note Expand once per translation unit, at file scope. String keys are stored as
+ *       the pointer only; the caller keeps the characters alive.
+ * @note `Name##_Init` captures the default allocator; the struct and slots are
+ *       allocated and freed through the one recorded in `allocator`.
+ *
+ * Example:
+ * `D_TABLE_DEFINE(EntityMap, int, Entity_t, D_TABLE_HASH_INT, D_TABLE_EQ_VALUE)`
+ * `EntityMap_t* map = EntityMap_Init(64);`
+ * `EntityMap_Set(map, id, entity); Entity_t* e = EntityMap_Get(map, id);`
+ * `EntityMap_Destroy(&map);`
+ */
+#define D_TABLE_DEFINE(Name, KeyType, ValueType, hash_expr, eq_expr)                          \
+typedef struct { KeyType key; ValueType value; } Name##Slot_t;                                \
+typedef struct {                                                                              \
+    uint8_t* ctrl;          /* One control byte per slot */                                   \
+    Name##Slot_t* slots;    /* Key/value pairs, parallel to ctrl */                           \
+    size_t capacity;        /* Number of slots, always a power of two */                      \
+    size_t count;           /* Number of live entries */                                      \
+    size_t tombstones;      /* Deleted slots still lengthening probe sequences */             \
+    const dAllocator_t* allocator; /* Allocator for the struct and slots, fixed at init */    \
+} Name##_t;                                                                                   \
+                                                                                              \
+static inline int Name##_AllocSlots(Name##_t* table, size_t capacity)                         \
+{                                                                                             \
+    uint8_t* ctrl = (uint8_t*)d_Alloc(table->allocator, capacity);                            \
+    Name##Slot_t* slots = (Name##Slot_t*)d_Alloc(table->allocator,                            \
+                                                 capacity * sizeof(Name##Slot_t));            \
+    if (!ctrl || !slots) {                                                                    \
+        d_Free(table->allocator, ctrl);                                                       \
+        d_Free(table->allocator, slots);                                                      \
+        d_LogError("Failed to allocate slots for " #Name ".");                                \
+        return 1;                                                                             \
+    }                                                                                         \
+    memset(ctrl, D_TABLE_CTRL_EMPTY, capacity);                                               \
+    table->ctrl = ctrl;                                                                       \
+    table->slots = slots;                                                                     \
+    table->capacity = capacity;                                                               \
+    table->tombstones = 0;                                                                    \
+    return 0;                                                                                 \
+}                                                                                             \
+                                                                                              \
+static inline Name##_t* Name##_InitWithAllocator(size_t initial_capacity,                     \
+                                                  const dAllocator_t* allocator)              \
+{                                                                                             \
+    if (!allocator) {                                                                         \
+        allocator = d_GetDefaultAllocator();                                                  \
+    }                                                                                         \
+    Name##_t* table = (Name##_t*)d_Calloc(allocator, 1, sizeof(Name##_t));                    \
+    if (!table) {                                                                             \
+        d_LogError("Failed to allocate memory for " #Name ".");                               \
+        return NULL;                                                                          \
+    }                                                                                         \
+    table->allocator = allocator;                                                             \
+    size_t capacity = D_TABLE_TYPED_MIN_CAPACITY;                                             \
+    while (capacity < initial_capacity) {                                                     \
+        capacity <<= 1;                                                                       \
+    }                                                                                         \
+    if (Name##_AllocSlots(table, capacity) != 0) {                                            \
+        d_Free(allocator, table);                                                             \
+        return NULL;                                                                          \
+    }                                                                                         \
+    return table;                                                                             \
+}                                                                                             \
+                                                                                              \
+static inline Name##_t* Name##_Init(size_t initial_capacity)                                  \
+{                                                                                             \
+    return Name##_InitWithAllocator(initial_capacity, NULL);                                  \
+}                                                                                             \
+                                                                                              \
+static inline int Name##_Destroy(Name##_t** table)                                            \
+{                                                                                             \
+    if (!table || !*table) {                                                                  \
+        d_LogError("Attempted to destroy NULL " #Name ".");                                   \
+        return 1;                                                                             \
+    }                                                                                         \
+    const dAllocator_t* allocator = (*table)->allocator;                                      \
+    d_Free(allocator, (*table)->ctrl);                                                        \
+    d_Free(allocator, (*table)->slots);                                                       \
+    d_Free(allocator, *table);                                                                \
+    *table = NULL;                                                                            \
+    return 0;                                                                                 \
+}                                                                                             \
+                                                                                              \
+/* Slot index holding key, or SIZE_MAX */                                                     \
+static inline size_t Name##_FindIndex(const Name##_t* table, KeyType key, size_t mixed)       \
+{                                                                                             \
+    size_t mask = table->capacity - 1;                                                        \
+    size_t index = (mixed >> 7) & mask;                                                       \
+    uint8_t tag = (uint8_t)(mixed & 0x7F);                                                    \
+    for (size_t probes = 0; probes < table->capacity; probes++) {                             \
+        uint8_t c = table->ctrl[index];                                                       \
+        if (c == D_TABLE_CTRL_EMPTY) {                                                        \
+            return SIZE_MAX;                                                                  \
+        }                                                                                     \
+        if (c == tag && eq_expr(table->slots[index].key, key)) {                              \
+            return index;                                                                     \
+        }                                                                                     \
+        index = (index + 1) & mask;                                                           \
+    }                                                                                         \
+    return SIZE_MAX;                                                                          \
+}                                                                                             \
+                                                                                              \
+/* First empty or deleted slot on key's probe sequence; the table is never full */            \
+static inline size_t Name##_FindInsertIndex(const Name##_t* table, size_t mixed)              \
+{                                                                                             \
+    size_t mask = table->capacity - 1;                                                        \
+    size_t index = (mixed >> 7) & mask;                                                       \
+    while (D_TABLE_CTRL_IS_FULL(table->ctrl[index])) {                                        \
+        index = (index + 1) & mask;                                                           \
+    }                                                                                         \
+    return index;                                                                             \
+}                                                                                             \
+                                                                                              \
+static inline int Name##_Rehash(Name##_t* table, size_t new_capacity)                         \
+{                                                                                             \
+    if (!table || new_capacity <= table->count || (new_capacity & (new_capacity - 1)) != 0) { \
+        d_LogError("Invalid capacity for " #Name " rehash (must be a power of two above count).");\
+        return 1;                                                                             \
+    }                                                                                         \
+    Name##_t old = *table;                                                                    \
+    if (Name##_AllocSlots(table, new_capacity) != 0) {                                        \
+        return 1;                                                                             \
+    }                                                                                         \
+    for (size_t i = 0; i < old.capacity; i++) {                                               \
+        if (D_TABLE_CTRL_IS_FULL(old.ctrl[i])) {                                              \
+            size_t mixed = d_HashMix(hash_expr(old.slots[i].key));                            \
+            size_t index = Name##_FindInsertIndex(table, mixed);                              \
+            table->ctrl[index] = old.ctrl[i];                                                 \
+            table->slots[index] = old.slots[i];                                               \
+        }                                                                                     \
+    }                                                                                         \
+    d_Free(table->allocator, old.ctrl);                                                       \
+    d_Free(table->allocator, old.slots);                                                      \
+    return 0;                                                                                 \
+}                                                                                             \
+                                                                                              \
+static inline int Name##_Set(Name##_t* table, KeyType key, ValueType value)                   \
+{                                                                                             \
+    size_t mixed = d_HashMix(hash_expr(key));                                                 \
+    size_t index = Name##_FindIndex(table, key, mixed);                                       \
+    if (index != SIZE_MAX) {                                                                  \
+        table->slots[index].value = value;                                                    \
+        return 0;                                                                             \
+    }                                                                                         \
+    /* Same 7/8 threshold as flat dTable_t; mostly tombstones rebuilds in place */            \
+    if ((table->count + table->tombstones + 1) * 8 > table->capacity * 7) {                   \
+        size_t new_capacity = (table->tombstones > table->count)                              \
+                              ? table->capacity : table->capacity * 2;                        \
+        if (Name##_Rehash(table, new_capacity) != 0) {                                        \
+            return 1;                                                                         \
+        }                                                                                     \
+    }                                                                                         \
+    index = Name##_FindInsertIndex(table, mixed);                                             \
+    if (table->ctrl[index] == D_TABLE_CTRL_DELETED) {                                         \
+        table->tombstones--;                                                                  \
+    }                                                                                         \
+    table->ctrl[index] = (uint8_t)(mixed & 0x7F);                                             \
+    table->slots[index].key = key;                                                            \
+    table->slots[index].value = value;                                                        \
+    table->count++;                                                                           \
+    return 0;                                                                                 \
+}                                                                                             \
+                                                                                              \
+static inline ValueType* Name##_Get(Name##_t* table, KeyType key)                             \
+{                                                                                             \
+    size_t index = Name##_FindIndex(table, key, d_HashMix(hash_expr(key)));                   \
+    return (index != SIZE_MAX) ? &table->slots[index].value : NULL;                           \
+}                                                                                             \
+                                                                                              \
+static inline int Name##_HasKey(const Name##_t* table, KeyType key)                           \
+{                                                                                             \
+    return (Name##_FindIndex(table, key, d_HashMix(hash_expr(key))) != SIZE_MAX) ? 0 : 1;     \
+}                                                                                             \
+                                                                                              \
+static inline int Name##_Remove(Name##_t* table, KeyType key)                                 \
+{                                                                                             \
+    size_t index = Name##_FindIndex(table, key, d_HashMix(hash_expr(key)));                   \
+    if (index == SIZE_MAX) {                                                                  \
+        return 1;                                                                             \
+    }                                                                                         \
+    /* An empty successor means no probe sequence runs through this slot */                   \
+    size_t next = (index + 1) & (table->capacity - 1);                                        \
+    if (table->ctrl[next] == D_TABLE_CTRL_EMPTY) {                                            \
+        table->ctrl[index] = D_TABLE_CTRL_EMPTY;                                              \
+    } else {                                                                                  \
+        table->ctrl[index] = D_TABLE_CTRL_DELETED;                                            \
+        table->tombstones++;                                                                  \
+    }                                                                                         \
+    table->count--;                                                                           \
+    return 0;                                                                                 \
+}                                                                                             \
+                                                                                              \
+static inline void Name##_Clear(Name##_t* table)                                              \
+{                                                                                             \
+    memset(table->ctrl, D_TABLE_CTRL_EMPTY, table->capacity);                                 \
+    table->count = 0;                                                                         \
+    table->tombstones = 0;                                                                    \
+}                                                                                             \
+                                                                                              \
+static inline size_t Name##_Count(const Name##_t* table)                                      \
+{                                                                                             \
+    return table->count;                                                                      \
+}
 
- /** @brief Get the current log level for a logger
-  * @param logger Logger to get level from (NULL for global logger)
-  * @return Current minimum log level for the logger
-  */
- dLogLevel_t d_GetLogLevel(dLogger_t* logger);
+/* Quad Tree */
+dQuadTree_t *d_CreateQuadtree( float *rect, int capacity );
+void d_InsertObjectInQuadtree( dQuadTree_t *tree, void *object );
+void d_SubdivideQuadtree( dQuadTree_t *tree );
 
- /** @brief Enable or disable logging globally
-  * @param enabled true to enable, false to disable
-  */
- void d_SetLoggingEnabled(bool enabled);
+/* Kinematic Body 2D  */
+void d_CreateKinmaticBody( dKinematicBody_t *output, const dVec2_t position, const dVec2_t velocity, const dVec2_t acceleration, const float mass );
 
- /** @brief Check if logging is globally enabled
-  * @return true if logging is enabled, false if disabled
-  */
- bool d_IsLoggingEnabled(void);
+/* Strings */
 
- // =============================================================================
- // LOG HANDLERS
- // =============================================================================
+/**
+ * @brief Checks if a dString_t is NULL, contains a NULL buffer, or is empty.
+ *
+ * @param s The dString_t pointer to validate.
+ * @return true if the string is considered invalid or empty, otherwise false.
+ */
+static inline bool d_IsStringInvalid(const dString_t* s)
+{
+    return (s == NULL || s->str == NULL || s->len == 0);
+}
 
- /** @brief Add a log handler to a logger
-  * @param logger Logger to add handler to (NULL for global logger)
-  * @param handler Handler function to call for each log entry
-  * @param user_data Arbitrary data passed to handler
-  */
- void d_AddLogHandler(dLogger_t* logger, dLogHandler_t handler, void* user_data);
+/**
+ * @brief Create a dString from the contents of a file
+ * 
+ * Reads the entire contents of a file into a newly allocated dString_t object.
+ * The file is opened in binary mode to ensure accurate reading across all platforms,
+ * including Windows where text mode performs newline translation.
+ * 
+ * @param filename Path to the file to read (must not be NULL)
+ * 
+ * @return A new dString_t* containing the file contents, or NULL if:
+ *         - filename is NULL
+ *         - file cannot be opened
+ *         - memory allocation fails
+ *         - file read operation fails
+ */
+dString_t* d_StringCreateFromFile(const char *filename);
 
- /** @brief Remove a log handler from a logger
-  * @param logger Logger to remove handler from (NULL for global logger)
-  * @param handler Handler function to remove
-  */
- void d_RemoveLogHandler(dLogger_t* logger, dLogHandler_t handler);
+/**
+ * @brief Create a new string builder.
+ *
+ * @return A new string builder, or NULL on allocation failure.
+ */
+dString_t *d_StringInit(void);
 
- /** @brief Built-in console log handler
-  * @param entry Log entry to output
-  * @param user_data Unused (pass NULL)
-  */
- void d_ConsoleLogHandler(const dLogEntry_t* entry, void* user_data);
+/**
+ * @brief Create a new string builder whose memory comes from `allocator` (NULL = default).
+ *
+ * @return A new string builder, or NULL on allocation failure.
+ */
+dString_t *d_StringInitWithAllocator(const dAllocator_t* allocator);
 
- /** @brief Built-in file log handler
-  * @param entry Log entry to output
-  * @param user_data FILE* to write to
-  */
- void d_FileLogHandler(const dLogEntry_t* entry, void* user_data);
+// Macro to capture file/line info for debugging
+#define d_StringDestroy(sb) \
+    _d_StringDestroy_impl(sb, __FILE__, __LINE__, __func__)
+/**
+ * @brief Destroy a string builder and free its memory.
+ * 
+ * @param sb The string builder to destroy.
+ * 
+ * @return: Success/failure indicator.
+ */
+void _d_StringDestroy_impl(dString_t* sb, const char* file, int line, const char* func);
 
- /** @brief Built-in string builder log handler
-  * @param entry Log entry to output
-  * @param user_data dString_t* to append to
-  */
- void d_StringLogHandler(const dLogEntry_t* entry, void* user_data);
+/**
+ * @brief Add a C string to the string builder. 
+ * 
+ * @param sb The string builder to append to.
+ * @param str The string to append (must be null-terminated if len is 0).
+ * @param len The length of string to append, or 0 to use strlen().
+ * 
+ * @return: Success/failure indicator.
+ */
+void d_StringAppend(dString_t* sb, const char* str, size_t len);
 
- // =============================================================================
- // LOG CONTEXTS
- // =============================================================================
+/**
+ * @brief Set the content of an existing dString_t to a new value.
+ *
+ * @param string: Pointer to existing dString_t structure.
+ * @param content: C-string content to copy into the dString_t.
+ * 
+ * @return: Success/failure indicator.
+ */
+int d_StringSet(dString_t* string, const char* content);
 
- /** @brief Push a new logging context onto the stack
-  * @param name Context name (e.g., "Physics", "Renderer")
-  * @return Context handle, or NULL on error
-  */
- dLogContext_t* d_PushLogContext(const char* name);
+/**
+ * @brief Create a new string builder with the same content as another string.
+ *
+ * @param source The string to copy content from.
+ *
+ * @return A new string builder with the same content as the source, or NULL on error.
+ */
+dString_t* d_StringClone(const dString_t* source);
 
- /** @brief Pop a logging context from the stack
-  * @param context Context handle from d_PushLogContext()
-  */
- void d_PopLogContext(dLogContext_t* context);
+/**
+ * @brief Negatively Append, removing content from the end of the string.
+ * 
+ * @param sb The string builder to remove from.
+ * @param count The number of characters to remove.
+ */
+void d_StringAppendN(dString_t* sb, const char* str, size_t max_len);
 
- /** @brief Log the execution time of a context when popped
-  * @param context Context to enable timing for
+/**
+ * @brief Add a single character to the string builder.
+ * 
+ * @param sb The string builder to append to.
+ * @param c The character to append.
+ */
+void d_StringAppendChar(dString_t* sb, char c);
+/**
+ * @brief Add an integer to the string builder as a decimal string.
+ * 
+ * @param sb The string builder to append to.
+ * @param val The integer value to append.
+ 
+ */
+void d_StringAppendInt(dString_t* sb, int val);
+/**
+ * @brief Add a floating-point number to the string builder.
+ * 
+ * @param sb The string builder to append to.
+ * @param val The floating-point value to append.
+ * @param decimals The number of decimal places to show (0-10).
+ * 
+ * @return Success/failure indicator.
+ */
+void d_StringAppendFloat(dString_t* sb, float val, int decimals);
+/**
+ * @brief Clear the string builder content.
+ * 
+ * @param sb The string builder to clear.
+ *
+ * @return Success/failure indicator.
+ */
+void d_StringClear(dString_t* sb);
+/*
+ * Truncate the string builder to a specific length
+ *
+ * `sb` - Pointer to string builder
+ * `len` - New length (must be <= current length)
+ *
+ * -- Does nothing if sb is NULL or len >= current length
+ * -- Memory is not freed, only the length is reduced
+ * -- The string remains null-terminated at the new length
+ */
+void d_StringTruncate(dString_t* sb, size_t len);
+/*
+ * Remove characters from the beginning of the string builder
+ *
+ * `sb` - Pointer to string builder
+ * `len` - Number of characters to remove from the beginning
+ *
+ * -- Does nothing if sb is NULL or len is 0
+ * -- If len >= current length, the string builder is cleared completely
+ * -- Uses memmove for safe overlapping memory operation
+ */
+void d_StringDrop(dString_t* sb, size_t len);
+/*
+ * Get the current length of the string builder content
+ *
+ * `sb` - Pointer to string builder
+ *
+ * `size_t` - Current length in characters, or 0 if sb is NULL
+ *
+ * -- Return value does not include the null terminator
+ * -- Safe to call with NULL pointer (returns 0)
+ */
+size_t d_StringGetLength(const dString_t* sb);
+
+// User calls d_StringPeek(sb) - macro captures their location
+#define d_StringPeek(sb) \
+    _d_StringPeek_impl(sb, __FILE__, __LINE__, __func__)
+// Actual function declaration (note the underscore prefix)
+/**
+ * @brief Get the internal C string without copying
+ * 
+ * @param sb String builder
+ * 
+ * @return Pointer to internal string, or NULL if sb is NULL
+ */
+const char* _d_StringPeek_impl(const dString_t* sb, const char* file, int line, const char* func);
+
+/**
+ * @brief Dump the string builder content to a newly allocated C string.
+ * 
+ * @param sb String builder to dump
+ * @param len Pointer to size_t to receive length of dumped string (excluding null terminator)
+ * 
+ * @return Newly allocated C string containing the content, or NULL on failure
+ * 
+ */
+char *d_StringDump(const dString_t* sb, size_t* len);
+
+/**
+ * @brief Append formatted text to string builder using printf-style format specifiers
+ * 
+ * @param sb String builder to append to
+ * @param format Format string with %s, %d, %f, etc.
+ * @param ... Variable arguments corresponding to format specifiers
+ */
+void d_StringFormat(dString_t* sb, const char* format, ...);
+
+/**
+ * @brief Perform template string substitution replacing {key} placeholders with values
+ * 
+ * @param sb String builder to append result to
+ * @param tmplt Template string containing {key} placeholders
+ * @param keys Array of key strings to match
+ * @param values Array of replacement values
+ * @param count Number of key-value pairs
+ */
+void d_StringTemplate(dString_t* sb, const char* tmplt, const char* keys[], const char* values[], int count);
+/*
+ * Add an ASCII progress bar to the string builder
+ *
+ * `sb` - Pointer to string builder
+ * `current` - Current progress value
+ * `max` - Maximum progress value
+ * `width` - Width of the progress bar (excluding brackets)
+ * `fill_char` - Character to use for filled portions
+ * `empty_char` - Character to use for empty portions
+ *
+ * -- Does nothing if sb is NULL, width <= 0, or max <= 0
+ * -- Progress bar format: [████████----] where █ is fill_char and - is empty_char
+ * -- If current > max, the bar is filled completely
+ * -- If current < 0, the bar is empty
+ * -- Total visual width is width + 2 (for brackets)
+ */
+void d_StringAppendProgressBar(dString_t* sb, int current, int max, int width, char fill_char, char empty_char);
+/*
+  * Add text padded to the center with specified character to reach target width
+  *
+  * `sb` - Pointer to string builder
+  * `text` - Text to center (must be null-terminated)
+  * `width` - Target total width including padding
+  * `pad_char` - Character to use for padding
+  *
+  * -- Does nothing if sb or text is NULL
+  * -- If text length >= width, adds text without padding
+  * -- Text is centered with padding distributed evenly on both sides
+  * -- If padding cannot be evenly distributed, left side gets one less character
+  * -- Example: d_StringPadCenter(sb, "Hi", 6, '.') produces "..Hi.."
+  * -- Example: d_StringPadCenter(sb, "Hi", 7, '.') produces "..Hi..."
+  * -- Commonly used for centered headers and titles in ASCII interfaces
   */
- void d_LogContext_EnableTiming(dLogContext_t* context);
+void d_StringPadCenter(dString_t* sb, const char* text, int width, char pad_char);
+/*
+  * Add text padded to the left with specified character to reach target width
+  *
+  * `sb` - Pointer to string builder
+  * `text` - Text to pad (must be null-terminated)
+  * `width` - Target total width including padding
+  * `pad_char` - Character to use for padding
+  *
+  * -- Does nothing if sb or text is NULL
+  * -- If text length >= width, adds text without padding
+  * -- Padding is added to the left side of the text
+  * -- Example: d_StringPadLeft(sb, "Hi", 5, '.') produces "...Hi"
+  * -- Commonly used for right-aligned text in tables and menus
+  */
+void d_StringPadLeft(dString_t* sb, const char* text, int width, char pad_char);
+/*
+  * Add text padded to the right with specified character to reach target width
+
+  * `sb` - Pointer to string builder
+  * `text` - Text to pad (must be null-terminated)
+  * `width` - Target total width including padding
+  * `pad_char` - Character to use for padding
+  *
+  * -- Does nothing if sb or text is NULL
+  * -- If text length >= width, adds text without padding
+  * -- Padding is added to the right side of the text
+  * -- Example: d_StringPadRight(sb, "Hi", 5, '.') produces "Hi..."
+  * -- Commonly used for left-aligned text in tables and menus
+  */
+void d_StringPadRight(dString_t* sb, const char* text, int width, char pad_char);
+/*
+ * Add repeated characters to the string builder
+ *
+ * `sb` - Pointer to string builder
+ * `character` - Character to repeat
+ * `count` - Number of times to repeat the character
+ *
+ * -- Does nothing if sb is NULL or count <= 0
+ * -- Efficiently adds multiple copies of the same character
+ * -- Used internally by progress bar and padding functions
+ */
+void d_StringRepeat(dString_t* sb, char character, int count);
+
+// Pythonic String Utils
+/*
+  * Join an array of strings with a separator (like Python's str.join())
+  *
+  * `sb` - Pointer to string builder
+  * `strings` - Array of string pointers to join
+  * `count` - Number of strings in the array
+  * `separator` - String to insert between each element
+  *
+  * -- Does nothing if sb is NULL or count <= 0
+  * -- If strings array is NULL, does nothing
+  * -- NULL strings in the array are treated as empty strings
+  * -- If separator is NULL, strings are joined without separation
+  * -- Example: d_StringJoin(sb, {"a", "b", "c"}, 3, ", ") produces "a, b, c"
+  * -- Commonly used for creating comma-separated lists, file paths, etc.
+  */
+void d_StringJoin(dString_t* sb, const char** strings, int count, const char* separator);
+
+/**
+ * @brief Slice text and append a substring slice with Python-style indexing
+ * @param sb String builder to append result to
+ * @param text Source text to slice
+ * @param start Start index (negative counts from end)
+ * @param end End index, exclusive (negative counts from end)
+ */
+void d_StringSlice(dString_t* sb, const char* text, int start, int end);
+
+/*
+ * Compare two dString_t objects lexicographically
+ *
+ * `str1` - The first Daedalus string object
+ * `str2` - The second Daedalus string object
+ *
+ * `int` - An integer less than, equal to, or greater than zero if str1 is found,
+ * respectively, to be less than, to match, or be greater than str2
+ *
+ * -- If both are the same kind of invalid, consider them equal
+ * -- If one is invalid and the other is not, they are not equal
+ * -- Invalid str1 is considered "less than" valid str2
+ * -- Valid str1 is considered "greater than" invalid str2
+ * -- Uses strcmp() for lexicographical comparison of valid strings
+ */
+int d_StringCompare(const dString_t* str1, const dString_t* str2);
+
+/*
+ * Compare a dString_t with a standard C-string
+ *
+ * `d_str` - The Daedalus string object to compare
+ * `c_str` - The standard null-terminated C-string to compare against
+ *
+ * `int` - An integer less than, equal to, or greater than zero if d_str is found,
+ * respectively, to be less than, to match, or be greater than c_str
+ *
+ * -- An invalid dString and a NULL/empty C-string are considered "equal"
+ * -- Invalid d_str is considered "less than" a valid c_str
+ * -- Valid d_str is considered "greater than" a NULL c_str
+ * -- Uses strcmp() for lexicographical comparison when both are valid
+ * -- Avoids need to create temporary dString_t for comparison
+ * -- Critical for performance when interfacing with external C-strings
+ */
+int d_StringCompareToCString(const dString_t* d_str, const char* c_str);
+
+
+/* Dynamic Arrays */
+/*
+ * Create a new dynamic array with specified capacity and element size
+ *
+ * `capacity` - Initial number of elements the array can hold
+ * `element_size` - Size in bytes of each element (e.g., sizeof(int))
+ *
+ * `dArray_t*` - Pointer to new dynamic array, or NULL on allocation failure
+ *
+ * -- Must be destroyed with d_DestroyArray() to free memory
+ * -- Initial count is 0 even though capacity may be larger
+ * -- Elements can be any type as long as element_size is correct
+ * -- Capacity of 0 is allowed but array cannot store elements until resized
+ */
+
+ /* Logging System */
+
+ // =============================================================================
+ // CORE LOGGING FUNCTIONS
+ // =============================================================================
+
+ /** @brief Log a message at the specified level
+  * @param level Log level (DEBUG, INFO, WARNING, ERROR, FATAL)
+  * @param message Message string to log
+  */
+ void d_Log(dLogLevel_t level, const char* message);
+
+ /** @brief Log a formatted message at the specified level (printf-style)
+  * @param level Log level (DEBUG, INFO, WARNING, ERROR, FATAL)
+  * @param format Printf-style format string
+  * @param ... Variable arguments for format specifiers
+  */
+ void d_LogF(dLogLevel_t level, const char* format, ...);
+
+ /** @brief Log with explicit file/line/function information
+  * @param level Log level
+  * @param file Source file path
+  * @param line Line number
+  * @param func Function name
+  * @param message Message to log
+  */
+ void d_LogEx(dLogLevel_t level, const char* file, int line, const char* func, const char* message);
+
+ /** @brief Log with explicit file/line/function and formatting
+  * @param level Log level
+  * @param file Source file path
+  * @param line Line number
+  * @param func Function name
+  * @param format Printf-style format string
+  * @param ... Variable arguments
+  */
+ void d_LogExF(dLogLevel_t level, const char* file, int line, const char* func, const char* format, ...);
+
+ // =============================================================================
+ // CONVENIENCE LOGGING FUNCTIONS
+ // =============================================================================
+
+ /** @brief Log a debug message
+  * @param message Message to log
+  */
+ void d_LogDebug(const char* message);
+
+ /** @brief Log an info message
+  * @param message Message to log
+  */
+ void d_LogInfo(const char* message);
+
+ /** @brief Log a warning message
+  * @param message Message to log
+  */
+ void d_LogWarning(const char* message);
+
+ /** @brief Log an error message
+  * @param message Message to log
+  */
+ void d_LogError(const char* message);
+
+ /** @brief Log a fatal message
+  * @param message Message to log
+  */
+ void d_LogFatal(const char* message);
+
+ /** @brief Log a formatted debug message
+  * @param format Printf-style format string
+  * @param ... Variable arguments
+  */
+ void d_LogDebugF(const char* format, ...);
+
+ /** @brief Log a formatted info message
+  * @param format Printf-style format string
+  * @param ... Variable arguments
+  */
+ void d_LogInfoF(const char* format, ...);
+
+ /** @brief Log a formatted warning message
+  * @param format Printf-style format string
+  * @param ... Variable arguments
+  */
+ void d_LogWarningF(const char* format, ...);
+
+ /** @brief Log a formatted error message
+  * @param format Printf-style format string
+  * @param ... Variable arguments
+  */
+ void d_LogErrorF(const char* format, ...);
+
+ /** @brief Log a formatted fatal message
+  * @param format Printf-style format string
+  * @param ... Variable arguments
+  */
+ void d_LogFatalF(const char* format, ...);
+
+ // =============================================================================
+ // LOGGER MANAGEMENT
+ // =============================================================================
+
+ /** @brief Create a new logger with the specified configuration
+  * @param config Logger configuration settings
+  * @return Pointer to new logger, or NULL on allocation failure
+  */
+ dLogger_t* d_CreateLogger(dLogConfig_t config);
+
+ /** @brief Destroy a logger and free all associated resources
+  * @param logger Pointer to logger to destroy
+  */
+ void d_DestroyLogger(dLogger_t* logger);
+
+ /** @brief Set a logger as the global default logger
+  * @param logger Logger to set as global (can be NULL to disable)
+  */
+ void d_SetGlobalLogger(dLogger_t* logger);
+
+ /** @brief Get the current global logger
+  * @return Pointer to global logger, or NULL if none set
+  */
+ dLogger_t* d_GetGlobalLogger(void);
+
+ // =============================================================================
+ // CONFIGURATION
+ // =============================================================================
+
+ /** @brief Set the minimum log level for a logger
+  * @param logger Logger to configure (NULL for global logger)
+  * @param level Minimum level to log
+  */
+ void d_SetLogLevel(dLogger_t* logger, dLogLevel_t level);
+
+ /** @brief Get the current log level for a logger
+  * @param logger Logger to get level from (NULL for global logger)
+  * @return Current minimum log level for the logger
+  */
+ dLogLevel_t d_GetLogLevel(dLogger_t* logger);
+
+ /** @brief Enable or disable logging globally
+  * @param enabled true to enable, false to disable
+  */
+ void d_SetLoggingEnabled(bool enabled);
+
+ /** @brief Check if logging is globally enabled
+  * @return true if logging is enabled, false if disabled
+  */
+ bool d_IsLoggingEnabled(void);
+
+ // =============================================================================
+ // LOG HANDLERS
+ // =============================================================================
+
+ /** @brief Add a log handler to a logger
+  * @param logger Logger to add handler to (NULL for global logger)
+  * @param handler Handler function to call for each log entry
+  * @param user_data Arbitrary data passed to handler
+  */
+ void d_AddLogHandler(dLogger_t* logger, dLogHandler_t handler, void* user_data);
+
+ /** @brief Remove a log handler from a logger
+  * @param logger Logger to remove handler from (NULL for global logger)
+  * @param handler Handler function to remove
+  */
+ void d_RemoveLogHandler(dLogger_t* logger, dLogHandler_t handler);
+
+ /** @brief Built-in console log handler
+  * @param entry Log entry to output
+  * @param user_data Unused (pass NULL)
+  */
+ void d_ConsoleLogHandler(const dLogEntry_t* entry, void* user_data);
+
+ /** @brief Built-in file log handler
+  * @param entry Log entry to output
+  * @param user_data FILE* to write to
+  */
+ void d_FileLogHandler(const dLogEntry_t* entry, void* user_data);
+
+ /** @brief Built-in string builder log handler
+  * @param entry Log entry to output
+  * @param user_data dString_t* to append to
+  */
+ void d_StringLogHandler(const dLogEntry_t* entry, void* user_data);
+
+ // =============================================================================
+ // LOG CONTEXTS
+ // =============================================================================
+
+ /** @brief Push a new logging context onto the stack
+  * @param name Context name (e.g., "Physics", "Renderer")
+  * @return Context handle, or NULL on error
+  */
+ dLogContext_t* d_PushLogContext(const char* name);
+
+ /** @brief Pop a logging context from the stack
+  * @param context Context handle from d_PushLogContext()
+  */
+ void d_PopLogContext(dLogContext_t* context);
+
+ /** @brief Log the execution time of a context when popped
+  * @param context Context to enable timing for
+  */
+ void d_LogContext_EnableTiming(dLogContext_t* context);
+
+ // =============================================================================
+ // THROTTLED LOGGING - Per-Call-Site Rate Limiting
+ // =============================================================================
+
+ /** @brief Log with per-call-site throttling (Debug level)
+  * @param interval Minimum seconds between logs at this call site
+  * @param fmt Printf-style format string
+  * @param ... Variable arguments
+  */
+ #define d_LogDebugF_Throttle(interval, fmt, ...) do { \
+     static double _throttle_last = 0; \
+     double _throttle_now = d_GetTimestamp(); \
+     if (_throttle_now - _throttle_last >= (interval)) { \
+         _throttle_last = _throttle_now; \
+         d_LogDebugF(fmt, ##__VA_ARGS__); \
+     } \
+ } while(0)
+
+ /** @brief Log with per-call-site throttling (Info level)
+  * @param interval Minimum seconds between logs at this call site
+  * @param fmt Printf-style format string
+  * @param ... Variable arguments
+  */
+ #define d_LogInfoF_Throttle(interval, fmt, ...) do { \
+     static double _throttle_last = 0; \
+     double _throttle_now = d_GetTimestamp(); \
+     if (_throttle_now - _throttle_last >= (interval)) { \
+         _throttle_last = _throttle_now; \
+         d_LogInfoF(fmt, ##__VA_ARGS__); \
+     } \
+ } while(0)
+
+ /** @brief Log with per-call-site throttling (Warning level)
+  * @param interval Minimum seconds between logs at this call site
+  * @param fmt Printf-style format string
+  * @param ... Variable arguments
+  */
+ #define d_LogWarningF_Throttle(interval, fmt, ...) do { \
+     static double _throttle_last = 0; \
+     double _throttle_now = d_GetTimestamp(); \
+     if (_throttle_now - _throttle_last >= (interval)) { \
+         _throttle_last = _throttle_now; \
+         d_LogWarningF(fmt, ##__VA_ARGS__); \
+     } \
+ } while(0)
+
+ /** @brief Log with per-call-site throttling (Error level)
+  * @param interval Minimum seconds between logs at this call site
+  * @param fmt Printf-style format string
+  * @param ... Variable arguments
+  */
+ #define d_LogErrorF_Throttle(interval, fmt, ...) do { \
+     static double _throttle_last = 0; \
+     double _throttle_now = d_GetTimestamp(); \
+     if (_throttle_now - _throttle_last >= (interval)) { \
+         _throttle_last = _throttle_now; \
+         d_LogErrorF(fmt, ##__VA_ARGS__); \
+     } \
+ } while(0)
+
+ /** @brief Log with per-call-site throttling (Fatal level)
+  * @param interval Minimum seconds between logs at this call site
+  * @param fmt Printf-style format string
+  * @param ... Variable arguments
+  */
+ #define d_LogFatalF_Throttle(interval, fmt, ...) do { \
+     static double _throttle_last = 0; \
+     double _throttle_now = d_GetTimestamp(); \
+     if (_throttle_now - _throttle_last >= (interval)) { \
+         _throttle_last = _throttle_now; \
+         d_LogFatalF(fmt, ##__VA_ARGS__); \
+     } \
+ } while(0)
+
+ // =============================================================================
+ // UTILITY FUNCTIONS
+ // =============================================================================
+
+ /** @brief Get string representation of log level
+  * @param level Log level enum value
+  * @return String like "DEBUG", "INFO", etc. Returns "UNKNOWN" for invalid levels
+  */
+ const char* d_LogLevel_ToString(dLogLevel_t level);
+
+ /** @brief Parse log level from string
+  * @param str String like "DEBUG", "INFO", etc. Case-insensitive
+  * @return Parsed level, or D_LOG_LEVEL_INFO on error
+  */
+ dLogLevel_t d_LogLevel_FromString(const char* str);
+
+ /** @brief Get ANSI color code for log level
+  * @param level Log level
+  * @return ANSI escape sequence, or empty string if colors disabled
+  */
+ const char* d_LogLevel_GetColor(dLogLevel_t level);
+
+ /** @brief Get color reset sequence
+  * @return ANSI reset sequence, or empty string if colors disabled
+  */
+ const char* d_LogLevel_GetColorReset(void);
+
+ /** @brief Get gaming-themed prefix for log level
+  * @param level Log level
+  * @return Prefix string like "[DEBUG]", "[INFO] ", etc.
+  */
+ const char* d_LogLevel_GetGamePrefix(dLogLevel_t level);
+
+ /** @brief Get current timestamp as Unix time
+  * @return Current time in seconds since epoch
+  */
+ double d_GetTimestamp(void);
+
+ /** @brief Format timestamp into string
+  * @param buffer Output buffer
+  * @param buffer_size Size of buffer
+  * @param timestamp Unix timestamp
+  * @param format strftime format string (NULL for ISO-8601)
+  */
+ void d_FormatTimestamp(char* buffer, size_t buffer_size, double timestamp, const char* format);
+
+ // =============================================================================
+ // ZERO-OVERHEAD MACROS
+ // =============================================================================
+
+ // These macros provide zero overhead when logging is disabled at compile time
+ // They automatically capture file, line, and function information
+
+ #ifndef D_LOG_CURRENT_FILE_ID
+     #define D_LOG_CURRENT_FILE_ID (__COUNTER__)
+ #endif
+
+ #ifdef D_LOGGING_ENABLED
+     #define D_LOG(level, msg) \
+         do { \
+             extern dLogGlobalConfig_t g_log_config; \
+             if ((level) >= g_log_config.file_log_levels[D_LOG_CURRENT_FILE_ID]) { \
+                 d_LogEx(level, __FILE__, __LINE__, __func__, msg); \
+             } \
+         } while(0)
+
+     #define D_LOGF(level, fmt, ...) \
+         do { \
+             extern dLogGlobalConfig_t g_log_config; \
+             if ((level) >= g_log_config.file_log_levels[D_LOG_CURRENT_FILE_ID]) { \
+                 d_LogExF(level, __FILE__, __LINE__, __func__, fmt, __VA_ARGS__); \
+             } \
+         } while(0)
+ #else
+     #define D_LOG(level, msg) ((void)0)
+     #define D_LOGF(level, fmt, ...) ((void)0)
+ #endif
+
+ // Convenience macros for common log levels
+ #define D_LOG_DEBUG(msg) D_LOG(D_LOG_LEVEL_DEBUG, msg)
+ #define D_LOG_INFO(msg) D_LOG(D_LOG_LEVEL_INFO, msg)
+ #define D_LOG_WARNING(msg) D_LOG(D_LOG_LEVEL_WARNING, msg)
+ #define D_LOG_ERROR(msg) D_LOG(D_LOG_LEVEL_ERROR, msg)
+ #define D_LOG_FATAL(msg) D_LOG(D_LOG_LEVEL_FATAL, msg)
+
+ #define D_LOG_DEBUGF(fmt, ...) D_LOGF(D_LOG_LEVEL_DEBUG, fmt, __VA_ARGS__)
+ #define D_LOG_INFOF(fmt, ...) D_LOGF(D_LOG_LEVEL_INFO, fmt, __VA_ARGS__)
+ #define D_LOG_WARNINGF(fmt, ...) D_LOGF(D_LOG_LEVEL_WARNING, fmt, __VA_ARGS__)
+ #define D_LOG_ERRORF(fmt, ...) D_LOGF(D_LOG_LEVEL_ERROR, fmt, __VA_ARGS__)
+ #define D_LOG_FATALF(fmt, ...) D_LOGF(D_LOG_LEVEL_FATAL, fmt, __VA_ARGS__)
+
+ // Builder pattern macro
+ #define D_LOG_BUILD(level) d_LogBegin(level)
+
+ // Timed block macro
+ #define D_LOG_TIMED_BLOCK(name) \
+     for (dLogContext_t* _ctx = d_PushLogContext(name); _ctx; d_PopLogContext(_ctx), _ctx = NULL) \
+         for (d_LogContext_EnableTiming(_ctx); _ctx; _ctx = NULL)
+
+/**
+ * @brief Initialize a Dynamic Array.
+ * 
+ * @param capacity The initial capacity of the array in elements.
+ * @param element_size The size of each element in bytes.
+ * 
+ * @return A pointer to the new array, or NULL on error.
+ * 
+ * -- Must be destroyed with d_DestroyArray() to free memory
+ * -- Initial count is 0 even though capacity may be larger
+ * -- Elements can be any type as long as element_size is correct
+ * -- Capacity of 0 is allowed but array cannot store elements until resized
+ * 
+ * Example: `dArray_t* array = d_ArrayInit(10, sizeof(int));`
+ * This creates a new array with a capacity of 10 elements, each of size 4 bytes.
+ */
+dArray_t* d_ArrayInit( size_t capacity, size_t element_size );
+
+/**
+ * @brief Initialize a Dynamic Array whose memory comes from `allocator`.
+ *
+ * @param capacity The initial capacity of the array in elements.
+ * @param element_size The size of each element in bytes.
+ * @param allocator Allocator for the array and every resize (NULL = current default).
+ *
+ * @return A pointer to the new array, or NULL on error.
+ *
+ * -- Behaves exactly like d_ArrayInit otherwise
+ *
+ * Example: `dArray_t* array = d_ArrayInitWithAllocator(10, sizeof(int), arena);`
+ */
+dArray_t* d_ArrayInitWithAllocator( size_t capacity, size_t element_size, const dAllocator_t* allocator );
+
+/**
+ * @brief Destroy a dynamic array.
+ * 
+ * @param array The array to destroy.
+ * 
+ * @return: 0 on success, 1 on failure.
+ * 
+ * -- Frees both the data buffer and the array structure itself
+ * -- After calling this function, the pointer is invalid and should not be used
+ * 
+ * Example: `d_ArrayDestroy(array);`
+ * This destroys the dynamic array and frees its memory.
+ */
+int d_ArrayDestroy( dArray_t* array );
+
+/**
+ * @brief Resize the internal data buffer of a dynamic array.
+ *
+ * This function adjusts the allocated memory for the array's elements.
+ *
+ * @param array A pointer to the dynamic array whose internal buffer is to be resized.
+ * @param new_size_in_bytes The desired new total size of the internal data buffer in bytes.
+ * This will determine the new capacity in elements.
+ *
+ * @return 0 on success, 1 on failure.
+ *
+ * @note If `new_size_in_bytes` is 0, the internal data buffer will be freed, and the array's
+ * capacity and count will be reset to 0.
+ * @note If `new_size_in_bytes` is larger than the current allocated size, the data buffer
+ * is reallocated, potentially moving to a new memory location. Existing data (up to
+ * the old capacity) is preserved.
+ * @note If `new_size_in_bytes` is smaller than the current allocated size, the data buffer
+ * is truncated. If the current `count` of elements exceeds the new capacity, `count`
+ * will be adjusted down to match the new capacity, effectively truncating the array's
+ * contents.
+ * @warning This function only affects the internal data buffer (`array->data`). The `dArray_t* array`
+ * pointer itself remains valid and points to the same `dArray_t` structure.
+ * Pointers obtained previously via `d_IndexDataFromArray` (or similar direct access)
+ * will become invalid if the underlying `array->data` buffer is reallocated and moved.
+ *
+ * Example: `d_ArrayResize(myArray, 10 * sizeof(int));`
+ * This resizes the internal buffer of `myArray` to accommodate 10 integer elements.
+ * If `myArray` previously held more than 10 elements, its `count` will be truncated.
+ */
+int d_ArrayResize( dArray_t* array, size_t new_capacity );
+
+/**
+ * @brief Grow the array by a number of additional bytes.
+ * 
+ * @param array The array to grow.
+ * @param additional_bytes The number of bytes to add.
+ * 
+ * @return 0 on success, 1 on failure.
+ * 
+ * -- Convenience function that calls d_ArrayResize() internally
+ * 
+ * Example: `d_ArrayGrow(array, 10 * sizeof(int));`
+ * This grows the dynamic array by 10 elements, each of size 4 bytes.
+ */
+int d_ArrayGrow( dArray_t* array, size_t additional_capacity );
+
+/**
+ * @brief Append an element to the end of the dynamic array.
+ *
+ * This function adds a new element to the array. If the array's current capacity
+ * is insufficient, it will automatically grow to accommodate the new element,
+ * typically by doubling its capacity.
+ *
+ * @param array A pointer to the dynamic array to append to.
+ * @param data A pointer to the element data to copy into the array.
+ * The data pointed to will be copied by `element_size` bytes.
+ *
+ * @return 0 on success, 1 on failure.
+ *
+ * @note Fails if `array` or `data` is NULL.
+ * @note If the array's capacity is reached, it will attempt to grow its
+ * internal buffer. If reallocation fails, the append operation will fail.
+ * @note Copies `element_size` bytes from the `data` pointer into the array.
+ * @note Increments the array's `count` on successful append.
+ *
+ * Example: `int my_value = 123; int result = d_ArrayAppend(myArray, &my_value);`
+ * This appends an integer value to the end of `myArray`.
+ */
+int d_ArrayAppend( dArray_t* array, void* data );
+
+/**
+ * @brief Get a pointer to the data at a specific index.
+ * 
+ * @param array The array to get data from.
+ * @param index The index of the element to get.
+ * 
+ * @return A pointer to the element data, or NULL if index is out of bounds.
+ * 
+ * -- Returns NULL if array is NULL or index >= count
+ * -- Returned pointer is valid until the array is modified or destroyed
+ * -- Caller can read/write through the returned pointer safely
+ * -- Use appropriate casting: int* ptr = (int*)d_ArrayGet(array, 0)
+ * -- Index must be less than count, not capacity (only counts appended elements)
+ * 
+ * Example: `void* data = d_ArrayGet(array, 0);`
+ * This retrieves the first element from the dynamic array.
+ */
+void* d_ArrayGet(dArray_t* array, size_t index);
+
+/**
+ * @brief Remove and return the last element from the array.
+ *
+ * @param array The array to pop from.
+ *
+ * @return A pointer to the last element's data, or NULL if array is empty.
+ *
+ * -- Decrements count but does not free memory (element data remains in buffer)
+ * -- Returned pointer becomes invalid after next append or array modification
+ * -- Implements stack-like behavior for dynamic arrays
+ * -- Memory is not reallocated, only the count is decremented for efficiency
+ *
+ * Example: `void* data = d_ArrayPop(array);`
+ * This removes and returns the last element from the dynamic array.
+ */
+void* d_ArrayPop(dArray_t* array);
+
+/**
+ * @brief Clear all elements from the array (sets count to 0).
+ *
+ * @param array The array to clear.
+ *
+ * @return 0 on success, 1 on error.
+ *
+ * -- Sets count to 0 but does not free memory or reduce capacity
+ * -- Element data remains in buffer but is considered removed
+ * -- More efficient than destroying and recreating the array
+ * -- Can reuse the cleared array immediately with d_ArrayAppend
+ *
+ * Example: `d_ArrayClear(array);`
+ * This removes all elements from the array without deallocating memory.
+ */
+int d_ArrayClear(dArray_t* array);
+
+/**
+ * @brief Insert data at a specific index in the array
+ * 
+ * @param array The array to insert into
+ * @param data Pointer to the data to insert
+ * @param index The index where to insert the data
+ * 
+ * @return 0 on success, 1 on failure
+ * 
+ * -- Shifts existing elements to the right to make space
+ * -- Grows the array capacity if needed
+ * -- index must be <= array->count (can insert at end)
+ * -- Uses memmove for safe overlapping memory operations
+ * 
+ * Example: `d_ArrayInsert(array, &value, 2);`
+ * This inserts a value at index 2, shifting existing elements to the right.
+ */
+int d_ArrayInsert(dArray_t* array, void* data, size_t index);
+
+/**
+ * @brief Remove data at a specific index from the array
+ *
+ * @param array The array to remove from
+ * @param index The index of the element to remove
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * -- Shifts existing elements to the left to fill the gap
+ * -- Does not resize the array capacity (use d_ArrayTrimCapacity for that)
+ * -- index must be < array->count
+ * -- Uses memmove for safe overlapping memory operations
+ *
+ * Example: `d_ArrayRemove(array, 2);`
+ * This removes the element at index 2, shifting remaining elements to the left.
+ */
+int d_ArrayRemove(dArray_t* array, size_t index);
+
+/**
+ * @brief Clear all elements from the array without deallocating memory
+ *
+ * @param array The array to clear
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * -- Sets count to 0, preserving capacity for efficient reuse
+ * -- O(1) operation - no memory operations performed
+ * -- Does not zero memory or shrink capacity
+ * -- Ideal for clearing collections that will be reused (hands, queues, temp buffers)
+ *
+ * Example: `d_ClearArray(array);`
+ * This clears all elements from the array, resetting count to 0 while keeping capacity.
+ */
+int d_ClearArray(dArray_t* array);
+
+/**
+ * @brief Optimize memory usage by shrinking the array's capacity to match its count
+ *
+ * @param array The array to trim
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * -- Reduces allocated memory to exactly match the number of elements
+ * -- If array is empty, frees the data buffer
+ * -- Does nothing if array is already optimally sized
+ * -- Useful after bulk removal operations to reclaim memory
+ *
+ * Example: `d_ArrayTrimCapacity(array);`
+ * This trims the array's capacity to match its count, freeing memory if necessary.
+ */
+int d_ArrayTrimCapacity(dArray_t* array);
+
+/**
+ * @brief Ensure the array has enough capacity for at least min_capacity elements
+ *
+ * @param array The array to ensure capacity for
+ * @param min_capacity Minimum number of elements the array should accommodate
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * -- Grows the array if current capacity is less than min_capacity
+ * -- Uses exponential growth strategy to minimize reallocations
+ * -- Never shrinks the array - use d_ArrayTrimCapacity for that
+ * -- Useful for pre-allocating space before bulk operations
+ *
+ * Example: `d_ArrayEnsureCapacity(array, 100);`
+ * This ensures the array has at least 100 elements allocated, growing the array if needed.
+ */
+int d_ArrayEnsureCapacity(dArray_t* array, size_t min_capacity);
+
+
+/* --- Static Arrays --- */
+
+
+/**
+ * @brief Initialize a new static array with fixed capacity
+ *
+ * @param capacity: Maximum number of elements the array can hold
+ * @param element_size: Size of each element in bytes
+ * 
+ * @return: Pointer to new static array, or NULL on allocation failure
+ *
+ * -- Allocates memory for both the structure and the data buffer
+ * -- Data buffer size = capacity * element_size
+ * -- count is initialized to 0
+ * -- capacity and element_size are fixed for the lifetime of the array
+ * 
+ * Example: `dStaticArray_t* array = d_InitStaticArray(10, sizeof(int));`
+ * This creates a new static array with a capacity of 10 elements, each of size 4 bytes.
+ */
+dStaticArray_t* d_InitStaticArray(size_t capacity, size_t element_size);
+
+/**
+ * @brief Initialize a new static array whose memory comes from `allocator`
+ *
+ * @param capacity: Maximum number of elements the array can hold
+ * @param element_size: Size of each element in bytes
+ * @param allocator: Allocator for the structure and data buffer (NULL = current default)
+ *
+ * @return: Pointer to new static array, or NULL on allocation failure
+ *
+ * Example: `dStaticArray_t* array = d_InitStaticArrayWithAllocator(10, sizeof(int), arena);`
+ */
+dStaticArray_t* d_InitStaticArrayWithAllocator(size_t capacity, size_t element_size, const dAllocator_t* allocator);
+
+/**
+ * @brief: Destroy a static array and free all associated memory
+ *
+ * @param array: Pointer to static array to destroy
+ * @return: 0 on success, 1 on failure
+ *
+ * -- Safe to call with NULL pointer
+ * -- Frees data buffer first, then structure
+ * -- After calling, the pointer becomes invalid
+ * 
+ * Example: `d_StaticArrayDestroy(array);`
+ * This destroys the static array and frees its memory.
+ */
+int d_StaticArrayDestroy(dStaticArray_t* array);
 
- // =============================================================================
- // THROTTLED LOGGING - Per-Call-Site Rate Limiting
- // =============================================================================
+/** 
+ * @brief Append an element to the end of the static array.
+ * *
+ * @param array: Pointer to static array
+ * @param data: Pointer to element data to copy
+ * @return: 0 on success, 1 on failure
+ *
+ * -- Fails if array is at maximum capacity
+ * -- Fails if array or data is NULL
+ * -- Copies element_size bytes from data
+ * -- Increments count on successful append
+ * 
+ * Example: `d_StaticArrayAppend(array, &data);`
+ * This appends a pointer to a data element to the end of the static array.
+ */
+int d_StaticArrayAppend(dStaticArray_t* array, void* data);
 
- /** @brief Log with per-call-site throttling (Debug level)
-  * @param interval Minimum seconds between logs at this call site
-  * @param fmt Printf-style format string
-  * @param ... Variable arguments
-  */
- #define d_LogDebugF_Throttle(interval, fmt, ...) do { \
-     static double _throttle_last = 0; \
-     double _throttle_now = d_GetTimestamp(); \
-     if (_throttle_now - _throttle_last >= (interval)) { \
-         _throttle_last = _throttle_now; \
-         d_LogDebugF(fmt, ##__VA_ARGS__); \
-     } \
- } while(0)
+/**
+ * @brief: Get a pointer to an element at the specified index
+ *
+ * @param array: Pointer to static array
+ * @param index: Zero-based index of element to retrieve
+ * @return: Pointer to element data, or NULL if out of bounds
+ *
+ * -- Returns NULL if array is NULL or index >= count
+ * -- Performs bounds checking for safety
+ * -- Returned pointer is valid until array is modified or destroyed
+ * 
+ * Example: `void* data = d_StaticArrayGet(array, 0);`
+ * This retrieves the first element from the static array.
+ */
+void* d_StaticArrayGet(dStaticArray_t* array, size_t index);
 
- /** @brief Log with per-call-site throttling (Info level)
-  * @param interval Minimum seconds between logs at this call site
-  * @param fmt Printf-style format string
-  * @param ... Variable arguments
-  */
- #define d_LogInfoF_Throttle(interval, fmt, ...) do { \
-     static double _throttle_last = 0; \
-     double _throttle_now = d_GetTimestamp(); \
-     if (_throttle_now - _throttle_last >= (interval)) { \
-         _throttle_last = _throttle_now; \
-         d_LogInfoF(fmt, ##__VA_ARGS__); \
-     } \
- } while(0)
+/**
+ * @brief: Remove and return a pointer to the last element (LIFO behavior)
+ *
+ * @param array: Pointer to static array
+ * @return: Pointer to last element data, or NULL if empty
+ *
+ * -- Returns NULL if array is NULL or empty
+ * -- Decrements count but doesn't free memory
+ * -- Element data remains in buffer but is no longer active
+ * -- Returned pointer becomes invalid after next append
+ * 
+ * Example: `void* data = d_StaticArrayPop(array);`
+ * This removes and returns the last element from the static array.
+ */
+void* d_StaticArrayPop(dStaticArray_t* array);
 
- /** @brief Log with per-call-site throttling (Warning level)
-  * @param interval Minimum seconds between logs at this call site
-  * @param fmt Printf-style format string
-  * @param ... Variable arguments
-  */
- #define d_LogWarningF_Throttle(interval, fmt, ...) do { \
-     static double _throttle_last = 0; \
-     double _throttle_now = d_GetTimestamp(); \
-     if (_throttle_now - _throttle_last >= (interval)) { \
-         _throttle_last = _throttle_now; \
-         d_LogWarningF(fmt, ##__VA_ARGS__); \
-     } \
- } while(0)
+/**
+ * @brief Get the number of free slots remaining in the static array
+ *
+ * @param array: Pointer to static array
+ * @return: Number of elements that can still be added, or 0 if array is NULL/full
+ *
+ * -- Returns 0 if array is NULL (no space available)
+ * -- Returns capacity - count for valid arrays
+ * -- Useful for checking if array can accept more elements before attempting append
+ * 
+ * Example: `size_t free_slots = d_StaticArrayGetFreeSpace(array);`
+ * This returns how many more elements can be added to the array.
+ */
+size_t d_StaticArrayGetFreeSpace(dStaticArray_t* array);
 
- /** @brief Log with per-call-site throttling (Error level)
-  * @param interval Minimum seconds between logs at this call site
-  * @param fmt Printf-style format string
-  * @param ... Variable arguments
-  */
- #define d_LogErrorF_Throttle(interval, fmt, ...) do { \
-     static double _throttle_last = 0; \
-     double _throttle_now = d_GetTimestamp(); \
-     if (_throttle_now - _throttle_last >= (interval)) { \
-         _throttle_last = _throttle_now; \
-         d_LogErrorF(fmt, ##__VA_ARGS__); \
-     } \
- } while(0)
+/**
+ * @brief Fill the static array with multiple copies of a given value
+ *
+ * @param array: Pointer to static array
+ * @param value: Pointer to the value to copy into each element
+ * @param num_elements: Number of elements to fill
+ * @return: 0 on success, 1 on failure
+ *
+ * -- Fails if array or value is NULL
+ * -- Fails if num_elements exceeds array capacity
+ * -- Copies element_size bytes from value to each position
+ * -- Sets array count to num_elements after successful fill
+ * -- Overwrites existing data in the array
+ * 
+ * Example: `int value = 42; d_StaticArrayFill(array, &value, 5);`
+ * This fills the first 5 positions of the array with the value 42.
+ */
+int d_StaticArrayFill(dStaticArray_t* array, const void* value, size_t num_elements);
 
- /** @brief Log with per-call-site throttling (Fatal level)
-  * @param interval Minimum seconds between logs at this call site
-  * @param fmt Printf-style format string
-  * @param ... Variable arguments
-  */
- #define d_LogFatalF_Throttle(interval, fmt, ...) do { \
-     static double _throttle_last = 0; \
-     double _throttle_now = d_GetTimestamp(); \
-     if (_throttle_now - _throttle_last >= (interval)) { \
-         _throttle_last = _throttle_now; \
-         d_LogFatalF(fmt, ##__VA_ARGS__); \
-     } \
- } while(0)
+/**
+ * @brief Get direct access to the raw memory buffer of the static array
+ *
+ * @param array: Pointer to static array
+ * @return: Pointer to the start of the raw data buffer, or NULL on error
+ *
+ * -- Returns NULL if array is NULL or data buffer is NULL
+ * -- Provides access to entire allocated buffer regardless of current count
+ * -- Returned pointer is valid until array is destroyed
+ * -- Use with caution - direct memory access bypasses safety checks
+ * -- Primarily intended for advanced operations or serialization
+ * 
+ * Example: `void* raw_buffer = d_StaticArrayPeekRawMemory(array);`
+ * This returns a pointer to the entire data buffer of the array.
+ */
+void* d_StaticArrayPeekRawMemory(dStaticArray_t* array);
 
- // =============================================================================
- // UTILITY FUNCTIONS
- // =============================================================================
+/**
+ * @brief Save a static array to a binary file
+ *
+ * @param filename Path to the file where the array should be saved
+ * @param array Pointer to the static array to save
+ * @return 0 on success, 1 on failure
+ *
+ * -- Saves array metadata (capacity, count, element_size) and the `count` used elements
+ * -- Uses binary format with magic number for validation and a trailing checksum
+ * -- Writes to a temporary file beside `filename` and renames it into place once complete
+ * -- File can be loaded later using d_LoadStaticArrayFromFile
+ * 
+ * Example: `d_StaticArraySaveToFile("myarray.bin", array);`
+ */
+int d_StaticArraySaveToFile(const char* filename, const dStaticArray_t* array);
 
- /** @brief Get string representation of log level
-  * @param level Log level enum value
-  * @return String like "DEBUG", "INFO", etc. Returns "UNKNOWN" for invalid levels
-  */
- const char* d_LogLevel_ToString(dLogLevel_t level);
+/**
+ * @brief Save a static array to a binary file on a background thread
+ *
+ * @param filename Path to the file where the array should be saved
+ * @param array Pointer to the static array to save
+ * @param callback Optional completion callback, run on the background thread
+ * @param user_data Passed to `callback`
+ * @return Save handle to poll, wait on and destroy, or NULL on failure
+ *
+ * -- Copies the `count` used elements with one memcpy on the calling thread
+ * -- Writing, checksumming and syncing happen on the background thread
+ * -- The array may be modified or destroyed as soon as this returns
+ * -- Produces the same file as d_StaticArraySaveToFile
+ *
+ * Example: `dAsyncSave_t* save = d_StaticArraySaveToFileAsync("myarray.bin", array, NULL, NULL);`
+ */
+dAsyncSave_t* d_StaticArraySaveToFileAsync(const char* filename, const dStaticArray_t* array,
+                                           dAsyncSaveCallback callback, void* user_data);
 
- /** @brief Parse log level from string
-  * @param str String like "DEBUG", "INFO", etc. Case-insensitive
-  * @return Parsed level, or D_LOG_LEVEL_INFO on error
-  */
- dLogLevel_t d_LogLevel_FromString(const char* str);
+/**
+ * @brief Load a static array from a binary file
+ *
+ * @param filename Path to the file containing the saved array
+ * @return Pointer to new static array, or NULL on failure
+ *
+ * -- Validates file format, magic number and checksum
+ * -- Allocates new array with original capacity and data
+ * -- Still reads version 1 files, which stored the full capacity and no checksum
+ * -- Returns NULL if file format is invalid or allocation fails
+ * 
+ * Example: `dStaticArray_t* array = d_LoadStaticArrayFromFile("myarray.bin");`
+ */
+dStaticArray_t* d_LoadStaticArrayFromFile(const char* filename);
 
- /** @brief Get ANSI color code for log level
-  * @param level Log level
-  * @return ANSI escape sequence, or empty string if colors disabled
-  */
- const char* d_LogLevel_GetColor(dLogLevel_t level);
+/**
+ * @brief Iterate over all elements in a static array
+ *
+ * @param array Pointer to the static array to iterate
+ * @param callback Function to call for each element
+ * @param user_data Optional data to pass to the callback
+ * @return 0 on success, 1 on failure
+ *
+ * -- Calls callback function for each element in the array (up to count)
+ * -- Provides element index, data pointer, and size to callback
+ * -- Safe iteration - callback receives read-only access to elements
+ * 
+ * Example: `d_StaticArrayIterate(array, my_callback, &context);`
+ */
+int d_StaticArrayIterate(const dStaticArray_t* array, dStaticArrayIteratorFunc callback, void* user_data);
+
+
+/* --- Slot Maps --- */
+
+
+/**
+ * @brief Create an empty slot map.
+ *
+ * @param element_size Size of each element in bytes
+ * @param capacity Number of elements to reserve room for (0 allowed)
+ *
+ * @return Pointer to the new slot map, or NULL on failure
+ *
+ * Example: `dSlotMap_t* entities = d_SlotMapInit(sizeof(Entity_t), 256);`
+ */
+dSlotMap_t* d_SlotMapInit(size_t element_size, size_t capacity);
+
+/**
+ * @brief Create an empty slot map whose memory comes from `allocator`.
+ *
+ * @param allocator Allocator for the map and every resize (NULL = current default)
+ *
+ * -- Behaves exactly like d_SlotMapInit otherwise
+ */
+dSlotMap_t* d_SlotMapInitWithAllocator(size_t element_size, size_t capacity, const dAllocator_t* allocator);
+
+/**
+ * @brief Destroy a slot map and all of its elements.
+ *
+ * @param map Pointer to the slot map pointer (set to NULL after destruction)
+ *
+ * @return 0 on success, 1 on failure
+ */
+int d_SlotMapDestroy(dSlotMap_t** map);
+
+/**
+ * @brief Copy an element into the map.
+ *
+ * @param map The slot map
+ * @param data Element to copy, or NULL to insert a zeroed element
+ *
+ * @return Handle to the new element, or D_SLOT_HANDLE_NULL on failure
+ *
+ * -- Reuses the most recently freed slot, with its bumped generation
+ *
+ * Example: `dSlotHandle_t player = d_SlotMapInsert(entities, &spawn);`
+ */
+dSlotHandle_t d_SlotMapInsert(dSlotMap_t* map, const void* data);
 
- /** @brief Get color reset sequence
-  * @return ANSI reset sequence, or empty string if colors disabled
-  */
- const char* d_LogLevel_GetColorReset(void);
+/**
+ * @brief Look up the element a handle refers to.
+ *
+ * @return Pointer to the element, or NULL if the handle is stale or invalid
+ *
+ * -- The pointer is valid until the next insert or remove
+ */
+void* d_SlotMapGet(const dSlotMap_t* map, dSlotHandle_t handle);
 
- /** @brief Get gaming-themed prefix for log level
-  * @param level Log level
-  * @return Prefix string like "[DEBUG]", "[INFO] ", etc.
-  */
- const char* d_LogLevel_GetGamePrefix(dLogLevel_t level);
+/**
+ * @brief Check whether a handle still refers to an element.
+ */
+bool d_SlotMapContains(const dSlotMap_t* map, dSlotHandle_t handle);
 
- /** @brief Get current timestamp as Unix time
-  * @return Current time in seconds since epoch
-  */
- double d_GetTimestamp(void);
+/**
+ * @brief Remove the element a handle refers to.
+ *
+ * @return 0 on success, 1 if the handle is stale or invalid
+ *
+ * -- O(1): the last dense element moves into the hole, so dense order is not preserved
+ * -- Every handle to the removed element becomes stale
+ */
+int d_SlotMapRemove(dSlotMap_t* map, dSlotHandle_t handle);
 
- /** @brief Format timestamp into string
-  * @param buffer Output buffer
-  * @param buffer_size Size of buffer
-  * @param timestamp Unix timestamp
-  * @param format strftime format string (NULL for ISO-8601)
-  */
- void d_FormatTimestamp(char* buffer, size_t buffer_size, double timestamp, const char* format);
+/**
+ * @brief Remove every element, keeping capacity.
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * -- All outstanding handles become stale
+ */
+int d_SlotMapClear(dSlotMap_t* map);
 
- // =============================================================================
- // ZERO-OVERHEAD MACROS
- // =============================================================================
+/**
+ * @brief Get the number of elements in the map.
+ */
+size_t d_SlotMapGetCount(const dSlotMap_t* map);
 
- // These macros provide zero overhead when logging is disabled at compile time
- // They automatically capture file, line, and function information
+/**
+ * @brief Get the element at a dense position, for linear iteration.
+ *
+ * @return Pointer to the element, or NULL if `dense_index >= count`
+ *
+ * Example: `for (size_t i = 0; i < d_SlotMapGetCount(map); i++) update(d_SlotMapGetDense(map, i));`
+ */
+void* d_SlotMapGetDense(const dSlotMap_t* map, size_t dense_index);
 
- #ifndef D_LOG_CURRENT_FILE_ID
-     #define D_LOG_CURRENT_FILE_ID (__COUNTER__)
- #endif
+/**
+ * @brief Get the handle of the element at a dense position.
+ *
+ * @return The element's handle, or D_SLOT_HANDLE_NULL if `dense_index >= count`
+ *
+ * -- Lets a linear scan remove elements; after removing at `i`, visit `i` again
+ */
+dSlotHandle_t d_SlotMapHandleAt(const dSlotMap_t* map, size_t dense_index);
 
- #ifdef D_LOGGING_ENABLED
-     #define D_LOG(level, msg) \
-         do { \
-             extern dLogGlobalConfig_t g_log_config; \
-             if ((level) >= g_log_config.file_log_levels[D_LOG_CURRENT_FILE_ID]) { \
-                 d_LogEx(level, __FILE__, __LINE__, __func__, msg); \
-             } \
-         } while(0)
 
-     #define D_LOGF(level, fmt, ...) \
-         do { \
-             extern dLogGlobalConfig_t g_log_config; \
-             if ((level) >= g_log_config.file_log_levels[D_LOG_CURRENT_FILE_ID]) { \
-                 d_LogExF(level, __FILE__, __LINE__, __func__, fmt, __VA_ARGS__); \
-             } \
-         } while(0)
- #else
-     #define D_LOG(level, msg) ((void)0)
-     #define D_LOGF(level, fmt, ...) ((void)0)
- #endif
+/* --- Struct of Arrays --- */
 
- // Convenience macros for common log levels
- #define D_LOG_DEBUG(msg) D_LOG(D_LOG_LEVEL_DEBUG, msg)
- #define D_LOG_INFO(msg) D_LOG(D_LOG_LEVEL_INFO, msg)
- #define D_LOG_WARNING(msg) D_LOG(D_LOG_LEVEL_WARNING, msg)
- #define D_LOG_ERROR(msg) D_LOG(D_LOG_LEVEL_ERROR, msg)
- #define D_LOG_FATAL(msg) D_LOG(D_LOG_LEVEL_FATAL, msg)
 
- #define D_LOG_DEBUGF(fmt, ...) D_LOGF(D_LOG_LEVEL_DEBUG, fmt, __VA_ARGS__)
- #define D_LOG_INFOF(fmt, ...) D_LOGF(D_LOG_LEVEL_INFO, fmt, __VA_ARGS__)
- #define D_LOG_WARNINGF(fmt, ...) D_LOGF(D_LOG_LEVEL_WARNING, fmt, __VA_ARGS__)
- #define D_LOG_ERRORF(fmt, ...) D_LOGF(D_LOG_LEVEL_ERROR, fmt, __VA_ARGS__)
- #define D_LOG_FATALF(fmt, ...) D_LOGF(D_LOG_LEVEL_FATAL, fmt, __VA_ARGS__)
+/**
+ * @brief Create an empty struct-of-arrays container from a field schema.
+ *
+ * @param fields Array of `field_count` field descriptions (copied)
+ * @param field_count Number of fields, at least 1
+ * @param capacity Number of rows to reserve room for (0 allowed)
+ *
+ * @return Pointer to the new container, or NULL on failure
+ *
+ * Example:
+ * `dSoAField_t fields[] = { { sizeof(dVec3_t), 0 }, { sizeof(dVec3_t), 0 }, { sizeof(float), 0 } };`
+ * `dSoA_t* bodies = d_SoAInit(fields, 3, 1024);`
+ */
+dSoA_t* d_SoAInit(const dSoAField_t* fields, size_t field_count, size_t capacity);
 
- // Builder pattern macro
- #define D_LOG_BUILD(level) d_LogBegin(level)
+/**
+ * @brief Create an empty struct-of-arrays container whose memory comes from `allocator`.
+ *
+ * @param allocator Allocator for the container and every resize (NULL = current default)
+ *
+ * -- Behaves exactly like d_SoAInit otherwise
+ */
+dSoA_t* d_SoAInitWithAllocator(const dSoAField_t* fields, size_t field_count, size_t capacity,
+                               const dAllocator_t* allocator);
 
- // Timed block macro
- #define D_LOG_TIMED_BLOCK(name) \
-     for (dLogContext_t* _ctx = d_PushLogContext(name); _ctx; d_PopLogContext(_ctx), _ctx = NULL) \
-         for (d_LogContext_EnableTiming(_ctx); _ctx; _ctx = NULL)
+/**
+ * @brief Destroy a struct-of-arrays container.
+ *
+ * @param soa Pointer to the container pointer (set to NULL after destruction)
+ *
+ * @return 0 on success, 1 on failure
+ */
+int d_SoADestroy(dSoA_t** soa);
 
 /**
- * @brief Initialize a Dynamic Array.
- * 
- * @param capacity The initial capacity of the array in elements.
- * @param element_size The size of each element in bytes.
- * 
- * @return A pointer to the new array, or NULL on error.
- * 
- * -- Must be destroyed with d_DestroyArray() to free memory
- * -- Initial count is 0 even though capacity may be larger
- * -- Elements can be any type as long as element_size is correct
- * -- Capacity of 0 is allowed but array cannot store elements until resized
- * 
- * Example: `dArray_t* array = d_ArrayInit(10, sizeof(int));`
- * This creates a new array with a capacity of 10 elements, each of size 4 bytes.
+ * @brief Make room for at least `min_capacity` rows.
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * -- Never shrinks; existing rows are copied column by column into one new block
  */
-dArray_t* d_ArrayInit( size_t capacity, size_t element_size );
+int d_SoAReserve(dSoA_t* soa, size_t min_capacity);
 
 /**
- * @brief Destroy a dynamic array.
- * 
- * @param array The array to destroy.
- * 
- * @return: 0 on success, 1 on failure.
- * 
- * -- Frees both the data buffer and the array structure itself
- * -- After calling this function, the pointer is invalid and should not be used
- * 
- * Example: `d_ArrayDestroy(array);`
- * This destroys the dynamic array and frees its memory.
+ * @brief Append one row.
+ *
+ * @param soa The container
+ * @param values Array of `field_count` pointers, one value per field; NULL (or a NULL
+ *               entry) zero-fills that field
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * -- The new row's index is `count - 1`; capacity doubles when full
+ *
+ * Example: `const void* row[] = { &pos, &vel, &mass }; d_SoAAppend(bodies, row);`
  */
-int d_ArrayDestroy( dArray_t* array );
+int d_SoAAppend(dSoA_t* soa, const void* const* values);
 
 /**
- * @brief Resize the internal data buffer of a dynamic array.
+ * @brief Remove a row by moving the last row into its place.
  *
- * This function adjusts the allocated memory for the array's elements.
+ * @return 0 on success, 1 if `index >= count`
  *
- * @param array A pointer to the dynamic array whose internal buffer is to be resized.
- * @param new_size_in_bytes The desired new total size of the internal data buffer in bytes.
- * This will determine the new capacity in elements.
+ * -- O(field_count); row order is not preserved
+ */
+int d_SoASwapRemove(dSoA_t* soa, size_t index);
+
+/**
+ * @brief Remove every row, keeping capacity.
  *
- * @return 0 on success, 1 on failure.
+ * @return 0 on success, 1 on failure
+ */
+int d_SoAClear(dSoA_t* soa);
+
+/**
+ * @brief Get the start of a field's column.
  *
- * @note If `new_size_in_bytes` is 0, the internal data buffer will be freed, and the array's
- * capacity and count will be reset to 0.
- * @note If `new_size_in_bytes` is larger than the current allocated size, the data buffer
- * is reallocated, potentially moving to a new memory location. Existing data (up to
- * the old capacity) is preserved.
- * @note If `new_size_in_bytes` is smaller than the current allocated size, the data buffer
- * is truncated. If the current `count` of elements exceeds the new capacity, `count`
- * will be adjusted down to match the new capacity, effectively truncating the array's
- * contents.
- * @warning This function only affects the internal data buffer (`array->data`). The `dArray_t* array`
- * pointer itself remains valid and points to the same `dArray_t` structure.
- * Pointers obtained previously via `d_IndexDataFromArray` (or similar direct access)
- * will become invalid if the underlying `array->data` buffer is reallocated and moved.
+ * @return Pointer to `count` packed values, aligned to at least D_SOA_COLUMN_ALIGNMENT,
+ *         or NULL if `field` is out of range or nothing is allocated yet
  *
- * Example: `d_ArrayResize(myArray, 10 * sizeof(int));`
- * This resizes the internal buffer of `myArray` to accommodate 10 integer elements.
- * If `myArray` previously held more than 10 elements, its `count` will be truncated.
+ * Example: `dVec3_t* pos = (dVec3_t*)d_SoAGetColumn(bodies, 0);`
  */
-int d_ArrayResize( dArray_t* array, size_t new_capacity );
+void* d_SoAGetColumn(const dSoA_t* soa, size_t field);
 
 /**
- * @brief Grow the array by a number of additional bytes.
- * 
- * @param array The array to grow.
- * @param additional_bytes The number of bytes to add.
- * 
- * @return 0 on success, 1 on failure.
- * 
- * -- Convenience function that calls d_ArrayResize() internally
- * 
- * Example: `d_ArrayGrow(array, 10 * sizeof(int));`
- * This grows the dynamic array by 10 elements, each of size 4 bytes.
+ * @brief Get one field of one row.
+ *
+ * @return Pointer to the value, or NULL if `field` or `index` is out of range
  */
-int d_ArrayGrow( dArray_t* array, size_t additional_capacity );
+void* d_SoAGet(const dSoA_t* soa, size_t field, size_t index);
 
 /**
- * @brief Append an element to the end of the dynamic array.
+ * @brief Get the number of rows.
+ */
+size_t d_SoAGetCount(const dSoA_t* soa);
+
+
+/* --- Ring Buffers --- */
+
+
+/**
+ * @brief Create a bounded ring buffer.
  *
- * This function adds a new element to the array. If the array's current capacity
- * is insufficient, it will automatically grow to accommodate the new element,
- * typically by doubling its capacity.
+ * @param capacity Minimum number of elements it can hold; rounded up to a power of two (at least 2)
+ * @param element_size Size of each element in bytes
+ * @param mode D_RING_BUFFER_SPSC or D_RING_BUFFER_MPMC
  *
- * @param array A pointer to the dynamic array to append to.
- * @param data A pointer to the element data to copy into the array.
- * The data pointed to will be copied by `element_size` bytes.
+ * @return Pointer to the new ring buffer, or NULL on failure
  *
- * @return 0 on success, 1 on failure.
+ * Example: `dRingBuffer_t* audio = d_RingBufferInit(1024, sizeof(AudioCmd_t), D_RING_BUFFER_SPSC);`
+ */
+dRingBuffer_t* d_RingBufferInit(size_t capacity, size_t element_size, dRingBufferMode_t mode);
+
+/**
+ * @brief Create a bounded ring buffer whose memory comes from `allocator`.
  *
- * @note Fails if `array` or `data` is NULL.
- * @note If the array's capacity is reached, it will attempt to grow its
- * internal buffer. If reallocation fails, the append operation will fail.
- * @note Copies `element_size` bytes from the `data` pointer into the array.
- * @note Increments the array's `count` on successful append.
+ * @param allocator Allocator for the ring buffer and its slots (NULL = current default)
  *
- * Example: `int my_value = 123; int result = d_ArrayAppend(myArray, &my_value);`
- * This appends an integer value to the end of `myArray`.
+ * -- Behaves exactly like d_RingBufferInit otherwise
  */
-int d_ArrayAppend( dArray_t* array, void* data );
+dRingBuffer_t* d_RingBufferInitWithAllocator(size_t capacity, size_t element_size, dRingBufferMode_t mode,
+                                             const dAllocator_t* allocator);
 
 /**
- * @brief Get a pointer to the data at a specific index.
- * 
- * @param array The array to get data from.
- * @param index The index of the element to get.
- * 
- * @return A pointer to the element data, or NULL if index is out of bounds.
- * 
- * -- Returns NULL if array is NULL or index >= count
- * -- Returned pointer is valid until the array is modified or destroyed
- * -- Caller can read/write through the returned pointer safely
- * -- Use appropriate casting: int* ptr = (int*)d_ArrayGet(array, 0)
- * -- Index must be less than count, not capacity (only counts appended elements)
- * 
- * Example: `void* data = d_ArrayGet(array, 0);`
- * This retrieves the first element from the dynamic array.
+ * @brief Destroy a ring buffer. No thread may still be using it.
+ *
+ * @param ring Pointer to the ring buffer pointer (set to NULL after destruction)
+ *
+ * @return 0 on success, 1 on failure
  */
-void* d_ArrayGet(dArray_t* array, size_t index);
+int d_RingBufferDestroy(dRingBuffer_t** ring);
 
 /**
- * @brief Remove and return the last element from the array.
+ * @brief Copy one element into the ring buffer.
  *
- * @param array The array to pop from.
+ * @return 0 on success, 1 if the buffer is full (or on invalid input)
  *
- * @return A pointer to the last element's data, or NULL if array is empty.
+ * -- Never blocks; in SPSC mode only one thread may enqueue
+ */
+int d_RingBufferEnqueue(dRingBuffer_t* ring, const void* data);
+
+/**
+ * @brief Copy the oldest element out of the ring buffer.
  *
- * -- Decrements count but does not free memory (element data remains in buffer)
- * -- Returned pointer becomes invalid after next append or array modification
- * -- Implements stack-like behavior for dynamic arrays
- * -- Memory is not reallocated, only the count is decremented for efficiency
+ * @return 0 on success, 1 if the buffer is empty (or on invalid input)
  *
- * Example: `void* data = d_ArrayPop(array);`
- * This removes and returns the last element from the dynamic array.
+ * -- Never blocks; in SPSC mode only one thread may dequeue
  */
-void* d_ArrayPop(dArray_t* array);
+int d_RingBufferDequeue(dRingBuffer_t* ring, void* out);
+
+/**
+ * @brief Enqueue up to `n` elements from a packed array in one step.
+ *
+ * @return Number of elements enqueued (fewer than `n` when the buffer fills up)
+ *
+ * -- The enqueued elements are consecutive in the queue even with other producers
+ * -- Publishes the whole batch with one position update, which amortizes the atomics
+ */
+size_t d_RingBufferEnqueueBatch(dRingBuffer_t* ring, const void* data, size_t n);
+
+/**
+ * @brief Dequeue up to `n` elements into a packed array in one step.
+ *
+ * @return Number of elements dequeued (fewer than `n` when the buffer runs empty)
+ */
+size_t d_RingBufferDequeueBatch(dRingBuffer_t* ring, void* out, size_t n);
+
+/**
+ * @brief Get the number of queued elements.
+ *
+ * -- A snapshot only: other threads may change it before the caller looks at it
+ */
+size_t d_RingBufferGetCount(const dRingBuffer_t* ring);
+
+/**
+ * @brief Get the number of elements the ring buffer can hold.
+ */
+size_t d_RingBufferGetCapacity(const dRingBuffer_t* ring);
+
+
+/* --- Heaps --- */
+
 
 /**
- * @brief Clear all elements from the array (sets count to 0).
+ * @brief Create an empty priority queue.
  *
- * @param array The array to clear.
- *
- * @return 0 on success, 1 on error.
+ * @param element_size Size of each element in bytes
+ * @param capacity Initial number of elements to reserve room for
+ * @param arity Children per node: 2 (binary) or 4 (4-ary, better for large queues)
+ * @param compare Ordering; the element sorting first is popped first
+ * @param user_data Passed to `compare`
  *
- * -- Sets count to 0 but does not free memory or reduce capacity
- * -- Element data remains in buffer but is considered removed
- * -- More efficient than destroying and recreating the array
- * -- Can reuse the cleared array immediately with d_ArrayAppend
+ * @return Pointer to the new heap, or NULL on failure
  *
- * Example: `d_ArrayClear(array);`
- * This removes all elements from the array without deallocating memory.
+ * Example: `dHeap_t* open = d_HeapInit(sizeof(PathNode_t), 1024, 4, compare_f_cost, NULL);`
  */
-int d_ArrayClear(dArray_t* array);
+dHeap_t* d_HeapInit(size_t element_size, size_t capacity, unsigned arity, dSortCompareFunc compare,
+                    void* user_data);
 
 /**
- * @brief Insert data at a specific index in the array
- * 
- * @param array The array to insert into
- * @param data Pointer to the data to insert
- * @param index The index where to insert the data
- * 
- * @return 0 on success, 1 on failure
- * 
- * -- Shifts existing elements to the right to make space
- * -- Grows the array capacity if needed
- * -- index must be <= array->count (can insert at end)
- * -- Uses memmove for safe overlapping memory operations
- * 
- * Example: `d_ArrayInsert(array, &value, 2);`
- * This inserts a value at index 2, shifting existing elements to the right.
+ * @brief Create an empty priority queue that draws its memory from `allocator` (NULL = default).
  */
-int d_ArrayInsert(dArray_t* array, void* data, size_t index);
+dHeap_t* d_HeapInitWithAllocator(size_t element_size, size_t capacity, unsigned arity,
+                                 dSortCompareFunc compare, void* user_data, const dAllocator_t* allocator);
 
 /**
- * @brief Remove data at a specific index from the array
+ * @brief Build a priority queue from the elements of an existing array in O(n).
  *
- * @param array The array to remove from
- * @param index The index of the element to remove
+ * @param array Elements to copy in; the array itself is not modified
+ * @param element_size Size of each element; must equal `array->element_size`
+ * @param handles Optional output of `array->count` handles, one per input element in array order
  *
- * @return 0 on success, 1 on failure
+ * @return Pointer to the new heap (using the array's allocator), or NULL on failure
  *
- * -- Shifts existing elements to the left to fill the gap
- * -- Does not resize the array capacity (use d_ArrayTrimCapacity for that)
- * -- index must be < array->count
- * -- Uses memmove for safe overlapping memory operations
+ * -- Bottom-up heap construction: cheaper than pushing the elements one at a time
+ */
+dHeap_t* d_HeapInitFromArray(const dArray_t* array, size_t element_size, unsigned arity,
+                             dSortCompareFunc compare, void* user_data, dSlotHandle_t* handles);
+
+/**
+ * @brief Destroy a heap and set the caller's pointer to NULL.
  *
- * Example: `d_ArrayRemove(array, 2);`
- * This removes the element at index 2, shifting remaining elements to the left.
+ * @return 0 on success, 1 if `heap` or `*heap` is NULL
  */
-int d_ArrayRemove(dArray_t* array, size_t index);
+int d_HeapDestroy(dHeap_t** heap);
 
 /**
- * @brief Clear all elements from the array without deallocating memory
+ * @brief Add a copy of `data` to the heap.
  *
- * @param array The array to clear
+ * @param data Element to copy in (NULL = zero-filled element)
  *
- * @return 0 on success, 1 on failure
+ * @return Handle to the element, or D_SLOT_HANDLE_NULL on failure
  *
- * -- Sets count to 0, preserving capacity for efficient reuse
- * -- O(1) operation - no memory operations performed
- * -- Does not zero memory or shrink capacity
- * -- Ideal for clearing collections that will be reused (hands, queues, temp buffers)
+ * -- O(log n)
+ */
+dSlotHandle_t d_HeapPush(dHeap_t* heap, const void* data);
+
+/**
+ * @brief Remove the top element.
  *
- * Example: `d_ClearArray(array);`
- * This clears all elements from the array, resetting count to 0 while keeping capacity.
+ * @param out Receives a copy of the removed element (may be NULL)
+ *
+ * @return 0 on success, 1 if the heap is NULL or empty
+ *
+ * -- The removed element's handle goes stale
  */
-int d_ClearArray(dArray_t* array);
+int d_HeapPop(dHeap_t* heap, void* out);
 
 /**
- * @brief Optimize memory usage by shrinking the array's capacity to match its count
+ * @brief The top element, or NULL if the heap is empty.
+ */
+void* d_HeapPeek(const dHeap_t* heap);
+
+/**
+ * @brief Replace a queued element with one that sorts no later (decrease-key).
  *
- * @param array The array to trim
+ * @param handle Handle returned when the element was pushed
+ * @param data New value for the element
  *
- * @return 0 on success, 1 on failure
+ * @return 0 on success, 1 if the handle is stale or `data` sorts after the current value
  *
- * -- Reduces allocated memory to exactly match the number of elements
- * -- If array is empty, frees the data buffer
- * -- Does nothing if array is already optimally sized
- * -- Useful after bulk removal operations to reclaim memory
+ * -- O(log n); the element only moves towards the top
  *
- * Example: `d_ArrayTrimCapacity(array);`
- * This trims the array's capacity to match its count, freeing memory if necessary.
+ * Example: `d_HeapDecreaseKey(open, node->heap_handle, &(PathNode_t){ id, new_cost });`
  */
-int d_ArrayTrimCapacity(dArray_t* array);
+int d_HeapDecreaseKey(dHeap_t* heap, dSlotHandle_t handle, const void* data);
 
 /**
- * @brief Ensure the array has enough capacity for at least min_capacity elements
+ * @brief Remove a queued element by handle.
  *
- * @param array The array to ensure capacity for
- * @param min_capacity Minimum number of elements the array should accommodate
+ * @param out Receives a copy of the removed element (may be NULL)
  *
- * @return 0 on success, 1 on failure
+ * @return 0 on success, 1 if the handle is stale or invalid
+ */
+int d_HeapRemove(dHeap_t* heap, dSlotHandle_t handle, void* out);
+
+/**
+ * @brief A queued element by handle, or NULL if the handle is stale.
  *
- * -- Grows the array if current capacity is less than min_capacity
- * -- Uses exponential growth strategy to minimize reallocations
- * -- Never shrinks the array - use d_ArrayTrimCapacity for that
- * -- Useful for pre-allocating space before bulk operations
+ * @warning Read-only: changing the element's ordering in place breaks the heap; use d_HeapDecreaseKey().
+ */
+void* d_HeapGet(const dHeap_t* heap, dSlotHandle_t handle);
+
+/**
+ * @brief Whether `handle` still refers to a queued element.
+ */
+bool d_HeapContains(const dHeap_t* heap, dSlotHandle_t handle);
+
+/**
+ * @brief Remove every element; all outstanding handles go stale.
  *
- * Example: `d_ArrayEnsureCapacity(array, 100);`
- * This ensures the array has at least 100 elements allocated, growing the array if needed.
+ * @return 0 on success, 1 if `heap` is NULL
  */
-int d_ArrayEnsureCapacity(dArray_t* array, size_t min_capacity);
+int d_HeapClear(dHeap_t* heap);
 
+/**
+ * @brief Number of queued elements.
+ */
+size_t d_HeapGetCount(const dHeap_t* heap);
 
-/* --- Static Arrays --- */
+
+/* --- Chunked Arrays --- */
 
 
 /**
- * @brief Initialize a new static array with fixed capacity
+ * @brief Create an empty chunked array.
  *
- * @param capacity: Maximum number of elements the array can hold
- * @param element_size: Size of each element in bytes
- * 
- * @return: Pointer to new static array, or NULL on allocation failure
+ * @param element_size Size of each element in bytes
+ * @param chunk_elements Elements per chunk, rounded up to a power of two
+ *                       (0 = as many as fit in D_CHUNKED_ARRAY_DEFAULT_CHUNK_BYTES)
  *
- * -- Allocates memory for both the structure and the data buffer
- * -- Data buffer size = capacity * element_size
- * -- count is initialized to 0
- * -- capacity and element_size are fixed for the lifetime of the array
- * 
- * Example: `dStaticArray_t* array = d_InitStaticArray(10, sizeof(int));`
- * This creates a new static array with a capacity of 10 elements, each of size 4 bytes.
+ * @return Pointer to the new chunked array, or NULL on failure
+ *
+ * Example: `dChunkedArray_t* particles = d_ChunkedArrayInit(sizeof(Particle_t), 0);`
  */
-dStaticArray_t* d_InitStaticArray(size_t capacity, size_t element_size);
+dChunkedArray_t* d_ChunkedArrayInit(size_t element_size, size_t chunk_elements);
 
 /**
- * @brief: Destroy a static array and free all associated memory
- *
- * @param array: Pointer to static array to destroy
- * @return: 0 on success, 1 on failure
- *
- * -- Safe to call with NULL pointer
- * -- Frees data buffer first, then structure
- * -- After calling, the pointer becomes invalid
- * 
- * Example: `d_StaticArrayDestroy(array);`
- * This destroys the static array and frees its memory.
+ * @brief Create an empty chunked array that draws its memory from `allocator` (NULL = default).
  */
-int d_StaticArrayDestroy(dStaticArray_t* array);
+dChunkedArray_t* d_ChunkedArrayInitWithAllocator(size_t element_size, size_t chunk_elements,
+                                                 const dAllocator_t* allocator);
 
-/** 
- * @brief Append an element to the end of the static array.
- * *
- * @param array: Pointer to static array
- * @param data: Pointer to element data to copy
- * @return: 0 on success, 1 on failure
+/**
+ * @brief Destroy a chunked array and all of its chunks, and set the caller's pointer to NULL.
  *
- * -- Fails if array is at maximum capacity
- * -- Fails if array or data is NULL
- * -- Copies element_size bytes from data
- * -- Increments count on successful append
- * 
- * Example: `d_StaticArrayAppend(array, &data);`
- * This appends a pointer to a data element to the end of the static array.
+ * @return 0 on success, 1 if `array` or `*array` is NULL
  */
-int d_StaticArrayAppend(dStaticArray_t* array, void* data);
+int d_ChunkedArrayDestroy(dChunkedArray_t** array);
 
 /**
- * @brief: Get a pointer to an element at the specified index
+ * @brief Add a copy of `data` at the end.
  *
- * @param array: Pointer to static array
- * @param index: Zero-based index of element to retrieve
- * @return: Pointer to element data, or NULL if out of bounds
+ * @param data Element to copy in (NULL = zero-filled element)
  *
- * -- Returns NULL if array is NULL or index >= count
- * -- Performs bounds checking for safety
- * -- Returned pointer is valid until array is modified or destroyed
- * 
- * Example: `void* data = d_StaticArrayGet(array, 0);`
- * This retrieves the first element from the static array.
+ * @return Pointer to the stored element, valid until it is removed; NULL on failure
+ *
+ * -- O(1): at most one chunk allocation, never a copy of existing elements
  */
-void* d_StaticArrayGet(dStaticArray_t* array, size_t index);
+void* d_ChunkedArrayAppend(dChunkedArray_t* array, const void* data);
 
 /**
- * @brief: Remove and return a pointer to the last element (LIFO behavior)
- *
- * @param array: Pointer to static array
- * @return: Pointer to last element data, or NULL if empty
- *
- * -- Returns NULL if array is NULL or empty
- * -- Decrements count but doesn't free memory
- * -- Element data remains in buffer but is no longer active
- * -- Returned pointer becomes invalid after next append
- * 
- * Example: `void* data = d_StaticArrayPop(array);`
- * This removes and returns the last element from the static array.
+ * @brief Element `index`, or NULL if out of range.
  */
-void* d_StaticArrayPop(dStaticArray_t* array);
+void* d_ChunkedArrayGet(const dChunkedArray_t* array, size_t index);
 
 /**
- * @brief Get the number of free slots remaining in the static array
+ * @brief Remove the last element.
  *
- * @param array: Pointer to static array
- * @return: Number of elements that can still be added, or 0 if array is NULL/full
+ * @param out Receives a copy of the removed element (may be NULL)
  *
- * -- Returns 0 if array is NULL (no space available)
- * -- Returns capacity - count for valid arrays
- * -- Useful for checking if array can accept more elements before attempting append
- * 
- * Example: `size_t free_slots = d_StaticArrayGetFreeSpace(array);`
- * This returns how many more elements can be added to the array.
+ * @return 0 on success, 1 if the array is NULL or empty
  */
-size_t d_StaticArrayGetFreeSpace(dStaticArray_t* array);
+int d_ChunkedArrayPop(dChunkedArray_t* array, void* out);
 
 /**
- * @brief Fill the static array with multiple copies of a given value
+ * @brief Grow or shrink to exactly `count` elements.
  *
- * @param array: Pointer to static array
- * @param value: Pointer to the value to copy into each element
- * @param num_elements: Number of elements to fill
- * @return: 0 on success, 1 on failure
+ * @return 0 on success, 1 on invalid input or if a chunk could not be allocated
  *
- * -- Fails if array or value is NULL
- * -- Fails if num_elements exceeds array capacity
- * -- Copies element_size bytes from value to each position
- * -- Sets array count to num_elements after successful fill
- * -- Overwrites existing data in the array
- * 
- * Example: `int value = 42; d_StaticArrayFill(array, &value, 5);`
- * This fills the first 5 positions of the array with the value 42.
+ * -- New elements are zero-filled; existing elements never move
+ * -- Shrinking frees trailing chunks, keeping one spare so appends and pops at a chunk boundary do not thrash
  */
-int d_StaticArrayFill(dStaticArray_t* array, const void* value, size_t num_elements);
+int d_ChunkedArrayResize(dChunkedArray_t* array, size_t count);
 
 /**
- * @brief Get direct access to the raw memory buffer of the static array
+ * @brief Allocate chunks up front so the first `count` elements need no further allocation.
  *
- * @param array: Pointer to static array
- * @return: Pointer to the start of the raw data buffer, or NULL on error
+ * @return 0 on success, 1 on invalid input or if a chunk could not be allocated
  *
- * -- Returns NULL if array is NULL or data buffer is NULL
- * -- Provides access to entire allocated buffer regardless of current count
- * -- Returned pointer is valid until array is destroyed
- * -- Use with caution - direct memory access bypasses safety checks
- * -- Primarily intended for advanced operations or serialization
- * 
- * Example: `void* raw_buffer = d_StaticArrayPeekRawMemory(array);`
- * This returns a pointer to the entire data buffer of the array.
+ * -- Unused chunks are released again by the next pop or shrinking resize
  */
-void* d_StaticArrayPeekRawMemory(dStaticArray_t* array);
+int d_ChunkedArrayReserve(dChunkedArray_t* array, size_t count);
 
 /**
- * @brief Save a static array to a binary file
- *
- * @param filename Path to the file where the array should be saved
- * @param array Pointer to the static array to save
- * @return 0 on success, 1 on failure
+ * @brief Remove every element and free every chunk.
  *
- * -- Saves array metadata (capacity, count, element_size) and data
- * -- Uses binary format with magic number for validation
- * -- File can be loaded later using d_LoadStaticArrayFromFile
- * 
- * Example: `d_StaticArraySaveToFile("myarray.bin", array);`
+ * @return 0 on success, 1 if `array` is NULL
  */
-int d_StaticArraySaveToFile(const char* filename, const dStaticArray_t* array);
+int d_ChunkedArrayClear(dChunkedArray_t* array);
 
 /**
- * @brief Load a static array from a binary file
- *
- * @param filename Path to the file containing the saved array
- * @return Pointer to new static array, or NULL on failure
- *
- * -- Validates file format and magic number
- * -- Allocates new array with original capacity and data
- * -- Returns NULL if file format is invalid or allocation fails
- * 
- * Example: `dStaticArray_t* array = d_LoadStaticArrayFromFile("myarray.bin");`
+ * @brief Number of elements in use.
  */
-dStaticArray_t* d_LoadStaticArrayFromFile(const char* filename);
+size_t d_ChunkedArrayGetCount(const dChunkedArray_t* array);
 
 /**
- * @brief Iterate over all elements in a static array
+ * @brief Contiguous run of elements in chunk `chunk_index`, for chunk-at-a-time iteration.
  *
- * @param array Pointer to the static array to iterate
- * @param callback Function to call for each element
- * @param user_data Optional data to pass to the callback
- * @return 0 on success, 1 on failure
+ * @param count_out Receives the number of elements in use in that chunk
  *
- * -- Calls callback function for each element in the array (up to count)
- * -- Provides element index, data pointer, and size to callback
- * -- Safe iteration - callback receives read-only access to elements
- * 
- * Example: `d_StaticArrayIterate(array, my_callback, &context);`
+ * @return Pointer to the chunk's first element, or NULL if the chunk holds no elements
+ *
+ * Example: `for (size_t c = 0; (p = d_ChunkedArrayGetChunk(arr, c, &n)); c++) { ... }`
  */
-int d_StaticArrayIterate(const dStaticArray_t* array, dStaticArrayIteratorFunc callback, void* user_data);
+void* d_ChunkedArrayGetChunk(const dChunkedArray_t* array, size_t chunk_index, size_t* count_out);
 
 // Turning Strings Into Dynamic Arrays
 // src/dStrings-dArrays.c
@@ -3046,8 +5742,47 @@ dDUFError_t* d_DUFParseFile(const char* filename, dDUFValue_t** out_value);
  */
 dDUFError_t* d_DUFParseString(const char* content, dDUFValue_t** out_value);
 
+/**
+ * @brief Parse a DUF file into a value tree whose nodes and strings come from `allocator`
+ *
+ * Like d_DUFParseFile(); the file contents, tokens and errors stay on the default allocator.
+ *
+ * @param filename Path to the DUF file to parse
+ * @param out_value Pointer to store the parsed value tree (set to NULL on error)
+ * @param allocator Allocator for the tree (NULL = current default)
+ * @return Error information, or NULL on success
+ */
+dDUFError_t* d_DUFParseFileWithAllocator(const char* filename, dDUFValue_t** out_value,
+                                         const dAllocator_t* allocator);
+
+/**
+ * @brief Parse a DUF string into a value tree whose nodes and strings come from `allocator`
+ *
+ * With an arena allocator the whole tree is released by resetting the arena;
+ * d_DUFFree() is then optional.
+ *
+ * @param content Null-terminated string containing DUF content
+ * @param out_value Pointer to store the parsed value tree (set to NULL on error)
+ * @param allocator Allocator for the tree (NULL = current default)
+ * @return Error information, or NULL on success
+ */
+dDUFError_t* d_DUFParseStringWithAllocator(const char* content, dDUFValue_t** out_value,
+                                           const dAllocator_t* allocator);
+
 // --- Value Creation ---
 
+/**
+ * @brief Take DUF nodes created on the default allocator from `pool` (NULL = stop pooling)
+ *
+ * Covers d_DUFCreate*(), d_DUFParseString() and d_DUFParseFile(); nodes created with an
+ * explicit allocator are unaffected. Keys and string values stay on the allocator.
+ * Each node records its pool, so d_DUFFree() returns it there even after the setting
+ * changes; the pool must outlive every node taken from it.
+ *
+ * @param pool Pool with blocks of at least sizeof(dDUFValue_t) bytes, or NULL
+ */
+void d_DUFSetNodePool(dPool_t* pool);
+
 /**
  * @brief Create a new DUF table value
  *
@@ -3055,6 +5790,7 @@ dDUFError_t* d_DUFParseString(const char* content, dDUFValue_t** out_value);
  */
 dDUFValue_t* d_DUFCreateTable(void);
 
+
 /**
  * @brief Create a new DUF array value
  *
@@ -3096,6 +5832,17 @@ dDUFValue_t* d_DUFCreateBool(bool val);
  */
 dDUFValue_t* d_DUFCreateString(const char* str);
 
+/**
+ * @brief Create an empty value node of `type` on `allocator` (NULL = current default)
+ *
+ * The node records its allocator; d_DUFFree() returns the node and its strings to it.
+ *
+ * @param type Type tag for the new node
+ * @param allocator Allocator for the node, its key and its string value
+ * @return New zero-valued node, or NULL on allocation failure
+ */
+dDUFValue_t* d_DUFCreateWithAllocator(dDUFType_t type, const dAllocator_t* allocator);
+
 // --- Type Inspection ---
 
 /**
@@ -0,0 +1,110 @@
+// File: src/dAllocators.c - Pluggable Allocator Interface for Daedalus Library
+// Heap allocator, process-wide default, and the helpers every container allocates through
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+
+// =============================================================================
+// HEAP ALLOCATOR
+// =============================================================================
+
+static void* _d_HeapAlloc(void* context, size_t size)
+{
+    (void)context;
+    return malloc(size);
+}
+
+static void* _d_HeapRealloc(void* context, void* ptr, size_t size)
+{
+    (void)context;
+    return realloc(ptr, size);
+}
+
+static void _d_HeapFree(void* context, void* ptr)
+{
+    (void)context;
+    free(ptr);
+}
+
+static const dAllocator_t d_heap_allocator = { _d_HeapAlloc, _d_HeapRealloc, _d_HeapFree, NULL };
+
+// Read on every container creation, possibly from several threads; written rarely
+static const dAllocator_t* d_default_allocator = &d_heap_allocator;
+
+const dAllocator_t* d_GetHeapAllocator(void)
+{
+    return &d_heap_allocator;
+}
+
+const dAllocator_t* d_GetDefaultAllocator(void)
+{
+    return __atomic_load_n(&d_default_allocator, __ATOMIC_ACQUIRE);
+}
+
+void d_SetDefaultAllocator(const dAllocator_t* allocator)
+{
+    if (allocator && (!allocator->alloc_func || !allocator->realloc_func || !allocator->free_func)) {
+        d_LogError("Allocator is missing a callback; default allocator unchanged.");
+        return;
+    }
+    __atomic_store_n(&d_default_allocator, allocator ? allocator : &d_heap_allocator, __ATOMIC_RELEASE);
+}
+
+// =============================================================================
+// ALLOCATION HELPERS
+// =============================================================================
+
+void* d_Alloc(const dAllocator_t* allocator, size_t size)
+{
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+    return allocator->alloc_func(allocator->context, size);
+}
+
+void* d_Calloc(const dAllocator_t* allocator, size_t count, size_t size)
+{
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    void* ptr = d_Alloc(allocator, count * size);
+    if (ptr) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+void* d_Realloc(const dAllocator_t* allocator, void* ptr, size_t size)
+{
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+    return allocator->realloc_func(allocator->context, ptr, size);
+}
+
+void d_Free(const dAllocator_t* allocator, void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+    allocator->free_func(allocator->context, ptr);
+}
+
+char* d_StrDup(const dAllocator_t* allocator, const char* str)
+{
+    if (!str) {
+        return NULL;
+    }
+    size_t length = strlen(str) + 1;
+    char* copy = (char*)d_Alloc(allocator, length);
+    if (copy) {
+        memcpy(copy, str, length);
+    }
+    return copy;
+}
@@ -0,0 +1,290 @@
+// File: src/dArenas.c - Linear Arena Allocator for Daedalus Library
+// Bump allocation from a chain of kept chunks, markers, and O(1) bulk reset
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+
+#define D_ARENA_DEFAULT_CHUNK (64u * 1024u)
+#define D_ARENA_ALIGNMENT 16u
+
+// Block header used by the dAllocator_t view, which gets no size on realloc; padded to keep alignment
+#define D_ARENA_BLOCK_HEADER D_ARENA_ALIGNMENT
+
+#define D_ARENA_ALIGN_UP(n) (((n) + (D_ARENA_ALIGNMENT - 1)) & ~(size_t)(D_ARENA_ALIGNMENT - 1))
+#define D_ARENA_CHUNK_HEADER D_ARENA_ALIGN_UP(sizeof(dArenaChunk_t))
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+static inline uint8_t* _d_ArenaChunkData(dArenaChunk_t* chunk)
+{
+    return (uint8_t*)chunk + D_ARENA_CHUNK_HEADER;
+}
+
+/**
+ * @brief Internal helper: Allocate a chunk with room for at least `capacity` bytes.
+ */
+static dArenaChunk_t* _d_ArenaNewChunk(dArena_t* arena, size_t capacity)
+{
+    if (capacity > SIZE_MAX - D_ARENA_CHUNK_HEADER) {
+        return NULL;
+    }
+    dArenaChunk_t* chunk = (dArenaChunk_t*)d_Alloc(arena->backing, D_ARENA_CHUNK_HEADER + capacity);
+    if (!chunk) {
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->capacity = capacity;
+    chunk->used = 0;
+    arena->chunk_count++;
+    arena->reserved += capacity;
+    return chunk;
+}
+
+/**
+ * @brief Internal helper: Make `current` a chunk with room for `aligned` more bytes.
+ *
+ * Reuses the next kept chunk when it is large enough; otherwise a new chunk is
+ * linked in right after `current`, ahead of the kept ones.
+ *
+ * @return 0 on success, 1 on failure
+ */
+static int _d_ArenaAdvance(dArena_t* arena, size_t aligned)
+{
+    dArenaChunk_t* next = arena->current->next;
+    if (!next || next->capacity < aligned) {
+        next = _d_ArenaNewChunk(arena, MAX(arena->chunk_size, aligned));
+        if (!next) {
+            d_LogErrorF("Failed to allocate a %zu byte arena chunk.", MAX(arena->chunk_size, aligned));
+            return 1;
+        }
+        next->next = arena->current->next;
+        arena->current->next = next;
+    }
+    next->used = 0;
+    arena->current = next;
+    return 0;
+}
+
+static inline uint8_t* _d_ArenaBump(dArena_t* arena, size_t aligned)
+{
+    dArenaChunk_t* chunk = arena->current;
+    if (aligned > chunk->capacity - chunk->used) {
+        if (_d_ArenaAdvance(arena, aligned) != 0) {
+            return NULL;
+        }
+        chunk = arena->current;
+    }
+    uint8_t* block = _d_ArenaChunkData(chunk) + chunk->used;
+    chunk->used += aligned;
+    return block;
+}
+
+static inline size_t* _d_ArenaBlockSize(void* ptr)
+{
+    return (size_t*)((uint8_t*)ptr - D_ARENA_BLOCK_HEADER);
+}
+
+/**
+ * @brief Internal helper: True if `ptr` is the newest block in the current chunk.
+ */
+static inline bool _d_ArenaIsTop(dArena_t* arena, void* ptr)
+{
+    uint8_t* top = _d_ArenaChunkData(arena->current) + arena->current->used;
+    uint8_t* start = (uint8_t*)ptr - D_ARENA_BLOCK_HEADER;
+    return start >= _d_ArenaChunkData(arena->current) && start < top &&
+           start + D_ARENA_ALIGN_UP(D_ARENA_BLOCK_HEADER + *_d_ArenaBlockSize(ptr)) == top;
+}
+
+// =============================================================================
+// ALLOCATOR INTERFACE
+// =============================================================================
+
+static void* _d_ArenaInterfaceAlloc(void* context, size_t size)
+{
+    if (size > SIZE_MAX - 2 * D_ARENA_ALIGNMENT) {
+        return NULL;
+    }
+    uint8_t* block = _d_ArenaBump((dArena_t*)context, D_ARENA_ALIGN_UP(D_ARENA_BLOCK_HEADER + size));
+    if (!block) {
+        return NULL;
+    }
+    *(size_t*)block = size;
+    return block + D_ARENA_BLOCK_HEADER;
+}
+
+static void* _d_ArenaInterfaceRealloc(void* context, void* ptr, size_t size)
+{
+    if (!ptr) {
+        return _d_ArenaInterfaceAlloc(context, size);
+    }
+    if (size > SIZE_MAX - 2 * D_ARENA_ALIGNMENT) {
+        return NULL;
+    }
+
+    dArena_t* arena = (dArena_t*)context;
+    size_t old_size = *_d_ArenaBlockSize(ptr);
+
+    // The newest block resizes in place while its chunk has room
+    if (_d_ArenaIsTop(arena, ptr)) {
+        dArenaChunk_t* chunk = arena->current;
+        size_t start = (size_t)((uint8_t*)ptr - D_ARENA_BLOCK_HEADER - _d_ArenaChunkData(chunk));
+        size_t aligned = D_ARENA_ALIGN_UP(D_ARENA_BLOCK_HEADER + size);
+        if (aligned <= chunk->capacity - start) {
+            chunk->used = start + aligned;
+            *_d_ArenaBlockSize(ptr) = size;
+            return ptr;
+        }
+    } else if (size <= old_size) {
+        *_d_ArenaBlockSize(ptr) = size;
+        return ptr;
+    }
+
+    void* moved = _d_ArenaInterfaceAlloc(context, size);
+    if (moved) {
+        memcpy(moved, ptr, MIN(old_size, size));
+    }
+    return moved;
+}
+
+static void _d_ArenaInterfaceFree(void* context, void* ptr)
+{
+    dArena_t* arena = (dArena_t*)context;
+    if (_d_ArenaIsTop(arena, ptr)) {
+        arena->current->used = (size_t)((uint8_t*)ptr - D_ARENA_BLOCK_HEADER - _d_ArenaChunkData(arena->current));
+    }
+}
+
+// =============================================================================
+// ARENA LIFECYCLE
+// =============================================================================
+
+dArena_t* d_ArenaCreate(size_t chunk_size)
+{
+    const dAllocator_t* backing = d_GetDefaultAllocator();
+    dArena_t* arena = (dArena_t*)d_Calloc(backing, 1, sizeof(dArena_t));
+    if (!arena) {
+        d_LogError("Failed to allocate arena.");
+        return NULL;
+    }
+
+    arena->backing = backing;
+    arena->chunk_size = D_ARENA_ALIGN_UP(chunk_size > 0 ? chunk_size : D_ARENA_DEFAULT_CHUNK);
+    arena->allocator.alloc_func = _d_ArenaInterfaceAlloc;
+    arena->allocator.realloc_func = _d_ArenaInterfaceRealloc;
+    arena->allocator.free_func = _d_ArenaInterfaceFree;
+    arena->allocator.context = arena;
+
+    arena->first = _d_ArenaNewChunk(arena, arena->chunk_size);
+    if (!arena->first) {
+        d_LogErrorF("Failed to allocate a %zu byte arena chunk.", arena->chunk_size);
+        d_Free(backing, arena);
+        return NULL;
+    }
+    arena->current = arena->first;
+    return arena;
+}
+
+int d_ArenaDestroy(dArena_t** arena)
+{
+    if (!arena || !*arena) {
+        d_LogError("Attempted to destroy NULL arena.");
+        return 1;
+    }
+
+    const dAllocator_t* backing = (*arena)->backing;
+    dArenaChunk_t* chunk = (*arena)->first;
+    while (chunk) {
+        dArenaChunk_t* next = chunk->next;
+        d_Free(backing, chunk);
+        chunk = next;
+    }
+    d_Free(backing, *arena);
+    *arena = NULL;
+    return 0;
+}
+
+// =============================================================================
+// ALLOCATION AND RESET
+// =============================================================================
+
+void* d_ArenaAlloc(dArena_t* arena, size_t size)
+{
+    if (!arena) {
+        d_LogError("Attempted to allocate from NULL arena.");
+        return NULL;
+    }
+    if (size > SIZE_MAX - D_ARENA_ALIGNMENT) {
+        return NULL;
+    }
+    // Zero-byte requests still get a distinct address, like malloc
+    return _d_ArenaBump(arena, D_ARENA_ALIGN_UP(size > 0 ? size : 1));
+}
+
+const dAllocator_t* d_ArenaGetAllocator(dArena_t* arena)
+{
+    return arena ? &arena->allocator : NULL;
+}
+
+dArenaMarker_t d_ArenaGetMarker(const dArena_t* arena)
+{
+    dArenaMarker_t marker = { NULL, 0 };
+    if (arena) {
+        marker.chunk = arena->current;
+        marker.used = arena->current->used;
+    }
+    return marker;
+}
+
+void d_ArenaRestore(dArena_t* arena, dArenaMarker_t marker)
+{
+    if (!arena || !marker.chunk) {
+        d_LogError("Invalid parameters for arena restore.");
+        return;
+    }
+    arena->current = marker.chunk;
+    arena->current->used = marker.used;
+}
+
+void d_ArenaReset(dArena_t* arena)
+{
+    if (!arena) {
+        return;
+    }
+    arena->current = arena->first;
+    arena->current->used = 0;
+}
+
+void d_ArenaTrim(dArena_t* arena)
+{
+    if (!arena) {
+        return;
+    }
+
+    dArenaChunk_t* chunk = arena->current->next;
+    arena->current->next = NULL;
+    while (chunk) {
+        dArenaChunk_t* next = chunk->next;
+        arena->chunk_count--;
+        arena->reserved -= chunk->capacity;
+        d_Free(arena->backing, chunk);
+        chunk = next;
+    }
+}
+
+size_t d_ArenaGetUsed(const dArena_t* arena)
+{
+    if (!arena) {
+        return 0;
+    }
+
+    size_t used = 0;
+    for (dArenaChunk_t* chunk = arena->first; chunk != arena->current; chunk = chunk->next) {
+        used += chunk->used;
+    }
+    return used + arena->current->used;
+}
@@ -16,20 +16,26 @@
 // =============================================================================
 
 dArray_t* d_ArrayInit(size_t capacity, size_t element_size) {
+    return d_ArrayInitWithAllocator(capacity, element_size, NULL);
+}
+
+dArray_t* d_ArrayInitWithAllocator(size_t capacity, size_t element_size, const dAllocator_t* allocator) {
     if (element_size == 0) return NULL;
+    if (!allocator) allocator = d_GetDefaultAllocator();
 
-    dArray_t* array = (dArray_t*)malloc(sizeof(dArray_t));
+    dArray_t* array = (dArray_t*)d_Alloc(allocator, sizeof(dArray_t));
     if (!array) return NULL;
 
     array->capacity = capacity;
     array->count = 0;
     array->element_size = element_size;
+    array->allocator = allocator;
 
     // Only allocate memory if the initial capacity is greater than zero.
     if (capacity > 0) {
-        array->data = malloc(array->capacity * array->element_size);
+        array->data = d_Alloc(allocator, array->capacity * array->element_size);
         if (!array->data) {
-            free(array);
+            d_Free(allocator, array);
             return NULL;
         }
     } else {
@@ -40,8 +46,9 @@ dArray_t* d_ArrayInit(size_t capacity, size_t element_size) {
 
 int d_ArrayDestroy(dArray_t* array) {
     if (!array) return 1;
-    if (array->data) free(array->data);
-    free(array);
+    const dAllocator_t* allocator = array->allocator;
+    if (array->data) d_Free(allocator, array->data);
+    d_Free(allocator, array);
     return 0;
 }
 
@@ -54,14 +61,14 @@ int d_ArrayResize(dArray_t* array, size_t new_size_in_bytes) {
 
     // If new size is 0, free the data and reset.
     if (new_size_in_bytes == 0) {
-        if(array->data) free(array->data);
+        if(array->data) d_Free(array->allocator, array->data);
         array->data = NULL;
         array->capacity = 0;
         array->count = 0;
         return 0;
     }
 
-    void* new_data = realloc(array->data, new_size_in_bytes);
+    void* new_data = d_Realloc(array->allocator, array->data, new_size_in_bytes);
     if (!new_data) return 1;
 
     array->data = new_data;
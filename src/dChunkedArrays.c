@@ -0,0 +1,252 @@
+// File: src/dChunkedArrays.c - Segmented Arrays for Daedalus Library
+// Power-of-two chunks addressed by shift and mask, so elements keep their addresses as the array grows
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+static inline void** _d_ChunkTable(const dChunkedArray_t* array)
+{
+    return (void**)array->chunks->data;
+}
+
+static inline uint8_t* _d_ChunkElement(const dChunkedArray_t* array, size_t index)
+{
+    return (uint8_t*)_d_ChunkTable(array)[index >> array->chunk_shift] +
+           (index & array->chunk_mask) * array->element_size;
+}
+
+/**
+ * @brief Internal helper: Chunks needed to hold `count` elements.
+ */
+static inline size_t _d_ChunksFor(const dChunkedArray_t* array, size_t count)
+{
+    return (count >> array->chunk_shift) + ((count & array->chunk_mask) != 0);
+}
+
+/**
+ * @brief Internal helper: Allocate chunks until there are at least `needed`.
+ *
+ * Only the table of chunk pointers is ever reallocated; chunks themselves never move.
+ */
+static int _d_ChunkGrow(dChunkedArray_t* array, size_t needed)
+{
+    dArray_t* table = array->chunks;
+    if (needed > table->capacity) {
+        size_t new_capacity = MAX(needed, table->capacity * 2);
+        if (d_ArrayResize(table, new_capacity * sizeof(void*)) != 0) {
+            d_LogError("Failed to grow chunked array chunk table.");
+            return 1;
+        }
+    }
+    size_t chunk_bytes = (array->chunk_mask + 1) * array->element_size;
+    while (table->count < needed) {
+        void* chunk = d_Alloc(array->allocator, chunk_bytes);
+        if (!chunk) {
+            d_LogErrorF("Failed to allocate chunked array chunk of %zu bytes.", chunk_bytes);
+            return 1;
+        }
+        _d_ChunkTable(array)[table->count++] = chunk;
+    }
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Free trailing chunks beyond those `count` elements need, plus one spare.
+ */
+static void _d_ChunkTrim(dChunkedArray_t* array, size_t count)
+{
+    size_t keep = _d_ChunksFor(array, count) + 1;
+    dArray_t* table = array->chunks;
+    while (table->count > keep) {
+        d_Free(array->allocator, _d_ChunkTable(array)[--table->count]);
+    }
+}
+
+// =============================================================================
+// CHUNKED ARRAY LIFECYCLE
+// =============================================================================
+
+dChunkedArray_t* d_ChunkedArrayInit(size_t element_size, size_t chunk_elements)
+{
+    return d_ChunkedArrayInitWithAllocator(element_size, chunk_elements, NULL);
+}
+
+dChunkedArray_t* d_ChunkedArrayInitWithAllocator(size_t element_size, size_t chunk_elements,
+                                                 const dAllocator_t* allocator)
+{
+    if (element_size == 0) {
+        d_LogError("Invalid element size for chunked array.");
+        return NULL;
+    }
+    bool use_default = chunk_elements == 0;
+    if (use_default) {
+        chunk_elements = MAX(1, D_CHUNKED_ARRAY_DEFAULT_CHUNK_BYTES / element_size);
+    }
+
+    // Round to a power of two (down for the default so chunks stay within the byte budget)
+    size_t shift = 0;
+    while (shift < sizeof(size_t) * 8 - 2 && ((size_t)1 << shift) < chunk_elements) {
+        shift++;
+    }
+    if (use_default && ((size_t)1 << shift) > chunk_elements) {
+        shift--;
+    }
+    if (((size_t)1 << shift) > SIZE_MAX / element_size) {
+        d_LogErrorF("Chunked array chunk of %zu elements is too large.", chunk_elements);
+        return NULL;
+    }
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+
+    dChunkedArray_t* array = (dChunkedArray_t*)d_Calloc(allocator, 1, sizeof(dChunkedArray_t));
+    if (!array) {
+        d_LogError("Failed to allocate chunked array.");
+        return NULL;
+    }
+    array->element_size = element_size;
+    array->chunk_shift = shift;
+    array->chunk_mask = ((size_t)1 << shift) - 1;
+    array->allocator = allocator;
+    array->chunks = d_ArrayInitWithAllocator(8, sizeof(void*), allocator);
+    if (!array->chunks) {
+        d_LogError("Failed to allocate chunked array chunk table.");
+        d_Free(allocator, array);
+        return NULL;
+    }
+    return array;
+}
+
+int d_ChunkedArrayDestroy(dChunkedArray_t** array)
+{
+    if (!array || !*array) {
+        d_LogError("Attempted to destroy NULL chunked array.");
+        return 1;
+    }
+
+    dChunkedArray_t* a = *array;
+    d_ChunkedArrayClear(a);
+    d_ArrayDestroy(a->chunks);
+    d_Free(a->allocator, a);
+    *array = NULL;
+    return 0;
+}
+
+// =============================================================================
+// CHUNKED ARRAY OPERATIONS
+// =============================================================================
+
+void* d_ChunkedArrayAppend(dChunkedArray_t* array, const void* data)
+{
+    if (!array) {
+        d_LogError("Attempted to append to NULL chunked array.");
+        return NULL;
+    }
+    size_t chunk = array->count >> array->chunk_shift;
+    if (chunk >= array->chunks->count && _d_ChunkGrow(array, chunk + 1) != 0) {
+        return NULL;
+    }
+
+    uint8_t* element = _d_ChunkElement(array, array->count++);
+    if (data) {
+        memcpy(element, data, array->element_size);
+    } else {
+        memset(element, 0, array->element_size);
+    }
+    return element;
+}
+
+void* d_ChunkedArrayGet(const dChunkedArray_t* array, size_t index)
+{
+    if (!array || index >= array->count) {
+        return NULL;
+    }
+    return _d_ChunkElement(array, index);
+}
+
+int d_ChunkedArrayPop(dChunkedArray_t* array, void* out)
+{
+    if (!array || array->count == 0) {
+        return 1;
+    }
+    array->count--;
+    if (out) {
+        memcpy(out, _d_ChunkElement(array, array->count), array->element_size);
+    }
+    _d_ChunkTrim(array, array->count);
+    return 0;
+}
+
+int d_ChunkedArrayResize(dChunkedArray_t* array, size_t count)
+{
+    if (!array) {
+        d_LogError("Attempted to resize NULL chunked array.");
+        return 1;
+    }
+    if (count <= array->count) {
+        array->count = count;
+        _d_ChunkTrim(array, count);
+        return 0;
+    }
+
+    if (_d_ChunkGrow(array, _d_ChunksFor(array, count)) != 0) {
+        return 1;
+    }
+    // Zero the new tail one chunk-sized run at a time
+    while (array->count < count) {
+        size_t offset = array->count & array->chunk_mask;
+        size_t run = MIN(array->chunk_mask + 1 - offset, count - array->count);
+        memset(_d_ChunkElement(array, array->count), 0, run * array->element_size);
+        array->count += run;
+    }
+    return 0;
+}
+
+int d_ChunkedArrayReserve(dChunkedArray_t* array, size_t count)
+{
+    if (!array) {
+        d_LogError("Attempted to reserve NULL chunked array.");
+        return 1;
+    }
+    return _d_ChunkGrow(array, _d_ChunksFor(array, count));
+}
+
+int d_ChunkedArrayClear(dChunkedArray_t* array)
+{
+    if (!array) {
+        d_LogError("Attempted to clear NULL chunked array.");
+        return 1;
+    }
+    while (array->chunks->count > 0) {
+        d_Free(array->allocator, _d_ChunkTable(array)[--array->chunks->count]);
+    }
+    array->count = 0;
+    return 0;
+}
+
+size_t d_ChunkedArrayGetCount(const dChunkedArray_t* array)
+{
+    return array ? array->count : 0;
+}
+
+void* d_ChunkedArrayGetChunk(const dChunkedArray_t* array, size_t chunk_index, size_t* count_out)
+{
+    size_t in_use = 0;
+    void* chunk = NULL;
+    if (array && chunk_index < _d_ChunksFor(array, array->count)) {
+        size_t first = chunk_index << array->chunk_shift;
+        in_use = MIN(array->chunk_mask + 1, array->count - first);
+        chunk = _d_ChunkTable(array)[chunk_index];
+    }
+    if (count_out) {
+        *count_out = in_use;
+    }
+    return chunk;
+}
@@ -0,0 +1,299 @@
+// File: src/dConcurrentTables.c - Sharded Thread-Safe Hash Table for Daedalus Library
+// Keys are partitioned across independently locked dTable_t shards
+
+// Define feature test macros before any includes
+#define _POSIX_C_SOURCE 200809L  // For pthread_rwlock_t
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+
+// Platform-specific reader/writer lock
+#ifdef __EMSCRIPTEN__
+    typedef int dRWLock_t;  // Dummy lock for single-threaded Emscripten
+    #define RWLOCK_INIT(l) (*(l) = 0, 0)
+    #define RWLOCK_DESTROY(l) (*(l) = 0)
+    #define RWLOCK_READ_LOCK(l) (void)(l)
+    #define RWLOCK_READ_UNLOCK(l) (void)(l)
+    #define RWLOCK_WRITE_LOCK(l) (void)(l)
+    #define RWLOCK_WRITE_UNLOCK(l) (void)(l)
+#elif defined(_WIN32)
+    #include <windows.h>
+    typedef SRWLOCK dRWLock_t;
+    #define RWLOCK_INIT(l) (InitializeSRWLock(l), 0)
+    #define RWLOCK_DESTROY(l) (void)(l)
+    #define RWLOCK_READ_LOCK(l) AcquireSRWLockShared(l)
+    #define RWLOCK_READ_UNLOCK(l) ReleaseSRWLockShared(l)
+    #define RWLOCK_WRITE_LOCK(l) AcquireSRWLockExclusive(l)
+    #define RWLOCK_WRITE_UNLOCK(l) ReleaseSRWLockExclusive(l)
+#else
+    #include <pthread.h>
+    typedef pthread_rwlock_t dRWLock_t;
+    #define RWLOCK_INIT(l) pthread_rwlock_init(l, NULL)
+    #define RWLOCK_DESTROY(l) pthread_rwlock_destroy(l)
+    #define RWLOCK_READ_LOCK(l) pthread_rwlock_rdlock(l)
+    #define RWLOCK_READ_UNLOCK(l) pthread_rwlock_unlock(l)
+    #define RWLOCK_WRITE_LOCK(l) pthread_rwlock_wrlock(l)
+    #define RWLOCK_WRITE_UNLOCK(l) pthread_rwlock_unlock(l)
+#endif
+
+#define D_CONCURRENT_TABLE_DEFAULT_SHARDS 16
+#define D_CONCURRENT_TABLE_CACHE_LINE 64
+
+// One shard: its lock and the table it guards. Padded to whole cache lines so
+// threads hammering neighbouring shards do not false-share lock words.
+typedef struct {
+    dRWLock_t lock;
+    dTable_t* table;
+} _dConcurrentShardData_t;
+
+typedef union {
+    _dConcurrentShardData_t s;
+    unsigned char pad[((sizeof(_dConcurrentShardData_t) + D_CONCURRENT_TABLE_CACHE_LINE - 1)
+                       / D_CONCURRENT_TABLE_CACHE_LINE) * D_CONCURRENT_TABLE_CACHE_LINE];
+} _dConcurrentShard_t;
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+/**
+ * @brief Internal helper: Select the shard owning a key from its hash.
+ *
+ * Uses the high bits of the mixed hash. The shard tables index their own slots
+ * with the low bits, so shard choice and in-shard position stay independent.
+ * The same raw hash is then handed to the shard, so each key is hashed once.
+ */
+static _dConcurrentShard_t* _d_ConcurrentShardFor(const dConcurrentTable_t* table, size_t hash)
+{
+    _dConcurrentShard_t* shards = (_dConcurrentShard_t*)table->shards;
+    if (table->shard_bits == 0) {
+        return &shards[0];
+    }
+
+    size_t index = d_HashMix(hash) >> (sizeof(size_t) * 8 - table->shard_bits);
+    return &shards[index];
+}
+
+// =============================================================================
+// CONCURRENT TABLE CREATION AND DESTRUCTION
+// =============================================================================
+
+dConcurrentTable_t* d_ConcurrentTableInit(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                          dTableCompareFunc compare_func, size_t num_shards,
+                                          size_t initial_capacity_per_shard)
+{
+    return d_ConcurrentTableInitWithAllocator(key_size, value_size, hash_func, compare_func, num_shards,
+                                              initial_capacity_per_shard, NULL);
+}
+
+dConcurrentTable_t* d_ConcurrentTableInitWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                                       dTableCompareFunc compare_func, size_t num_shards,
+                                                       size_t initial_capacity_per_shard,
+                                                       const dAllocator_t* allocator)
+{
+    if (key_size == 0 || value_size == 0) {
+        d_LogError("Concurrent table key_size and value_size must be greater than 0.");
+        return NULL;
+    }
+
+    if (!hash_func || !compare_func) {
+        d_LogError("Concurrent table requires valid hash and compare functions.");
+        return NULL;
+    }
+
+    if (num_shards == 0) {
+        num_shards = D_CONCURRENT_TABLE_DEFAULT_SHARDS;
+    }
+
+    // Round shard count up to a power of two so high hash bits select it directly
+    unsigned int shard_bits = 0;
+    while (((size_t)1 << shard_bits) < num_shards && shard_bits < sizeof(size_t) * 8 - 1) {
+        shard_bits++;
+    }
+    num_shards = (size_t)1 << shard_bits;
+
+    // Shards share one allocator, called from whichever threads hold their locks
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+    dConcurrentTable_t* table = (dConcurrentTable_t*)d_Calloc(allocator, 1, sizeof(dConcurrentTable_t));
+    if (!table) {
+        d_LogError("Failed to allocate memory for concurrent table structure.");
+        return NULL;
+    }
+
+    _dConcurrentShard_t* shards = (_dConcurrentShard_t*)d_Calloc(allocator, num_shards, sizeof(_dConcurrentShard_t));
+    if (!shards) {
+        d_LogError("Failed to allocate memory for concurrent table shards.");
+        d_Free(allocator, table);
+        return NULL;
+    }
+
+    table->allocator = allocator;
+    table->shards = shards;
+    table->num_shards = num_shards;
+    table->shard_bits = shard_bits;
+    table->key_size = key_size;
+    table->value_size = value_size;
+    table->hash_func = hash_func;
+    table->compare_func = compare_func;
+
+    for (size_t i = 0; i < num_shards; i++) {
+        // Shards never rehash incrementally: lookups must not mutate under a read lock
+        shards[i].s.table = d_TableInitWithAllocator(key_size, value_size, hash_func, compare_func,
+                                                     initial_capacity_per_shard, D_TABLE_MODE_FLAT, allocator);
+        if (!shards[i].s.table || RWLOCK_INIT(&shards[i].s.lock) != 0) {
+            d_LogErrorF("Failed to initialize concurrent table shard %zu.", i);
+            if (shards[i].s.table) {
+                d_TableDestroy(&shards[i].s.table);
+            }
+            table->num_shards = i;
+            d_ConcurrentTableDestroy(&table);
+            return NULL;
+        }
+    }
+
+    d_LogDebugF("Created concurrent table with %zu shards (key_size: %zu, value_size: %zu).",
+                num_shards, key_size, value_size);
+    return table;
+}
+
+int d_ConcurrentTableDestroy(dConcurrentTable_t** table)
+{
+    if (!table || !*table) {
+        d_LogWarning("Attempted to destroy NULL concurrent table.");
+        return 1;
+    }
+
+    dConcurrentTable_t* t = *table;
+    _dConcurrentShard_t* shards = (_dConcurrentShard_t*)t->shards;
+    for (size_t i = 0; i < t->num_shards; i++) {
+        d_TableDestroy(&shards[i].s.table);
+        RWLOCK_DESTROY(&shards[i].s.lock);
+    }
+
+    d_Free(t->allocator, shards);
+    d_Free(t->allocator, t);
+    *table = NULL;
+    return 0;
+}
+
+// =============================================================================
+// CONCURRENT TABLE OPERATIONS
+// =============================================================================
+
+int d_ConcurrentTableSet(dConcurrentTable_t* table, const void* key, const void* value)
+{
+    if (!table || !key || !value) {
+        d_LogError("Invalid input: table, key, or value is NULL for d_ConcurrentTableSet.");
+        return 1;
+    }
+
+    size_t hash = table->hash_func(key, table->key_size);
+    _dConcurrentShard_t* shard = _d_ConcurrentShardFor(table, hash);
+    RWLOCK_WRITE_LOCK(&shard->s.lock);
+    // Any growth rehashes this shard only; the other shards stay available
+    int result = d_TableSetHashed(shard->s.table, key, value, hash);
+    RWLOCK_WRITE_UNLOCK(&shard->s.lock);
+    return result;
+}
+
+int d_ConcurrentTableGet(dConcurrentTable_t* table, const void* key, void* out_value)
+{
+    if (!table || !key || !out_value) {
+        d_LogError("Invalid input: table, key, or out_value is NULL for d_ConcurrentTableGet.");
+        return 1;
+    }
+
+    size_t hash = table->hash_func(key, table->key_size);
+    _dConcurrentShard_t* shard = _d_ConcurrentShardFor(table, hash);
+    RWLOCK_READ_LOCK(&shard->s.lock);
+    void* value = d_TableGetHashed(shard->s.table, key, hash);
+    if (value) {
+        memcpy(out_value, value, table->value_size);
+    }
+    RWLOCK_READ_UNLOCK(&shard->s.lock);
+    return value ? 0 : 1;
+}
+
+int d_ConcurrentTableRemove(dConcurrentTable_t* table, const void* key)
+{
+    if (!table || !key) {
+        d_LogError("Invalid input: table or key is NULL for d_ConcurrentTableRemove.");
+        return 1;
+    }
+
+    size_t hash = table->hash_func(key, table->key_size);
+    _dConcurrentShard_t* shard = _d_ConcurrentShardFor(table, hash);
+    RWLOCK_WRITE_LOCK(&shard->s.lock);
+    int result = d_TableRemoveHashed(shard->s.table, key, hash);
+    RWLOCK_WRITE_UNLOCK(&shard->s.lock);
+    return result;
+}
+
+int d_ConcurrentTableHasKey(dConcurrentTable_t* table, const void* key)
+{
+    if (!table || !key) {
+        d_LogError("Invalid input: table or key is NULL for d_ConcurrentTableHasKey.");
+        return 1;
+    }
+
+    size_t hash = table->hash_func(key, table->key_size);
+    _dConcurrentShard_t* shard = _d_ConcurrentShardFor(table, hash);
+    RWLOCK_READ_LOCK(&shard->s.lock);
+    int result = d_TableHasKeyHashed(shard->s.table, key, hash);
+    RWLOCK_READ_UNLOCK(&shard->s.lock);
+    return result;
+}
+
+size_t d_ConcurrentTableGetCount(dConcurrentTable_t* table)
+{
+    if (!table) {
+        return 0;
+    }
+
+    // Not a global snapshot: shards are counted one at a time
+    _dConcurrentShard_t* shards = (_dConcurrentShard_t*)table->shards;
+    size_t count = 0;
+    for (size_t i = 0; i < table->num_shards; i++) {
+        RWLOCK_READ_LOCK(&shards[i].s.lock);
+        count += d_TableGetCount(shards[i].s.table);
+        RWLOCK_READ_UNLOCK(&shards[i].s.lock);
+    }
+    return count;
+}
+
+int d_ConcurrentTableClear(dConcurrentTable_t* table)
+{
+    if (!table) {
+        d_LogError("Attempted to clear NULL concurrent table.");
+        return 1;
+    }
+
+    _dConcurrentShard_t* shards = (_dConcurrentShard_t*)table->shards;
+    int result = 0;
+    for (size_t i = 0; i < table->num_shards; i++) {
+        RWLOCK_WRITE_LOCK(&shards[i].s.lock);
+        result |= d_TableClear(shards[i].s.table);
+        RWLOCK_WRITE_UNLOCK(&shards[i].s.lock);
+    }
+    return result;
+}
+
+void d_ConcurrentTableForEach(dConcurrentTable_t* table, dTableIteratorFunc callback, void* user_data)
+{
+    if (!table || !callback) {
+        d_LogError("Invalid input: table or callback is NULL for d_ConcurrentTableForEach.");
+        return;
+    }
+
+    _dConcurrentShard_t* shards = (_dConcurrentShard_t*)table->shards;
+    for (size_t i = 0; i < table->num_shards; i++) {
+        RWLOCK_READ_LOCK(&shards[i].s.lock);
+        d_TableForEach(shards[i].s.table, callback, user_data);
+        RWLOCK_READ_UNLOCK(&shards[i].s.lock);
+    }
+}
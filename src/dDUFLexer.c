@@ -16,6 +16,7 @@ typedef struct {
     int line;
     int column;
     dArray_t* tokens;     // Array of Token_t*
+    const dAllocator_t* allocator;  // Tokens and their strings; also tokens->allocator
 } Lexer_t;
 
 // =============================================================================
@@ -65,9 +66,9 @@ static void lexer_skip_comment(Lexer_t* lex)
     }
 }
 
-static Token_t* token_create(TokenType_t type, const char* value, int line, int column)
+static Token_t* token_create(const dAllocator_t* allocator, TokenType_t type, const char* value, int line, int column)
 {
-    Token_t* tok = (Token_t*)calloc(1, sizeof(Token_t));
+    Token_t* tok = (Token_t*)d_Calloc(allocator, 1, sizeof(Token_t));
     if (tok == NULL) {
         return NULL;
     }
@@ -75,10 +76,10 @@ static Token_t* token_create(TokenType_t type, const char* value, int line, int
     tok->type = type;
     tok->line = line;
     tok->column = column;
-    tok->value = d_StringInit();
+    tok->value = d_StringInitWithAllocator(allocator);
 
     if (tok->value == NULL) {
-        free(tok);
+        d_Free(allocator, tok);
         return NULL;
     }
 
@@ -89,7 +90,7 @@ static Token_t* token_create(TokenType_t type, const char* value, int line, int
     return tok;
 }
 
-static void token_destroy(Token_t* tok)
+static void token_destroy(const dAllocator_t* allocator, Token_t* tok)
 {
     if (tok == NULL) {
         return;
@@ -99,7 +100,7 @@ static void token_destroy(Token_t* tok)
         d_StringDestroy(tok->value);
     }
 
-    free(tok);
+    d_Free(allocator, tok);
 }
 
 // =============================================================================
@@ -113,7 +114,7 @@ static Token_t* lexer_read_string(Lexer_t* lex)
     dString_t* str = d_StringInit();
 
     if (str == NULL) {
-        return token_create(TOK_ERROR, "Memory allocation failed", start_line, start_column);
+        return token_create(lex->allocator, TOK_ERROR, "Memory allocation failed", start_line, start_column);
     }
 
     // Check for multi-line string (""")
@@ -128,7 +129,7 @@ static Token_t* lexer_read_string(Lexer_t* lex)
                 is_multiline = true;
             } else {
                 // Just an empty string ""
-                Token_t* tok = token_create(TOK_STRING, "", start_line, start_column);
+                Token_t* tok = token_create(lex->allocator, TOK_STRING, "", start_line, start_column);
                 d_StringDestroy(str);
                 return tok;
             }
@@ -197,7 +198,7 @@ static Token_t* lexer_read_string(Lexer_t* lex)
         }
     }
 
-    Token_t* tok = token_create(TOK_STRING, d_StringPeek(str), start_line, start_column);
+    Token_t* tok = token_create(lex->allocator, TOK_STRING, d_StringPeek(str), start_line, start_column);
     d_StringDestroy(str);
     return tok;
 }
@@ -209,7 +210,7 @@ static Token_t* lexer_read_number(Lexer_t* lex)
     dString_t* num = d_StringInit();
 
     if (num == NULL) {
-        return token_create(TOK_ERROR, "Memory allocation failed", start_line, start_column);
+        return token_create(lex->allocator, TOK_ERROR, "Memory allocation failed", start_line, start_column);
     }
 
     // Handle negative numbers
@@ -232,7 +233,7 @@ static Token_t* lexer_read_number(Lexer_t* lex)
         }
     }
 
-    Token_t* tok = token_create(TOK_NUMBER, d_StringPeek(num), start_line, start_column);
+    Token_t* tok = token_create(lex->allocator, TOK_NUMBER, d_StringPeek(num), start_line, start_column);
     d_StringDestroy(num);
     return tok;
 }
@@ -244,7 +245,7 @@ static Token_t* lexer_read_identifier(Lexer_t* lex)
     dString_t* id = d_StringInit();
 
     if (id == NULL) {
-        return token_create(TOK_ERROR, "Memory allocation failed", start_line, start_column);
+        return token_create(lex->allocator, TOK_ERROR, "Memory allocation failed", start_line, start_column);
     }
 
     // Read alphanumeric and underscore
@@ -260,7 +261,7 @@ static Token_t* lexer_read_identifier(Lexer_t* lex)
         type = TOK_BOOL;
     }
 
-    Token_t* tok = token_create(type, id_str, start_line, start_column);
+    Token_t* tok = token_create(lex->allocator, type, id_str, start_line, start_column);
     d_StringDestroy(id);
     return tok;
 }
@@ -281,7 +282,9 @@ dArray_t* d_DUFLex(const char* input)
     lex.pos = 0;
     lex.line = 1;
     lex.column = 1;
-    lex.tokens = d_ArrayInit(32, sizeof(Token_t*));
+    // Resolved once, so every token is freed through the allocator it came from
+    lex.allocator = d_GetDefaultAllocator();
+    lex.tokens = d_ArrayInitWithAllocator(32, sizeof(Token_t*), lex.allocator);
 
     if (lex.tokens == NULL) {
         return NULL;
@@ -318,37 +321,37 @@ dArray_t* d_DUFLex(const char* input)
 
         switch (c) {
             case '@':
-                tok = token_create(TOK_AT, "@", lex.line, lex.column);
+                tok = token_create(lex.allocator, TOK_AT, "@", lex.line, lex.column);
                 lexer_advance(&lex);
                 break;
 
             case '{':
-                tok = token_create(TOK_LBRACE, "{", lex.line, lex.column);
+                tok = token_create(lex.allocator, TOK_LBRACE, "{", lex.line, lex.column);
                 lexer_advance(&lex);
                 break;
 
             case '}':
-                tok = token_create(TOK_RBRACE, "}", lex.line, lex.column);
+                tok = token_create(lex.allocator, TOK_RBRACE, "}", lex.line, lex.column);
                 lexer_advance(&lex);
                 break;
 
             case '[':
-                tok = token_create(TOK_LBRACKET, "[", lex.line, lex.column);
+                tok = token_create(lex.allocator, TOK_LBRACKET, "[", lex.line, lex.column);
                 lexer_advance(&lex);
                 break;
 
             case ']':
-                tok = token_create(TOK_RBRACKET, "]", lex.line, lex.column);
+                tok = token_create(lex.allocator, TOK_RBRACKET, "]", lex.line, lex.column);
                 lexer_advance(&lex);
                 break;
 
             case ':':
-                tok = token_create(TOK_COLON, ":", lex.line, lex.column);
+                tok = token_create(lex.allocator, TOK_COLON, ":", lex.line, lex.column);
                 lexer_advance(&lex);
                 break;
 
             case ',':
-                tok = token_create(TOK_COMMA, ",", lex.line, lex.column);
+                tok = token_create(lex.allocator, TOK_COMMA, ",", lex.line, lex.column);
                 lexer_advance(&lex);
                 break;
 
@@ -369,7 +372,7 @@ dArray_t* d_DUFLex(const char* input)
                     // Unknown character
                     dString_t* err = d_StringInit();
                     d_StringFormat(err, "Unexpected character '%c'", c);
-                    tok = token_create(TOK_ERROR, d_StringPeek(err), lex.line, lex.column);
+                    tok = token_create(lex.allocator, TOK_ERROR, d_StringPeek(err), lex.line, lex.column);
                     d_StringDestroy(err);
                     lexer_advance(&lex);
                 }
@@ -382,7 +385,7 @@ dArray_t* d_DUFLex(const char* input)
     }
 
     // Add EOF token
-    Token_t* eof = token_create(TOK_EOF, "", lex.line, lex.column);
+    Token_t* eof = token_create(lex.allocator, TOK_EOF, "", lex.line, lex.column);
     if (eof != NULL) {
         d_ArrayAppend(lex.tokens, &eof);
     }
@@ -400,7 +403,7 @@ void d_DUFLexFree(dArray_t* tokens)
     for (size_t i = 0; i < tokens->count; i++) {
         Token_t** tok_ptr = (Token_t**)d_ArrayGet(tokens, i);
         if (tok_ptr != NULL && *tok_ptr != NULL) {
-            token_destroy(*tok_ptr);
+            token_destroy(tokens->allocator, *tok_ptr);
         }
     }
 
@@ -19,10 +19,12 @@
  */
 static dDUFError_t* create_internal_error(const char* message, const char* file, int line)
 {
-    dDUFError_t* err = (dDUFError_t*)calloc(1, sizeof(dDUFError_t));
+    const dAllocator_t* allocator = d_GetDefaultAllocator();
+    dDUFError_t* err = (dDUFError_t*)d_Calloc(allocator, 1, sizeof(dDUFError_t));
     if (err == NULL) {
         return NULL;
     }
+    err->allocator = allocator;
 
     err->line = 0;      // Internal errors don't have DUF source location
     err->column = 0;
@@ -44,6 +46,7 @@ typedef struct {
     dArray_t* tokens;
     size_t pos;
     Token_t* current;
+    const dAllocator_t* allocator;  // Where value nodes and their strings go
 } Parser_t;
 
 // =============================================================================
@@ -52,10 +55,12 @@ typedef struct {
 
 static dDUFError_t* parser_error(Parser_t* p, const char* message)
 {
-    dDUFError_t* err = (dDUFError_t*)calloc(1, sizeof(dDUFError_t));
+    const dAllocator_t* allocator = d_GetDefaultAllocator();
+    dDUFError_t* err = (dDUFError_t*)d_Calloc(allocator, 1, sizeof(dDUFError_t));
     if (err == NULL) {
         return NULL;
     }
+    err->allocator = allocator;
 
     if (p->current != NULL) {
         err->line = p->current->line;
@@ -148,6 +153,25 @@ static void add_child(dDUFValue_t* parent, dDUFValue_t* child)
     }
 }
 
+// =============================================================================
+// Node Creation
+// =============================================================================
+
+static dDUFValue_t* parser_new_string(Parser_t* p, const char* str)
+{
+    dDUFValue_t* val = d_DUFCreateWithAllocator(D_DUF_STRING, p->allocator);
+    if (val == NULL) {
+        return NULL;
+    }
+
+    val->value_string = d_StrDup(val->allocator, str);
+    if (val->value_string == NULL) {
+        d_DUFFree(val);
+        return NULL;
+    }
+    return val;
+}
+
 // =============================================================================
 // Parsing Functions
 // =============================================================================
@@ -169,7 +193,7 @@ static dDUFValue_t* parse_value(Parser_t* p, dDUFError_t** err)
     switch (tok->type) {
         case TOK_STRING:
             parser_advance(p);
-            return d_DUFCreateString(d_StringPeek(tok->value));
+            return parser_new_string(p, d_StringPeek(tok->value));
 
         case TOK_NUMBER: {
             parser_advance(p);
@@ -183,7 +207,11 @@ static dDUFValue_t* parse_value(Parser_t* p, dDUFError_t** err)
                     *err = parser_error(p, "Invalid float literal");
                     return NULL;
                 }
-                return d_DUFCreateFloat(val);
+                dDUFValue_t* node = d_DUFCreateWithAllocator(D_DUF_FLOAT, p->allocator);
+                if (node != NULL) {
+                    node->value_double = val;
+                }
+                return node;
             } else {
                 char* endptr;
                 long long val = strtoll(num_str, &endptr, 10);
@@ -191,15 +219,22 @@ static dDUFValue_t* parse_value(Parser_t* p, dDUFError_t** err)
                     *err = parser_error(p, "Invalid integer literal");
                     return NULL;
                 }
-                return d_DUFCreateInt((int64_t)val);
+                dDUFValue_t* node = d_DUFCreateWithAllocator(D_DUF_INT, p->allocator);
+                if (node != NULL) {
+                    node->value_int = (int64_t)val;
+                }
+                return node;
             }
         }
 
         case TOK_BOOL: {
             parser_advance(p);
             const char* bool_str = d_StringPeek(tok->value);
-            bool val = (strcmp(bool_str, "true") == 0);
-            return d_DUFCreateBool(val);
+            dDUFValue_t* node = d_DUFCreateWithAllocator(D_DUF_BOOL, p->allocator);
+            if (node != NULL) {
+                node->value_int = (strcmp(bool_str, "true") == 0) ? 1 : 0;
+            }
+            return node;
         }
 
         case TOK_LBRACE:
@@ -221,7 +256,7 @@ static dDUFValue_t* parse_array(Parser_t* p, dDUFError_t** err)
         return NULL;
     }
 
-    dDUFValue_t* array = d_DUFCreateArray();
+    dDUFValue_t* array = d_DUFCreateWithAllocator(D_DUF_ARRAY, p->allocator);
     if (array == NULL) {
         *err = parser_error(p, "Failed to create array");
         return NULL;
@@ -264,7 +299,7 @@ static dDUFValue_t* parse_table(Parser_t* p, dDUFError_t** err)
         return NULL;
     }
 
-    dDUFValue_t* table = d_DUFCreateTable();
+    dDUFValue_t* table = d_DUFCreateWithAllocator(D_DUF_TABLE, p->allocator);
     if (table == NULL) {
         *err = parser_error(p, "Failed to create table");
         return NULL;
@@ -295,7 +330,7 @@ static dDUFValue_t* parse_table(Parser_t* p, dDUFError_t** err)
         }
 
         // Set the key name on the value node
-        value->key = strdup(key);
+        value->key = d_StrDup(value->allocator, key);
         if (value->key == NULL) {
             d_DUFFree(value);
             d_DUFFree(table);
@@ -340,7 +375,7 @@ static dDUFValue_t* parse_entry(Parser_t* p, dDUFError_t** err)
     }
 
     // Set the entry name on the table
-    table->key = strdup(entry_name);
+    table->key = d_StrDup(table->allocator, entry_name);
     if (table->key == NULL) {
         d_DUFFree(table);
         *err = parser_error(p, "Memory allocation failed");
@@ -352,7 +387,7 @@ static dDUFValue_t* parse_entry(Parser_t* p, dDUFError_t** err)
 
 static dDUFValue_t* parse_document(Parser_t* p, dDUFError_t** err)
 {
-    dDUFValue_t* root = d_DUFCreateTable();
+    dDUFValue_t* root = d_DUFCreateWithAllocator(D_DUF_TABLE, p->allocator);
     if (root == NULL) {
         *err = parser_error(p, "Failed to create root table");
         return NULL;
@@ -384,6 +419,12 @@ static dDUFValue_t* parse_document(Parser_t* p, dDUFError_t** err)
 // =============================================================================
 
 dDUFError_t* d_DUFParseString(const char* content, dDUFValue_t** out_value)
+{
+    return d_DUFParseStringWithAllocator(content, out_value, NULL);
+}
+
+dDUFError_t* d_DUFParseStringWithAllocator(const char* content, dDUFValue_t** out_value,
+                                           const dAllocator_t* allocator)
 {
     *out_value = NULL;
 
@@ -403,7 +444,8 @@ dDUFError_t* d_DUFParseString(const char* content, dDUFValue_t** out_value)
         if (tok_ptr != NULL && *tok_ptr != NULL) {
             Token_t* tok = *tok_ptr;
             if (tok->type == TOK_ERROR) {
-                dDUFError_t* err = (dDUFError_t*)calloc(1, sizeof(dDUFError_t));
+                dDUFError_t* err = (dDUFError_t*)d_Calloc(d_GetDefaultAllocator(), 1, sizeof(dDUFError_t));
+                err->allocator = d_GetDefaultAllocator();
                 err->line = tok->line;
                 err->column = tok->column;
                 err->message = d_StringInit();
@@ -419,6 +461,7 @@ dDUFError_t* d_DUFParseString(const char* content, dDUFValue_t** out_value)
     parser.tokens = tokens;
     parser.pos = 0;
     parser.current = NULL;
+    parser.allocator = allocator;
 
     dDUFError_t* err = NULL;
     *out_value = parse_document(&parser, &err);
@@ -428,6 +471,12 @@ dDUFError_t* d_DUFParseString(const char* content, dDUFValue_t** out_value)
 }
 
 dDUFError_t* d_DUFParseFile(const char* filename, dDUFValue_t** out_value)
+{
+    return d_DUFParseFileWithAllocator(filename, out_value, NULL);
+}
+
+dDUFError_t* d_DUFParseFileWithAllocator(const char* filename, dDUFValue_t** out_value,
+                                         const dAllocator_t* allocator)
 {
     *out_value = NULL;
 
@@ -448,7 +497,7 @@ dDUFError_t* d_DUFParseFile(const char* filename, dDUFValue_t** out_value)
     }
 
     // Parse content
-    dDUFError_t* parse_err = d_DUFParseString(d_StringPeek(content), out_value);
+    dDUFError_t* parse_err = d_DUFParseStringWithAllocator(d_StringPeek(content), out_value, allocator);
     d_StringDestroy(content);
 
     return parse_err;
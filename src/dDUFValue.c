@@ -6,64 +6,93 @@
 #include <stdlib.h>
 #include <string.h>
 
+// Pool for nodes created on the default allocator, or NULL; see d_DUFSetNodePool()
+static dPool_t* d_duf_node_pool = NULL;
+
+void d_DUFSetNodePool(dPool_t* pool)
+{
+    if (pool != NULL && pool->block_size < sizeof(dDUFValue_t)) {
+        d_LogErrorF("Pool blocks of %zu bytes cannot hold a %zu-byte DUF node; node pool unchanged.",
+                    pool->block_size, sizeof(dDUFValue_t));
+        return;
+    }
+    __atomic_store_n(&d_duf_node_pool, pool, __ATOMIC_RELEASE);
+}
+
 // =============================================================================
 // Value Creation Functions
 // =============================================================================
 
+dDUFValue_t* d_DUFCreateWithAllocator(dDUFType_t type, const dAllocator_t* allocator)
+{
+    dPool_t* pool = NULL;
+    if (allocator == NULL) {
+        allocator = d_GetDefaultAllocator();
+        pool = __atomic_load_n(&d_duf_node_pool, __ATOMIC_ACQUIRE);
+    }
+
+    dDUFValue_t* val = pool != NULL ? (dDUFValue_t*)d_PoolAlloc(pool)
+                                    : (dDUFValue_t*)d_Alloc(allocator, sizeof(dDUFValue_t));
+    if (val == NULL) {
+        return NULL;
+    }
+
+    memset(val, 0, sizeof(dDUFValue_t));
+    val->allocator = allocator;
+    val->pool = pool;
+    val->type = type;
+    return val;
+}
+
 dDUFValue_t* d_DUFCreateTable(void)
 {
-    dDUFValue_t* val = (dDUFValue_t*)calloc(1, sizeof(dDUFValue_t));
+    dDUFValue_t* val = d_DUFCreateWithAllocator(D_DUF_TABLE, NULL);
     if (val == NULL) {
         return NULL;
     }
 
-    val->type = D_DUF_TABLE;
     return val;
 }
 
 dDUFValue_t* d_DUFCreateArray(void)
 {
-    dDUFValue_t* val = (dDUFValue_t*)calloc(1, sizeof(dDUFValue_t));
+    dDUFValue_t* val = d_DUFCreateWithAllocator(D_DUF_ARRAY, NULL);
     if (val == NULL) {
         return NULL;
     }
 
-    val->type = D_DUF_ARRAY;
     return val;
 }
 
 dDUFValue_t* d_DUFCreateInt(int64_t int_val)
 {
-    dDUFValue_t* val = (dDUFValue_t*)calloc(1, sizeof(dDUFValue_t));
+    dDUFValue_t* val = d_DUFCreateWithAllocator(D_DUF_INT, NULL);
     if (val == NULL) {
         return NULL;
     }
 
-    val->type = D_DUF_INT;
     val->value_int = int_val;
     return val;
 }
 
 dDUFValue_t* d_DUFCreateFloat(double float_val)
 {
-    dDUFValue_t* val = (dDUFValue_t*)calloc(1, sizeof(dDUFValue_t));
+    dDUFValue_t* val = d_DUFCreateWithAllocator(D_DUF_FLOAT, NULL);
     if (val == NULL) {
         return NULL;
     }
 
-    val->type = D_DUF_FLOAT;
     val->value_double = float_val;
     return val;
 }
 
 dDUFValue_t* d_DUFCreateBool(bool bool_val)
 {
-    dDUFValue_t* val = (dDUFValue_t*)calloc(1, sizeof(dDUFValue_t));
+    dDUFValue_t* val = d_DUFCreateWithAllocator(D_DUF_BOOL, NULL);
     if (val == NULL) {
         return NULL;
     }
 
-    val->type = D_DUF_BOOL;
     val->value_int = bool_val ? 1 : 0;  // Store bool as int
     return val;
 }
@@ -74,15 +103,14 @@ dDUFValue_t* d_DUFCreateString(const char* str)
         return NULL;
     }
 
-    dDUFValue_t* val = (dDUFValue_t*)calloc(1, sizeof(dDUFValue_t));
+    dDUFValue_t* val = d_DUFCreateWithAllocator(D_DUF_STRING, NULL);
     if (val == NULL) {
         return NULL;
     }
 
-    val->type = D_DUF_STRING;
-    val->value_string = strdup(str);
+    val->value_string = d_StrDup(val->allocator, str);
     if (val->value_string == NULL) {
-        free(val);
+        d_DUFFree(val);
         return NULL;
     }
 
@@ -121,14 +149,18 @@ void d_DUFFree(dDUFValue_t* val)
 
     // Free string fields
     if (val->key != NULL) {
-        free(val->key);
+        d_Free(val->allocator, val->key);
     }
     if (val->value_string != NULL) {
-        free(val->value_string);
+        d_Free(val->allocator, val->value_string);
     }
 
     // Free the node itself
-    free(val);
+    if (val->pool != NULL) {
+        d_PoolFree(val->pool, val);
+    } else {
+        d_Free(val->allocator, val);
+    }
 }
 
 void d_DUFErrorFree(dDUFError_t* err)
@@ -141,5 +173,5 @@ void d_DUFErrorFree(dDUFError_t* err)
         d_StringDestroy(err->message);
     }
 
-    free(err);
+    d_Free(err->allocator, err);
 }
@@ -0,0 +1,471 @@
+// File: src/dFileWriters.c - Buffered Atomic File Writer for Daedalus Library
+// Large staging buffer, checksum trailer, write-to-temp-then-rename commits, and background saves
+
+// Define feature test macros before any includes
+#define _POSIX_C_SOURCE 200809L  // For fileno, fsync, getpid
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+
+// Platform-specific durable rename
+#ifdef _WIN32
+    #include <windows.h>
+    #include <io.h>
+    #include <process.h>
+    #define FILE_SYNC(f) _commit(_fileno(f))
+    #define FILE_REPLACE(from, to) (MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? 0 : -1)
+    #define FILE_SYNC_PARENT(path) 0  // MOVEFILE_WRITE_THROUGH already flushes the rename
+    #define PROCESS_ID() ((unsigned long)_getpid())
+#else
+    #include <unistd.h>
+    #include <fcntl.h>
+    #define FILE_SYNC(f) fsync(fileno(f))
+    #define FILE_REPLACE(from, to) rename(from, to)
+    #define FILE_SYNC_PARENT(path) _d_SyncParentDirectory(path)
+    #define PROCESS_ID() ((unsigned long)getpid())
+#endif
+
+// Platform-specific worker thread for d_AsyncSaveStart
+#if defined(__EMSCRIPTEN__) || defined(_WIN32)
+    #define D_ASYNC_SAVE_HAS_THREADS 0  // Saves run on the calling thread
+#else
+    #include <pthread.h>
+    #define D_ASYNC_SAVE_HAS_THREADS 1
+#endif
+
+#define D_FILE_WRITER_DEFAULT_BUFFER (1u << 20)
+#define D_FILE_WRITER_TEMP_FORMAT "%s.%lu.%lu.tmp"  // path, process id, per-process counter
+
+#define D_CHECKSUM_PRIME1 0x9E3779B97F4A7C15ULL
+#define D_CHECKSUM_PRIME2 0xC2B2AE3D27D4EB4FULL
+#define D_CHECKSUM_SEED 0x27D4EB2F165667C5ULL
+
+// =============================================================================
+// CHECKSUM
+// =============================================================================
+
+static inline uint64_t _d_ChecksumRound(uint64_t state, uint64_t word)
+{
+    state ^= word * D_CHECKSUM_PRIME1;
+    state = (state << 31) | (state >> 33);
+    return state * D_CHECKSUM_PRIME2;
+}
+
+void d_ChecksumReset(dChecksum_t* checksum)
+{
+    if (!checksum) {
+        return;
+    }
+    checksum->state = D_CHECKSUM_SEED;
+    checksum->pending = 0;
+    checksum->pending_bytes = 0;
+    checksum->length = 0;
+}
+
+void d_ChecksumUpdate(dChecksum_t* checksum, const void* data, size_t size)
+{
+    if (!checksum || !data || size == 0) {
+        return;
+    }
+
+    const unsigned char* bytes = (const unsigned char*)data;
+    checksum->length += size;
+
+    // Top up a word left incomplete by the previous call
+    while (checksum->pending_bytes > 0 && size > 0) {
+        checksum->pending |= (uint64_t)*bytes++ << (checksum->pending_bytes * 8);
+        size--;
+        if (++checksum->pending_bytes == 8) {
+            checksum->state = _d_ChecksumRound(checksum->state, checksum->pending);
+            checksum->pending = 0;
+            checksum->pending_bytes = 0;
+        }
+    }
+
+    // Whole words; one multiply-rotate-multiply chain per 8 bytes
+    uint64_t state = checksum->state;
+    for (; size >= 8; size -= 8, bytes += 8) {
+        uint64_t word = 0;
+        for (int b = 0; b < 8; b++) {
+            word |= (uint64_t)bytes[b] << (b * 8);
+        }
+        state = _d_ChecksumRound(state, word);
+    }
+    checksum->state = state;
+
+    for (; size > 0; size--) {
+        checksum->pending |= (uint64_t)*bytes++ << (checksum->pending_bytes * 8);
+        checksum->pending_bytes++;
+    }
+}
+
+uint64_t d_ChecksumFinal(const dChecksum_t* checksum)
+{
+    if (!checksum) {
+        return 0;
+    }
+
+    uint64_t state = checksum->state;
+    if (checksum->pending_bytes > 0) {
+        state = _d_ChecksumRound(state, checksum->pending);
+    }
+
+    // Fold in the length so trailing zero bytes change the result, then avalanche
+    state ^= checksum->length;
+    state ^= state >> 33;
+    state *= 0xFF51AFD7ED558CCDULL;
+    state ^= state >> 33;
+    state *= 0xC4CEB9FE1A85EC53ULL;
+    state ^= state >> 33;
+    return state;
+}
+
+// =============================================================================
+// FILE WRITER
+// =============================================================================
+
+// Distinguishes temp files of writers opened on the same path by one process
+static unsigned long g_file_writer_serial = 0;
+
+#ifndef _WIN32
+/**
+ * @brief Internal helper: fsync the directory holding `path` so a rename into it survives a crash.
+ *
+ * @return 0 on success, nonzero on failure
+ */
+static int _d_SyncParentDirectory(const char* path)
+{
+    const char* slash = strrchr(path, '/');
+    char directory[4096];
+    if (!slash) {
+        strcpy(directory, ".");
+    } else if (slash == path) {
+        strcpy(directory, "/");
+    } else if ((size_t)(slash - path) < sizeof(directory)) {
+        memcpy(directory, path, (size_t)(slash - path));
+        directory[slash - path] = '\0';
+    } else {
+        return -1;
+    }
+
+    int fd = open(directory, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    int result = fsync(fd);
+    close(fd);
+    return result;
+}
+#endif
+
+/**
+ * @brief Internal helper: Write out the staged bytes.
+ *
+ * @return 0 on success, 1 on failure (the writer is marked failed)
+ */
+static int _d_FileWriterFlush(dFileWriter_t* writer)
+{
+    if (writer->used > 0 && fwrite(writer->buffer, 1, writer->used, writer->file) != writer->used) {
+        d_LogErrorF("Failed to write %zu bytes to '%s'.", writer->used, writer->temp_path);
+        writer->failed = true;
+    }
+    writer->used = 0;
+    return writer->failed ? 1 : 0;
+}
+
+/**
+ * @brief Internal helper: Free a writer whose file is already closed.
+ */
+static void _d_FileWriterFree(dFileWriter_t* writer)
+{
+    const dAllocator_t* allocator = writer->allocator;
+    d_Free(allocator, writer->buffer);
+    d_Free(allocator, writer->path);
+    d_Free(allocator, writer->temp_path);
+    d_Free(allocator, writer);
+}
+
+dFileWriter_t* d_FileWriterOpen(const char* filename, size_t buffer_size)
+{
+    if (!filename || filename[0] == '\0') {
+        d_LogError("Invalid filename for file writer.");
+        return NULL;
+    }
+
+    // Writers run on async save worker threads, so they never use the (possibly
+    // single-threaded) default allocator
+    const dAllocator_t* allocator = d_GetHeapAllocator();
+    dFileWriter_t* writer = (dFileWriter_t*)d_Calloc(allocator, 1, sizeof(dFileWriter_t));
+    if (!writer) {
+        d_LogError("Failed to allocate file writer.");
+        return NULL;
+    }
+    writer->allocator = allocator;
+
+    // Unique per writer, so concurrent saves to one path never share a temp file
+    unsigned long serial = __atomic_fetch_add(&g_file_writer_serial, 1, __ATOMIC_RELAXED);
+    int temp_length = snprintf(NULL, 0, D_FILE_WRITER_TEMP_FORMAT, filename, PROCESS_ID(), serial);
+
+    writer->buffer_size = buffer_size > 0 ? buffer_size : D_FILE_WRITER_DEFAULT_BUFFER;
+    writer->buffer = (char*)d_Alloc(allocator, writer->buffer_size);
+    writer->path = d_StrDup(allocator, filename);
+    writer->temp_path = temp_length > 0 ? (char*)d_Alloc(allocator, (size_t)temp_length + 1) : NULL;
+    if (!writer->buffer || !writer->path || !writer->temp_path) {
+        d_LogError("Failed to allocate file writer buffers.");
+        _d_FileWriterFree(writer);
+        return NULL;
+    }
+    snprintf(writer->temp_path, (size_t)temp_length + 1, D_FILE_WRITER_TEMP_FORMAT, filename, PROCESS_ID(), serial);
+
+    writer->file = fopen(writer->temp_path, "wb");
+    if (!writer->file) {
+        d_LogErrorF("Failed to open temporary file '%s' for writing.", writer->temp_path);
+        _d_FileWriterFree(writer);
+        return NULL;
+    }
+    // Our buffer replaces stdio's, so large writes reach the kernel without an extra copy
+    setvbuf(writer->file, NULL, _IONBF, 0);
+
+    d_ChecksumReset(&writer->checksum);
+    return writer;
+}
+
+int d_FileWriterWrite(dFileWriter_t* writer, const void* data, size_t size)
+{
+    if (!writer || (!data && size > 0)) {
+        d_LogError("Invalid parameters for file writer write.");
+        return 1;
+    }
+    if (writer->failed) {
+        return 1;
+    }
+
+    d_ChecksumUpdate(&writer->checksum, data, size);
+    writer->offset += size;
+
+    if (size <= writer->buffer_size - writer->used) {
+        memcpy(writer->buffer + writer->used, data, size);
+        writer->used += size;
+        return 0;
+    }
+
+    if (_d_FileWriterFlush(writer) != 0) {
+        return 1;
+    }
+
+    if (size >= writer->buffer_size) {
+        if (fwrite(data, 1, size, writer->file) != size) {
+            d_LogErrorF("Failed to write %zu bytes to '%s'.", size, writer->temp_path);
+            writer->failed = true;
+            return 1;
+        }
+        return 0;
+    }
+
+    memcpy(writer->buffer, data, size);
+    writer->used = size;
+    return 0;
+}
+
+int d_FileWriterWriteZeros(dFileWriter_t* writer, size_t size)
+{
+    if (!writer) {
+        d_LogError("Invalid parameters for file writer write.");
+        return 1;
+    }
+
+    while (size > 0 && !writer->failed) {
+        if (writer->used == writer->buffer_size && _d_FileWriterFlush(writer) != 0) {
+            break;
+        }
+        size_t chunk = MIN(size, writer->buffer_size - writer->used);
+        memset(writer->buffer + writer->used, 0, chunk);
+        d_ChecksumUpdate(&writer->checksum, writer->buffer + writer->used, chunk);
+        writer->used += chunk;
+        writer->offset += chunk;
+        size -= chunk;
+    }
+    return writer->failed ? 1 : 0;
+}
+
+uint64_t d_FileWriterTell(const dFileWriter_t* writer)
+{
+    return writer ? writer->offset : 0;
+}
+
+int d_FileWriterCommit(dFileWriter_t** writer)
+{
+    if (!writer || !*writer) {
+        d_LogError("Attempted to commit NULL file writer.");
+        return 1;
+    }
+
+    dFileWriter_t* w = *writer;
+    *writer = NULL;
+
+    // The trailer itself is not part of the checksum
+    uint64_t checksum = d_ChecksumFinal(&w->checksum);
+    if (!w->failed && w->buffer_size - w->used < sizeof(checksum)) {
+        _d_FileWriterFlush(w);
+    }
+    if (!w->failed) {
+        memcpy(w->buffer + w->used, &checksum, sizeof(checksum));
+        w->used += sizeof(checksum);
+        _d_FileWriterFlush(w);
+    }
+
+    // The data must be on disk before the rename makes it visible
+    if (!w->failed && (fflush(w->file) != 0 || FILE_SYNC(w->file) != 0)) {
+        d_LogErrorF("Failed to sync '%s' to disk.", w->temp_path);
+        w->failed = true;
+    }
+    if (fclose(w->file) != 0) {
+        w->failed = true;
+    }
+    if (!w->failed && FILE_REPLACE(w->temp_path, w->path) != 0) {
+        d_LogErrorF("Failed to rename '%s' to '%s'.", w->temp_path, w->path);
+        w->failed = true;
+    }
+    // The rename is only durable once the directory entry is on disk too
+    if (!w->failed && FILE_SYNC_PARENT(w->path) != 0) {
+        d_LogErrorF("Failed to sync the directory of '%s' to disk.", w->path);
+        w->failed = true;
+    }
+
+    int result = w->failed ? 1 : 0;
+    if (result != 0) {
+        remove(w->temp_path);
+    }
+    _d_FileWriterFree(w);
+    return result;
+}
+
+void d_FileWriterAbort(dFileWriter_t** writer)
+{
+    if (!writer || !*writer) {
+        return;
+    }
+
+    dFileWriter_t* w = *writer;
+    fclose(w->file);
+    remove(w->temp_path);
+    _d_FileWriterFree(w);
+    *writer = NULL;
+}
+
+// =============================================================================
+// ASYNC SAVE
+// =============================================================================
+
+/**
+ * @brief Internal helper: Write the snapshot, free it, report the result.
+ *
+ * Runs on the worker thread, or inline when no thread is available.
+ */
+static void _d_AsyncSaveRun(dAsyncSave_t* save)
+{
+    int result = save->write_func(save->filename, save->snapshot) == 0 ? 0 : 1;
+    if (save->free_func) {
+        save->free_func(save->snapshot);
+    }
+    save->snapshot = NULL;
+
+    if (save->callback) {
+        save->callback(save->filename, result, save->user_data);
+    }
+    // Publish last, so a poll that sees the result also sees the callback's effects
+    __atomic_store_n(&save->status, result == 0 ? D_ASYNC_SAVE_DONE : D_ASYNC_SAVE_FAILED, __ATOMIC_RELEASE);
+}
+
+#if D_ASYNC_SAVE_HAS_THREADS
+static void* _d_AsyncSaveThread(void* arg)
+{
+    _d_AsyncSaveRun((dAsyncSave_t*)arg);
+    return NULL;
+}
+#endif
+
+dAsyncSave_t* d_AsyncSaveStart(const char* filename, void* snapshot, dAsyncSaveWriteFunc write_func,
+                               dAsyncSaveFreeFunc free_func, dAsyncSaveCallback callback, void* user_data)
+{
+    // Freed after the worker thread finishes; the heap allocator is safe to share with it
+    const dAllocator_t* allocator = d_GetHeapAllocator();
+    dAsyncSave_t* save = NULL;
+    if (!filename || filename[0] == '\0' || !write_func) {
+        d_LogError("Invalid parameters for async save.");
+    } else if (!(save = (dAsyncSave_t*)d_Calloc(allocator, 1, sizeof(dAsyncSave_t))) ||
+               !(save->filename = d_StrDup(allocator, filename))) {
+        d_LogError("Failed to allocate async save.");
+        d_Free(allocator, save);
+        save = NULL;
+    }
+    if (!save) {
+        // The snapshot is ours either way
+        if (free_func) {
+            free_func(snapshot);
+        }
+        return NULL;
+    }
+
+    save->allocator = allocator;
+    save->snapshot = snapshot;
+    save->write_func = write_func;
+    save->free_func = free_func;
+    save->callback = callback;
+    save->user_data = user_data;
+    save->status = D_ASYNC_SAVE_PENDING;
+
+#if D_ASYNC_SAVE_HAS_THREADS
+    pthread_t* thread = (pthread_t*)d_Alloc(allocator, sizeof(pthread_t));
+    if (thread && pthread_create(thread, NULL, _d_AsyncSaveThread, save) == 0) {
+        save->thread = thread;
+        return save;
+    }
+    d_Free(allocator, thread);
+    d_LogDebugF("No worker thread for async save of '%s'; saving on the calling thread.", filename);
+#endif
+
+    _d_AsyncSaveRun(save);
+    return save;
+}
+
+dAsyncSaveStatus_t d_AsyncSavePoll(const dAsyncSave_t* save)
+{
+    if (!save) {
+        return D_ASYNC_SAVE_FAILED;
+    }
+    return (dAsyncSaveStatus_t)__atomic_load_n(&save->status, __ATOMIC_ACQUIRE);
+}
+
+int d_AsyncSaveWait(dAsyncSave_t* save)
+{
+    if (!save) {
+        d_LogError("Attempted to wait on NULL async save.");
+        return 1;
+    }
+
+#if D_ASYNC_SAVE_HAS_THREADS
+    if (save->thread) {
+        pthread_join(*(pthread_t*)save->thread, NULL);
+        d_Free(save->allocator, save->thread);
+        save->thread = NULL;
+    }
+#endif
+
+    return d_AsyncSavePoll(save) == D_ASYNC_SAVE_DONE ? 0 : 1;
+}
+
+void d_AsyncSaveDestroy(dAsyncSave_t** save)
+{
+    if (!save || !*save) {
+        return;
+    }
+
+    d_AsyncSaveWait(*save);
+    d_Free((*save)->allocator, (*save)->filename);
+    d_Free((*save)->allocator, *save);
+    *save = NULL;
+}
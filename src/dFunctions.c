@@ -32,8 +32,7 @@ size_t d_HashInt(const void* key, size_t key_size)
     (void)key_size; // Unused parameter
     if (!key) return 0;
     
-    int* int_key = (int*)key;
-    return (size_t)(*int_key * 2654435761U); // Knuth's multiplicative constant
+    return d_HashIntValue(*(const int*)key);
 }
 
 /**
@@ -56,19 +55,8 @@ size_t d_HashString(const void* key, size_t key_size)
 {
     if (!key) return 0;
     
-    const char* str = *(const char**)key;
-    if (!str) return 0;
-    
-    const unsigned char* data = (const unsigned char*)str;
-    size_t hash = 2166136261U; // FNV-1a offset basis
-    
-    while (*data) {
-        hash ^= *data++;
-        hash *= 16777619U; // FNV-1a prime
-    }
-    
     (void)key_size; // Unused for null-terminated strings
-    return hash;
+    return d_HashStringValue(*(const char**)key);
 }
 
 size_t d_HashStringLiteral(const void* key, size_t key_size)
@@ -155,21 +143,7 @@ size_t d_HashPointer(const void* key, size_t key_size)
     (void)key_size; // Unused parameter
     if (!key) return 0;
     
-    void** ptr_key = (void**)key;
-    uintptr_t addr = (uintptr_t)(*ptr_key);
-    
-    // Mix the pointer bits
-    if (sizeof(void*) == 8) {
-        // 64-bit pointers
-        uint64_t hash_val = (uint64_t)addr;
-        hash_val ^= hash_val >> 33;
-        hash_val *= 0xff51afd7ed558ccdULL;
-        hash_val ^= hash_val >> 33;
-        return (size_t)hash_val;
-    } else {
-        // 32-bit pointers
-        return (size_t)(addr * 2654435761U);
-    }
+    return d_HashPointerValue(*(void* const*)key);
 }
 
 // =============================================================================
@@ -0,0 +1,380 @@
+// File: src/dHeaps.c - Priority Queues for Daedalus Library
+// Binary and 4-ary min-heaps over a dArray_t, with generational handles for decrease-key and removal
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+#include "dSlots.h"
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+static inline uint8_t* _d_HeapNode(const dHeap_t* heap, size_t index)
+{
+    return (uint8_t*)heap->nodes->data + index * heap->nodes->element_size;
+}
+
+/**
+ * @brief Internal helper: Store `item`, owned by `slot`, at node `index`.
+ */
+static inline void _d_HeapPlace(dHeap_t* heap, size_t index, const void* item, uint32_t slot)
+{
+    memcpy(_d_HeapNode(heap, index), item, heap->nodes->element_size);
+    ((uint32_t*)heap->node_slot->data)[index] = slot;
+    _d_SlotAt(heap->slots, slot)->index = (uint32_t)index;
+}
+
+/**
+ * @brief Internal helper: Move `item` up from the hole at `index` to where it belongs.
+ *
+ * Parents slide down into the hole one at a time, so each level costs one copy rather
+ * than a three-way swap.
+ *
+ * @return The node index `item` ended up at
+ */
+static inline size_t _d_HeapSiftUpArity(dHeap_t* heap, size_t index, const void* item, uint32_t slot,
+                                        unsigned arity)
+{
+    const uint32_t* owners = (const uint32_t*)heap->node_slot->data;
+    while (index > 0) {
+        size_t parent = (index - 1) / arity;
+        const uint8_t* node = _d_HeapNode(heap, parent);
+        if (heap->compare(item, node, heap->user_data) >= 0) {
+            break;
+        }
+        _d_HeapPlace(heap, index, node, owners[parent]);
+        index = parent;
+    }
+    _d_HeapPlace(heap, index, item, slot);
+    return index;
+}
+
+/**
+ * @brief Internal helper: Move `item` down from the hole at `index` to where it belongs.
+ */
+static inline void _d_HeapSiftDownArity(dHeap_t* heap, size_t index, const void* item, uint32_t slot,
+                                        unsigned arity)
+{
+    size_t count = heap->nodes->count;
+    const uint32_t* owners = (const uint32_t*)heap->node_slot->data;
+    for (;;) {
+        size_t first = index * arity + 1;
+        if (first >= count) {
+            break;
+        }
+        size_t last = MIN(first + arity, count);
+        size_t best = first;
+        const uint8_t* best_node = _d_HeapNode(heap, first);
+        for (size_t child = first + 1; child < last; child++) {
+            const uint8_t* node = _d_HeapNode(heap, child);
+            if (heap->compare(node, best_node, heap->user_data) < 0) {
+                best = child;
+                best_node = node;
+            }
+        }
+        if (heap->compare(best_node, item, heap->user_data) >= 0) {
+            break;
+        }
+        _d_HeapPlace(heap, index, best_node, owners[best]);
+        index = best;
+    }
+    _d_HeapPlace(heap, index, item, slot);
+}
+
+// Fixed-arity dispatch so the child loop and the parent division compile to constants
+static size_t _d_HeapSiftUp(dHeap_t* heap, size_t index, const void* item, uint32_t slot)
+{
+    if (heap->arity == 4) {
+        return _d_HeapSiftUpArity(heap, index, item, slot, 4);
+    }
+    return _d_HeapSiftUpArity(heap, index, item, slot, 2);
+}
+
+static void _d_HeapSiftDown(dHeap_t* heap, size_t index, const void* item, uint32_t slot)
+{
+    if (heap->arity == 4) {
+        _d_HeapSiftDownArity(heap, index, item, slot, 4);
+    } else {
+        _d_HeapSiftDownArity(heap, index, item, slot, 2);
+    }
+}
+
+/**
+ * @brief Internal helper: Take node `index` out of the heap, refilling the hole with the last node.
+ */
+static void _d_HeapRemoveAt(dHeap_t* heap, size_t index, void* out)
+{
+    size_t size = heap->nodes->element_size;
+    uint32_t* owners = (uint32_t*)heap->node_slot->data;
+    if (out) {
+        memcpy(out, _d_HeapNode(heap, index), size);
+    }
+    _d_SlotRetire(heap->slots, &heap->free_head, owners[index]);
+
+    size_t last = --heap->nodes->count;
+    heap->node_slot->count--;
+    if (index == last) {
+        return;
+    }
+
+    // The last node is placed from a copy because the hole may be its final spot
+    uint32_t moved_slot = owners[last];
+    memcpy(heap->hole, _d_HeapNode(heap, last), size);
+    if (_d_HeapSiftUp(heap, index, heap->hole, moved_slot) == index) {
+        _d_HeapSiftDown(heap, index, heap->hole, moved_slot);
+    }
+}
+
+// =============================================================================
+// HEAP LIFECYCLE
+// =============================================================================
+
+dHeap_t* d_HeapInit(size_t element_size, size_t capacity, unsigned arity, dSortCompareFunc compare,
+                    void* user_data)
+{
+    return d_HeapInitWithAllocator(element_size, capacity, arity, compare, user_data, NULL);
+}
+
+dHeap_t* d_HeapInitWithAllocator(size_t element_size, size_t capacity, unsigned arity,
+                                 dSortCompareFunc compare, void* user_data, const dAllocator_t* allocator)
+{
+    if (element_size == 0 || !compare || (arity != 2 && arity != 4)) {
+        d_LogError("Invalid parameters for heap (arity must be 2 or 4).");
+        return NULL;
+    }
+    if (capacity >= D_SLOT_NIL) {
+        d_LogErrorF("Heap capacity %zu exceeds the 32-bit handle range.", capacity);
+        return NULL;
+    }
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+
+    dHeap_t* heap = (dHeap_t*)d_Calloc(allocator, 1, sizeof(dHeap_t));
+    if (!heap) {
+        d_LogError("Failed to allocate heap.");
+        return NULL;
+    }
+
+    heap->allocator = allocator;
+    heap->free_head = D_SLOT_NIL;
+    heap->arity = arity;
+    heap->compare = compare;
+    heap->user_data = user_data;
+    heap->nodes = d_ArrayInitWithAllocator(capacity, element_size, allocator);
+    heap->node_slot = d_ArrayInitWithAllocator(capacity, sizeof(uint32_t), allocator);
+    heap->slots = d_ArrayInitWithAllocator(capacity, sizeof(_dSlot_t), allocator);
+    heap->hole = d_Alloc(allocator, element_size);
+    if (!heap->nodes || !heap->node_slot || !heap->slots || !heap->hole) {
+        d_LogError("Failed to allocate heap arrays.");
+        d_HeapDestroy(&heap);
+        return NULL;
+    }
+    return heap;
+}
+
+dHeap_t* d_HeapInitFromArray(const dArray_t* array, size_t element_size, unsigned arity,
+                             dSortCompareFunc compare, void* user_data, dSlotHandle_t* handles)
+{
+    if (!array) {
+        d_LogError("Attempted to build heap from NULL array.");
+        return NULL;
+    }
+    if (element_size != array->element_size) {
+        d_LogErrorF("Heap element size %zu does not match the array's %zu.", element_size, array->element_size);
+        return NULL;
+    }
+    size_t count = array->count;
+    dHeap_t* heap = d_HeapInitWithAllocator(element_size, count, arity, compare, user_data,
+                                            array->allocator);
+    if (!heap) {
+        return NULL;
+    }
+
+    // Element i starts at node i owned by slot i, so its handle is fixed before any sifting
+    if (count > 0) {
+        memcpy(heap->nodes->data, array->data, count * element_size);
+    }
+    uint32_t* owners = (uint32_t*)heap->node_slot->data;
+    _dSlot_t* slots = (_dSlot_t*)heap->slots->data;
+    for (size_t i = 0; i < count; i++) {
+        owners[i] = (uint32_t)i;
+        slots[i].index = (uint32_t)i;
+        slots[i].generation = 1;
+        if (handles) {
+            handles[i] = _d_SlotMakeHandle((uint32_t)i, 1);
+        }
+    }
+    heap->nodes->count = count;
+    heap->node_slot->count = count;
+    heap->slots->count = count;
+
+    // Floyd's construction: sift down every parent, deepest first
+    if (count > 1) {
+        for (size_t i = (count - 2) / arity + 1; i-- > 0;) {
+            memcpy(heap->hole, _d_HeapNode(heap, i), element_size);
+            _d_HeapSiftDown(heap, i, heap->hole, owners[i]);
+        }
+    }
+    return heap;
+}
+
+int d_HeapDestroy(dHeap_t** heap)
+{
+    if (!heap || !*heap) {
+        d_LogError("Attempted to destroy NULL heap.");
+        return 1;
+    }
+
+    dHeap_t* h = *heap;
+    if (h->nodes) {
+        d_ArrayDestroy(h->nodes);
+    }
+    if (h->node_slot) {
+        d_ArrayDestroy(h->node_slot);
+    }
+    if (h->slots) {
+        d_ArrayDestroy(h->slots);
+    }
+    d_Free(h->allocator, h->hole);
+    d_Free(h->allocator, h);
+    *heap = NULL;
+    return 0;
+}
+
+// =============================================================================
+// HEAP OPERATIONS
+// =============================================================================
+
+dSlotHandle_t d_HeapPush(dHeap_t* heap, const void* data)
+{
+    if (!heap) {
+        d_LogError("Attempted to push onto NULL heap.");
+        return D_SLOT_HANDLE_NULL;
+    }
+
+    if (heap->free_head == D_SLOT_NIL && heap->slots->count >= D_SLOT_NIL) {
+        d_LogError("Heap is out of 32-bit handle indices.");
+        return D_SLOT_HANDLE_NULL;
+    }
+
+    // Every push is undone on a later failure so the heap is left unchanged
+    if (!_d_SlotArrayPush(heap->nodes)) {
+        d_LogError("Failed to grow heap storage.");
+        return D_SLOT_HANDLE_NULL;
+    }
+    if (!_d_SlotArrayPush(heap->node_slot)) {
+        heap->nodes->count--;
+        d_LogError("Failed to grow heap storage.");
+        return D_SLOT_HANDLE_NULL;
+    }
+
+    uint32_t slot;
+    _dSlot_t* entry = _d_SlotAcquire(heap->slots, &heap->free_head, &slot);
+    if (!entry) {
+        heap->nodes->count--;
+        heap->node_slot->count--;
+        d_LogError("Failed to grow heap storage.");
+        return D_SLOT_HANDLE_NULL;
+    }
+
+    if (data) {
+        memcpy(heap->hole, data, heap->nodes->element_size);
+    } else {
+        memset(heap->hole, 0, heap->nodes->element_size);
+    }
+    _d_HeapSiftUp(heap, heap->nodes->count - 1, heap->hole, slot);
+    return _d_SlotMakeHandle(slot, entry->generation);
+}
+
+int d_HeapPop(dHeap_t* heap, void* out)
+{
+    if (!heap || heap->nodes->count == 0) {
+        return 1;
+    }
+    _d_HeapRemoveAt(heap, 0, out);
+    return 0;
+}
+
+void* d_HeapPeek(const dHeap_t* heap)
+{
+    if (!heap || heap->nodes->count == 0) {
+        return NULL;
+    }
+    return heap->nodes->data;
+}
+
+int d_HeapDecreaseKey(dHeap_t* heap, dSlotHandle_t handle, const void* data)
+{
+    if (!heap || !data) {
+        d_LogError("Invalid parameters for heap decrease-key.");
+        return 1;
+    }
+    _dSlot_t* entry = _d_SlotResolve(heap->slots, handle);
+    if (!entry) {
+        d_LogDebug("Heap handle is stale or invalid.");
+        return 1;
+    }
+    size_t index = entry->index;
+    if (heap->compare(data, _d_HeapNode(heap, index), heap->user_data) > 0) {
+        d_LogError("Heap decrease-key given a value that sorts after the current one.");
+        return 1;
+    }
+
+    memcpy(heap->hole, data, heap->nodes->element_size);
+    _d_HeapSiftUp(heap, index, heap->hole, (uint32_t)handle);
+    return 0;
+}
+
+int d_HeapRemove(dHeap_t* heap, dSlotHandle_t handle, void* out)
+{
+    if (!heap) {
+        d_LogError("Attempted to remove from NULL heap.");
+        return 1;
+    }
+    _dSlot_t* entry = _d_SlotResolve(heap->slots, handle);
+    if (!entry) {
+        d_LogDebug("Heap handle is stale or invalid.");
+        return 1;
+    }
+    _d_HeapRemoveAt(heap, entry->index, out);
+    return 0;
+}
+
+void* d_HeapGet(const dHeap_t* heap, dSlotHandle_t handle)
+{
+    if (!heap) {
+        return NULL;
+    }
+    _dSlot_t* entry = _d_SlotResolve(heap->slots, handle);
+    return entry ? _d_HeapNode(heap, entry->index) : NULL;
+}
+
+bool d_HeapContains(const dHeap_t* heap, dSlotHandle_t handle)
+{
+    return heap && _d_SlotResolve(heap->slots, handle) != NULL;
+}
+
+int d_HeapClear(dHeap_t* heap)
+{
+    if (!heap) {
+        d_LogError("Attempted to clear NULL heap.");
+        return 1;
+    }
+
+    const uint32_t* owners = (const uint32_t*)heap->node_slot->data;
+    for (size_t i = 0; i < heap->nodes->count; i++) {
+        _d_SlotRetire(heap->slots, &heap->free_head, owners[i]);
+    }
+    heap->nodes->count = 0;
+    heap->node_slot->count = 0;
+    return 0;
+}
+
+size_t d_HeapGetCount(const dHeap_t* heap)
+{
+    return heap ? heap->nodes->count : 0;
+}
@@ -0,0 +1,86 @@
+// File: src/dInternal.h - Helpers and layouts shared by several Daedalus source files
+// Internal to the library: not installed, and not part of Daedalus.h
+
+#ifndef D_INTERNAL_H
+#define D_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "Daedalus.h"
+
+#if !defined(__EMSCRIPTEN__) && !defined(_WIN32)
+    #include <unistd.h>
+    #define D_INTERNAL_HAS_SYSCONF 1
+#else
+    #define D_INTERNAL_HAS_SYSCONF 0
+#endif
+
+/**
+ * @brief Internal helper: Natural alignment for a field of the given size.
+ *
+ * Returns the largest power of two (capped at 16) that divides `size`, which is
+ * the strictest alignment any C type of that size can require.
+ */
+static inline size_t _d_NaturalAlignment(size_t size)
+{
+    size_t align = 1;
+    while (align < 16 && (size % (align * 2)) == 0) {
+        align *= 2;
+    }
+    return align;
+}
+
+/**
+ * @brief Internal helper: Number of online CPUs, or 1 if unknown or threads are unavailable.
+ */
+static inline size_t _d_HardwareThreads(void)
+{
+#if D_INTERNAL_HAS_SYSCONF
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+#else
+    return 1;
+#endif
+}
+
+// Chained tables keep each key in one block: chain node, entry, key, then value
+#define D_CHAIN_BLOCK_ALIGN(n) (((n) + 15) & ~(size_t)15)
+#define D_CHAIN_BLOCK_KEY_OFFSET D_CHAIN_BLOCK_ALIGN(sizeof(dLinkedList_t) + sizeof(dTableEntry_t))
+
+static inline size_t _d_ChainBlockValueOffset(size_t key_size)
+{
+    return D_CHAIN_BLOCK_KEY_OFFSET + D_CHAIN_BLOCK_ALIGN(key_size);
+}
+
+static inline size_t _d_ChainBlockSize(size_t key_size, size_t value_size)
+{
+    return _d_ChainBlockValueOffset(key_size) + value_size;
+}
+
+/**
+ * @brief Internal helper: Lay out a chain node, entry and key/value copies in `block`.
+ *
+ * `block` must hold _d_ChainBlockSize(key_size, value_size) bytes and be 16-byte
+ * aligned. The node is returned unlinked with no pool; the name buffer is left
+ * unset, since table chains are never searched by name.
+ */
+static inline dLinkedList_t* _d_ChainBlockFill(void* block, const void* key, size_t key_size,
+                                               const void* value, size_t value_size, size_t hash)
+{
+    dLinkedList_t* node = (dLinkedList_t*)block;
+    dTableEntry_t* entry = (dTableEntry_t*)(node + 1);
+    entry->key_data = (uint8_t*)block + D_CHAIN_BLOCK_KEY_OFFSET;
+    entry->value_data = (uint8_t*)block + _d_ChainBlockValueOffset(key_size);
+    memcpy(entry->key_data, key, key_size);
+    memcpy(entry->value_data, value, value_size);
+    entry->hash = hash;
+
+    node->data = entry;
+    node->buffer[0] = '\0';
+    node->next = NULL;
+    node->pool = NULL;
+    return node;
+}
+
+#endif // D_INTERNAL_H
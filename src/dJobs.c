@@ -0,0 +1,671 @@
+// File: src/dJobs.c - Work-Stealing Job System for Daedalus Library
+// Chase-Lev deques per worker, a shared injection queue, counters, and parallel-for over arrays
+
+// Define feature test macros before any includes
+#define _POSIX_C_SOURCE 200809L  // For sysconf, sched_yield
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+#include "dInternal.h"
+
+// Platform-specific worker threads
+#if defined(__EMSCRIPTEN__) || defined(_WIN32)
+    #define D_JOBS_HAS_THREADS 0  // No workers: every job runs on the submitting thread
+    #define D_JOBS_THREAD_LOCAL
+    #define D_JOBS_YIELD() ((void)0)
+#else
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+    #define D_JOBS_HAS_THREADS 1
+    #define D_JOBS_THREAD_LOCAL __thread
+    #define D_JOBS_YIELD() sched_yield()
+#endif
+
+#define D_JOBS_MAX_WORKERS 64
+#define D_JOBS_DEQUE_CAPACITY 4096u      // Per worker; a full deque runs new jobs inline
+#define D_JOBS_INJECTION_CAPACITY 4096u  // Shared queue for submissions from other threads
+#define D_JOBS_IDLE_SPINS 64             // Failed searches before a worker goes to sleep
+#define D_JOBS_CACHE_LINE 64u
+#define D_JOBS_RECORD_BATCH 32u          // Job records moved between a worker's free list and the pool
+
+// Parallel-for splits into about this many chunks per thread, each at least this many bytes
+#define D_JOBS_CHUNKS_PER_THREAD 4
+#define D_JOBS_MIN_CHUNK_BYTES 4096u
+
+typedef struct _dJob_t {
+    struct _dJob_t* next;  // Link while held back on a counter or free; first, as the pool links blocks there
+    dJobFunc func;
+    void* data;
+    dJobCounter_t* counter;
+} _dJob_t;
+
+// Chase-Lev deque: the owner pushes and pops at `bottom`, thieves take from `top`
+typedef struct {
+    int64_t top;
+    unsigned char pad0[D_JOBS_CACHE_LINE - sizeof(int64_t)];
+    int64_t bottom;
+    unsigned char pad1[D_JOBS_CACHE_LINE - sizeof(int64_t)];
+    _dJob_t** buffer;
+    dJobSystem_t* system;
+    size_t index;
+    _dJob_t* free_jobs;  // Owner-only free records, so workers never take a pool cache slot
+    size_t free_count;
+#if D_JOBS_HAS_THREADS
+    pthread_t thread;
+    bool started;
+#endif
+} _dJobWorker_t;
+
+#if D_JOBS_HAS_THREADS
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+} _dJobSleep_t;
+#endif
+
+// The worker running on this thread, or NULL for threads outside every job system
+static D_JOBS_THREAD_LOCAL _dJobWorker_t* d_job_current_worker = NULL;
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+static inline _dJobWorker_t* _d_JobWorker(const dJobSystem_t* jobs, size_t index)
+{
+    return (_dJobWorker_t*)jobs->workers + index;
+}
+
+/**
+ * @brief Internal helper: This thread's worker in `jobs`, or NULL if it is not one of them.
+ */
+static inline _dJobWorker_t* _d_JobSelf(const dJobSystem_t* jobs)
+{
+    _dJobWorker_t* self = d_job_current_worker;
+    return self && self->system == jobs ? self : NULL;
+}
+
+/**
+ * @brief Internal helper: Take a job record. Workers use their own free list, refilled in batches.
+ */
+static _dJob_t* _d_JobAlloc(dJobSystem_t* jobs)
+{
+    _dJobWorker_t* self = _d_JobSelf(jobs);
+    if (!self) {
+        return (_dJob_t*)d_PoolAlloc(jobs->job_pool);
+    }
+    if (!self->free_jobs) {
+        self->free_count = d_PoolAllocBatch(jobs->job_pool, (void**)&self->free_jobs, D_JOBS_RECORD_BATCH);
+        if (!self->free_jobs) {
+            return NULL;
+        }
+    }
+    _dJob_t* job = self->free_jobs;
+    self->free_jobs = job->next;
+    self->free_count--;
+    return job;
+}
+
+/**
+ * @brief Internal helper: Release a job record to the running worker's free list, or to the pool.
+ */
+static void _d_JobFree(dJobSystem_t* jobs, _dJob_t* job)
+{
+    _dJobWorker_t* self = _d_JobSelf(jobs);
+    if (!self) {
+        d_PoolFree(jobs->job_pool, job);
+        return;
+    }
+
+    job->next = self->free_jobs;
+    self->free_jobs = job;
+    if (++self->free_count < 2 * D_JOBS_RECORD_BATCH) {
+        return;
+    }
+
+    // Records submitted from outside pile up on workers; hand a batch back to the pool
+    _dJob_t* tail = self->free_jobs;
+    for (size_t i = 1; i < D_JOBS_RECORD_BATCH; i++) {
+        tail = tail->next;
+    }
+    _dJob_t* batch = self->free_jobs;
+    self->free_jobs = tail->next;
+    self->free_count -= D_JOBS_RECORD_BATCH;
+    tail->next = NULL;
+    d_PoolFreeBatch(jobs->job_pool, batch);
+}
+
+static inline void _d_JobCounterLock(dJobCounter_t* counter)
+{
+    int spins = 0;
+    while (__atomic_exchange_n(&counter->lock, 1, __ATOMIC_ACQUIRE)) {
+        while (__atomic_load_n(&counter->lock, __ATOMIC_RELAXED)) {
+            if (++spins == D_JOBS_IDLE_SPINS) {
+                spins = 0;
+                D_JOBS_YIELD();
+            }
+        }
+    }
+}
+
+static inline void _d_JobCounterUnlock(dJobCounter_t* counter)
+{
+    __atomic_store_n(&counter->lock, 0, __ATOMIC_RELEASE);
+}
+
+// =============================================================================
+// CHASE-LEV DEQUE
+// =============================================================================
+
+/**
+ * @brief Internal helper: Push onto the owner's end. Owner thread only.
+ *
+ * @return 0 on success, 1 if the deque is full
+ */
+static int _d_DequePush(_dJobWorker_t* worker, _dJob_t* job)
+{
+    int64_t bottom = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED);
+    int64_t top = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+    if (bottom - top >= (int64_t)D_JOBS_DEQUE_CAPACITY) {
+        return 1;
+    }
+    __atomic_store_n(&worker->buffer[bottom & (D_JOBS_DEQUE_CAPACITY - 1)], job, __ATOMIC_RELAXED);
+    __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Pop the newest job from the owner's end. Owner thread only.
+ */
+static _dJob_t* _d_DequePop(_dJobWorker_t* worker)
+{
+    int64_t bottom = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED) - 1;
+    __atomic_store_n(&worker->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t top = __atomic_load_n(&worker->top, __ATOMIC_RELAXED);
+
+    if (top > bottom) {
+        __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    _dJob_t* job = __atomic_load_n(&worker->buffer[bottom & (D_JOBS_DEQUE_CAPACITY - 1)], __ATOMIC_RELAXED);
+    if (top == bottom) {
+        // Last job: race any thief for it
+        if (!__atomic_compare_exchange_n(&worker->top, &top, top + 1, false,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            job = NULL;
+        }
+        __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+    return job;
+}
+
+/**
+ * @brief Internal helper: Take the oldest job from a worker's deque. Any thread.
+ */
+static _dJob_t* _d_DequeSteal(_dJobWorker_t* worker)
+{
+    int64_t top = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t bottom = __atomic_load_n(&worker->bottom, __ATOMIC_ACQUIRE);
+    if (top >= bottom) {
+        return NULL;
+    }
+    _dJob_t* job = __atomic_load_n(&worker->buffer[top & (D_JOBS_DEQUE_CAPACITY - 1)], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&worker->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return NULL;  // Lost to the owner or another thief
+    }
+    return job;
+}
+
+// =============================================================================
+// SCHEDULING
+// =============================================================================
+
+static void _d_JobPush(dJobSystem_t* jobs, _dJob_t* job);
+
+/**
+ * @brief Internal helper: Run a job, then count it done and release anything waiting on its counter.
+ */
+static void _d_JobRun(dJobSystem_t* jobs, _dJob_t* job)
+{
+    job->func(job->data);
+    dJobCounter_t* counter = job->counter;
+    _d_JobFree(jobs, job);
+    if (!counter) {
+        return;
+    }
+
+    // The final decrement and the hand-off of held-back jobs happen under the lock, and
+    // waiters do not return while it is held, so the counter is never touched after it is gone
+    _d_JobCounterLock(counter);
+    _dJob_t* released = NULL;
+    if (__atomic_sub_fetch(&counter->pending, 1, __ATOMIC_ACQ_REL) == 0) {
+        released = (_dJob_t*)counter->waiting;
+        counter->waiting = NULL;
+    }
+    _d_JobCounterUnlock(counter);
+
+    while (released) {
+        _dJob_t* next = released->next;
+        _d_JobPush(jobs, released);
+        released = next;
+    }
+}
+
+/**
+ * @brief Internal helper: Wake one sleeping worker after new work was queued.
+ */
+static void _d_JobWake(dJobSystem_t* jobs)
+{
+    __atomic_add_fetch(&jobs->signal, 1, __ATOMIC_SEQ_CST);
+#if D_JOBS_HAS_THREADS
+    if (__atomic_load_n(&jobs->sleepers, __ATOMIC_SEQ_CST) > 0) {
+        _dJobSleep_t* sleep = (_dJobSleep_t*)jobs->sleep;
+        pthread_mutex_lock(&sleep->mutex);
+        pthread_cond_signal(&sleep->cond);
+        pthread_mutex_unlock(&sleep->mutex);
+    }
+#endif
+}
+
+/**
+ * @brief Internal helper: Queue a ready job, or run it here when there is nowhere to put it.
+ */
+static void _d_JobPush(dJobSystem_t* jobs, _dJob_t* job)
+{
+    _dJobWorker_t* self = _d_JobSelf(jobs);
+    int queued;
+    if (jobs->worker_count == 0) {
+        queued = 0;
+    } else if (self) {
+        queued = _d_DequePush(self, job) == 0;
+    } else {
+        queued = d_RingBufferEnqueue(jobs->injection, &job) == 0;
+    }
+
+    if (!queued) {
+        _d_JobRun(jobs, job);
+        return;
+    }
+    _d_JobWake(jobs);
+}
+
+/**
+ * @brief Internal helper: Find a job: own deque first, then the shared queue, then steal.
+ */
+static _dJob_t* _d_JobFind(dJobSystem_t* jobs, _dJobWorker_t* self)
+{
+    _dJob_t* job = NULL;
+    if (self && (job = _d_DequePop(self)) != NULL) {
+        return job;
+    }
+    if (jobs->worker_count > 0 && d_RingBufferDequeue(jobs->injection, &job) == 0) {
+        return job;
+    }
+
+    // Start at the next worker so thieves spread out instead of all hitting worker 0
+    size_t start = self ? self->index + 1 : 0;
+    for (size_t i = 0; i < jobs->worker_count; i++) {
+        _dJobWorker_t* victim = _d_JobWorker(jobs, (start + i) % jobs->worker_count);
+        if (victim != self && (job = _d_DequeSteal(victim)) != NULL) {
+            return job;
+        }
+    }
+    return NULL;
+}
+
+#if D_JOBS_HAS_THREADS
+static void* _d_JobWorkerMain(void* arg)
+{
+    _dJobWorker_t* self = (_dJobWorker_t*)arg;
+    dJobSystem_t* jobs = self->system;
+    _dJobSleep_t* sleep = (_dJobSleep_t*)jobs->sleep;
+    d_job_current_worker = self;
+
+    int idle = 0;
+    while (!__atomic_load_n(&jobs->shutdown, __ATOMIC_ACQUIRE)) {
+        size_t seen = __atomic_load_n(&jobs->signal, __ATOMIC_SEQ_CST);
+        _dJob_t* job = _d_JobFind(jobs, self);
+        if (job) {
+            _d_JobRun(jobs, job);
+            idle = 0;
+            continue;
+        }
+        if (++idle < D_JOBS_IDLE_SPINS) {
+            D_JOBS_YIELD();
+            continue;
+        }
+
+        // Sleep until a submission bumps the signal; registering as a sleeper before the
+        // final check means _d_JobWake either sees us or we see its bump
+        pthread_mutex_lock(&sleep->mutex);
+        __atomic_add_fetch(&jobs->sleepers, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&jobs->signal, __ATOMIC_SEQ_CST) == seen &&
+               !__atomic_load_n(&jobs->shutdown, __ATOMIC_ACQUIRE)) {
+            pthread_cond_wait(&sleep->cond, &sleep->mutex);
+        }
+        __atomic_sub_fetch(&jobs->sleepers, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&sleep->mutex);
+        idle = 0;
+    }
+
+    d_PoolFreeBatch(jobs->job_pool, self->free_jobs);
+    self->free_jobs = NULL;
+    self->free_count = 0;
+    d_job_current_worker = NULL;
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Internal helper: Free a job system's memory; the first `worker_slots` workers may own deques.
+ */
+static void _d_JobSystemFree(dJobSystem_t* jobs, size_t worker_slots)
+{
+    const dAllocator_t* allocator = jobs->allocator;
+    if (jobs->workers) {
+        for (size_t w = 0; w < worker_slots; w++) {
+            d_Free(allocator, _d_JobWorker(jobs, w)->buffer);
+        }
+        d_Free(allocator, jobs->workers);
+    }
+    if (jobs->injection) {
+        d_RingBufferDestroy(&jobs->injection);
+    }
+    d_Free(allocator, jobs->sleep);
+    d_PoolDestroy(&jobs->job_pool);
+    d_Free(allocator, jobs);
+}
+
+// =============================================================================
+// JOB SYSTEM LIFECYCLE
+// =============================================================================
+
+dJobSystem_t* d_JobSystemInit(size_t num_workers)
+{
+    return d_JobSystemInitWithAllocator(num_workers, NULL);
+}
+
+dJobSystem_t* d_JobSystemInitWithAllocator(size_t num_workers, const dAllocator_t* allocator)
+{
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+    if (num_workers == 0) {
+        num_workers = _d_HardwareThreads();
+    }
+    num_workers = MIN(num_workers, (size_t)D_JOBS_MAX_WORKERS);
+#if !D_JOBS_HAS_THREADS
+    num_workers = 0;
+#endif
+
+    dJobSystem_t* jobs = (dJobSystem_t*)d_Calloc(allocator, 1, sizeof(dJobSystem_t));
+    if (!jobs) {
+        d_LogError("Failed to allocate job system.");
+        return NULL;
+    }
+    jobs->allocator = allocator;
+    jobs->job_pool = d_PoolCreateWithAllocator(sizeof(_dJob_t), 0, allocator);
+    if (!jobs->job_pool) {
+        d_Free(allocator, jobs);
+        return NULL;
+    }
+    if (num_workers == 0) {
+        return jobs;
+    }
+
+#if D_JOBS_HAS_THREADS
+    jobs->injection = d_RingBufferInitWithAllocator(D_JOBS_INJECTION_CAPACITY, sizeof(_dJob_t*),
+                                                    D_RING_BUFFER_MPMC, allocator);
+    jobs->workers = d_Calloc(allocator, num_workers, sizeof(_dJobWorker_t));
+    _dJobSleep_t* sleep = (_dJobSleep_t*)d_Calloc(allocator, 1, sizeof(_dJobSleep_t));
+    jobs->sleep = sleep;
+    int failed = !jobs->injection || !jobs->workers || !sleep;
+    for (size_t w = 0; !failed && w < num_workers; w++) {
+        _dJobWorker_t* worker = _d_JobWorker(jobs, w);
+        worker->buffer = (_dJob_t**)d_Calloc(allocator, D_JOBS_DEQUE_CAPACITY, sizeof(_dJob_t*));
+        worker->system = jobs;
+        worker->index = w;
+        failed = !worker->buffer;
+    }
+    if (failed) {
+        d_LogError("Failed to allocate job system queues.");
+        _d_JobSystemFree(jobs, jobs->workers ? num_workers : 0);
+        return NULL;
+    }
+    pthread_mutex_init(&sleep->mutex, NULL);
+    pthread_cond_init(&sleep->cond, NULL);
+
+    // Workers count as present only once the whole array is set up
+    jobs->worker_count = num_workers;
+    for (size_t w = 0; w < num_workers; w++) {
+        _dJobWorker_t* worker = _d_JobWorker(jobs, w);
+        worker->started = pthread_create(&worker->thread, NULL, _d_JobWorkerMain, worker) == 0;
+        if (!worker->started) {
+            d_LogErrorF("Failed to start job worker %zu.", w);
+        }
+    }
+#endif
+    return jobs;
+}
+
+int d_JobSystemDestroy(dJobSystem_t** jobs)
+{
+    if (!jobs || !*jobs) {
+        d_LogError("Attempted to destroy NULL job system.");
+        return 1;
+    }
+
+    dJobSystem_t* js = *jobs;
+#if D_JOBS_HAS_THREADS
+    if (js->worker_count > 0) {
+        _dJobSleep_t* sleep = (_dJobSleep_t*)js->sleep;
+        pthread_mutex_lock(&sleep->mutex);
+        __atomic_store_n(&js->shutdown, 1, __ATOMIC_RELEASE);
+        pthread_cond_broadcast(&sleep->cond);
+        pthread_mutex_unlock(&sleep->mutex);
+        for (size_t w = 0; w < js->worker_count; w++) {
+            if (_d_JobWorker(js, w)->started) {
+                pthread_join(_d_JobWorker(js, w)->thread, NULL);
+            }
+        }
+
+        // Whatever is still queued runs here; jobs it spawns go to the shared queue
+        _dJob_t* job;
+        while ((job = _d_JobFind(js, NULL)) != NULL) {
+            _d_JobRun(js, job);
+        }
+        pthread_mutex_destroy(&sleep->mutex);
+        pthread_cond_destroy(&sleep->cond);
+    }
+#endif
+
+    _d_JobSystemFree(js, js->worker_count);
+    *jobs = NULL;
+    return 0;
+}
+
+// =============================================================================
+// SUBMISSION AND WAITING
+// =============================================================================
+
+int d_JobSystemSubmit(dJobSystem_t* jobs, dJobFunc func, void* data, dJobCounter_t* counter,
+                      dJobCounter_t* depends_on)
+{
+    if (!jobs || !func) {
+        d_LogError("Invalid parameters for job submission.");
+        return 1;
+    }
+
+    _dJob_t* job = _d_JobAlloc(jobs);
+    if (!job) {
+        d_LogError("Failed to allocate job.");
+        return 1;
+    }
+    job->func = func;
+    job->data = data;
+    job->counter = counter;
+    job->next = NULL;
+    if (counter) {
+        __atomic_add_fetch(&counter->pending, 1, __ATOMIC_RELAXED);
+    }
+
+    // Held back jobs are queued by whichever job brings `depends_on` to zero
+    if (depends_on) {
+        _d_JobCounterLock(depends_on);
+        if (__atomic_load_n(&depends_on->pending, __ATOMIC_ACQUIRE) > 0) {
+            job->next = (_dJob_t*)depends_on->waiting;
+            depends_on->waiting = job;
+            _d_JobCounterUnlock(depends_on);
+            return 0;
+        }
+        _d_JobCounterUnlock(depends_on);
+    }
+
+    _d_JobPush(jobs, job);
+    return 0;
+}
+
+void d_JobSystemWait(dJobSystem_t* jobs, dJobCounter_t* counter)
+{
+    if (!jobs || !counter) {
+        return;
+    }
+
+    _dJobWorker_t* self = _d_JobSelf(jobs);
+    while (__atomic_load_n(&counter->pending, __ATOMIC_ACQUIRE) > 0) {
+        _dJob_t* job = _d_JobFind(jobs, self);
+        if (job) {
+            _d_JobRun(jobs, job);
+        } else {
+            D_JOBS_YIELD();
+        }
+    }
+    // The last finisher may still hold the lock while it hands off held-back jobs
+    while (__atomic_load_n(&counter->lock, __ATOMIC_ACQUIRE)) {
+        D_JOBS_YIELD();
+    }
+}
+
+bool d_JobCounterIsDone(const dJobCounter_t* counter)
+{
+    return !counter || __atomic_load_n(&counter->pending, __ATOMIC_ACQUIRE) == 0;
+}
+
+size_t d_JobSystemGetWorkerCount(const dJobSystem_t* jobs)
+{
+    return jobs ? jobs->worker_count : 0;
+}
+
+// =============================================================================
+// PARALLEL FOR
+// =============================================================================
+
+typedef struct {
+    dParallelForFunc func;
+    void* user_data;
+    uint8_t* base;
+    size_t element_size;
+    size_t count;
+    size_t chunk;
+    size_t next;  // First element of the next unclaimed chunk
+} _dParallelRange_t;
+
+/**
+ * @brief Internal helper: Claim and run chunks until the range is used up.
+ *
+ * Every participant pulls chunks from one shared cursor, so a slow chunk never leaves
+ * other threads idle while work remains.
+ */
+static void _d_ParallelRangeJob(void* data)
+{
+    _dParallelRange_t* range = (_dParallelRange_t*)data;
+    for (;;) {
+        size_t first = __atomic_fetch_add(&range->next, range->chunk, __ATOMIC_RELAXED);
+        if (first >= range->count) {
+            return;
+        }
+        size_t n = MIN(range->chunk, range->count - first);
+        range->func(range->base + first * range->element_size, first, n, range->user_data);
+    }
+}
+
+/**
+ * @brief Internal helper: Chunk length in elements, rounded up to whole cache lines.
+ */
+static size_t _d_ParallelChunkSize(size_t count, size_t element_size, size_t threads, size_t requested)
+{
+    size_t chunk = requested;
+    if (chunk == 0 && threads == 1) {
+        return count;  // Nothing to spread over: one pass over the whole range
+    }
+    if (chunk == 0) {
+        chunk = (count + threads * D_JOBS_CHUNKS_PER_THREAD - 1) / (threads * D_JOBS_CHUNKS_PER_THREAD);
+        chunk = MAX(chunk, (D_JOBS_MIN_CHUNK_BYTES + element_size - 1) / element_size);
+    }
+
+    // Smallest element count that spans a whole number of cache lines
+    size_t line_elements = D_JOBS_CACHE_LINE;
+    size_t a = D_JOBS_CACHE_LINE, b = element_size;
+    while (b != 0) {
+        size_t t = a % b;
+        a = b;
+        b = t;
+    }
+    line_elements /= a;
+    chunk = (chunk + line_elements - 1) / line_elements * line_elements;
+    return MIN(chunk, count);
+}
+
+static int _d_ParallelFor(dJobSystem_t* jobs, void* data, size_t count, size_t element_size, size_t chunk_size,
+                          dParallelForFunc func, void* user_data)
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    size_t threads = (jobs ? jobs->worker_count : 0) + 1;
+    _dParallelRange_t range = { func, user_data, (uint8_t*)data, element_size, count,
+                                _d_ParallelChunkSize(count, element_size, threads, chunk_size), 0 };
+    size_t chunks = (count + range.chunk - 1) / range.chunk;
+    if (threads == 1 || chunks == 1) {
+        _d_ParallelRangeJob(&range);
+        return 0;
+    }
+
+    // One helper job per extra thread that has a chunk to take; this thread works too
+    dJobCounter_t done = { 0, 0, NULL };
+    size_t helpers = MIN(threads - 1, chunks - 1);
+    for (size_t h = 0; h < helpers; h++) {
+        if (d_JobSystemSubmit(jobs, _d_ParallelRangeJob, &range, &done, NULL) != 0) {
+            break;
+        }
+    }
+    _d_ParallelRangeJob(&range);
+    d_JobSystemWait(jobs, &done);
+    return 0;
+}
+
+int d_ArrayParallelFor(dJobSystem_t* jobs, dArray_t* array, size_t chunk_size, dParallelForFunc func,
+                       void* user_data)
+{
+    if (!array || !func) {
+        d_LogError("Invalid parameters for array parallel-for.");
+        return 1;
+    }
+    return _d_ParallelFor(jobs, array->data, array->count, array->element_size, chunk_size, func, user_data);
+}
+
+int d_StaticArrayParallelFor(dJobSystem_t* jobs, dStaticArray_t* array, size_t chunk_size,
+                             dParallelForFunc func, void* user_data)
+{
+    if (!array || !func) {
+        d_LogError("Invalid parameters for static array parallel-for.");
+        return 1;
+    }
+    return _d_ParallelFor(jobs, array->data, array->count, array->element_size, chunk_size, func, user_data);
+}
@@ -0,0 +1,395 @@
+// File: src/dLRUCaches.c - Bounded LRU Cache for Daedalus Library
+// A FLAT dTable_t index over an array of nodes threaded onto an intrusive recency list
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+#include "dInternal.h"
+
+#define D_LRU_NIL SIZE_MAX
+#define D_LRU_MIN_NODES 16
+
+// Links and bookkeeping at the front of every node; key and value follow
+typedef struct {
+    size_t prev;  // Toward the most recently used end
+    size_t next;  // Toward the least recently used end; free-list link when unused
+    size_t cost;  // Bytes charged against max_bytes
+} _dLRULink_t;
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+static inline _dLRULink_t* _d_LRUNode(const dLRUCache_t* cache, size_t node)
+{
+    return (_dLRULink_t*)((uint8_t*)cache->nodes + node * cache->node_size);
+}
+
+static inline void* _d_LRUNodeKey(const dLRUCache_t* cache, size_t node)
+{
+    return (uint8_t*)cache->nodes + node * cache->node_size + cache->key_offset;
+}
+
+static inline void* _d_LRUNodeValue(const dLRUCache_t* cache, size_t node)
+{
+    return (uint8_t*)cache->nodes + node * cache->node_size + cache->value_offset;
+}
+
+/**
+ * @brief Internal helper: Detach a node from the recency list.
+ */
+static void _d_LRUUnlink(dLRUCache_t* cache, size_t node)
+{
+    _dLRULink_t* link = _d_LRUNode(cache, node);
+    if (link->prev != D_LRU_NIL) {
+        _d_LRUNode(cache, link->prev)->next = link->next;
+    } else {
+        cache->head = link->next;
+    }
+    if (link->next != D_LRU_NIL) {
+        _d_LRUNode(cache, link->next)->prev = link->prev;
+    } else {
+        cache->tail = link->prev;
+    }
+}
+
+/**
+ * @brief Internal helper: Attach a detached node as the most recently used.
+ */
+static void _d_LRUPushFront(dLRUCache_t* cache, size_t node)
+{
+    _dLRULink_t* link = _d_LRUNode(cache, node);
+    link->prev = D_LRU_NIL;
+    link->next = cache->head;
+    if (cache->head != D_LRU_NIL) {
+        _d_LRUNode(cache, cache->head)->prev = node;
+    } else {
+        cache->tail = node;
+    }
+    cache->head = node;
+}
+
+/**
+ * @brief Internal helper: Take a node from the free list, growing the array if needed.
+ *
+ * @return Node number, or D_LRU_NIL on allocation failure
+ */
+static size_t _d_LRUAllocNode(dLRUCache_t* cache)
+{
+    if (cache->free_head != D_LRU_NIL) {
+        size_t node = cache->free_head;
+        cache->free_head = _d_LRUNode(cache, node)->next;
+        return node;
+    }
+
+    if (cache->nodes_used == cache->node_capacity) {
+        size_t new_capacity = cache->node_capacity * 2;
+        void* grown = d_Realloc(cache->allocator, cache->nodes, new_capacity * cache->node_size);
+        if (!grown) {
+            d_LogError("Failed to grow LRU cache node array.");
+            return D_LRU_NIL;
+        }
+        cache->nodes = grown;
+        cache->node_capacity = new_capacity;
+    }
+    return cache->nodes_used++;
+}
+
+/**
+ * @brief Internal helper: Drop an entry from the index and list and free its node.
+ *
+ * Runs the evict callback first, while key and value are still intact.
+ */
+static void _d_LRUDropNode(dLRUCache_t* cache, size_t node)
+{
+    void* key = _d_LRUNodeKey(cache, node);
+    if (cache->on_evict) {
+        cache->on_evict(key, _d_LRUNodeValue(cache, node), cache->evict_user_data);
+    }
+    d_TableRemove(cache->index, key);
+    _d_LRUUnlink(cache, node);
+
+    _dLRULink_t* link = _d_LRUNode(cache, node);
+    cache->total_bytes -= link->cost;
+    cache->count--;
+    link->next = cache->free_head;
+    cache->free_head = node;
+}
+
+/**
+ * @brief Internal helper: Evict from the tail until both limits hold.
+ *
+ * The most recently used entry is never evicted, so a put always keeps its own entry.
+ */
+static void _d_LRUEnforceLimits(dLRUCache_t* cache)
+{
+    while (cache->count > 1 &&
+           ((cache->max_entries && cache->count > cache->max_entries) ||
+            (cache->max_bytes && cache->total_bytes > cache->max_bytes))) {
+        _d_LRUDropNode(cache, cache->tail);
+        cache->evictions++;
+    }
+}
+
+// =============================================================================
+// LRU CACHE CREATION AND DESTRUCTION
+// =============================================================================
+
+dLRUCache_t* d_LRUCacheInit(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                            dTableCompareFunc compare_func, size_t max_entries, size_t max_bytes)
+{
+    return d_LRUCacheInitWithAllocator(key_size, value_size, hash_func, compare_func, max_entries, max_bytes, NULL);
+}
+
+dLRUCache_t* d_LRUCacheInitWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                         dTableCompareFunc compare_func, size_t max_entries, size_t max_bytes,
+                                         const dAllocator_t* allocator)
+{
+    if (key_size == 0 || value_size == 0 || !hash_func || !compare_func) {
+        d_LogError("Invalid parameters for LRU cache initialization.");
+        return NULL;
+    }
+
+    if (max_entries == 0 && max_bytes == 0) {
+        d_LogError("LRU cache needs an entry limit, a byte limit, or both.");
+        return NULL;
+    }
+
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+    dLRUCache_t* cache = (dLRUCache_t*)d_Calloc(allocator, 1, sizeof(dLRUCache_t));
+    if (!cache) {
+        d_LogError("Failed to allocate memory for LRU cache structure.");
+        return NULL;
+    }
+    cache->allocator = allocator;
+
+    // Lay key and value out at their natural alignment after the links
+    size_t key_align = _d_NaturalAlignment(key_size);
+    size_t value_align = _d_NaturalAlignment(value_size);
+    size_t node_align = MAX(MAX(key_align, value_align), sizeof(size_t));
+    cache->key_offset = (sizeof(_dLRULink_t) + key_align - 1) / key_align * key_align;
+    cache->value_offset = (cache->key_offset + key_size + value_align - 1) / value_align * value_align;
+    cache->node_size = (cache->value_offset + value_size + node_align - 1) / node_align * node_align;
+
+    // A bounded entry count allocates every node now (+1: a put links before evicting)
+    cache->node_capacity = max_entries ? max_entries + 1 : D_LRU_MIN_NODES;
+    cache->nodes = d_Alloc(allocator, cache->node_capacity * cache->node_size);
+    cache->index = d_TableInitWithAllocator(key_size, sizeof(size_t), hash_func, compare_func,
+                                            cache->node_capacity + cache->node_capacity / 4, D_TABLE_MODE_FLAT,
+                                            allocator);
+    if (!cache->nodes || !cache->index) {
+        d_LogError("Failed to allocate LRU cache storage.");
+        d_Free(allocator, cache->nodes);
+        if (cache->index) {
+            d_TableDestroy(&cache->index);
+        }
+        d_Free(allocator, cache);
+        return NULL;
+    }
+
+    cache->free_head = D_LRU_NIL;
+    cache->head = D_LRU_NIL;
+    cache->tail = D_LRU_NIL;
+    cache->key_size = key_size;
+    cache->value_size = value_size;
+    cache->max_entries = max_entries;
+    cache->max_bytes = max_bytes;
+
+    d_LogDebugF("Created LRU cache (max_entries: %zu, max_bytes: %zu, node_size: %zu).",
+                max_entries, max_bytes, cache->node_size);
+    return cache;
+}
+
+int d_LRUCacheDestroy(dLRUCache_t** cache)
+{
+    if (!cache || !*cache) {
+        d_LogWarning("Attempted to destroy NULL LRU cache.");
+        return 1;
+    }
+
+    dLRUCache_t* c = *cache;
+    if (c->on_evict) {
+        for (size_t node = c->head; node != D_LRU_NIL; node = _d_LRUNode(c, node)->next) {
+            c->on_evict(_d_LRUNodeKey(c, node), _d_LRUNodeValue(c, node), c->evict_user_data);
+        }
+    }
+
+    d_TableDestroy(&c->index);
+    d_Free(c->allocator, c->nodes);
+    d_Free(c->allocator, c);
+    *cache = NULL;
+    return 0;
+}
+
+void d_LRUCacheSetEvictCallback(dLRUCache_t* cache, dLRUEvictFunc on_evict, void* user_data)
+{
+    if (!cache) {
+        d_LogError("Attempted to set evict callback on NULL LRU cache.");
+        return;
+    }
+
+    cache->on_evict = on_evict;
+    cache->evict_user_data = user_data;
+}
+
+// =============================================================================
+// LRU CACHE OPERATIONS
+// =============================================================================
+
+void* d_LRUCacheGet(dLRUCache_t* cache, const void* key)
+{
+    if (!cache || !key) {
+        d_LogError("Invalid parameters for getting value from LRU cache.");
+        return NULL;
+    }
+
+    size_t* node_ptr = (size_t*)d_TableGet(cache->index, key);
+    if (!node_ptr) {
+        cache->misses++;
+        return NULL;
+    }
+
+    size_t node = *node_ptr;
+    if (node != cache->head) {
+        _d_LRUUnlink(cache, node);
+        _d_LRUPushFront(cache, node);
+    }
+    cache->hits++;
+    return _d_LRUNodeValue(cache, node);
+}
+
+void* d_LRUCachePeek(const dLRUCache_t* cache, const void* key)
+{
+    if (!cache || !key) {
+        d_LogError("Invalid parameters for peeking into LRU cache.");
+        return NULL;
+    }
+
+    size_t* node_ptr = (size_t*)d_TableGet(cache->index, key);
+    return node_ptr ? _d_LRUNodeValue(cache, *node_ptr) : NULL;
+}
+
+int d_LRUCachePut(dLRUCache_t* cache, const void* key, const void* value)
+{
+    if (!cache) {
+        d_LogError("Attempted to put into NULL LRU cache.");
+        return 1;
+    }
+
+    return d_LRUCachePutWithCost(cache, key, value, cache->key_size + cache->value_size);
+}
+
+int d_LRUCachePutWithCost(dLRUCache_t* cache, const void* key, const void* value, size_t cost)
+{
+    if (!cache || !key || !value) {
+        d_LogError("Invalid parameters for putting value into LRU cache.");
+        return 1;
+    }
+
+    if (cache->max_bytes && cost > cache->max_bytes) {
+        d_LogErrorF("LRU cache entry cost %zu exceeds the cache's byte limit %zu.", cost, cache->max_bytes);
+        return 1;
+    }
+
+    size_t* node_ptr = (size_t*)d_TableGet(cache->index, key);
+    size_t node;
+    if (node_ptr) {
+        // Replace in place; the old value leaves the cache
+        node = *node_ptr;
+        if (cache->on_evict) {
+            cache->on_evict(_d_LRUNodeKey(cache, node), _d_LRUNodeValue(cache, node), cache->evict_user_data);
+        }
+        _d_LRUUnlink(cache, node);
+        cache->total_bytes -= _d_LRUNode(cache, node)->cost;
+    } else {
+        node = _d_LRUAllocNode(cache);
+        if (node == D_LRU_NIL) {
+            return 1;
+        }
+        if (d_TableSet(cache->index, key, &node) != 0) {
+            d_LogError("Failed to index new LRU cache entry.");
+            _d_LRUNode(cache, node)->next = cache->free_head;
+            cache->free_head = node;
+            return 1;
+        }
+        memcpy(_d_LRUNodeKey(cache, node), key, cache->key_size);
+        cache->count++;
+    }
+
+    memcpy(_d_LRUNodeValue(cache, node), value, cache->value_size);
+    _d_LRUNode(cache, node)->cost = cost;
+    cache->total_bytes += cost;
+    _d_LRUPushFront(cache, node);
+
+    _d_LRUEnforceLimits(cache);
+    return 0;
+}
+
+int d_LRUCacheRemove(dLRUCache_t* cache, const void* key)
+{
+    if (!cache || !key) {
+        d_LogError("Invalid parameters for removing from LRU cache.");
+        return 1;
+    }
+
+    size_t* node_ptr = (size_t*)d_TableGet(cache->index, key);
+    if (!node_ptr) {
+        return 1;
+    }
+
+    _d_LRUDropNode(cache, *node_ptr);
+    return 0;
+}
+
+int d_LRUCacheClear(dLRUCache_t* cache)
+{
+    if (!cache) {
+        d_LogError("Attempted to clear NULL LRU cache.");
+        return 1;
+    }
+
+    // Hand every node back to the free list in one pass
+    for (size_t node = cache->head; node != D_LRU_NIL; ) {
+        _dLRULink_t* link = _d_LRUNode(cache, node);
+        size_t next = link->next;
+        if (cache->on_evict) {
+            cache->on_evict(_d_LRUNodeKey(cache, node), _d_LRUNodeValue(cache, node), cache->evict_user_data);
+        }
+        link->next = cache->free_head;
+        cache->free_head = node;
+        node = next;
+    }
+
+    d_TableClear(cache->index);
+    cache->head = D_LRU_NIL;
+    cache->tail = D_LRU_NIL;
+    cache->count = 0;
+    cache->total_bytes = 0;
+    return 0;
+}
+
+size_t d_LRUCacheGetCount(const dLRUCache_t* cache)
+{
+    if (!cache) {
+        d_LogError("Attempted to get count from NULL LRU cache.");
+        return 0;
+    }
+
+    return cache->count;
+}
+
+void d_LRUCacheGetStats(const dLRUCache_t* cache, size_t* hits, size_t* misses, size_t* evictions)
+{
+    if (!cache) {
+        d_LogError("Attempted to get stats from NULL LRU cache.");
+        return;
+    }
+
+    if (hits) *hits = cache->hits;
+    if (misses) *misses = cache->misses;
+    if (evictions) *evictions = cache->evictions;
+}
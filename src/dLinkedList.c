@@ -4,6 +4,55 @@
 
 #include "Daedalus.h"
 
+// Pool new nodes are taken from, or NULL for the default allocator; see d_LinkedListSetNodePool()
+static dPool_t* d_list_node_pool = NULL;
+
+void d_LinkedListSetNodePool( dPool_t* pool )
+{
+  if ( pool && pool->block_size < sizeof( dLinkedList_t ) )
+  {
+    d_LogErrorF("Pool blocks of %zu bytes cannot hold a %zu-byte list node; node pool unchanged.",
+                pool->block_size, sizeof( dLinkedList_t ));
+    return;
+  }
+  __atomic_store_n( &d_list_node_pool, pool, __ATOMIC_RELEASE );
+}
+
+/**
+ * @brief Internal helper: Allocate a bare node from the node pool or the default allocator.
+ *
+ * The node records its pool and the default allocator current at creation, so node and
+ * data go back to where they came from even if either setting changes later.
+ */
+static dLinkedList_t* _d_AllocLinkedListNode( void )
+{
+  const dAllocator_t* allocator = d_GetDefaultAllocator();
+  dPool_t* pool = __atomic_load_n( &d_list_node_pool, __ATOMIC_ACQUIRE );
+  dLinkedList_t* node = pool ? ( dLinkedList_t* )d_PoolAlloc( pool )
+                             : ( dLinkedList_t* )d_Alloc( allocator, sizeof( dLinkedList_t ) );
+  if ( node != NULL )
+  {
+    node->pool = pool;
+    node->allocator = allocator;
+  }
+  return node;
+}
+
+/**
+ * @brief Internal helper: Return a node (not its data) to where it came from.
+ */
+static void _d_FreeLinkedListNode( dLinkedList_t* node )
+{
+  if ( node->pool )
+  {
+    d_PoolFree( node->pool, node );
+  }
+  else
+  {
+    d_Free( node->allocator, node );
+  }
+}
+
 /**
  * @brief Internal helper function: Creates and initializes a single new linked list node.
  *
@@ -26,7 +75,7 @@
  */
 static dLinkedList_t* _d_CreateLinkedListNodeInternal( void *data, char *name, size_t size )
 {
-  dLinkedList_t* newNode = ( dLinkedList_t* )malloc( sizeof( dLinkedList_t ) );
+  dLinkedList_t* newNode = _d_AllocLinkedListNode();
 
   if ( newNode == NULL )
   {
@@ -34,11 +83,11 @@ static dLinkedList_t* _d_CreateLinkedListNodeInternal( void *data, char *name, s
     return NULL;
   }
 
-  newNode->data = malloc( size );
+  newNode->data = d_Alloc( newNode->allocator, size );
   if ( newNode->data == NULL )
   {
     d_LogError("Failed to allocate memory for data in internal linked list node.");
-    free( newNode );
+    _d_FreeLinkedListNode( newNode );
     return NULL;
   }
 
@@ -55,7 +104,7 @@ static dLinkedList_t* _d_CreateLinkedListNodeInternal( void *data, char *name, s
 
 dLinkedList_t* d_InitLinkedList( void *data, char *name, size_t size )
 {
-  dLinkedList_t* newList = ( dLinkedList_t* )malloc( sizeof( dLinkedList_t ) );
+  dLinkedList_t* newList = _d_AllocLinkedListNode();
 
   if ( newList == NULL )
   {
@@ -63,11 +112,11 @@ dLinkedList_t* d_InitLinkedList( void *data, char *name, size_t size )
     return NULL; // Return NULL on failure instead of exiting
   }
 
-  newList->data = malloc( size );
+  newList->data = d_Alloc( newList->allocator, size );
   if ( newList->data == NULL )
   {
     d_LogError("Failed to allocate memory for data in linked list head node."); // Use Daedalus logging
-    free( newList ); // Clean up the node itself
+    _d_FreeLinkedListNode( newList ); // Clean up the node itself
     return NULL; // Return NULL on failure
   }
 
@@ -95,9 +144,9 @@ int d_DestroyLinkedList( dLinkedList_t **head )
         // Free the data held by the node if it was dynamically allocated
         if ( current->data )
         {
-            free( current->data );
+            d_Free( current->allocator, current->data );
         }
-        free( current ); // Free the node itself
+        _d_FreeLinkedListNode( current ); // Free the node itself
         current = next_node;
     }
 
@@ -190,8 +239,8 @@ int d_RemoveIndexFromLinkedList( dLinkedList_t **head, int index )
     if ( index == 0 )
     {
         *head = current->next; // Move head to the next node
-        if ( current->data ) free( current->data ); // Free data
-        free( current ); // Free the node itself
+        if ( current->data ) d_Free( current->allocator, current->data ); // Free data
+        _d_FreeLinkedListNode( current ); // Free the node itself
         return 0;
     }
 
@@ -213,8 +262,8 @@ int d_RemoveIndexFromLinkedList( dLinkedList_t **head, int index )
     // Node found: re-link the previous node to skip the current node
     prev->next = current->next;
 
-    if ( current->data ) free( current->data ); // Free data
-    free( current ); // Free the node itself
+    if ( current->data ) d_Free( current->allocator, current->data ); // Free data
+    _d_FreeLinkedListNode( current ); // Free the node itself
 
     return 0; // Success
 }
@@ -239,8 +288,8 @@ int d_RemoveDataFromLinkedList( dLinkedList_t **head, char *name )
     if ( strcmp( current->buffer, name ) == 0 )
     {
         *head = current->next; // Move head to the next node
-        if ( current->data ) free( current->data ); // Free data
-        free( current ); // Free the node itself
+        if ( current->data ) d_Free( current->allocator, current->data ); // Free data
+        _d_FreeLinkedListNode( current ); // Free the node itself
         return 0;
     }
 
@@ -261,8 +310,8 @@ int d_RemoveDataFromLinkedList( dLinkedList_t **head, char *name )
     // Node found: re-link the previous node to skip the current node
     prev->next = current->next;
 
-    if ( current->data ) free( current->data ); // Free data
-    free( current ); // Free the node itself
+    if ( current->data ) d_Free( current->allocator, current->data ); // Free data
+    _d_FreeLinkedListNode( current ); // Free the node itself
 
     return 0; // Success
 }
@@ -339,7 +388,7 @@ void* d_PopBackFromLinkedList( dLinkedList_t **head )
     if ( current->next == NULL )
     {
         popped_data = current->data; // Get data from the head
-        free( current );             // Free the head node
+        _d_FreeLinkedListNode( current ); // Free the head node
         *head = NULL;                // Set the caller's head to NULL (list is now empty)
         return popped_data;
     }
@@ -354,7 +403,7 @@ void* d_PopBackFromLinkedList( dLinkedList_t **head )
 
     // 'current' is now the last node, 'prev' is the second-to-last
     popped_data = current->data; // Get data from the last node
-    free( current );             // Free the last node
+    _d_FreeLinkedListNode( current ); // Free the last node
     prev->next = NULL;           // Terminate the list at the new last node
 
     return popped_data;
@@ -373,7 +422,7 @@ void* d_PopFrontFromLinkedList( dLinkedList_t **head )
 
     *head = old_head->next; // Update the list's head to the next node
 
-    free( old_head ); // Free the original head node
+    _d_FreeLinkedListNode( old_head ); // Free the original head node
     // Note: old_head->data is not freed here, as it's returned to the caller.
     // If the data was *not* intended to be returned, it would be free(old_head->data); here.
 
@@ -458,11 +507,11 @@ int d_UpdateDataByNameLinkedList(dLinkedList_t **head, void *new_data, char *tar
             
             // Free the old data
             if (current->data) {
-                free(current->data);
+                d_Free( current->allocator, current->data );
             }
             
             // Allocate new data memory
-            current->data = malloc(new_size);
+            current->data = d_Alloc( current->allocator, new_size );
             if (!current->data) {
                 d_LogErrorF("Failed to allocate memory for updated data in node '%s'.", target_name);
                 return 1; // Failure
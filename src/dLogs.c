@@ -140,7 +140,7 @@ dLogGlobalConfig_t g_log_config = {
     .logging_enabled = true
 };
 
-// Thread-local storage for format buffers
+// Thread-local storage for format buffers (heap-allocated: logging runs on any thread)
 static __thread dString_t* tls_format_buffer = NULL;
 
 // Global logger instance
@@ -350,7 +350,7 @@ void d_FormatTimestamp(char* buffer, size_t buffer_size, double timestamp, const
 static dString_t* get_tls_buffer(void)
 {
     if (!tls_format_buffer) {
-        tls_format_buffer = d_StringInit();
+        tls_format_buffer = d_StringInitWithAllocator(d_GetHeapAllocator());
     } else {
         d_StringClear(tls_format_buffer);
     }
@@ -370,7 +370,7 @@ static void enhanced_console_handler(const dLogEntry_t* entry, void* user_data)
 
     if (!entry || !entry->message) return;
 
-    dString_t* output = d_StringInit();
+    dString_t* output = d_StringInitWithAllocator(d_GetHeapAllocator());
 
     // Get colors
     const char* level_color = d_LogLevel_GetColor(entry->level);
@@ -482,16 +482,18 @@ static void enhanced_console_handler(const dLogEntry_t* entry, void* user_data)
  */
 dLogger_t* d_CreateLogger(dLogConfig_t config)
 {
-    dLogger_t* logger = (dLogger_t*)calloc(1, sizeof(dLogger_t));
+    const dAllocator_t* allocator = d_GetDefaultAllocator();
+    dLogger_t* logger = (dLogger_t*)d_Calloc(allocator, 1, sizeof(dLogger_t));
     if (!logger) return NULL;
 
+    logger->allocator = allocator;
     logger->config = config;
-    logger->handlers = d_ArrayInit(4, sizeof(dLogHandlerReg_t));
-    logger->contexts = d_ArrayInit(8, sizeof(char*));
-    logger->format_buffer = d_StringInit();
+    logger->handlers = d_ArrayInitWithAllocator(4, sizeof(dLogHandlerReg_t), allocator);
+    logger->contexts = d_ArrayInitWithAllocator(8, sizeof(char*), allocator);
+    logger->format_buffer = d_StringInitWithAllocator(allocator);
 
     // Initialize mutex for thread safety
-    logger->mutex = malloc(sizeof(dMutex_t));
+    logger->mutex = d_Alloc(allocator, sizeof(dMutex_t));
     if (logger->mutex) {
         MUTEX_INIT((dMutex_t*)logger->mutex);
     }
@@ -535,10 +537,10 @@ void d_DestroyLogger(dLogger_t* logger)
     if (logger->format_buffer) d_StringDestroy(logger->format_buffer);
     if (logger->mutex) {
         MUTEX_DESTROY((dMutex_t*)logger->mutex);
-        free(logger->mutex);
+        d_Free(logger->allocator, logger->mutex);
     }
 
-    free(logger);
+    d_Free(logger->allocator, logger);
 }
 
 /*
@@ -742,7 +744,7 @@ void d_LogEx(dLogLevel_t level, const char* file, int line, const char* func, co
     };
 
     // Create a temporary string for the message (don't use TLS buffer)
-    dString_t* msg_buffer = d_StringInit();
+    dString_t* msg_buffer = d_StringInitWithAllocator(d_GetHeapAllocator());
     d_StringAppend(msg_buffer, message, 0);
     entry.message = msg_buffer;
 
@@ -1075,12 +1077,14 @@ void d_StringLogHandler(const dLogEntry_t* entry, void* user_data) {
 dLogContext_t* d_PushLogContext(const char* name) {
     if (!name) return NULL;
 
-    dLogContext_t* context = malloc(sizeof(dLogContext_t));
+    // Heap, not the default: the default may change before the matching pop
+    const dAllocator_t* heap = d_GetHeapAllocator();
+    dLogContext_t* context = d_Alloc(heap, sizeof(dLogContext_t));
     if (!context) return NULL;
 
-    context->name = strdup(name);
+    context->name = d_StrDup(heap, name);
     if (!context->name) {
-        free(context);
+        d_Free(heap, context);
         return NULL;
     }
 
@@ -1122,8 +1126,8 @@ void d_PopLogContext(dLogContext_t* context) {
         }
     }
 
-    free((void*)context->name);
-    free(context);
+    d_Free(d_GetHeapAllocator(), (void*)context->name);
+    d_Free(d_GetHeapAllocator(), context);
 }
 
 /*
@@ -1156,7 +1160,7 @@ void d_FormatStringV(dString_t* sb, const char* format, va_list args) {
         // Ensure string builder has capacity. Your dString library should handle this.
         // For this example, we assume it can grow.
         if (sb->len + needed + 1 > sb->alloced) {
-             sb->str = realloc(sb->str, sb->len + needed + 1);
+             sb->str = d_Realloc(sb->allocator, sb->str, sb->len + needed + 1);
              sb->alloced = sb->len + needed + 1;
         }
         vsnprintf(sb->str + sb->len, needed + 1, format, args);
@@ -0,0 +1,492 @@
+// File: src/dPools.c - Fixed-Size Object Pool for Daedalus Library
+// Slab-carved blocks on an intrusive free list, per-thread caches, and bulk release
+
+// Define feature test macros before any includes
+#define _POSIX_C_SOURCE 200809L  // For sched_yield, pthread keys
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+
+// Platform-specific thread-local storage, spin back-off and thread-exit hook
+#if defined(_MSC_VER)
+    #include <windows.h>
+    #define D_POOL_THREAD_LOCAL __declspec(thread)
+    #define D_POOL_YIELD() SwitchToThread()
+    #define D_POOL_HAS_THREAD_EXIT 0  // Cache slots are never reclaimed
+#else
+    #include <sched.h>
+    #include <pthread.h>
+    #define D_POOL_THREAD_LOCAL __thread
+    #define D_POOL_YIELD() sched_yield()
+    #define D_POOL_HAS_THREAD_EXIT 1
+#endif
+
+#define D_POOL_ALIGNMENT 16u
+#define D_POOL_DEFAULT_SLAB_BYTES (64u * 1024u)
+#define D_POOL_MIN_BLOCKS_PER_SLAB 16u
+#define D_POOL_THREAD_CACHES 64u  // Threads past this many share the locked free list
+#define D_POOL_CACHE_BATCH 32u    // Blocks moved between a thread cache and the shared list at once
+#define D_POOL_CACHE_LINE 64u
+#define D_POOL_SPINS_BEFORE_YIELD 64
+
+#define D_POOL_ALIGN_UP(n) (((n) + (D_POOL_ALIGNMENT - 1)) & ~(size_t)(D_POOL_ALIGNMENT - 1))
+
+// Slab header; blocks follow at D_POOL_SLAB_HEADER
+typedef struct _dPoolSlab_t {
+    struct _dPoolSlab_t* next;
+} _dPoolSlab_t;
+
+#define D_POOL_SLAB_HEADER D_POOL_ALIGN_UP(sizeof(_dPoolSlab_t))
+
+// One thread's free blocks. Padded to a cache line so neighbouring threads do not false-share.
+typedef union {
+    struct {
+        void* head;
+        size_t count;
+    } s;
+    unsigned char pad[D_POOL_CACHE_LINE];
+} _dPoolCache_t;
+
+// Per-thread cache slot, shared by every pool: 0 = not yet assigned, past D_POOL_THREAD_CACHES = none
+static D_POOL_THREAD_LOCAL unsigned int d_pool_thread_slot = 0;
+
+// Slot ownership and the list of live pools, so an exiting thread can flush its
+// cache in every pool and hand its slot to the next thread. Lock order: registry, then pool.
+static unsigned char d_pool_slot_taken[D_POOL_THREAD_CACHES];
+static dPool_t* d_pool_registry = NULL;
+static int d_pool_registry_lock = 0;
+
+#if D_POOL_HAS_THREAD_EXIT
+static pthread_key_t d_pool_slot_key;
+static pthread_once_t d_pool_slot_key_once = PTHREAD_ONCE_INIT;
+static int d_pool_slot_key_ok = 0;
+#endif
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+static inline void _d_PoolSpinLock(int* lock)
+{
+    int spins = 0;
+    while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE)) {
+        while (__atomic_load_n(lock, __ATOMIC_RELAXED)) {
+            if (++spins == D_POOL_SPINS_BEFORE_YIELD) {
+                spins = 0;
+                D_POOL_YIELD();
+            }
+        }
+    }
+}
+
+static inline void _d_PoolSpinUnlock(int* lock)
+{
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+}
+
+static inline void _d_PoolLock(dPool_t* pool)
+{
+    _d_PoolSpinLock(&pool->lock);
+}
+
+static inline void _d_PoolUnlock(dPool_t* pool)
+{
+    _d_PoolSpinUnlock(&pool->lock);
+}
+
+static inline void* _d_PoolNextBlock(void* block)
+{
+    return *(void**)block;
+}
+
+static inline void _d_PoolSetNextBlock(void* block, void* next)
+{
+    *(void**)block = next;
+}
+
+#if D_POOL_HAS_THREAD_EXIT
+/**
+ * @brief Internal helper: Thread-exit destructor; flush the slot's cache in every pool and free the slot.
+ *
+ * Later pool calls from this thread (other destructors) use the locked free list.
+ */
+static void _d_PoolReleaseThreadSlot(void* value)
+{
+    unsigned int slot = (unsigned int)(uintptr_t)value;
+    d_pool_thread_slot = D_POOL_THREAD_CACHES + 1;
+
+    _d_PoolSpinLock(&d_pool_registry_lock);
+    for (dPool_t* pool = d_pool_registry; pool; pool = (dPool_t*)pool->registry_next) {
+        _dPoolCache_t* cache = (_dPoolCache_t*)pool->caches + (slot - 1);
+        if (!cache->s.head) {
+            continue;
+        }
+        void* tail = cache->s.head;
+        while (_d_PoolNextBlock(tail)) {
+            tail = _d_PoolNextBlock(tail);
+        }
+        _d_PoolLock(pool);
+        _d_PoolSetNextBlock(tail, pool->free_list);
+        pool->free_list = cache->s.head;
+        _d_PoolUnlock(pool);
+        cache->s.head = NULL;
+        cache->s.count = 0;
+    }
+    d_pool_slot_taken[slot - 1] = 0;
+    _d_PoolSpinUnlock(&d_pool_registry_lock);
+}
+
+static void _d_PoolCreateSlotKey(void)
+{
+    d_pool_slot_key_ok = pthread_key_create(&d_pool_slot_key, _d_PoolReleaseThreadSlot) == 0;
+}
+#endif
+
+/**
+ * @brief Internal helper: Claim a free cache slot for this thread (1-based), or D_POOL_THREAD_CACHES + 1.
+ */
+static unsigned int _d_PoolClaimThreadSlot(void)
+{
+    unsigned int slot = D_POOL_THREAD_CACHES + 1;
+#if D_POOL_HAS_THREAD_EXIT
+    // Without the exit hook a slot could never be returned, so the thread goes without
+    pthread_once(&d_pool_slot_key_once, _d_PoolCreateSlotKey);
+    if (!d_pool_slot_key_ok) {
+        return slot;
+    }
+#endif
+
+    _d_PoolSpinLock(&d_pool_registry_lock);
+    for (unsigned int i = 0; i < D_POOL_THREAD_CACHES; i++) {
+        if (!d_pool_slot_taken[i]) {
+            d_pool_slot_taken[i] = 1;
+            slot = i + 1;
+            break;
+        }
+    }
+    _d_PoolSpinUnlock(&d_pool_registry_lock);
+
+#if D_POOL_HAS_THREAD_EXIT
+    if (slot <= D_POOL_THREAD_CACHES && pthread_setspecific(d_pool_slot_key, (void*)(uintptr_t)slot) != 0) {
+        _d_PoolSpinLock(&d_pool_registry_lock);
+        d_pool_slot_taken[slot - 1] = 0;
+        _d_PoolSpinUnlock(&d_pool_registry_lock);
+        slot = D_POOL_THREAD_CACHES + 1;
+    }
+#endif
+    return slot;
+}
+
+/**
+ * @brief Internal helper: This thread's cache in `pool`, or NULL if it has none.
+ */
+static inline _dPoolCache_t* _d_PoolThreadCache(dPool_t* pool)
+{
+    unsigned int slot = d_pool_thread_slot;
+    if (slot == 0) {
+        slot = _d_PoolClaimThreadSlot();
+        d_pool_thread_slot = slot;
+    }
+    if (slot > D_POOL_THREAD_CACHES) {
+        return NULL;
+    }
+    return (_dPoolCache_t*)pool->caches + (slot - 1);
+}
+
+/**
+ * @brief Internal helper: Move to the next kept slab, or allocate and link a new one.
+ *
+ * Caller holds the lock.
+ *
+ * @return 0 on success, 1 on allocation failure
+ */
+static int _d_PoolAdvanceSlabLocked(dPool_t* pool)
+{
+    _dPoolSlab_t* current = (_dPoolSlab_t*)pool->carve_slab;
+    _dPoolSlab_t* next = current ? current->next : (_dPoolSlab_t*)pool->slabs;
+    if (!next) {
+        next = (_dPoolSlab_t*)d_Alloc(pool->backing, D_POOL_SLAB_HEADER + pool->blocks_per_slab * pool->block_size);
+        if (!next) {
+            d_LogErrorF("Failed to allocate a pool slab of %zu blocks.", pool->blocks_per_slab);
+            return 1;
+        }
+        next->next = NULL;
+        if (current) {
+            current->next = next;
+        } else {
+            pool->slabs = next;
+        }
+        pool->slab_count++;
+    }
+    pool->carve_slab = next;
+    pool->carve_next = 0;
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Chain up to `want` free blocks onto `*head`.
+ *
+ * Recycled blocks are used before fresh ones are carved from a slab. Caller holds the lock.
+ *
+ * @return Number of blocks taken
+ */
+static size_t _d_PoolTakeLocked(dPool_t* pool, void** head, size_t want)
+{
+    size_t taken = 0;
+    while (taken < want && pool->free_list) {
+        void* block = pool->free_list;
+        pool->free_list = _d_PoolNextBlock(block);
+        _d_PoolSetNextBlock(block, *head);
+        *head = block;
+        taken++;
+    }
+    while (taken < want) {
+        if ((!pool->carve_slab || pool->carve_next == pool->blocks_per_slab) &&
+            _d_PoolAdvanceSlabLocked(pool) != 0) {
+            break;
+        }
+        void* block = (uint8_t*)pool->carve_slab + D_POOL_SLAB_HEADER + pool->carve_next * pool->block_size;
+        pool->carve_next++;
+        _d_PoolSetNextBlock(block, *head);
+        *head = block;
+        taken++;
+    }
+    return taken;
+}
+
+// =============================================================================
+// ALLOCATOR INTERFACE
+// =============================================================================
+
+static void* _d_PoolInterfaceAlloc(void* context, size_t size)
+{
+    dPool_t* pool = (dPool_t*)context;
+    if (size > pool->block_size) {
+        d_LogErrorF("Pool of %zu-byte blocks cannot serve a %zu-byte request.", pool->block_size, size);
+        return NULL;
+    }
+    return d_PoolAlloc(pool);
+}
+
+static void* _d_PoolInterfaceRealloc(void* context, void* ptr, size_t size)
+{
+    if (!ptr) {
+        return _d_PoolInterfaceAlloc(context, size);
+    }
+    // Every block already has the full block size
+    return size <= ((dPool_t*)context)->block_size ? ptr : NULL;
+}
+
+static void _d_PoolInterfaceFree(void* context, void* ptr)
+{
+    d_PoolFree((dPool_t*)context, ptr);
+}
+
+// =============================================================================
+// POOL LIFECYCLE
+// =============================================================================
+
+dPool_t* d_PoolCreate(size_t block_size, size_t blocks_per_slab)
+{
+    return d_PoolCreateWithAllocator(block_size, blocks_per_slab, NULL);
+}
+
+dPool_t* d_PoolCreateWithAllocator(size_t block_size, size_t blocks_per_slab, const dAllocator_t* allocator)
+{
+    if (block_size == 0 || block_size > SIZE_MAX / 2) {
+        d_LogError("Invalid block size for pool.");
+        return NULL;
+    }
+
+    const dAllocator_t* backing = allocator ? allocator : d_GetDefaultAllocator();
+    dPool_t* pool = (dPool_t*)d_Calloc(backing, 1, sizeof(dPool_t));
+    if (!pool) {
+        d_LogError("Failed to allocate pool.");
+        return NULL;
+    }
+
+    // Free blocks hold the list link in their first word
+    pool->block_size = D_POOL_ALIGN_UP(MAX(block_size, sizeof(void*)));
+    if (blocks_per_slab == 0) {
+        blocks_per_slab = MAX(D_POOL_DEFAULT_SLAB_BYTES / pool->block_size, D_POOL_MIN_BLOCKS_PER_SLAB);
+    }
+    if (blocks_per_slab > (SIZE_MAX - D_POOL_SLAB_HEADER) / pool->block_size) {
+        d_LogError("Pool slab size overflows.");
+        d_Free(backing, pool);
+        return NULL;
+    }
+
+    pool->backing = backing;
+    pool->blocks_per_slab = blocks_per_slab;
+    pool->allocator.alloc_func = _d_PoolInterfaceAlloc;
+    pool->allocator.realloc_func = _d_PoolInterfaceRealloc;
+    pool->allocator.free_func = _d_PoolInterfaceFree;
+    pool->allocator.context = pool;
+
+    pool->caches = d_Calloc(backing, D_POOL_THREAD_CACHES, sizeof(_dPoolCache_t));
+    if (!pool->caches) {
+        d_LogError("Failed to allocate pool thread caches.");
+        d_Free(backing, pool);
+        return NULL;
+    }
+
+    _d_PoolSpinLock(&d_pool_registry_lock);
+    pool->registry_next = d_pool_registry;
+    d_pool_registry = pool;
+    _d_PoolSpinUnlock(&d_pool_registry_lock);
+    return pool;
+}
+
+int d_PoolDestroy(dPool_t** pool)
+{
+    if (!pool || !*pool) {
+        d_LogError("Attempted to destroy NULL pool.");
+        return 1;
+    }
+
+    dPool_t* p = *pool;
+    _d_PoolSpinLock(&d_pool_registry_lock);
+    dPool_t** link = &d_pool_registry;
+    while (*link && *link != p) {
+        link = (dPool_t**)&(*link)->registry_next;
+    }
+    if (*link) {
+        *link = (dPool_t*)p->registry_next;
+    }
+    _d_PoolSpinUnlock(&d_pool_registry_lock);
+
+    _dPoolSlab_t* slab = (_dPoolSlab_t*)p->slabs;
+    while (slab) {
+        _dPoolSlab_t* next = slab->next;
+        d_Free(p->backing, slab);
+        slab = next;
+    }
+    d_Free(p->backing, p->caches);
+    d_Free(p->backing, p);
+    *pool = NULL;
+    return 0;
+}
+
+// =============================================================================
+// ALLOCATION AND RELEASE
+// =============================================================================
+
+void* d_PoolAlloc(dPool_t* pool)
+{
+    if (!pool) {
+        d_LogError("Attempted to allocate from NULL pool.");
+        return NULL;
+    }
+
+    void* block = NULL;
+    _dPoolCache_t* cache = _d_PoolThreadCache(pool);
+    if (!cache) {
+        _d_PoolLock(pool);
+        _d_PoolTakeLocked(pool, &block, 1);
+        _d_PoolUnlock(pool);
+        return block;
+    }
+
+    if (!cache->s.head) {
+        _d_PoolLock(pool);
+        cache->s.count = _d_PoolTakeLocked(pool, &cache->s.head, D_POOL_CACHE_BATCH);
+        _d_PoolUnlock(pool);
+        if (!cache->s.head) {
+            return NULL;
+        }
+    }
+    block = cache->s.head;
+    cache->s.head = _d_PoolNextBlock(block);
+    cache->s.count--;
+    return block;
+}
+
+void d_PoolFree(dPool_t* pool, void* block)
+{
+    if (!pool || !block) {
+        return;
+    }
+
+    _dPoolCache_t* cache = _d_PoolThreadCache(pool);
+    if (!cache) {
+        _d_PoolLock(pool);
+        _d_PoolSetNextBlock(block, pool->free_list);
+        pool->free_list = block;
+        _d_PoolUnlock(pool);
+        return;
+    }
+
+    _d_PoolSetNextBlock(block, cache->s.head);
+    cache->s.head = block;
+    if (++cache->s.count < 2 * D_POOL_CACHE_BATCH) {
+        return;
+    }
+
+    // Hand the newest batch back so other threads can reuse it
+    void* batch = cache->s.head;
+    void* tail = batch;
+    for (size_t i = 1; i < D_POOL_CACHE_BATCH; i++) {
+        tail = _d_PoolNextBlock(tail);
+    }
+    cache->s.head = _d_PoolNextBlock(tail);
+    cache->s.count -= D_POOL_CACHE_BATCH;
+
+    _d_PoolLock(pool);
+    _d_PoolSetNextBlock(tail, pool->free_list);
+    pool->free_list = batch;
+    _d_PoolUnlock(pool);
+}
+
+size_t d_PoolAllocBatch(dPool_t* pool, void** head, size_t count)
+{
+    if (!pool || !head) {
+        d_LogError("Invalid parameters for pool batch allocation.");
+        return 0;
+    }
+
+    *head = NULL;
+    _d_PoolLock(pool);
+    size_t taken = _d_PoolTakeLocked(pool, head, count);
+    _d_PoolUnlock(pool);
+    return taken;
+}
+
+void d_PoolFreeBatch(dPool_t* pool, void* head)
+{
+    if (!pool || !head) {
+        return;
+    }
+
+    void* tail = head;
+    while (_d_PoolNextBlock(tail)) {
+        tail = _d_PoolNextBlock(tail);
+    }
+    _d_PoolLock(pool);
+    _d_PoolSetNextBlock(tail, pool->free_list);
+    pool->free_list = head;
+    _d_PoolUnlock(pool);
+}
+
+void d_PoolReset(dPool_t* pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    // Slabs are kept and carved again from the first one; the registry lock keeps an
+    // exiting thread from flushing its cache while they are cleared
+    _d_PoolSpinLock(&d_pool_registry_lock);
+    pool->free_list = NULL;
+    pool->carve_slab = NULL;
+    pool->carve_next = 0;
+    memset(pool->caches, 0, D_POOL_THREAD_CACHES * sizeof(_dPoolCache_t));
+    _d_PoolSpinUnlock(&d_pool_registry_lock);
+}
+
+const dAllocator_t* d_PoolGetAllocator(dPool_t* pool)
+{
+    return pool ? &pool->allocator : NULL;
+}
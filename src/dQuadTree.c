@@ -6,7 +6,8 @@
 
 dQuadTree_t *d_CreateQuadtree( float *rect, int capacity )
 {
-  dQuadTree_t *newTree = ( dQuadTree_t* )malloc( sizeof( dQuadTree_t ) );
+  const dAllocator_t* allocator = d_GetDefaultAllocator();
+  dQuadTree_t *newTree = ( dQuadTree_t* )d_Alloc( allocator, sizeof( dQuadTree_t ) );
   if (newTree == NULL )
   {
     printf( "Failed to allocate memory for quad tree");
@@ -16,6 +17,7 @@ dQuadTree_t *d_CreateQuadtree( float *rect, int capacity )
   memcpy( newTree->rect, rect, ( sizeof( float ) * 4 ) );
   newTree->capacity = capacity;
   newTree->objects = NULL;
+  newTree->allocator = allocator;
 
   return newTree;
 }
@@ -0,0 +1,283 @@
+// File: src/dRingBuffers.c - Lock-Free Ring Buffers for Daedalus Library
+// Wait-free SPSC and sequence-numbered MPMC queues over a power-of-two dStaticArray_t
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+#include "dInternal.h"
+
+#define D_RING_MIN_CAPACITY 2
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+static inline uint8_t* _d_RingSlot(const dRingBuffer_t* ring, size_t position)
+{
+    return (uint8_t*)ring->slots->data + (position & ring->mask) * ring->slots->element_size;
+}
+
+/**
+ * @brief Internal helper: MPMC sequence number of the slot for `position`.
+ */
+static inline size_t* _d_RingSequence(const dRingBuffer_t* ring, size_t position)
+{
+    return (size_t*)_d_RingSlot(ring, position);
+}
+
+/**
+ * @brief Internal helper: Copy `n` packed elements into SPSC slots starting at `position`, wrapping once.
+ */
+static void _d_RingCopyIn(dRingBuffer_t* ring, size_t position, const uint8_t* data, size_t n)
+{
+    size_t index = position & ring->mask;
+    size_t first = MIN(n, ring->mask + 1 - index);
+    memcpy(_d_RingSlot(ring, position), data, first * ring->element_size);
+    if (n > first) {
+        memcpy(ring->slots->data, data + first * ring->element_size, (n - first) * ring->element_size);
+    }
+}
+
+static void _d_RingCopyOut(const dRingBuffer_t* ring, size_t position, uint8_t* out, size_t n)
+{
+    size_t index = position & ring->mask;
+    size_t first = MIN(n, ring->mask + 1 - index);
+    memcpy(out, _d_RingSlot(ring, position), first * ring->element_size);
+    if (n > first) {
+        memcpy(out + first * ring->element_size, ring->slots->data, (n - first) * ring->element_size);
+    }
+}
+
+// =============================================================================
+// SPSC OPERATIONS
+// =============================================================================
+
+static size_t _d_RingSPSCEnqueue(dRingBuffer_t* ring, const void* data, size_t n)
+{
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    size_t capacity = ring->mask + 1;
+    size_t free_slots = capacity - (head - ring->cached_tail);
+    if (free_slots < n) {
+        ring->cached_tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        free_slots = capacity - (head - ring->cached_tail);
+    }
+    n = MIN(n, free_slots);
+    if (n > 0) {
+        _d_RingCopyIn(ring, head, (const uint8_t*)data, n);
+        __atomic_store_n(&ring->head, head + n, __ATOMIC_RELEASE);
+    }
+    return n;
+}
+
+static size_t _d_RingSPSCDequeue(dRingBuffer_t* ring, void* out, size_t n)
+{
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    size_t available = ring->cached_head - tail;
+    if (available < n) {
+        ring->cached_head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        available = ring->cached_head - tail;
+    }
+    n = MIN(n, available);
+    if (n > 0) {
+        _d_RingCopyOut(ring, tail, (uint8_t*)out, n);
+        __atomic_store_n(&ring->tail, tail + n, __ATOMIC_RELEASE);
+    }
+    return n;
+}
+
+// =============================================================================
+// MPMC OPERATIONS
+// =============================================================================
+
+/**
+ * @brief Internal helper: Claim up to `n` consecutive MPMC positions on `*counter`.
+ *
+ * A slot is ready for position `p` when its sequence equals `p + lap_offset`: `p` for
+ * producers (empty on this lap) and `p + 1` for consumers (filled on this lap).
+ *
+ * @return Number of positions claimed, starting at `*first`
+ */
+static size_t _d_RingMPMCClaim(dRingBuffer_t* ring, size_t* counter, size_t lap_offset, size_t n, size_t* first)
+{
+    size_t position = __atomic_load_n(counter, __ATOMIC_RELAXED);
+    for (;;) {
+        size_t ready = 0;
+        while (ready < n) {
+            size_t seq = __atomic_load_n(_d_RingSequence(ring, position + ready), __ATOMIC_ACQUIRE);
+            intptr_t diff = (intptr_t)(seq - (position + ready + lap_offset));
+            if (diff != 0) {
+                // Behind this lap: the ring is full (producers) or empty (consumers) from here on
+                if (diff < 0 || ready > 0) {
+                    break;
+                }
+                // Ahead: another thread already claimed this position; start over from the new one
+                position = __atomic_load_n(counter, __ATOMIC_RELAXED);
+                continue;
+            }
+            ready++;
+        }
+        if (ready == 0) {
+            return 0;
+        }
+        if (__atomic_compare_exchange_n(counter, &position, position + ready, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            *first = position;
+            return ready;
+        }
+    }
+}
+
+static size_t _d_RingMPMCEnqueue(dRingBuffer_t* ring, const void* data, size_t n)
+{
+    size_t first;
+    n = _d_RingMPMCClaim(ring, &ring->head, 0, n, &first);
+    const uint8_t* src = (const uint8_t*)data;
+    for (size_t i = 0; i < n; i++) {
+        size_t position = first + i;
+        memcpy(_d_RingSlot(ring, position) + ring->element_offset, src + i * ring->element_size, ring->element_size);
+        __atomic_store_n(_d_RingSequence(ring, position), position + 1, __ATOMIC_RELEASE);
+    }
+    return n;
+}
+
+static size_t _d_RingMPMCDequeue(dRingBuffer_t* ring, void* out, size_t n)
+{
+    size_t first;
+    n = _d_RingMPMCClaim(ring, &ring->tail, 1, n, &first);
+    uint8_t* dst = (uint8_t*)out;
+    for (size_t i = 0; i < n; i++) {
+        size_t position = first + i;
+        memcpy(dst + i * ring->element_size, _d_RingSlot(ring, position) + ring->element_offset, ring->element_size);
+        // Hand the slot to the producer of the next lap
+        __atomic_store_n(_d_RingSequence(ring, position), position + ring->mask + 1, __ATOMIC_RELEASE);
+    }
+    return n;
+}
+
+// =============================================================================
+// RING BUFFER LIFECYCLE
+// =============================================================================
+
+dRingBuffer_t* d_RingBufferInit(size_t capacity, size_t element_size, dRingBufferMode_t mode)
+{
+    return d_RingBufferInitWithAllocator(capacity, element_size, mode, NULL);
+}
+
+dRingBuffer_t* d_RingBufferInitWithAllocator(size_t capacity, size_t element_size, dRingBufferMode_t mode,
+                                             const dAllocator_t* allocator)
+{
+    if (element_size == 0 || element_size > SIZE_MAX / 4 || capacity > SIZE_MAX / 4 ||
+        (mode != D_RING_BUFFER_SPSC && mode != D_RING_BUFFER_MPMC)) {
+        d_LogError("Invalid parameters for ring buffer.");
+        return NULL;
+    }
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+
+    size_t rounded = D_RING_MIN_CAPACITY;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+
+    // MPMC slots lead with their sequence number, padded to keep the element aligned
+    size_t element_offset = 0;
+    size_t slot_size = element_size;
+    if (mode == D_RING_BUFFER_MPMC) {
+        size_t align = MAX(_d_NaturalAlignment(element_size), sizeof(size_t));
+        element_offset = align;
+        slot_size = (element_offset + element_size + align - 1) & ~(align - 1);
+    }
+
+    dRingBuffer_t* ring = (dRingBuffer_t*)d_Calloc(allocator, 1, sizeof(dRingBuffer_t));
+    if (!ring) {
+        d_LogError("Failed to allocate ring buffer.");
+        return NULL;
+    }
+    ring->slots = d_InitStaticArrayWithAllocator(rounded, slot_size, allocator);
+    if (!ring->slots) {
+        d_LogErrorF("Failed to allocate %zu ring buffer slots.", rounded);
+        d_Free(allocator, ring);
+        return NULL;
+    }
+
+    ring->mask = rounded - 1;
+    ring->element_size = element_size;
+    ring->element_offset = element_offset;
+    ring->mode = mode;
+    ring->allocator = allocator;
+    if (mode == D_RING_BUFFER_MPMC) {
+        for (size_t i = 0; i < rounded; i++) {
+            *_d_RingSequence(ring, i) = i;
+        }
+    }
+    return ring;
+}
+
+int d_RingBufferDestroy(dRingBuffer_t** ring)
+{
+    if (!ring || !*ring) {
+        d_LogError("Attempted to destroy NULL ring buffer.");
+        return 1;
+    }
+
+    const dAllocator_t* allocator = (*ring)->allocator;
+    d_StaticArrayDestroy((*ring)->slots);
+    d_Free(allocator, *ring);
+    *ring = NULL;
+    return 0;
+}
+
+// =============================================================================
+// ENQUEUE AND DEQUEUE
+// =============================================================================
+
+int d_RingBufferEnqueue(dRingBuffer_t* ring, const void* data)
+{
+    return d_RingBufferEnqueueBatch(ring, data, 1) == 1 ? 0 : 1;
+}
+
+int d_RingBufferDequeue(dRingBuffer_t* ring, void* out)
+{
+    return d_RingBufferDequeueBatch(ring, out, 1) == 1 ? 0 : 1;
+}
+
+size_t d_RingBufferEnqueueBatch(dRingBuffer_t* ring, const void* data, size_t n)
+{
+    if (!ring || !data || n == 0) {
+        return 0;
+    }
+    if (ring->mode == D_RING_BUFFER_SPSC) {
+        return _d_RingSPSCEnqueue(ring, data, n);
+    }
+    return _d_RingMPMCEnqueue(ring, data, n);
+}
+
+size_t d_RingBufferDequeueBatch(dRingBuffer_t* ring, void* out, size_t n)
+{
+    if (!ring || !out || n == 0) {
+        return 0;
+    }
+    if (ring->mode == D_RING_BUFFER_SPSC) {
+        return _d_RingSPSCDequeue(ring, out, n);
+    }
+    return _d_RingMPMCDequeue(ring, out, n);
+}
+
+size_t d_RingBufferGetCount(const dRingBuffer_t* ring)
+{
+    if (!ring) {
+        return 0;
+    }
+    // Tail first: head only moves forward, so the difference never goes negative
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    return MIN(head - tail, ring->mask + 1);
+}
+
+size_t d_RingBufferGetCapacity(const dRingBuffer_t* ring)
+{
+    return ring ? ring->mask + 1 : 0;
+}
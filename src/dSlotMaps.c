@@ -0,0 +1,204 @@
+// File: src/dSlotMaps.c - Generational Slot Map for Daedalus Library
+// Dense element storage in a dArray_t, addressed through index + generation handles
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+#include "dSlots.h"
+
+// =============================================================================
+// SLOT MAP LIFECYCLE
+// =============================================================================
+
+dSlotMap_t* d_SlotMapInit(size_t element_size, size_t capacity)
+{
+    return d_SlotMapInitWithAllocator(element_size, capacity, NULL);
+}
+
+dSlotMap_t* d_SlotMapInitWithAllocator(size_t element_size, size_t capacity, const dAllocator_t* allocator)
+{
+    if (element_size == 0) {
+        d_LogError("Invalid element size for slot map.");
+        return NULL;
+    }
+    if (capacity >= D_SLOT_NIL) {
+        d_LogErrorF("Slot map capacity %zu exceeds the 32-bit handle range.", capacity);
+        return NULL;
+    }
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+
+    dSlotMap_t* map = (dSlotMap_t*)d_Calloc(allocator, 1, sizeof(dSlotMap_t));
+    if (!map) {
+        d_LogError("Failed to allocate slot map.");
+        return NULL;
+    }
+
+    map->allocator = allocator;
+    map->free_head = D_SLOT_NIL;
+    map->dense = d_ArrayInitWithAllocator(capacity, element_size, allocator);
+    map->dense_slot = d_ArrayInitWithAllocator(capacity, sizeof(uint32_t), allocator);
+    map->slots = d_ArrayInitWithAllocator(capacity, sizeof(_dSlot_t), allocator);
+    if (!map->dense || !map->dense_slot || !map->slots) {
+        d_LogError("Failed to allocate slot map arrays.");
+        d_SlotMapDestroy(&map);
+        return NULL;
+    }
+    return map;
+}
+
+int d_SlotMapDestroy(dSlotMap_t** map)
+{
+    if (!map || !*map) {
+        d_LogError("Attempted to destroy NULL slot map.");
+        return 1;
+    }
+
+    dSlotMap_t* m = *map;
+    if (m->dense) {
+        d_ArrayDestroy(m->dense);
+    }
+    if (m->dense_slot) {
+        d_ArrayDestroy(m->dense_slot);
+    }
+    if (m->slots) {
+        d_ArrayDestroy(m->slots);
+    }
+    d_Free(m->allocator, m);
+    *map = NULL;
+    return 0;
+}
+
+// =============================================================================
+// SLOT MAP OPERATIONS
+// =============================================================================
+
+dSlotHandle_t d_SlotMapInsert(dSlotMap_t* map, const void* data)
+{
+    if (!map) {
+        d_LogError("Attempted to insert into NULL slot map.");
+        return D_SLOT_HANDLE_NULL;
+    }
+
+    if (map->free_head == D_SLOT_NIL && map->slots->count >= D_SLOT_NIL) {
+        d_LogError("Slot map is out of 32-bit handle indices.");
+        return D_SLOT_HANDLE_NULL;
+    }
+
+    // Every push is undone on a later failure so the map is left unchanged
+    void* element = _d_SlotArrayPush(map->dense);
+    uint32_t* owner = element ? (uint32_t*)_d_SlotArrayPush(map->dense_slot) : NULL;
+    if (!owner) {
+        if (element) {
+            map->dense->count--;
+        }
+        d_LogError("Failed to grow slot map storage.");
+        return D_SLOT_HANDLE_NULL;
+    }
+
+    uint32_t slot;
+    _dSlot_t* entry = _d_SlotAcquire(map->slots, &map->free_head, &slot);
+    if (!entry) {
+        map->dense->count--;
+        map->dense_slot->count--;
+        d_LogError("Failed to grow slot map storage.");
+        return D_SLOT_HANDLE_NULL;
+    }
+
+    entry->index = (uint32_t)(map->dense->count - 1);
+    *owner = slot;
+    if (data) {
+        memcpy(element, data, map->dense->element_size);
+    } else {
+        memset(element, 0, map->dense->element_size);
+    }
+    return _d_SlotMakeHandle(slot, entry->generation);
+}
+
+void* d_SlotMapGet(const dSlotMap_t* map, dSlotHandle_t handle)
+{
+    if (!map) {
+        return NULL;
+    }
+    _dSlot_t* entry = _d_SlotResolve(map->slots, handle);
+    if (!entry) {
+        return NULL;
+    }
+    return (uint8_t*)map->dense->data + (size_t)entry->index * map->dense->element_size;
+}
+
+bool d_SlotMapContains(const dSlotMap_t* map, dSlotHandle_t handle)
+{
+    return map && _d_SlotResolve(map->slots, handle) != NULL;
+}
+
+int d_SlotMapRemove(dSlotMap_t* map, dSlotHandle_t handle)
+{
+    if (!map) {
+        d_LogError("Attempted to remove from NULL slot map.");
+        return 1;
+    }
+    _dSlot_t* entry = _d_SlotResolve(map->slots, handle);
+    if (!entry) {
+        d_LogDebug("Slot map handle is stale or invalid.");
+        return 1;
+    }
+
+    // Swap-and-pop: the last element fills the hole and its slot follows it
+    size_t hole = entry->index;
+    size_t last = map->dense->count - 1;
+    if (hole != last) {
+        size_t size = map->dense->element_size;
+        uint8_t* dense = (uint8_t*)map->dense->data;
+        uint32_t* owners = (uint32_t*)map->dense_slot->data;
+        memcpy(dense + hole * size, dense + last * size, size);
+        owners[hole] = owners[last];
+        _d_SlotAt(map->slots, owners[hole])->index = (uint32_t)hole;
+    }
+    map->dense->count--;
+    map->dense_slot->count--;
+
+    _d_SlotRetire(map->slots, &map->free_head, (uint32_t)handle);
+    return 0;
+}
+
+int d_SlotMapClear(dSlotMap_t* map)
+{
+    if (!map) {
+        d_LogError("Attempted to clear NULL slot map.");
+        return 1;
+    }
+
+    const uint32_t* owners = (const uint32_t*)map->dense_slot->data;
+    for (size_t i = 0; i < map->dense->count; i++) {
+        _d_SlotRetire(map->slots, &map->free_head, owners[i]);
+    }
+    map->dense->count = 0;
+    map->dense_slot->count = 0;
+    return 0;
+}
+
+size_t d_SlotMapGetCount(const dSlotMap_t* map)
+{
+    return map ? map->dense->count : 0;
+}
+
+void* d_SlotMapGetDense(const dSlotMap_t* map, size_t dense_index)
+{
+    if (!map || dense_index >= map->dense->count) {
+        return NULL;
+    }
+    return (uint8_t*)map->dense->data + dense_index * map->dense->element_size;
+}
+
+dSlotHandle_t d_SlotMapHandleAt(const dSlotMap_t* map, size_t dense_index)
+{
+    if (!map || dense_index >= map->dense->count) {
+        return D_SLOT_HANDLE_NULL;
+    }
+    uint32_t slot = ((const uint32_t*)map->dense_slot->data)[dense_index];
+    return _d_SlotMakeHandle(slot, _d_SlotAt(map->slots, slot)->generation);
+}
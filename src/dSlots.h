@@ -0,0 +1,92 @@
+// File: src/dSlots.h - Generational handle slots shared by dSlotMaps.c and dHeaps.c
+// Internal to the library: not installed, and not part of Daedalus.h
+
+#ifndef D_SLOTS_H
+#define D_SLOTS_H
+
+#include <stdint.h>
+#include "Daedalus.h"
+
+#define D_SLOT_NIL UINT32_MAX
+
+// One entry per handle index. While in use, `index` is the owner's position in its
+// dense storage; while free, it links to the next free slot.
+typedef struct {
+    uint32_t index;
+    uint32_t generation;
+} _dSlot_t;
+
+static inline dSlotHandle_t _d_SlotMakeHandle(uint32_t slot, uint32_t generation)
+{
+    return ((dSlotHandle_t)generation << 32) | slot;
+}
+
+static inline _dSlot_t* _d_SlotAt(const dArray_t* slots, uint32_t slot)
+{
+    return (_dSlot_t*)slots->data + slot;
+}
+
+/**
+ * @brief Internal helper: The slot a handle refers to, or NULL if the handle is stale.
+ */
+static inline _dSlot_t* _d_SlotResolve(const dArray_t* slots, dSlotHandle_t handle)
+{
+    uint32_t slot = (uint32_t)handle;
+    if (slot >= slots->count) {
+        return NULL;
+    }
+    _dSlot_t* entry = _d_SlotAt(slots, slot);
+    return entry->generation == (uint32_t)(handle >> 32) ? entry : NULL;
+}
+
+/**
+ * @brief Internal helper: Grow `array` by one element and return it, doubling capacity when full.
+ */
+static inline void* _d_SlotArrayPush(dArray_t* array)
+{
+    if (array->count >= array->capacity) {
+        size_t new_capacity = array->capacity == 0 ? 1 : array->capacity * 2;
+        if (d_ArrayResize(array, new_capacity * array->element_size) != 0) {
+            return NULL;
+        }
+    }
+    return (uint8_t*)array->data + array->count++ * array->element_size;
+}
+
+/**
+ * @brief Internal helper: Take a slot off the free list, or append a new one at generation 1.
+ *
+ * @return The slot entry with its number in `*slot`, or NULL if `slots` could not grow
+ */
+static inline _dSlot_t* _d_SlotAcquire(dArray_t* slots, uint32_t* free_head, uint32_t* slot)
+{
+    _dSlot_t* entry;
+    if (*free_head != D_SLOT_NIL) {
+        *slot = *free_head;
+        entry = _d_SlotAt(slots, *slot);
+        *free_head = entry->index;
+        return entry;
+    }
+    entry = (_dSlot_t*)_d_SlotArrayPush(slots);
+    if (!entry) {
+        return NULL;
+    }
+    *slot = (uint32_t)(slots->count - 1);
+    entry->generation = 1;
+    return entry;
+}
+
+/**
+ * @brief Internal helper: Free a slot, bumping its generation (skipping 0) so its handles go stale.
+ */
+static inline void _d_SlotRetire(dArray_t* slots, uint32_t* free_head, uint32_t slot)
+{
+    _dSlot_t* entry = _d_SlotAt(slots, slot);
+    if (++entry->generation == 0) {
+        entry->generation = 1;
+    }
+    entry->index = *free_head;
+    *free_head = slot;
+}
+
+#endif // D_SLOTS_H
@@ -0,0 +1,246 @@
+// File: src/dSoAs.c - Struct-of-Arrays Container for Daedalus Library
+// One cache-line aligned column per field, all carved from a single block
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+
+#define D_SOA_MIN_GROWTH 16
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+static inline size_t _d_SoAAlignUp(size_t n, size_t align)
+{
+    return (n + (align - 1)) & ~(align - 1);
+}
+
+/**
+ * @brief Internal helper: Bytes needed for every column at `capacity` rows, plus base alignment slack.
+ *
+ * @return The size, or 0 if it overflows
+ */
+static size_t _d_SoAStorageSize(const dSoA_t* soa, size_t capacity)
+{
+    size_t offset = 0;
+    size_t max_align = D_SOA_COLUMN_ALIGNMENT;
+    for (size_t f = 0; f < soa->field_count; f++) {
+        size_t align = soa->field_aligns[f];
+        if (capacity > (SIZE_MAX / 2) / soa->field_sizes[f] || offset > SIZE_MAX / 2) {
+            return 0;
+        }
+        offset = _d_SoAAlignUp(offset, align) + capacity * soa->field_sizes[f];
+        max_align = MAX(max_align, align);
+    }
+    if (offset > SIZE_MAX - max_align) {
+        return 0;
+    }
+    return offset + max_align - 1;
+}
+
+// =============================================================================
+// SOA LIFECYCLE
+// =============================================================================
+
+dSoA_t* d_SoAInit(const dSoAField_t* fields, size_t field_count, size_t capacity)
+{
+    return d_SoAInitWithAllocator(fields, field_count, capacity, NULL);
+}
+
+dSoA_t* d_SoAInitWithAllocator(const dSoAField_t* fields, size_t field_count, size_t capacity,
+                               const dAllocator_t* allocator)
+{
+    if (!fields || field_count == 0) {
+        d_LogError("Invalid field schema for struct-of-arrays container.");
+        return NULL;
+    }
+    for (size_t f = 0; f < field_count; f++) {
+        size_t align = fields[f].alignment;
+        if (fields[f].size == 0 || (align & (align - 1)) != 0) {
+            d_LogErrorF("Invalid size or alignment for struct-of-arrays field %zu.", f);
+            return NULL;
+        }
+    }
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
+
+    dSoA_t* soa = (dSoA_t*)d_Calloc(allocator, 1, sizeof(dSoA_t));
+    if (!soa) {
+        d_LogError("Failed to allocate struct-of-arrays container.");
+        return NULL;
+    }
+    soa->allocator = allocator;
+    soa->field_count = field_count;
+    soa->field_sizes = (size_t*)d_Calloc(allocator, field_count, sizeof(size_t));
+    soa->field_aligns = (size_t*)d_Calloc(allocator, field_count, sizeof(size_t));
+    soa->columns = (void**)d_Calloc(allocator, field_count, sizeof(void*));
+    if (!soa->field_sizes || !soa->field_aligns || !soa->columns) {
+        d_LogError("Failed to allocate struct-of-arrays field tables.");
+        d_SoADestroy(&soa);
+        return NULL;
+    }
+
+    for (size_t f = 0; f < field_count; f++) {
+        soa->field_sizes[f] = fields[f].size;
+        soa->field_aligns[f] = MAX(fields[f].alignment, (size_t)D_SOA_COLUMN_ALIGNMENT);
+    }
+
+    if (capacity > 0 && d_SoAReserve(soa, capacity) != 0) {
+        d_SoADestroy(&soa);
+        return NULL;
+    }
+    return soa;
+}
+
+int d_SoADestroy(dSoA_t** soa)
+{
+    if (!soa || !*soa) {
+        d_LogError("Attempted to destroy NULL struct-of-arrays container.");
+        return 1;
+    }
+
+    dSoA_t* s = *soa;
+    if (s->storage) {
+        d_Free(s->allocator, s->storage);
+    }
+    if (s->field_sizes) {
+        d_Free(s->allocator, s->field_sizes);
+    }
+    if (s->field_aligns) {
+        d_Free(s->allocator, s->field_aligns);
+    }
+    if (s->columns) {
+        d_Free(s->allocator, s->columns);
+    }
+    d_Free(s->allocator, s);
+    *soa = NULL;
+    return 0;
+}
+
+int d_SoAReserve(dSoA_t* soa, size_t min_capacity)
+{
+    if (!soa) {
+        d_LogError("Attempted to reserve space in NULL struct-of-arrays container.");
+        return 1;
+    }
+    if (min_capacity <= soa->capacity) {
+        return 0;
+    }
+
+    size_t bytes = _d_SoAStorageSize(soa, min_capacity);
+    void* storage = bytes ? d_Alloc(soa->allocator, bytes) : NULL;
+    if (!storage) {
+        d_LogErrorF("Failed to grow struct-of-arrays container to %zu rows.", min_capacity);
+        return 1;
+    }
+
+    // Columns keep their order; each one moves to its new aligned start
+    size_t max_align = D_SOA_COLUMN_ALIGNMENT;
+    for (size_t f = 0; f < soa->field_count; f++) {
+        max_align = MAX(max_align, soa->field_aligns[f]);
+    }
+    uintptr_t base = _d_SoAAlignUp((uintptr_t)storage, max_align);
+    size_t offset = 0;
+    for (size_t f = 0; f < soa->field_count; f++) {
+        offset = _d_SoAAlignUp(offset, soa->field_aligns[f]);
+        void* column = (void*)(base + offset);
+        if (soa->count > 0) {
+            memcpy(column, soa->columns[f], soa->count * soa->field_sizes[f]);
+        }
+        soa->columns[f] = column;
+        offset += min_capacity * soa->field_sizes[f];
+    }
+
+    if (soa->storage) {
+        d_Free(soa->allocator, soa->storage);
+    }
+    soa->storage = storage;
+    soa->capacity = min_capacity;
+    return 0;
+}
+
+// =============================================================================
+// ROW OPERATIONS
+// =============================================================================
+
+int d_SoAAppend(dSoA_t* soa, const void* const* values)
+{
+    if (!soa) {
+        d_LogError("Attempted to append to NULL struct-of-arrays container.");
+        return 1;
+    }
+    if (soa->count >= soa->capacity &&
+        d_SoAReserve(soa, soa->capacity < D_SOA_MIN_GROWTH ? D_SOA_MIN_GROWTH : soa->capacity * 2) != 0) {
+        return 1;
+    }
+
+    size_t row = soa->count;
+    for (size_t f = 0; f < soa->field_count; f++) {
+        uint8_t* dest = (uint8_t*)soa->columns[f] + row * soa->field_sizes[f];
+        if (values && values[f]) {
+            memcpy(dest, values[f], soa->field_sizes[f]);
+        } else {
+            memset(dest, 0, soa->field_sizes[f]);
+        }
+    }
+    soa->count++;
+    return 0;
+}
+
+int d_SoASwapRemove(dSoA_t* soa, size_t index)
+{
+    if (!soa || index >= soa->count) {
+        d_LogError("Invalid row for struct-of-arrays swap-remove.");
+        return 1;
+    }
+
+    size_t last = soa->count - 1;
+    if (index != last) {
+        for (size_t f = 0; f < soa->field_count; f++) {
+            size_t size = soa->field_sizes[f];
+            uint8_t* column = (uint8_t*)soa->columns[f];
+            memcpy(column + index * size, column + last * size, size);
+        }
+    }
+    soa->count--;
+    return 0;
+}
+
+int d_SoAClear(dSoA_t* soa)
+{
+    if (!soa) {
+        d_LogError("Attempted to clear NULL struct-of-arrays container.");
+        return 1;
+    }
+    soa->count = 0;
+    return 0;
+}
+
+// =============================================================================
+// COLUMN ACCESS
+// =============================================================================
+
+void* d_SoAGetColumn(const dSoA_t* soa, size_t field)
+{
+    if (!soa || field >= soa->field_count) {
+        return NULL;
+    }
+    return soa->columns[field];
+}
+
+void* d_SoAGet(const dSoA_t* soa, size_t field, size_t index)
+{
+    if (!soa || field >= soa->field_count || index >= soa->count) {
+        return NULL;
+    }
+    return (uint8_t*)soa->columns[field] + index * soa->field_sizes[field];
+}
+
+size_t d_SoAGetCount(const dSoA_t* soa)
+{
+    return soa ? soa->count : 0;
+}
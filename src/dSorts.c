@@ -0,0 +1,495 @@
+// File: src/dSorts.c - Array Sorting for Daedalus Library
+// Stable merge sort (serial and on a job system) and LSD radix sort for dArray_t and dStaticArray_t
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "Daedalus.h"
+
+#define D_SORT_RUN 32                 // Elements per insertion-sorted run before merging
+#define D_SORT_PARALLEL_GRAIN 16384   // Minimum elements per slice worth handing to a worker
+#define D_SORT_RADIX_BITS 8
+#define D_SORT_RADIX_BUCKETS (1u << D_SORT_RADIX_BITS)
+#define D_SORT_RADIX_PASSES (64 / D_SORT_RADIX_BITS)
+
+// One unit of parallel work: sort a slice in place, or merge two sorted runs into `dst`
+typedef struct {
+    const uint8_t* a;
+    size_t a_count;
+    const uint8_t* b;
+    size_t b_count;
+    uint8_t* dst;
+    uint8_t* scratch;
+    size_t element_size;
+    dSortCompareFunc compare;
+    void* user_data;
+} _dSortTask_t;
+
+// =============================================================================
+// INTERNAL HELPER FUNCTIONS
+// =============================================================================
+
+/**
+ * @brief Internal helper: Copy one element, with fixed-size copies for the common sizes.
+ */
+static inline void _d_SortCopy(void* dst, const void* src, size_t size)
+{
+    switch (size) {
+        case 4:  memcpy(dst, src, 4);  break;
+        case 8:  memcpy(dst, src, 8);  break;
+        case 16: memcpy(dst, src, 16); break;
+        default: memcpy(dst, src, size); break;
+    }
+}
+
+/**
+ * @brief Internal helper: Scratch buffer for `count` elements, or NULL on overflow or failure.
+ */
+static void* _d_SortScratch(const dAllocator_t* allocator, size_t count, size_t element_size)
+{
+    if (count > SIZE_MAX / element_size) {
+        d_LogErrorF("Sort scratch size overflows for %zu elements.", count);
+        return NULL;
+    }
+    void* scratch = d_Alloc(allocator, count * element_size);
+    if (!scratch) {
+        d_LogErrorF("Failed to allocate sort scratch for %zu elements.", count);
+    }
+    return scratch;
+}
+
+/**
+ * @brief Internal helper: Stable insertion sort of a short run; `tmp` holds one element.
+ */
+static void _d_SortInsertion(uint8_t* base, size_t count, size_t size, dSortCompareFunc compare,
+                             void* user_data, uint8_t* tmp)
+{
+    for (size_t i = 1; i < count; i++) {
+        uint8_t* item = base + i * size;
+        size_t j = i;
+        while (j > 0 && compare(base + (j - 1) * size, item, user_data) > 0) {
+            j--;
+        }
+        if (j < i) {
+            _d_SortCopy(tmp, item, size);
+            memmove(base + (j + 1) * size, base + j * size, (i - j) * size);
+            _d_SortCopy(base + j * size, tmp, size);
+        }
+    }
+}
+
+/**
+ * @brief Internal helper: Stable merge of sorted runs `a` and `b` into `dst` (ties take from `a`).
+ */
+static void _d_SortMerge(const uint8_t* a, size_t a_count, const uint8_t* b, size_t b_count, uint8_t* dst,
+                         size_t size, dSortCompareFunc compare, void* user_data)
+{
+    // Already in order: one bulk copy instead of a compare per element
+    if (a_count == 0 || b_count == 0 || compare(a + (a_count - 1) * size, b, user_data) <= 0) {
+        memcpy(dst, a, a_count * size);
+        memcpy(dst + a_count * size, b, b_count * size);
+        return;
+    }
+
+    const uint8_t* a_end = a + a_count * size;
+    const uint8_t* b_end = b + b_count * size;
+    while (a < a_end && b < b_end) {
+        if (compare(a, b, user_data) <= 0) {
+            _d_SortCopy(dst, a, size);
+            a += size;
+        } else {
+            _d_SortCopy(dst, b, size);
+            b += size;
+        }
+        dst += size;
+    }
+    memcpy(dst, a, (size_t)(a_end - a));
+    memcpy(dst + (a_end - a), b, (size_t)(b_end - b));
+}
+
+/**
+ * @brief Internal helper: Bottom-up merge sort of `count` elements, leaving the result in `base`.
+ *
+ * `scratch` must hold `count` elements.
+ */
+static void _d_SortRange(uint8_t* base, size_t count, size_t size, dSortCompareFunc compare, void* user_data,
+                         uint8_t* scratch)
+{
+    for (size_t lo = 0; lo < count; lo += D_SORT_RUN) {
+        _d_SortInsertion(base + lo * size, MIN(D_SORT_RUN, count - lo), size, compare, user_data, scratch);
+    }
+
+    uint8_t* src = base;
+    uint8_t* dst = scratch;
+    for (size_t width = D_SORT_RUN; width < count; width *= 2) {
+        for (size_t lo = 0; lo < count; lo += 2 * width) {
+            size_t mid = MIN(lo + width, count);
+            size_t hi = MIN(lo + 2 * width, count);
+            _d_SortMerge(src + lo * size, mid - lo, src + mid * size, hi - mid, dst + lo * size,
+                         size, compare, user_data);
+        }
+        uint8_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != base) {
+        memcpy(base, src, count * size);
+    }
+}
+
+static int _d_Sort(void* data, size_t count, size_t size, const dAllocator_t* allocator,
+                   dSortCompareFunc compare, void* user_data)
+{
+    if (count < 2) {
+        return 0;
+    }
+    uint8_t* scratch = (uint8_t*)_d_SortScratch(allocator, count, size);
+    if (!scratch) {
+        return 1;
+    }
+    _d_SortRange((uint8_t*)data, count, size, compare, user_data, scratch);
+    d_Free(allocator, scratch);
+    return 0;
+}
+
+// =============================================================================
+// PARALLEL MERGE SORT
+// =============================================================================
+
+static void _d_SortSliceJob(void* data)
+{
+    _dSortTask_t* task = (_dSortTask_t*)data;
+    _d_SortRange(task->dst, task->a_count, task->element_size, task->compare, task->user_data, task->scratch);
+}
+
+static void _d_SortMergeJob(void* data)
+{
+    _dSortTask_t* task = (_dSortTask_t*)data;
+    _d_SortMerge(task->a, task->a_count, task->b, task->b_count, task->dst, task->element_size,
+                 task->compare, task->user_data);
+}
+
+/**
+ * @brief Internal helper: Start of part `part` when `total` elements are cut into `parts` even parts.
+ */
+static inline size_t _d_SortSplit(size_t total, size_t part, size_t parts)
+{
+    return total / parts * part + total % parts * part / parts;
+}
+
+/**
+ * @brief Internal helper: How many elements of `a` land in the first `k` outputs of merging `a` and `b`.
+ *
+ * Lets one large merge be split into independent pieces that each write their own part of the output.
+ */
+static size_t _d_SortCoRank(size_t k, const uint8_t* a, size_t a_count, const uint8_t* b, size_t b_count,
+                            size_t size, dSortCompareFunc compare, void* user_data)
+{
+    size_t lo = k > b_count ? k - b_count : 0;
+    size_t hi = MIN(k, a_count);
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        // b[j - 1] only precedes a[i] if strictly smaller, since ties take from `a`
+        if (j > 0 && compare(b + (j - 1) * size, a + i * size, user_data) >= 0) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief Internal helper: Sort each slice as a job, then merge neighbouring runs in rounds.
+ *
+ * Every round splits its merges into about `slices` pieces, so the last round still keeps all
+ * threads busy instead of leaving one thread to merge the whole array.
+ */
+static int _d_SortParallel(dJobSystem_t* jobs, void* data, size_t count, size_t size,
+                           const dAllocator_t* allocator, dSortCompareFunc compare, void* user_data)
+{
+    size_t threads = d_JobSystemGetWorkerCount(jobs) + 1;
+    size_t slices = MIN(threads, count / D_SORT_PARALLEL_GRAIN);
+    if (slices < 2) {
+        return _d_Sort(data, count, size, allocator, compare, user_data);
+    }
+
+    uint8_t* scratch = (uint8_t*)_d_SortScratch(allocator, count, size);
+    _dSortTask_t* tasks = (_dSortTask_t*)d_Calloc(allocator, slices + 1, sizeof(_dSortTask_t));
+    size_t* bounds = (size_t*)d_Calloc(allocator, slices + 1, sizeof(size_t));
+    if (!scratch || !tasks || !bounds) {
+        d_LogError("Failed to allocate parallel sort state.");
+        d_Free(allocator, scratch);
+        d_Free(allocator, tasks);
+        d_Free(allocator, bounds);
+        return 1;
+    }
+
+    uint8_t* base = (uint8_t*)data;
+    for (size_t s = 0; s <= slices; s++) {
+        bounds[s] = _d_SortSplit(count, s, slices);
+    }
+
+    // Jobs that fail to submit run here instead, so the result never depends on the queue
+    dJobCounter_t done = { 0, 0, NULL };
+    for (size_t s = 0; s < slices; s++) {
+        _dSortTask_t* task = &tasks[s];
+        task->dst = base + bounds[s] * size;
+        task->scratch = scratch + bounds[s] * size;
+        task->a_count = bounds[s + 1] - bounds[s];
+        task->element_size = size;
+        task->compare = compare;
+        task->user_data = user_data;
+        if (s + 1 == slices || d_JobSystemSubmit(jobs, _d_SortSliceJob, task, &done, NULL) != 0) {
+            _d_SortSliceJob(task);
+        }
+    }
+    d_JobSystemWait(jobs, &done);
+
+    uint8_t* src = base;
+    uint8_t* dst = scratch;
+    for (size_t width = 1; width < slices; width *= 2) {
+        size_t pairs = (slices + 2 * width - 1) / (2 * width);
+        size_t pieces = MAX(1, slices / pairs);
+        size_t used = 0;
+        for (size_t p = 0; p < pairs; p++) {
+            size_t lo = bounds[p * 2 * width];
+            size_t mid = bounds[MIN(p * 2 * width + width, slices)];
+            size_t hi = bounds[MIN(p * 2 * width + 2 * width, slices)];
+            const uint8_t* a = src + lo * size;
+            const uint8_t* b = src + mid * size;
+            size_t a_count = mid - lo;
+            size_t b_count = hi - mid;
+            size_t total = a_count + b_count;
+            size_t prev_k = 0;
+            size_t prev_i = 0;
+            for (size_t piece = 1; piece <= pieces; piece++) {
+                size_t k = _d_SortSplit(total, piece, pieces);
+                size_t i = _d_SortCoRank(k, a, a_count, b, b_count, size, compare, user_data);
+                _dSortTask_t* task = &tasks[used++];
+                task->a = a + prev_i * size;
+                task->a_count = i - prev_i;
+                task->b = b + (prev_k - prev_i) * size;
+                task->b_count = (k - i) - (prev_k - prev_i);
+                task->dst = dst + (lo + prev_k) * size;
+                prev_k = k;
+                prev_i = i;
+            }
+        }
+        for (size_t t = 0; t < used; t++) {
+            if (t + 1 == used || d_JobSystemSubmit(jobs, _d_SortMergeJob, &tasks[t], &done, NULL) != 0) {
+                _d_SortMergeJob(&tasks[t]);
+            }
+        }
+        d_JobSystemWait(jobs, &done);
+
+        uint8_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != base) {
+        memcpy(base, src, count * size);
+    }
+
+    d_Free(allocator, scratch);
+    d_Free(allocator, tasks);
+    d_Free(allocator, bounds);
+    return 0;
+}
+
+// =============================================================================
+// RADIX SORT
+// =============================================================================
+
+/**
+ * @brief Internal helper: Stable LSD radix sort on keys extracted once per element.
+ *
+ * All digit histograms come from a single pass over the keys, and any digit that is the
+ * same in every key is skipped, so 32-bit keys cost at most four passes.
+ */
+static int _d_RadixSort(void* data, size_t count, size_t size, const dAllocator_t* allocator,
+                        dSortKeyFunc key_func, void* user_data)
+{
+    if (count < 2) {
+        return 0;
+    }
+    uint8_t* scratch = (uint8_t*)_d_SortScratch(allocator, count, size);
+    uint64_t* keys = scratch ? (uint64_t*)_d_SortScratch(allocator, count, 2 * sizeof(uint64_t)) : NULL;
+    size_t* histograms = keys ? (size_t*)d_Calloc(allocator, D_SORT_RADIX_PASSES * D_SORT_RADIX_BUCKETS,
+                                                  sizeof(size_t)) : NULL;
+    if (!histograms) {
+        d_Free(allocator, scratch);
+        d_Free(allocator, keys);
+        return 1;
+    }
+
+    uint8_t* base = (uint8_t*)data;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t key = key_func(base + i * size, user_data);
+        keys[i] = key;
+        for (unsigned pass = 0; pass < D_SORT_RADIX_PASSES; pass++) {
+            histograms[pass * D_SORT_RADIX_BUCKETS + ((key >> (pass * D_SORT_RADIX_BITS)) & 0xFF)]++;
+        }
+    }
+
+    uint8_t* src = base;
+    uint8_t* dst = scratch;
+    uint64_t* src_keys = keys;
+    uint64_t* dst_keys = keys + count;
+    for (unsigned pass = 0; pass < D_SORT_RADIX_PASSES; pass++) {
+        size_t* offsets = histograms + pass * D_SORT_RADIX_BUCKETS;
+        unsigned shift = pass * D_SORT_RADIX_BITS;
+        if (offsets[(src_keys[0] >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        size_t running = 0;
+        for (unsigned bucket = 0; bucket < D_SORT_RADIX_BUCKETS; bucket++) {
+            size_t n = offsets[bucket];
+            offsets[bucket] = running;
+            running += n;
+        }
+        for (size_t i = 0; i < count; i++) {
+            uint64_t key = src_keys[i];
+            size_t position = offsets[(key >> shift) & 0xFF]++;
+            dst_keys[position] = key;
+            _d_SortCopy(dst + position * size, src + i * size, size);
+        }
+
+        uint8_t* swap = src;
+        src = dst;
+        dst = swap;
+        uint64_t* swap_keys = src_keys;
+        src_keys = dst_keys;
+        dst_keys = swap_keys;
+    }
+    if (src != base) {
+        memcpy(base, src, count * size);
+    }
+
+    d_Free(allocator, scratch);
+    d_Free(allocator, keys);
+    d_Free(allocator, histograms);
+    return 0;
+}
+
+// =============================================================================
+// KEY EXTRACTORS
+// =============================================================================
+
+uint64_t d_SortKeyInt32(const void* element, void* user_data)
+{
+    (void)user_data;
+    int32_t value;
+    memcpy(&value, element, sizeof(value));
+    return (uint32_t)value ^ 0x80000000u;
+}
+
+uint64_t d_SortKeyUInt32(const void* element, void* user_data)
+{
+    (void)user_data;
+    uint32_t value;
+    memcpy(&value, element, sizeof(value));
+    return value;
+}
+
+uint64_t d_SortKeyInt64(const void* element, void* user_data)
+{
+    (void)user_data;
+    int64_t value;
+    memcpy(&value, element, sizeof(value));
+    return d_SortKeyFromInt64(value);
+}
+
+uint64_t d_SortKeyUInt64(const void* element, void* user_data)
+{
+    (void)user_data;
+    uint64_t value;
+    memcpy(&value, element, sizeof(value));
+    return value;
+}
+
+uint64_t d_SortKeyFloat(const void* element, void* user_data)
+{
+    (void)user_data;
+    float value;
+    memcpy(&value, element, sizeof(value));
+    return d_SortKeyFromFloat(value);
+}
+
+uint64_t d_SortKeyDouble(const void* element, void* user_data)
+{
+    (void)user_data;
+    double value;
+    memcpy(&value, element, sizeof(value));
+    return d_SortKeyFromDouble(value);
+}
+
+// =============================================================================
+// ARRAY SORTS
+// =============================================================================
+
+int d_ArraySort(dArray_t* array, dSortCompareFunc compare, void* user_data)
+{
+    if (!array || !compare) {
+        d_LogError("Invalid parameters for array sort.");
+        return 1;
+    }
+    return _d_Sort(array->data, array->count, array->element_size, array->allocator, compare, user_data);
+}
+
+int d_ArraySortParallel(dJobSystem_t* jobs, dArray_t* array, dSortCompareFunc compare, void* user_data)
+{
+    if (!array || !compare) {
+        d_LogError("Invalid parameters for parallel array sort.");
+        return 1;
+    }
+    if (!jobs) {
+        return _d_Sort(array->data, array->count, array->element_size, array->allocator, compare, user_data);
+    }
+    return _d_SortParallel(jobs, array->data, array->count, array->element_size, array->allocator,
+                           compare, user_data);
+}
+
+int d_ArrayRadixSort(dArray_t* array, dSortKeyFunc key_func, void* user_data)
+{
+    if (!array || !key_func) {
+        d_LogError("Invalid parameters for array radix sort.");
+        return 1;
+    }
+    return _d_RadixSort(array->data, array->count, array->element_size, array->allocator, key_func, user_data);
+}
+
+int d_StaticArraySort(dStaticArray_t* array, dSortCompareFunc compare, void* user_data)
+{
+    if (!array || !compare) {
+        d_LogError("Invalid parameters for static array sort.");
+        return 1;
+    }
+    return _d_Sort(array->data, array->count, array->element_size, array->allocator, compare, user_data);
+}
+
+int d_StaticArraySortParallel(dJobSystem_t* jobs, dStaticArray_t* array, dSortCompareFunc compare,
+                              void* user_data)
+{
+    if (!array || !compare) {
+        d_LogError("Invalid parameters for parallel static array sort.");
+        return 1;
+    }
+    if (!jobs) {
+        return _d_Sort(array->data, array->count, array->element_size, array->allocator, compare, user_data);
+    }
+    return _d_SortParallel(jobs, array->data, array->count, array->element_size, array->allocator,
+                           compare, user_data);
+}
+
+int d_StaticArrayRadixSort(dStaticArray_t* array, dSortKeyFunc key_func, void* user_data)
+{
+    if (!array || !key_func) {
+        d_LogError("Invalid parameters for static array radix sort.");
+        return 1;
+    }
+    return _d_RadixSort(array->data, array->count, array->element_size, array->allocator, key_func, user_data);
+}
@@ -3,15 +3,27 @@
 #include <string.h>
 #include "Daedalus.h"
 
+// File format identifiers for d_StaticArraySaveToFile / d_LoadStaticArrayFromFile
+#define D_STATIC_ARRAY_MAGIC 0xDAEDDDCA
+#define D_STATIC_ARRAY_VERSION 2
+
 dStaticArray_t* d_InitStaticArray(size_t capacity, size_t element_size)
+{
+    return d_InitStaticArrayWithAllocator(capacity, element_size, NULL);
+}
+
+dStaticArray_t* d_InitStaticArrayWithAllocator(size_t capacity, size_t element_size, const dAllocator_t* allocator)
 {
     // Validate input parameters
     if (capacity == 0 || element_size == 0) {
         return NULL;
     }
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
 
     // Allocate memory for the array structure
-    dStaticArray_t* array = (dStaticArray_t*)malloc(sizeof(dStaticArray_t));
+    dStaticArray_t* array = (dStaticArray_t*)d_Alloc(allocator, sizeof(dStaticArray_t));
     if (!array) {
         return NULL; // Structure allocation failed
     }
@@ -20,10 +32,10 @@ dStaticArray_t* d_InitStaticArray(size_t capacity, size_t element_size)
     size_t data_size = capacity * element_size;
     
     // Allocate memory for the data buffer
-    array->data = malloc(data_size);
+    array->data = d_Alloc(allocator, data_size);
     if (!array->data) {
         // Data allocation failed, cleanup structure
-        free(array);
+        d_Free(allocator, array);
         return NULL;
     }
 
@@ -31,6 +43,7 @@ dStaticArray_t* d_InitStaticArray(size_t capacity, size_t element_size)
     array->capacity = capacity;
     array->count = 0;
     array->element_size = element_size;
+    array->allocator = allocator;
 
     // Initialize data buffer to zero for predictable behavior
     memset(array->data, 0, data_size);
@@ -45,13 +58,14 @@ int d_StaticArrayDestroy(dStaticArray_t* array)
     }
 
     // Free data buffer if it exists
+    const dAllocator_t* allocator = array->allocator;
     if (array->data) {
-        free(array->data);
+        d_Free(allocator, array->data);
         array->data = NULL;
     }
 
     // Free the array structure itself
-    free(array);
+    d_Free(allocator, array);
 
     return 0; // Success
 }
@@ -241,13 +255,16 @@ void* d_StaticArrayPeekRawMemory(dStaticArray_t* array)
 /**
  * @brief Save a static array to a binary file
  *
- * Binary file format:
- * - Magic number (4 bytes): 0xDAEDARRA (Daedalus Array)
- * - Version (4 bytes): File format version (currently 1)
+ * Binary file format (version 2):
+ * - Magic number (4 bytes): 0xDAEDDDCA (Daedalus Array)
+ * - Version (4 bytes): File format version (currently 2)
  * - Capacity (8 bytes): Array capacity
  * - Count (8 bytes): Current number of elements
  * - Element size (8 bytes): Size of each element in bytes
- * - Data (capacity * element_size bytes): Raw array data
+ * - Data (count * element_size bytes): Used elements only
+ * - Checksum (8 bytes): d_ChecksumFinal() over everything before it
+ *
+ * Version 1 stored all capacity * element_size bytes and had no checksum.
  *
  * @param filename Path to the file where the array should be saved
  * @param array Pointer to the static array to save
@@ -266,64 +283,123 @@ int d_StaticArraySaveToFile(const char* filename, const dStaticArray_t* array)
         return 1;
     }
 
-    // Open file for binary writing
-    FILE* file = fopen(filename, "wb");
-    if (!file) {
+    // Staged in a large buffer and written to a temp file that replaces `filename` on commit
+    dFileWriter_t* writer = d_FileWriterOpen(filename, 0);
+    if (!writer) {
         d_LogErrorF("Failed to open file for writing: %s", filename);
         return 1;
     }
 
     // Write file header
-    const uint32_t magic_number = 0xDAEDDDCA; // Daedalus Array magic
-    const uint32_t version = 1;
+    const uint32_t magic_number = D_STATIC_ARRAY_MAGIC;
+    const uint32_t version = D_STATIC_ARRAY_VERSION;
 
-    if (fwrite(&magic_number, sizeof(uint32_t), 1, file) != 1) {
-        d_LogError("Failed to write magic number to file.");
-        fclose(file);
+    if (d_FileWriterWrite(writer, &magic_number, sizeof(uint32_t)) != 0 ||
+        d_FileWriterWrite(writer, &version, sizeof(uint32_t)) != 0) {
+        d_LogError("Failed to write file header.");
+        d_FileWriterAbort(&writer);
         return 1;
     }
 
-    if (fwrite(&version, sizeof(uint32_t), 1, file) != 1) {
-        d_LogError("Failed to write version to file.");
-        fclose(file);
+    // Write array metadata
+    if (d_FileWriterWrite(writer, &array->capacity, sizeof(size_t)) != 0 ||
+        d_FileWriterWrite(writer, &array->count, sizeof(size_t)) != 0 ||
+        d_FileWriterWrite(writer, &array->element_size, sizeof(size_t)) != 0) {
+        d_LogError("Failed to write array metadata to file.");
+        d_FileWriterAbort(&writer);
         return 1;
     }
 
-    // Write array metadata
-    if (fwrite(&array->capacity, sizeof(size_t), 1, file) != 1) {
-        d_LogError("Failed to write array capacity to file.");
-        fclose(file);
+    // Write array data (used elements only; the rest of the capacity is not meaningful)
+    if (d_FileWriterWrite(writer, array->data, array->count * array->element_size) != 0) {
+        d_LogError("Failed to write array data to file.");
+        d_FileWriterAbort(&writer);
         return 1;
     }
 
-    if (fwrite(&array->count, sizeof(size_t), 1, file) != 1) {
-        d_LogError("Failed to write array count to file.");
-        fclose(file);
+    if (d_FileWriterCommit(&writer) != 0) {
+        d_LogErrorF("Failed to commit static array file: %s", filename);
         return 1;
     }
 
-    if (fwrite(&array->element_size, sizeof(size_t), 1, file) != 1) {
-        d_LogError("Failed to write element size to file.");
-        fclose(file);
-        return 1;
+    d_LogInfo("Successfully saved static array to file.");
+    return 0;
+}
+
+static int _d_StaticArrayWriteSnapshot(const char* filename, void* snapshot)
+{
+    return d_StaticArraySaveToFile(filename, (const dStaticArray_t*)snapshot);
+}
+
+static void _d_StaticArrayFreeSnapshot(void* snapshot)
+{
+    d_StaticArrayDestroy((dStaticArray_t*)snapshot);
+}
+
+/**
+ * @brief Save a static array to a binary file on a background thread
+ *
+ * The snapshot keeps the array's capacity but allocates only the `count` used
+ * elements, which is all d_StaticArraySaveToFile writes.
+ *
+ * @param filename Path to the file where the array should be saved
+ * @param array Pointer to the static array to save
+ * @param callback Optional completion callback, run on the background thread
+ * @param user_data Passed to `callback`
+ * @return Save handle, or NULL on failure
+ */
+dAsyncSave_t* d_StaticArraySaveToFileAsync(const char* filename, const dStaticArray_t* array,
+                                           dAsyncSaveCallback callback, void* user_data)
+{
+    // Input validation
+    if (!filename || !array || !array->data) {
+        d_LogError("Invalid parameters for saving static array to file asynchronously.");
+        return NULL;
     }
 
-    // Write array data (entire capacity, not just count)
-    size_t total_data_size = array->capacity * array->element_size;
-    if (fwrite(array->data, 1, total_data_size, file) != total_data_size) {
-        d_LogError("Failed to write array data to file.");
-        fclose(file);
-        return 1;
+    // The snapshot is freed on the worker thread, so it lives on the heap whatever
+    // allocator the array uses (an arena may be reset before the save finishes)
+    const dAllocator_t* heap = d_GetHeapAllocator();
+    size_t data_size = array->count * array->element_size;
+    dStaticArray_t* snapshot = (dStaticArray_t*)d_Alloc(heap, sizeof(dStaticArray_t));
+    if (!snapshot) {
+        d_LogError("Failed to allocate static array snapshot.");
+        return NULL;
     }
+    *snapshot = *array;
+    snapshot->allocator = heap;
+    snapshot->data = d_Alloc(heap, data_size > 0 ? data_size : 1);
+    if (!snapshot->data) {
+        d_LogErrorF("Failed to allocate %zu bytes for static array snapshot.", data_size);
+        d_Free(heap, snapshot);
+        return NULL;
+    }
+    memcpy(snapshot->data, array->data, data_size);
 
-    fclose(file);
-    d_LogInfo("Successfully saved static array to file.");
+    return d_AsyncSaveStart(filename, snapshot, _d_StaticArrayWriteSnapshot, _d_StaticArrayFreeSnapshot,
+                            callback, user_data);
+}
+
+/**
+ * @brief Internal helper: fread that also feeds the bytes into a running checksum.
+ *
+ * @return 0 if all `size` bytes were read, 1 otherwise
+ */
+static int _d_StaticArrayRead(FILE* file, void* dest, size_t size, dChecksum_t* checksum)
+{
+    if (fread(dest, 1, size, file) != size) {
+        return 1;
+    }
+    d_ChecksumUpdate(checksum, dest, size);
     return 0;
 }
 
 /**
  * @brief Load a static array from a binary file
  *
+ * Accepts version 2 files (count-only data, checksum verified) and version 1 files
+ * (full capacity, no checksum).
+ *
  * @param filename Path to the file containing the saved array
  * @return Pointer to new static array, or NULL on failure
  */
@@ -342,29 +418,32 @@ dStaticArray_t* d_LoadStaticArrayFromFile(const char* filename)
         return NULL;
     }
 
+    dChecksum_t checksum;
+    d_ChecksumReset(&checksum);
+
     // Read and validate file header
     uint32_t magic_number, version;
 
-    if (fread(&magic_number, sizeof(uint32_t), 1, file) != 1) {
+    if (_d_StaticArrayRead(file, &magic_number, sizeof(uint32_t), &checksum) != 0) {
         d_LogErrorF("Failed to read magic number from file: %s", filename);
         fclose(file);
         return NULL;
     }
 
-    if (magic_number != 0xDAEDDDCA) {
+    if (magic_number != D_STATIC_ARRAY_MAGIC) {
         d_LogErrorF("Invalid magic number in file: %s (expected Daedalus Array format)", filename);
         fclose(file);
         return NULL;
     }
 
-    if (fread(&version, sizeof(uint32_t), 1, file) != 1) {
+    if (_d_StaticArrayRead(file, &version, sizeof(uint32_t), &checksum) != 0) {
         d_LogErrorF("Failed to read version from file: %s", filename);
         fclose(file);
         return NULL;
     }
 
-    if (version != 1) {
-        d_LogErrorF("Unsupported file version: %u (expected 1)", version);
+    if (version != 1 && version != D_STATIC_ARRAY_VERSION) {
+        d_LogErrorF("Unsupported file version: %u (expected 1 or %u)", version, D_STATIC_ARRAY_VERSION);
         fclose(file);
         return NULL;
     }
@@ -372,19 +451,19 @@ dStaticArray_t* d_LoadStaticArrayFromFile(const char* filename)
     // Read array metadata
     size_t capacity, count, element_size;
 
-    if (fread(&capacity, sizeof(size_t), 1, file) != 1) {
+    if (_d_StaticArrayRead(file, &capacity, sizeof(size_t), &checksum) != 0) {
         d_LogErrorF("Failed to read array capacity from file: %s", filename);
         fclose(file);
         return NULL;
     }
 
-    if (fread(&count, sizeof(size_t), 1, file) != 1) {
+    if (_d_StaticArrayRead(file, &count, sizeof(size_t), &checksum) != 0) {
         d_LogErrorF("Failed to read array count from file: %s", filename);
         fclose(file);
         return NULL;
     }
 
-    if (fread(&element_size, sizeof(size_t), 1, file) != 1) {
+    if (_d_StaticArrayRead(file, &element_size, sizeof(size_t), &checksum) != 0) {
         d_LogErrorF("Failed to read element size from file: %s", filename);
         fclose(file);
         return NULL;
@@ -412,15 +491,26 @@ dStaticArray_t* d_LoadStaticArrayFromFile(const char* filename)
         return NULL;
     }
 
-    // Read array data
-    size_t total_data_size = capacity * element_size;
-    if (fread(array->data, 1, total_data_size, file) != total_data_size) {
+    // Read array data; version 1 files hold the whole capacity
+    size_t total_data_size = (version == 1 ? capacity : count) * element_size;
+    if (_d_StaticArrayRead(file, array->data, total_data_size, &checksum) != 0) {
         d_LogErrorF("Failed to read array data from file: %s", filename);
         d_StaticArrayDestroy(array);
         fclose(file);
         return NULL;
     }
 
+    if (version == D_STATIC_ARRAY_VERSION) {
+        uint64_t stored_checksum;
+        if (fread(&stored_checksum, sizeof(uint64_t), 1, file) != 1 ||
+            stored_checksum != d_ChecksumFinal(&checksum)) {
+            d_LogErrorF("Checksum mismatch in file: %s (file is truncated or corrupt)", filename);
+            d_StaticArrayDestroy(array);
+            fclose(file);
+            return NULL;
+        }
+    }
+
     // Set the count to the loaded value
     array->count = count;
 
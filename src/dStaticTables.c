@@ -1,124 +1,535 @@
 // File: src/dStaticTables.c - Fixed-Structure Hash Table Implementation for Daedalus Library
 // Hash table with immutable key set and optimized for known key structures
 
+// Define feature test macros before any includes
+#define _POSIX_C_SOURCE 200809L  // For mmap, fstat, open
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "Daedalus.h"
+#include "dInternal.h"
+
+// Platform-specific read-only file mapping
+#ifdef _WIN32
+    // No mmap: the file is read into one heap block instead (still no per-entry work)
+    #define D_STATIC_TABLE_HAS_MMAP 0
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #define D_STATIC_TABLE_HAS_MMAP 1
+#endif
+
+// Platform-specific worker threads for d_InitStaticTableParallel
+#if defined(__EMSCRIPTEN__) || defined(_WIN32)
+    #define D_STATIC_TABLE_HAS_THREADS 0  // Build serially on the calling thread
+#else
+    #include <pthread.h>
+    #define D_STATIC_TABLE_HAS_THREADS 1
+#endif
+
+// Parallel builds give each thread at least this many keys, and use at most this many threads
+#define D_STATIC_PARALLEL_MIN_KEYS 4096
+#define D_STATIC_PARALLEL_MAX_THREADS 64
+
+// Average keys per pilot bucket in PERFECT mode; fewer means faster builds but more pilots
+#define D_STATIC_PERFECT_BUCKET_LOAD 4
+
+// Odd 64-bit constant spreading consecutive pilots across the hash space
+#define D_STATIC_PERFECT_PILOT_STEP ((size_t)0x9E3779B97F4A7C15ULL)
+
+// Bytes before the first chain block of a CHAINED-mode slab (holds the link to the next slab)
+#define D_STATIC_SLAB_HEADER D_CHAIN_BLOCK_ALIGN(sizeof(void*))
 
 // =============================================================================
 // INTERNAL HELPER FUNCTIONS (reuse from dTables.c)
 // =============================================================================
 
 /**
- * @brief Internal helper: Create a new hash table entry for static table.
+ * @brief Internal helper: Find an entry in a bucket by key for static table.
  *
- * Allocates memory for a dTableEntry_t and copies the provided key and value
- * data into it. This entry will be stored in a linked list bucket.
+ * Searches through a linked list bucket to find an entry with a matching key
+ * using the provided comparison function.
  *
- * @param key Pointer to the key data to copy
- * @param key_size Size of the key data in bytes
- * @param value Pointer to the value data to copy
- * @param value_size Size of the value data in bytes
+ * @param bucket_head Head of the linked list bucket
+ * @param key Key to search for
+ * @param key_size Size of the key
+ * @param compare_func Function to compare keys
+ * @param hash Full hash of `key`; entries with a different stored hash are skipped
+ *             without calling `compare_func`
  *
- * @return Pointer to new dTableEntry_t, or NULL on failure
+ * @return Pointer to the matching dTableEntry_t, or NULL if not found
  */
-static dTableEntry_t* _d_CreateStaticTableEntry(const void* key, size_t key_size, 
-                                                 const void* value, size_t value_size)
+static dTableEntry_t* _d_FindEntryInStaticBucket(dLinkedList_t* bucket_head, const void* key, 
+                                                  size_t key_size, dTableCompareFunc compare_func, size_t hash)
 {
-    if (!key || !value || key_size == 0 || value_size == 0) {
-        d_LogError("Invalid parameters for creating static table entry.");
-        return NULL;
+    if (!bucket_head || !key || !compare_func) return NULL;
+
+    dLinkedList_t* current = bucket_head;
+    while (current != NULL) {
+        dTableEntry_t* entry = (dTableEntry_t*)current->data;
+        if (entry && entry->hash == hash && compare_func(entry->key_data, key, key_size) == 0) {
+            return entry;
+        }
+        current = current->next;
     }
+    return NULL;
+}
+
+/**
+ * @brief Internal helper: Bytes between consecutive chain blocks in a slab.
+ */
+static size_t _d_StaticBlockStride(const dStaticTable_t* table)
+{
+    return D_CHAIN_BLOCK_ALIGN(_d_ChainBlockSize(table->key_size, table->value_size));
+}
 
-    dTableEntry_t* entry = (dTableEntry_t*)malloc(sizeof(dTableEntry_t));
-    if (!entry) {
-        d_LogError("Failed to allocate memory for static table entry structure.");
+/**
+ * @brief Internal helper: Allocate one slab of `count` chain blocks and link it on the table.
+ *
+ * CHAINED tables never free a single key, so every node, entry, key and value is
+ * carved from slabs: one per build, or one per partition of a parallel build. The
+ * slab's first D_STATIC_SLAB_HEADER bytes link it to the table's previous slab.
+ *
+ * @param count Number of blocks; must be nonzero
+ *
+ * @return The first block, or NULL on failure
+ */
+static uint8_t* _d_StaticReserveBlocks(dStaticTable_t* table, size_t count)
+{
+    size_t stride = _d_StaticBlockStride(table);
+    if (count > (SIZE_MAX - D_STATIC_SLAB_HEADER) / stride) {
+        d_LogError("Static table entries exceed the addressable size.");
         return NULL;
     }
 
-    // Allocate and copy key data
-    entry->key_data = malloc(key_size);
-    if (!entry->key_data) {
-        d_LogError("Failed to allocate memory for static table entry key data.");
-        free(entry);
+    void** slab = (void**)d_Alloc(table->allocator, D_STATIC_SLAB_HEADER + count * stride);
+    if (!slab) {
+        d_LogError("Failed to allocate memory for static table entries.");
         return NULL;
     }
-    memcpy(entry->key_data, key, key_size);
+    *slab = table->slabs;
+    table->slabs = slab;
+    return (uint8_t*)slab + D_STATIC_SLAB_HEADER;
+}
+
+/**
+ * @brief Internal helper: Free every slab of a CHAINED table.
+ *
+ * The bucket array itself is kept; all bucket heads are reset to NULL.
+ */
+static void _d_FreeStaticChains(dStaticTable_t* table)
+{
+    while (table->slabs) {
+        void* next = *(void**)table->slabs;
+        d_Free(table->allocator, table->slabs);
+        table->slabs = next;
+    }
+    if (table->buckets) {
+        memset(table->buckets->data, 0, table->num_buckets * sizeof(dLinkedList_t*));
+    }
+}
+
+/**
+ * @brief Internal helper: Allocate an empty static table with all buckets NULL.
+ *
+ * The table is returned with num_keys 0 and is_initialized false; the caller
+ * populates it and then marks it initialized. In PERFECT mode no bucket array is
+ * created; `num_buckets` is the pilot count and only the slot layout is computed.
+ *
+ * @param allocator Allocator for the table's lifetime (NULL = current default)
+ *
+ * @return Pointer to the new table, or NULL on failure
+ */
+static dStaticTable_t* _d_AllocStaticTable(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                           dTableCompareFunc compare_func, size_t num_buckets,
+                                           dStaticTableMode_t mode, const dAllocator_t* allocator)
+{
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
+    }
 
-    // Allocate and copy value data
-    entry->value_data = malloc(value_size);
-    if (!entry->value_data) {
-        d_LogError("Failed to allocate memory for static table entry value data.");
-        free(entry->key_data);
-        free(entry);
+    dStaticTable_t* table = (dStaticTable_t*)d_Calloc(allocator, 1, sizeof(dStaticTable_t));
+    if (!table) {
+        d_LogError("Failed to allocate memory for static hash table structure.");
         return NULL;
     }
-    memcpy(entry->value_data, value, value_size);
 
-    return entry;
+    table->allocator = allocator;
+    table->mode = mode;
+    if (mode == D_STATIC_TABLE_MODE_PERFECT) {
+        // Lay the value out at its natural alignment right after the key
+        size_t value_align = _d_NaturalAlignment(value_size);
+        size_t slot_align = MAX(_d_NaturalAlignment(key_size), value_align);
+        table->value_offset = (key_size + value_align - 1) / value_align * value_align;
+        table->slot_size = (table->value_offset + value_size + slot_align - 1) / slot_align * slot_align;
+    } else {
+        // Allocate buckets array using dArray_t as per header definition
+        table->buckets = d_ArrayInitWithAllocator(num_buckets, sizeof(dLinkedList_t*), allocator);
+        if (!table->buckets) {
+            d_LogError("Failed to allocate memory for static hash table buckets array.");
+            d_Free(allocator, table);
+            return NULL;
+        }
+
+        // Initialize all bucket pointers to NULL
+        for (size_t i = 0; i < num_buckets; i++) {
+            dLinkedList_t* null_ptr = NULL;
+            d_ArrayAppend(table->buckets, &null_ptr);
+        }
+    }
+
+    // Initialize table fields
+    table->num_buckets = num_buckets;
+    table->num_keys = 0;          // Will be set during population
+    table->key_size = key_size;
+    table->value_size = value_size;
+    table->hash_func = hash_func;
+    table->compare_func = compare_func;
+    table->is_initialized = false; // Will be set after population
+    table->version = 0;
+
+    return table;
 }
 
 /**
- * @brief Internal helper: Destroy a static hash table entry.
+ * @brief Internal helper: Add a key-value pair whose full hash is already known.
  *
- * Frees all memory associated with a dTableEntry_t including the key data,
- * value data, and the entry structure itself.
+ * The node, entry and copies are laid out in `block`, a block reserved with
+ * _d_StaticReserveBlocks(). Does not check for duplicates; the caller is
+ * responsible for that.
  *
- * @param entry Pointer to the entry to destroy
+ * @return 0 on success, 1 on failure
  */
-static void _d_DestroyStaticTableEntry(dTableEntry_t* entry)
+static int _d_StaticTableInsertHashed(dStaticTable_t* table, const void* key, const void* value, size_t hash,
+                                      uint8_t* block)
 {
-    if (!entry) return;
+    size_t bucket_index = hash % table->num_buckets;
+    dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, bucket_index);
+    if (!bucket_ptr) {
+        d_LogError("Failed to access bucket in static hash table.");
+        return 1;
+    }
 
-    if (entry->key_data) free(entry->key_data);
-    if (entry->value_data) free(entry->value_data);
-    free(entry);
+    dLinkedList_t* node = _d_ChainBlockFill(block, key, table->key_size, value, table->value_size, hash);
+    while (*bucket_ptr) {
+        bucket_ptr = &(*bucket_ptr)->next;
+    }
+    *bucket_ptr = node;
+    return 0;
 }
 
 /**
- * @brief Internal helper: Find an entry in a bucket by key for static table.
+ * @brief Internal helper: Copy every entry of `source` into the empty CHAINED table `dest`.
  *
- * Searches through a linked list bucket to find an entry with a matching key
- * using the provided comparison function.
- *
- * @param bucket_head Head of the linked list bucket
- * @param key Key to search for
- * @param key_size Size of the key
- * @param compare_func Function to compare keys
+ * Entries are placed using their stored hashes, so the hash function is not
+ * called again. `dest` is marked initialized on success.
  *
- * @return Pointer to the matching dTableEntry_t, or NULL if not found
+ * @return 0 on success, 1 on failure (dest is left partially populated)
  */
-static dTableEntry_t* _d_FindEntryInStaticBucket(dLinkedList_t* bucket_head, const void* key, 
-                                                  size_t key_size, dTableCompareFunc compare_func)
+static int _d_CopyStaticEntries(const dStaticTable_t* source, dStaticTable_t* dest)
 {
-    if (!bucket_head || !key || !compare_func) return NULL;
+    size_t stride = _d_StaticBlockStride(dest);
+    uint8_t* block = NULL;
+    if (source->num_keys > 0 && !(block = _d_StaticReserveBlocks(dest, source->num_keys))) {
+        return 1;
+    }
 
-    dLinkedList_t* current = bucket_head;
-    while (current != NULL) {
-        dTableEntry_t* entry = (dTableEntry_t*)current->data;
-        if (entry && compare_func(entry->key_data, key, key_size) == 0) {
-            return entry;
+    if (source->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        for (size_t i = 0; i < source->num_keys; i++, block += stride) {
+            const char* slot = (const char*)source->slots + i * source->slot_size;
+            if (_d_StaticTableInsertHashed(dest, slot, slot + source->value_offset, source->slot_hashes[i],
+                                           block) != 0) {
+                return 1;
+            }
         }
-        current = current->next;
+        dest->num_keys = source->num_keys;
+        dest->is_initialized = true;
+        return 0;
+    }
+
+    for (size_t i = 0; i < source->num_buckets; i++) {
+        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(source->buckets, i);
+        if (!bucket_ptr) {
+            continue;
+        }
+        for (dLinkedList_t* current = *bucket_ptr; current; current = current->next) {
+            dTableEntry_t* entry = (dTableEntry_t*)current->data;
+            if (!entry) {
+                continue;
+            }
+            if (_d_StaticTableInsertHashed(dest, entry->key_data, entry->value_data, entry->hash, block) != 0) {
+                return 1;
+            }
+            block += stride;
+        }
+    }
+
+    dest->num_keys = source->num_keys;
+    dest->is_initialized = true;
+    return 0;
+}
+
+// =============================================================================
+// PERFECT MODE (PTHash-style hash and displace)
+// =============================================================================
+
+/**
+ * @brief Internal helper: Slot a key with the given mixed hash lands in under `pilot`.
+ */
+static inline size_t _d_PerfectSlotFor(size_t mixed, size_t pilot, size_t num_slots)
+{
+    return d_HashMix(mixed ^ (pilot * D_STATIC_PERFECT_PILOT_STEP)) % num_slots;
+}
+
+/**
+ * @brief Internal helper: Find the slot holding `key` in a PERFECT table.
+ *
+ * The perfect hash gives the only slot the key can occupy, so a lookup is one
+ * key compare. The stored hash is not consulted: it lives in a separate array and
+ * would cost a second cache miss on every hit.
+ *
+ * @return Pointer to the slot (key first, value at `value_offset`), or NULL if absent
+ */
+static char* _d_PerfectFind(const dStaticTable_t* table, const void* key, size_t hash)
+{
+    size_t mixed = d_HashMix(hash);
+    size_t pilot = table->pilots[mixed % table->num_buckets];
+    size_t index = _d_PerfectSlotFor(mixed, pilot, table->num_keys);
+
+    char* slot = (char*)table->slots + index * table->slot_size;
+    if (table->compare_func(slot, key, table->key_size) == 0) {
+        return slot;
     }
     return NULL;
 }
 
 /**
- * @brief Internal helper: Generate a unique name for linked list storage.
+ * @brief Internal helper: Allocate the slot, hash and pilot arrays of a PERFECT table.
  *
- * Creates a unique string name for storing entries in linked lists based on
- * memory address to ensure uniqueness.
+ * @return 0 on success, 1 on failure (arrays already allocated are left for Destroy)
+ */
+static int _d_PerfectAllocArrays(dStaticTable_t* table, size_t num_slots)
+{
+    table->slots = d_Calloc(table->allocator, num_slots, table->slot_size);
+    table->slot_hashes = (size_t*)d_Alloc(table->allocator, num_slots * sizeof(size_t));
+    table->pilots = (uint32_t*)d_Calloc(table->allocator, table->num_buckets, sizeof(uint32_t));
+    if (!table->slots || !table->slot_hashes || !table->pilots) {
+        d_LogError("Failed to allocate arrays for perfect static hash table.");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Unmap a file mapped by d_MapStaticTableFromFile().
  *
- * @param entry Pointer to the entry
- * @param name_buffer Buffer to store the generated name
- * @param buffer_size Size of the name buffer
+ * @param allocator Allocator of the fallback buffer on platforms without mmap
  */
-static void _d_GenerateStaticEntryName(const dTableEntry_t* entry, char* name_buffer, size_t buffer_size)
+static void _d_StaticUnmap(const dAllocator_t* allocator, void* base, size_t size)
 {
-    snprintf(name_buffer, buffer_size, "static_entry_%p", (void*)entry);
+#if D_STATIC_TABLE_HAS_MMAP
+    (void)allocator;
+    munmap(base, size);
+#else
+    (void)size;
+    d_Free(allocator, base);
+#endif
+}
+
+/**
+ * @brief Internal helper: Free (or unmap) the arrays of a PERFECT table and NULL them.
+ */
+static void _d_PerfectReleaseArrays(dStaticTable_t* table)
+{
+    if (table->mapping) {
+        _d_StaticUnmap(table->allocator, table->mapping, table->mapping_size);
+    } else {
+        d_Free(table->allocator, table->slots);
+        d_Free(table->allocator, table->slot_hashes);
+        d_Free(table->allocator, table->pilots);
+    }
+    table->mapping = NULL;
+    table->mapping_size = 0;
+    table->slots = NULL;
+    table->slot_hashes = NULL;
+    table->pilots = NULL;
+}
+
+/**
+ * @brief Internal helper: Build the perfect hash and place every key in its slot.
+ *
+ * Keys are grouped into pilot buckets by their mixed hash. Buckets are then placed
+ * largest first, each trying pilots 0, 1, 2, ... until every one of its keys maps to
+ * a distinct free slot. Large buckets go first while most slots are still free; the
+ * singletons left at the end only need any one free slot.
+ *
+ * @return 0 on success, 1 on failure (duplicate keys, colliding hashes, or no memory)
+ */
+static int _d_PerfectBuild(dStaticTable_t* table, const void** keys, const void** values, size_t num_keys)
+{
+    size_t num_buckets = table->num_buckets;
+    size_t max_pilot = num_keys * 64 + 1024;
+    if (max_pilot > UINT32_MAX) {
+        max_pilot = UINT32_MAX;
+    }
+
+    int result = 1;
+    const dAllocator_t* allocator = table->allocator;
+    size_t* hashes = (size_t*)d_Alloc(allocator, num_keys * sizeof(size_t));
+    size_t* members = (size_t*)d_Alloc(allocator, num_keys * sizeof(size_t));
+    size_t* bucket_start = (size_t*)d_Calloc(allocator, num_buckets + 1, sizeof(size_t));
+    size_t* order = (size_t*)d_Alloc(allocator, num_buckets * sizeof(size_t));
+    uint8_t* taken = (uint8_t*)d_Calloc(allocator, num_keys, 1);
+    size_t* size_start = NULL;
+    size_t* bucket_mixed = NULL;
+    size_t* placed = NULL;
+    if (!hashes || !members || !bucket_start || !order || !taken) {
+        d_LogError("Failed to allocate scratch space for perfect hash construction.");
+        goto cleanup;
+    }
+
+    // Hash every key once and count how many land in each pilot bucket
+    for (size_t i = 0; i < num_keys; i++) {
+        if (!keys[i] || !values[i]) {
+            d_LogErrorF("NULL key or value at index %zu during static table initialization.", i);
+            goto cleanup;
+        }
+        hashes[i] = table->hash_func(keys[i], table->key_size);
+        bucket_start[d_HashMix(hashes[i]) % num_buckets + 1]++;
+    }
+
+    // Group key indices by bucket (bucket b owns members[bucket_start[b] .. bucket_start[b + 1]))
+    size_t max_size = 0;
+    for (size_t b = 0; b < num_buckets; b++) {
+        max_size = MAX(max_size, bucket_start[b + 1]);
+        bucket_start[b + 1] += bucket_start[b];
+        order[b] = bucket_start[b];
+    }
+    for (size_t i = 0; i < num_keys; i++) {
+        size_t b = d_HashMix(hashes[i]) % num_buckets;
+        members[order[b]++] = i;
+    }
+
+    // Counting sort of the buckets by size, largest first
+    size_start = (size_t*)d_Calloc(allocator, max_size + 2, sizeof(size_t));
+    bucket_mixed = (size_t*)d_Alloc(allocator, max_size * sizeof(size_t));
+    placed = (size_t*)d_Alloc(allocator, max_size * sizeof(size_t));
+    if (!size_start || !bucket_mixed || !placed) {
+        d_LogError("Failed to allocate scratch space for perfect hash construction.");
+        goto cleanup;
+    }
+    for (size_t b = 0; b < num_buckets; b++) {
+        size_start[max_size - (bucket_start[b + 1] - bucket_start[b]) + 1]++;
+    }
+    for (size_t s = 1; s <= max_size + 1; s++) {
+        size_start[s] += size_start[s - 1];
+    }
+    for (size_t b = 0; b < num_buckets; b++) {
+        order[size_start[max_size - (bucket_start[b + 1] - bucket_start[b])]++] = b;
+    }
+
+    for (size_t o = 0; o < num_buckets; o++) {
+        size_t b = order[o];
+        const size_t* bucket = members + bucket_start[b];
+        size_t bucket_size = bucket_start[b + 1] - bucket_start[b];
+        if (bucket_size == 0) {
+            break; // Sorted by size, so every remaining bucket is empty too
+        }
+
+        // Equal hashes always collide; tell duplicates apart from unusable hash functions
+        for (size_t m = 0; m < bucket_size; m++) {
+            bucket_mixed[m] = d_HashMix(hashes[bucket[m]]);
+            for (size_t prev = 0; prev < m; prev++) {
+                if (hashes[bucket[prev]] != hashes[bucket[m]]) {
+                    continue;
+                }
+                if (table->compare_func(keys[bucket[prev]], keys[bucket[m]], table->key_size) == 0) {
+                    d_LogErrorF("Duplicate key detected at index %zu during static table initialization.", bucket[m]);
+                } else {
+                    d_LogErrorF("Keys at index %zu and %zu have the same hash; no perfect hash can separate them.",
+                                bucket[prev], bucket[m]);
+                }
+                goto cleanup;
+            }
+        }
+
+        size_t pilot = 0;
+        for (; pilot <= max_pilot; pilot++) {
+            size_t placed_count = 0;
+            for (; placed_count < bucket_size; placed_count++) {
+                size_t slot = _d_PerfectSlotFor(bucket_mixed[placed_count], pilot, num_keys);
+                if (taken[slot]) {
+                    break;
+                }
+                size_t prev = 0;
+                while (prev < placed_count && placed[prev] != slot) {
+                    prev++;
+                }
+                if (prev < placed_count) {
+                    break;
+                }
+                placed[placed_count] = slot;
+            }
+            if (placed_count == bucket_size) {
+                break;
+            }
+        }
+        if (pilot > max_pilot) {
+            d_LogErrorF("No pilot found for perfect hash bucket %zu after %zu attempts.", b, max_pilot);
+            goto cleanup;
+        }
+
+        table->pilots[b] = (uint32_t)pilot;
+        for (size_t m = 0; m < bucket_size; m++) {
+            char* slot = (char*)table->slots + placed[m] * table->slot_size;
+            memcpy(slot, keys[bucket[m]], table->key_size);
+            memcpy(slot + table->value_offset, values[bucket[m]], table->value_size);
+            table->slot_hashes[placed[m]] = hashes[bucket[m]];
+            taken[placed[m]] = 1;
+        }
+    }
+
+    result = 0;
+
+cleanup:
+    d_Free(allocator, placed);
+    d_Free(allocator, bucket_mixed);
+    d_Free(allocator, size_start);
+    d_Free(allocator, taken);
+    d_Free(allocator, order);
+    d_Free(allocator, bucket_start);
+    d_Free(allocator, members);
+    d_Free(allocator, hashes);
+    return result;
+}
+
+/**
+ * @brief Internal helper: Deep copy of a PERFECT table into `allocator`; the pilots are reused as-is.
+ */
+static dStaticTable_t* _d_ClonePerfectTable(const dStaticTable_t* source, const dAllocator_t* allocator)
+{
+    dStaticTable_t* table = _d_AllocStaticTable(source->key_size, source->value_size,
+                                                source->hash_func, source->compare_func,
+                                                source->num_buckets, D_STATIC_TABLE_MODE_PERFECT, allocator);
+    if (!table) {
+        return NULL;
+    }
+    if (_d_PerfectAllocArrays(table, source->num_keys) != 0) {
+        d_StaticTableDestroy(&table);
+        return NULL;
+    }
+
+    memcpy(table->slots, source->slots, source->num_keys * source->slot_size);
+    memcpy(table->slot_hashes, source->slot_hashes, source->num_keys * sizeof(size_t));
+    memcpy(table->pilots, source->pilots, source->num_buckets * sizeof(uint32_t));
+    table->num_keys = source->num_keys;
+    table->is_initialized = true;
+    return table;
 }
 
 // =============================================================================
@@ -129,41 +540,35 @@ static void _d_GenerateStaticEntryName(const dTableEntry_t* entry, char* name_bu
 dStaticTable_t* d_InitStaticTable(size_t key_size, size_t value_size, dTableHashFunc hash_func,
                                   dTableCompareFunc compare_func, size_t num_buckets,
                                   const void** keys, const void** initial_values, size_t num_keys)
+{
+    return d_InitStaticTableWithAllocator(key_size, value_size, hash_func, compare_func, num_buckets,
+                                          keys, initial_values, num_keys, NULL);
+}
+
+dStaticTable_t* d_InitStaticTableWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                               dTableCompareFunc compare_func, size_t num_buckets,
+                                               const void** keys, const void** initial_values, size_t num_keys,
+                                               const dAllocator_t* allocator)
 {
     if (key_size == 0 || value_size == 0 || !hash_func || !compare_func || num_buckets == 0 || !keys || !initial_values || num_keys == 0) {
         d_LogError("Invalid parameters for static hash table initialization.");
         return NULL;
     }
 
-    dStaticTable_t* table = (dStaticTable_t*)malloc(sizeof(dStaticTable_t));
+    dStaticTable_t* table = _d_AllocStaticTable(key_size, value_size, hash_func, compare_func, num_buckets,
+                                                D_STATIC_TABLE_MODE_CHAINED, allocator);
     if (!table) {
-        d_LogError("Failed to allocate memory for static hash table structure.");
         return NULL;
     }
 
-    // Allocate buckets array using dArray_t as per header definition
-    table->buckets = d_ArrayInit(num_buckets, sizeof(dLinkedList_t*));
-    if (!table->buckets) {
-        d_LogError("Failed to allocate memory for static hash table buckets array.");
-        free(table);
+    // Every entry is carved from one slab
+    size_t stride = _d_StaticBlockStride(table);
+    uint8_t* blocks = _d_StaticReserveBlocks(table, num_keys);
+    if (!blocks) {
+        d_StaticTableDestroy(&table);
         return NULL;
     }
 
-    // Initialize all bucket pointers to NULL
-    for (size_t i = 0; i < num_buckets; i++) {
-        dLinkedList_t* null_ptr = NULL;
-        d_ArrayAppend(table->buckets, &null_ptr);
-    }
-
-    // Initialize table fields
-    table->num_buckets = num_buckets;
-    table->num_keys = 0;          // Will be set during population
-    table->key_size = key_size;
-    table->value_size = value_size;
-    table->hash_func = hash_func;
-    table->compare_func = compare_func;
-    table->is_initialized = false; // Will be set after population
-
     // Populate table with fixed key set
     for (size_t i = 0; i < num_keys; i++) {
         if (!keys[i] || !initial_values[i]) {
@@ -186,101 +591,452 @@ dStaticTable_t* d_InitStaticTable(size_t key_size, size_t value_size, dTableHash
         }
 
         // Check for duplicate keys
-        if (_d_FindEntryInStaticBucket(*bucket_ptr, keys[i], table->key_size, table->compare_func)) {
+        if (_d_FindEntryInStaticBucket(*bucket_ptr, keys[i], table->key_size, table->compare_func, hash)) {
             d_LogErrorF("Duplicate key detected at index %zu during static table initialization.", i);
             d_StaticTableDestroy(&table);
             return NULL;
         }
 
-        // Create new entry
-        dTableEntry_t* new_entry = _d_CreateStaticTableEntry(keys[i], table->key_size, 
-                                                              initial_values[i], table->value_size);
-        if (!new_entry) {
-            d_LogError("Failed to create entry during static table initialization.");
+        if (_d_StaticTableInsertHashed(table, keys[i], initial_values[i], hash, blocks + i * stride) != 0) {
+            d_LogErrorF("Failed to insert key at index %zu during static table initialization.", i);
             d_StaticTableDestroy(&table);
             return NULL;
         }
+    }
+
+    // Mark table as fully initialized
+    table->num_keys = num_keys;
+    table->is_initialized = true;
 
-        // Generate unique name and add to bucket
-        char entry_name[64];
-        _d_GenerateStaticEntryName(new_entry, entry_name, sizeof(entry_name));
+    d_LogInfoF("Static hash table initialized with %zu fixed keys across %zu buckets.", 
+               num_keys, table->num_buckets);
 
-        if (d_PushBackToLinkedList(bucket_ptr, new_entry, entry_name, sizeof(dTableEntry_t)) != 0) {
-            d_LogErrorF("Failed to add entry to bucket %zu during static table initialization.", bucket_index);
-            _d_DestroyStaticTableEntry(new_entry);
-            d_StaticTableDestroy(&table);
+    return table;
+}
+
+// =============================================================================
+// PARALLEL CONSTRUCTION
+// =============================================================================
+
+/**
+ * @brief Work assigned to one thread of a parallel static table build.
+ */
+typedef struct
+{
+    dStaticTable_t* table;
+    const void** keys;
+    const void** values;
+    size_t* hashes;                  // Full hash of every key, filled by the hash phase
+    const size_t* order;             // Key indices grouped by bucket, in input order within a bucket
+    const size_t* bucket_start;      // Bucket b owns order[bucket_start[b] .. bucket_start[b + 1])
+    size_t key_begin, key_end;       // Hash phase: keys hashed by this task
+    size_t bucket_begin, bucket_end; // Insert phase: buckets owned by this task
+    uint8_t* blocks;                 // Insert phase: chain blocks for those buckets' keys, in `order`
+    int failed;
+} _dStaticBuildTask_t;
+
+/**
+ * @brief Internal helper: Hash phase of a parallel build (one contiguous key range).
+ */
+static void* _d_StaticHashTask(void* arg)
+{
+    _dStaticBuildTask_t* task = (_dStaticBuildTask_t*)arg;
+    for (size_t i = task->key_begin; i < task->key_end; i++) {
+        if (!task->keys[i] || !task->values[i]) {
+            d_LogErrorF("NULL key or value at index %zu during static table initialization.", i);
+            task->failed = 1;
             return NULL;
         }
+        task->hashes[i] = task->table->hash_func(task->keys[i], task->table->key_size);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Internal helper: Insert phase of a parallel build (one contiguous bucket range).
+ *
+ * No other task touches these buckets, so the chains are built without locking, and
+ * the task's blocks were reserved up front, so it never calls the allocator. Keys are
+ * inserted in input order, giving the same chains as d_InitStaticTable().
+ */
+static void* _d_StaticInsertTask(void* arg)
+{
+    _dStaticBuildTask_t* task = (_dStaticBuildTask_t*)arg;
+    dStaticTable_t* table = task->table;
+    size_t stride = _d_StaticBlockStride(table);
+    uint8_t* block = task->blocks;
+    for (size_t b = task->bucket_begin; b < task->bucket_end; b++) {
+        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, b);
+        for (size_t j = task->bucket_start[b]; j < task->bucket_start[b + 1]; j++) {
+            size_t i = task->order[j];
+            if (_d_FindEntryInStaticBucket(*bucket_ptr, task->keys[i], table->key_size,
+                                           table->compare_func, task->hashes[i])) {
+                d_LogErrorF("Duplicate key detected at index %zu during static table initialization.", i);
+                task->failed = 1;
+                return NULL;
+            }
+            if (_d_StaticTableInsertHashed(table, task->keys[i], task->values[i], task->hashes[i], block) != 0) {
+                d_LogErrorF("Failed to insert key at index %zu during static table initialization.", i);
+                task->failed = 1;
+                return NULL;
+            }
+            block += stride;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Internal helper: Run `fn` over every task, tasks 1.. on new threads and task 0 here.
+ *
+ * A task whose thread cannot be started runs on the calling thread instead.
+ *
+ * @return 0 if every task succeeded, 1 otherwise
+ */
+static int _d_RunStaticBuildTasks(void* (*fn)(void*), _dStaticBuildTask_t* tasks, size_t num_tasks)
+{
+#if D_STATIC_TABLE_HAS_THREADS
+    pthread_t threads[D_STATIC_PARALLEL_MAX_THREADS];
+    bool started[D_STATIC_PARALLEL_MAX_THREADS] = { false };
+    for (size_t t = 1; t < num_tasks; t++) {
+        started[t] = pthread_create(&threads[t], NULL, fn, &tasks[t]) == 0;
+        if (!started[t]) {
+            fn(&tasks[t]);
+        }
+    }
+    fn(&tasks[0]);
+    for (size_t t = 1; t < num_tasks; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+#else
+    for (size_t t = 0; t < num_tasks; t++) {
+        fn(&tasks[t]);
+    }
+#endif
+
+    int failed = 0;
+    for (size_t t = 0; t < num_tasks; t++) {
+        failed |= tasks[t].failed;
+    }
+    return failed;
+}
+
+dStaticTable_t* d_InitStaticTableParallel(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                          dTableCompareFunc compare_func, size_t num_buckets,
+                                          const void** keys, const void** initial_values, size_t num_keys,
+                                          size_t num_threads)
+{
+    return d_InitStaticTableParallelWithAllocator(key_size, value_size, hash_func, compare_func, num_buckets,
+                                                  keys, initial_values, num_keys, num_threads, NULL);
+}
+
+dStaticTable_t* d_InitStaticTableParallelWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                                       dTableCompareFunc compare_func, size_t num_buckets,
+                                                       const void** keys, const void** initial_values,
+                                                       size_t num_keys, size_t num_threads,
+                                                       const dAllocator_t* allocator)
+{
+    if (key_size == 0 || value_size == 0 || !hash_func || !compare_func || num_buckets == 0 || !keys || !initial_values || num_keys == 0) {
+        d_LogError("Invalid parameters for static hash table initialization.");
+        return NULL;
+    }
+
+    if (num_threads == 0) {
+        num_threads = _d_HardwareThreads();
+    }
+    num_threads = MIN(num_threads, (size_t)D_STATIC_PARALLEL_MAX_THREADS);
+    num_threads = MIN(num_threads, MAX(num_keys / D_STATIC_PARALLEL_MIN_KEYS, (size_t)1));
+    if (num_threads <= 1 || !D_STATIC_TABLE_HAS_THREADS) {
+        return d_InitStaticTableWithAllocator(key_size, value_size, hash_func, compare_func, num_buckets,
+                                              keys, initial_values, num_keys, allocator);
+    }
+
+    dStaticTable_t* table = _d_AllocStaticTable(key_size, value_size, hash_func, compare_func, num_buckets,
+                                                D_STATIC_TABLE_MODE_CHAINED, allocator);
+    if (!table) {
+        return NULL;
+    }
+
+    // Scratch is allocated and freed here on the calling thread only
+    allocator = table->allocator;
+    size_t* hashes = (size_t*)d_Alloc(allocator, num_keys * sizeof(size_t));
+    size_t* order = (size_t*)d_Alloc(allocator, num_keys * sizeof(size_t));
+    size_t* bucket_start = (size_t*)d_Calloc(allocator, num_buckets + 1, sizeof(size_t));
+    _dStaticBuildTask_t tasks[D_STATIC_PARALLEL_MAX_THREADS];
+    int failed = !hashes || !order || !bucket_start;
+    if (failed) {
+        d_LogError("Failed to allocate scratch space for parallel static table build.");
+        goto done;
+    }
+
+    // Phase 1: hash every key, one contiguous key range per thread
+    for (size_t t = 0; t < num_threads; t++) {
+        tasks[t] = (_dStaticBuildTask_t){ table, keys, initial_values, hashes, order, bucket_start,
+                                          num_keys * t / num_threads, num_keys * (t + 1) / num_threads,
+                                          0, 0, NULL, 0 };
+    }
+    failed = _d_RunStaticBuildTasks(_d_StaticHashTask, tasks, num_threads);
+    if (failed) {
+        goto done;
+    }
+
+    // Phase 2: stable counting sort of key indices by bucket
+    for (size_t i = 0; i < num_keys; i++) {
+        bucket_start[hashes[i] % num_buckets + 1]++;
+    }
+    for (size_t b = 0; b < num_buckets; b++) {
+        bucket_start[b + 1] += bucket_start[b];
+    }
+    for (size_t i = 0; i < num_keys; i++) {
+        order[bucket_start[hashes[i] % num_buckets]++] = i;
+    }
+    // Each bucket_start[b] now holds the end of bucket b; shift back to start offsets
+    memmove(bucket_start + 1, bucket_start, num_buckets * sizeof(size_t));
+    bucket_start[0] = 0;
+
+    // Phase 3: split the buckets into ranges holding about the same number of keys, and
+    // reserve each range's chain blocks in one slab here, so no thread allocates
+    size_t bucket = 0;
+    for (size_t t = 0; t < num_threads && !failed; t++) {
+        size_t target = num_keys * (t + 1) / num_threads;
+        tasks[t].bucket_begin = bucket;
+        while (bucket < num_buckets && (t == num_threads - 1 || bucket_start[bucket + 1] <= target)) {
+            bucket++;
+        }
+        tasks[t].bucket_end = bucket;
+        size_t count = bucket_start[tasks[t].bucket_end] - bucket_start[tasks[t].bucket_begin];
+        if (count > 0 && !(tasks[t].blocks = _d_StaticReserveBlocks(table, count))) {
+            failed = 1;
+        }
+    }
+    if (!failed) {
+        failed = _d_RunStaticBuildTasks(_d_StaticInsertTask, tasks, num_threads);
+    }
+
+done:
+    d_Free(allocator, bucket_start);
+    d_Free(allocator, order);
+    d_Free(allocator, hashes);
+    if (failed) {
+        d_StaticTableDestroy(&table);
+        return NULL;
     }
 
-    // Mark table as fully initialized
     table->num_keys = num_keys;
     table->is_initialized = true;
 
-    d_LogInfoF("Static hash table initialized with %zu fixed keys across %zu buckets.", 
-               num_keys, table->num_buckets);
+    d_LogInfoF("Static hash table initialized with %zu fixed keys across %zu buckets on %zu threads.",
+               num_keys, table->num_buckets, num_threads);
+
+    return table;
+}
+
+dStaticTable_t* d_InitStaticTablePerfect(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                         dTableCompareFunc compare_func,
+                                         const void** keys, const void** initial_values, size_t num_keys)
+{
+    return d_InitStaticTablePerfectWithAllocator(key_size, value_size, hash_func, compare_func,
+                                                 keys, initial_values, num_keys, NULL);
+}
+
+dStaticTable_t* d_InitStaticTablePerfectWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                                      dTableCompareFunc compare_func,
+                                                      const void** keys, const void** initial_values, size_t num_keys,
+                                                      const dAllocator_t* allocator)
+{
+    if (key_size == 0 || value_size == 0 || !hash_func || !compare_func || !keys || !initial_values || num_keys == 0) {
+        d_LogError("Invalid parameters for perfect static hash table initialization.");
+        return NULL;
+    }
+
+    size_t num_pilots = (num_keys + D_STATIC_PERFECT_BUCKET_LOAD - 1) / D_STATIC_PERFECT_BUCKET_LOAD;
+    dStaticTable_t* table = _d_AllocStaticTable(key_size, value_size, hash_func, compare_func, num_pilots,
+                                                D_STATIC_TABLE_MODE_PERFECT, allocator);
+    if (!table) {
+        return NULL;
+    }
+
+    if (_d_PerfectAllocArrays(table, num_keys) != 0 ||
+        _d_PerfectBuild(table, keys, initial_values, num_keys) != 0) {
+        d_StaticTableDestroy(&table);
+        return NULL;
+    }
+
+    table->num_keys = num_keys;
+    table->is_initialized = true;
+
+    d_LogInfoF("Perfect static hash table initialized with %zu fixed keys and %zu pilots.",
+               num_keys, num_pilots);
 
     return table;
 }
 
-/**
- * @brief Destroy a static hash table and free all associated memory.
- *
- * Deallocates all memory associated with a dStaticTable_t instance, including
- * all entries, buckets, and the structure itself.
- *
- * @param table A pointer to the pointer of the static hash table to destroy
- *
- * @return 0 on success, 1 on failure
- *
- * Example:
- * `d_StaticTableDestroy(&my_table); // my_table will be NULL after this`
- */
-int d_StaticTableDestroy(dStaticTable_t** table)
+/**
+ * @brief Destroy a static hash table and free all associated memory.
+ *
+ * Deallocates all memory associated with a dStaticTable_t instance, including
+ * all entries, buckets, and the structure itself.
+ *
+ * @param table A pointer to the pointer of the static hash table to destroy
+ *
+ * @return 0 on success, 1 on failure
+ *
+ * Example:
+ * `d_StaticTableDestroy(&my_table); // my_table will be NULL after this`
+ */
+int d_StaticTableDestroy(dStaticTable_t** table)
+{
+    if (!table || !*table) {
+        d_LogError("Attempted to destroy NULL or invalid static hash table.");
+        return 1;
+    }
+
+    dStaticTable_t* t = *table;
+
+    d_Free(t->allocator, t->seqs);
+
+    if (t->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        _d_PerfectReleaseArrays(t);
+        d_Free(t->allocator, t);
+        *table = NULL;
+        d_LogDebug("Static hash table destroyed successfully.");
+        return 0;
+    }
+
+    // Destroy all buckets and their entries
+    _d_FreeStaticChains(t);
+
+    // Free buckets array
+    d_ArrayDestroy(t->buckets);
+
+    // Free table structure
+    d_Free(t->allocator, t);
+
+    // Set caller's pointer to NULL
+    *table = NULL;
+
+    d_LogDebug("Static hash table destroyed successfully.");
+    return 0;
+}
+
+// =============================================================================
+// STATIC HASH TABLE VALUE MANAGEMENT
+// =============================================================================
+
+/**
+ * @brief Internal helper: Overwrite a value, under its seqlock when concurrent mode is on.
+ *
+ * The writer claims the counter by moving it from even to odd, copies the value, then
+ * publishes it by making the counter even again. Concurrent writers to the same
+ * counter wait for each other; readers retry if they saw an odd or changed counter.
+ *
+ * @param seq_index Bucket index (CHAINED) or slot index (PERFECT) of the value
+ */
+static void _d_StaticSeqWrite(const dStaticTable_t* table, size_t seq_index, void* dest, const void* src)
+{
+    if (!table->seqs) {
+        memcpy(dest, src, table->value_size);
+        return;
+    }
+
+    uint32_t* seq = &table->seqs[seq_index];
+    uint32_t current = __atomic_load_n(seq, __ATOMIC_RELAXED);
+    while ((current & 1) ||
+           !__atomic_compare_exchange_n(seq, &current, current + 1, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        current = __atomic_load_n(seq, __ATOMIC_RELAXED);
+    }
+    // Order the odd counter before the value stores
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(dest, src, table->value_size);
+    __atomic_store_n(seq, current + 2, __ATOMIC_RELEASE);
+}
+
+int d_StaticTableEnableConcurrent(dStaticTable_t* table)
+{
+    if (!table) {
+        d_LogError("Attempted to enable concurrent access on NULL static hash table.");
+        return 1;
+    }
+
+    if (!table->is_initialized) {
+        d_LogError("Attempted to enable concurrent access on uninitialized static table.");
+        return 1;
+    }
+
+    if (table->seqs) {
+        return 0; // Already enabled
+    }
+
+    // One counter per slot when every key has its own slot, otherwise one per bucket
+    size_t count = table->mode == D_STATIC_TABLE_MODE_PERFECT ? table->num_keys : table->num_buckets;
+    table->seqs = (uint32_t*)d_Calloc(table->allocator, count, sizeof(uint32_t));
+    if (!table->seqs) {
+        d_LogError("Failed to allocate sequence counters for concurrent static table.");
+        return 1;
+    }
+
+    d_LogDebugF("Enabled concurrent access on static table with %zu sequence counters.", count);
+    return 0;
+}
+
+int d_StaticTableGetConcurrent(const dStaticTable_t* table, const void* key, void* out_value)
 {
-    if (!table || !*table) {
-        d_LogError("Attempted to destroy NULL or invalid static hash table.");
+    if (!table || !key || !out_value) {
+        d_LogError("Invalid parameters for concurrent static table read.");
         return 1;
     }
 
-    dStaticTable_t* t = *table;
+    if (!table->is_initialized) {
+        d_LogError("Attempted to read value from uninitialized static table.");
+        return 1;
+    }
 
-    // Destroy all buckets and their entries
-    for (size_t i = 0; i < t->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(t->buckets, i);
-        if (bucket_ptr && *bucket_ptr) {
-            // Manually destroy entries first, then the linked list structure
-            dLinkedList_t* current = *bucket_ptr;
-            while (current) {
-                dTableEntry_t* entry = (dTableEntry_t*)current->data;
-                if (entry) {
-                    _d_DestroyStaticTableEntry(entry);
-                    current->data = NULL; // Prevent double free by linked list
-                }
-                current = current->next;
-            }
-            // Now destroy the linked list structure itself
-            d_DestroyLinkedList(bucket_ptr);
+    // Keys never move, so locating the value needs no synchronization
+    size_t hash = table->hash_func(key, table->key_size);
+    const void* value = NULL;
+    size_t seq_index = 0;
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        const char* slot = _d_PerfectFind(table, key, hash);
+        if (slot) {
+            value = slot + table->value_offset;
+            seq_index = (size_t)(slot - (const char*)table->slots) / table->slot_size;
+        }
+    } else {
+        seq_index = hash % table->num_buckets;
+        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, seq_index);
+        dTableEntry_t* entry = bucket_ptr ? _d_FindEntryInStaticBucket(*bucket_ptr, key, table->key_size,
+                                                                       table->compare_func, hash) : NULL;
+        if (entry) {
+            value = entry->value_data;
         }
     }
 
-    // Free buckets array
-    d_ArrayDestroy(t->buckets);
-
-    // Free table structure
-    free(t);
+    if (!value) {
+        return 1;
+    }
 
-    // Set caller's pointer to NULL
-    *table = NULL;
+    if (!table->seqs) {
+        memcpy(out_value, value, table->value_size);
+        return 0;
+    }
 
-    d_LogDebug("Static hash table destroyed successfully.");
-    return 0;
+    // Copy between two reads of the counter; a writer in between forces a retry
+    uint32_t* seq = &table->seqs[seq_index];
+    for (;;) {
+        uint32_t before = __atomic_load_n(seq, __ATOMIC_ACQUIRE);
+        if (before & 1) {
+            continue;
+        }
+        memcpy(out_value, value, table->value_size);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(seq, __ATOMIC_RELAXED) == before) {
+            return 0;
+        }
+    }
 }
 
-// =============================================================================
-// STATIC HASH TABLE VALUE MANAGEMENT
-// =============================================================================
-
 /**
  * @brief Update the value associated with a key in the static table.
  *
@@ -310,6 +1066,20 @@ int d_StaticTableSet(dStaticTable_t* table, const void* key, const void* new_val
 
     // Compute hash and bucket index
     size_t hash = table->hash_func(key, table->key_size);
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        if (table->mapping) {
+            d_LogError("Attempted to set value in read-only mapped static table.");
+            return 1;
+        }
+        char* slot = _d_PerfectFind(table, key, hash);
+        if (!slot) {
+            d_LogDebug("Key not found in perfect static table. Cannot add new keys to static table.");
+            return 1;
+        }
+        _d_StaticSeqWrite(table, (size_t)(slot - (char*)table->slots) / table->slot_size,
+                          slot + table->value_offset, new_value);
+        return 0;
+    }
     size_t bucket_index = hash % table->num_buckets;
 
     // Get bucket pointer
@@ -320,7 +1090,7 @@ int d_StaticTableSet(dStaticTable_t* table, const void* key, const void* new_val
     }
 
     // Find existing entry
-    dTableEntry_t* existing_entry = _d_FindEntryInStaticBucket(*bucket_ptr, key, table->key_size, table->compare_func);
+    dTableEntry_t* existing_entry = _d_FindEntryInStaticBucket(*bucket_ptr, key, table->key_size, table->compare_func, hash);
 
     if (!existing_entry) {
         d_LogDebugF("Key not found in static table (bucket %zu). Cannot add new keys to static table.", bucket_index);
@@ -329,19 +1099,9 @@ int d_StaticTableSet(dStaticTable_t* table, const void* key, const void* new_val
 
     // Update existing entry's value
     d_LogDebugF("Updating existing key value in static hash table (bucket %zu).", bucket_index);
-    
-    // Free old value data
-    if (existing_entry->value_data) {
-        free(existing_entry->value_data);
-    }
-    
-    // Allocate and copy new value data
-    existing_entry->value_data = malloc(table->value_size);
-    if (!existing_entry->value_data) {
-        d_LogError("Failed to allocate memory for updated static table value data.");
-        return 1;
-    }
-    memcpy(existing_entry->value_data, new_value, table->value_size);
+
+    // value_size is fixed, so overwrite in place; pointers from d_StaticTableGet stay valid
+    _d_StaticSeqWrite(table, bucket_index, existing_entry->value_data, new_value);
     
     return 0; // Success
 }
@@ -360,6 +1120,14 @@ void* d_StaticTableGet(const dStaticTable_t* table, const void* key)
 
     // Compute hash and bucket index
     size_t hash = table->hash_func(key, table->key_size);
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        char* slot = _d_PerfectFind(table, key, hash);
+        if (!slot) {
+            d_LogDebug("Key not found in perfect static table.");
+            return NULL;
+        }
+        return slot + table->value_offset;
+    }
     size_t bucket_index = hash % table->num_buckets;
 
     // Get bucket pointer
@@ -370,7 +1138,7 @@ void* d_StaticTableGet(const dStaticTable_t* table, const void* key)
     }
 
     // Find entry in bucket
-    dTableEntry_t* entry = _d_FindEntryInStaticBucket(*bucket_ptr, key, table->key_size, table->compare_func);
+    dTableEntry_t* entry = _d_FindEntryInStaticBucket(*bucket_ptr, key, table->key_size, table->compare_func, hash);
 
     if (entry) {
         // d_LogDebugF("Found key in static hash table (bucket %zu).", bucket_index);
@@ -410,6 +1178,9 @@ int d_StaticTableHasKey(const dStaticTable_t* table, const void* key)
 
     // Compute hash and bucket index
     size_t hash = table->hash_func(key, table->key_size);
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        return _d_PerfectFind(table, key, hash) ? 0 : 1;
+    }
     size_t bucket_index = hash % table->num_buckets;
 
     // Get bucket pointer
@@ -420,7 +1191,7 @@ int d_StaticTableHasKey(const dStaticTable_t* table, const void* key)
     }
 
     // Find entry in bucket
-    dTableEntry_t* entry = _d_FindEntryInStaticBucket(*bucket_ptr, key, table->key_size, table->compare_func);
+    dTableEntry_t* entry = _d_FindEntryInStaticBucket(*bucket_ptr, key, table->key_size, table->compare_func, hash);
 
     if (entry) {
         d_LogDebugF("Key found in static hash table (bucket %zu).", bucket_index);
@@ -491,27 +1262,17 @@ dArray_t* d_StaticTableGetAllKeys(const dStaticTable_t* table)
 
     size_t keys_collected = 0;
 
-    // Iterate through all buckets
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
-        if (!bucket_ptr || !*bucket_ptr) {
-            continue; // Empty bucket
-        }
-
-        dLinkedList_t* current_node = *bucket_ptr;
-        while (current_node != NULL) {
-            dTableEntry_t* entry = (dTableEntry_t*)current_node->data;
-            if (entry && entry->key_data) {
-                // Append key data to result array
-                if (d_ArrayAppend(all_keys_array, entry->key_data) != 0) {
-                    d_LogErrorF("Failed to append key to result array at bucket %zu.", i);
-                    d_ArrayDestroy(all_keys_array);
-                    return NULL;
-                }
-                keys_collected++;
-            }
-            current_node = current_node->next;
+    // Walk every entry, whatever the storage mode
+    dTableIter_t iter = d_StaticTableIterBegin(table);
+    const void* key;
+    while (d_StaticTableIterNext(&iter, &key, NULL)) {
+        // Append key data to result array
+        if (d_ArrayAppend(all_keys_array, (void*)key) != 0) {
+            d_LogErrorF("Failed to append key %zu to result array.", keys_collected);
+            d_ArrayDestroy(all_keys_array);
+            return NULL;
         }
+        keys_collected++;
     }
 
     d_LogDebugF("Collected %zu keys from static table (expected: %zu).", keys_collected, table->num_keys);
@@ -553,27 +1314,17 @@ dArray_t* d_StaticTableGetAllValues(const dStaticTable_t* table)
 
     size_t values_collected = 0;
 
-    // Iterate through all buckets
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
-        if (!bucket_ptr || !*bucket_ptr) {
-            continue; // Empty bucket
-        }
-
-        dLinkedList_t* current_node = *bucket_ptr;
-        while (current_node != NULL) {
-            dTableEntry_t* entry = (dTableEntry_t*)current_node->data;
-            if (entry && entry->value_data) {
-                // Append value data to result array
-                if (d_ArrayAppend(all_values_array, entry->value_data) != 0) {
-                    d_LogErrorF("Failed to append value to result array at bucket %zu.", i);
-                    d_ArrayDestroy(all_values_array);
-                    return NULL;
-                }
-                values_collected++;
-            }
-            current_node = current_node->next;
+    // Walk every entry, whatever the storage mode
+    dTableIter_t iter = d_StaticTableIterBegin(table);
+    void* value;
+    while (d_StaticTableIterNext(&iter, NULL, &value)) {
+        // Append value data to result array
+        if (d_ArrayAppend(all_values_array, value) != 0) {
+            d_LogErrorF("Failed to append value %zu to result array.", values_collected);
+            d_ArrayDestroy(all_values_array);
+            return NULL;
         }
+        values_collected++;
     }
 
     d_LogDebugF("Collected %zu values from static table (expected: %zu).", values_collected, table->num_keys);
@@ -597,6 +1348,7 @@ dArray_t* d_StaticTableGetAllValues(const dStaticTable_t* table)
  *
  * @note After this operation, the table will be in an uninitialized state
  * @note The bucket structure is preserved, only the entries are removed
+ * @note In PERFECT mode the slots and pilots are freed, since they only fit the old key set
  * @note To reuse the table, you must reinitialize it with keys
  *
  * Example:
@@ -609,28 +1361,22 @@ int d_StaticTableClear(dStaticTable_t* table)
         return 1;
     }
 
-    // Clear all buckets
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
-        if (bucket_ptr && *bucket_ptr) {
-            // Manually destroy entries first, then the linked list structure
-            dLinkedList_t* current = *bucket_ptr;
-            while (current) {
-                dTableEntry_t* entry = (dTableEntry_t*)current->data;
-                if (entry) {
-                    _d_DestroyStaticTableEntry(entry);
-                    current->data = NULL; // Prevent double free by linked list
-                }
-                current = current->next;
-            }
-            // Destroy the linked list
-            d_DestroyLinkedList(bucket_ptr);
-        }
+    // A new key set may need a different number of counters
+    d_Free(table->allocator, table->seqs);
+    table->seqs = NULL;
+
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        // The pilots only place the old key set, so nothing is worth keeping
+        _d_PerfectReleaseArrays(table);
     }
 
+    // Clear all buckets (none in PERFECT mode)
+    _d_FreeStaticChains(table);
+
     // Reset table state to uninitialized
     table->num_keys = 0;
     table->is_initialized = false;
+    table->version++;
 
     d_LogDebugF("Cleared static hash table, reset to uninitialized state (%zu buckets preserved).", 
                 table->num_buckets);
@@ -655,6 +1401,8 @@ int d_StaticTableClear(dStaticTable_t* table)
  * @note All output parameters are optional (can be NULL)
  * @note Average is calculated as a floating-point value
  * @note Useful for performance analysis and optimization
+ * @note In PERFECT mode every slot holds exactly one key, so min, max and avg are 1
+ *       and there are no empty slots
  *
  * Example:
  * `size_t min, max, empty; float avg;`
@@ -673,6 +1421,15 @@ int d_StaticTableGetStats(const dStaticTable_t* table, size_t* min_entries,
         return 1;
     }
 
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        // One key per slot by construction
+        if (min_entries) *min_entries = 1;
+        if (max_entries) *max_entries = 1;
+        if (avg_entries) *avg_entries = 1.0f;
+        if (empty_buckets) *empty_buckets = 0;
+        return 0;
+    }
+
     size_t min_count = SIZE_MAX;
     size_t max_count = 0;
     size_t total_entries = 0;
@@ -706,241 +1463,551 @@ int d_StaticTableGetStats(const dStaticTable_t* table, size_t* min_entries,
         min_count = 0;
     }
 
-    // Set output parameters if provided
-    if (min_entries) *min_entries = min_count;
-    if (max_entries) *max_entries = max_count;
-    if (avg_entries) *avg_entries = table->num_buckets > 0 ? (float)total_entries / (float)table->num_buckets : 0.0f;
-    if (empty_buckets) *empty_buckets = empty_count;
+    // Set output parameters if provided
+    if (min_entries) *min_entries = min_count;
+    if (max_entries) *max_entries = max_count;
+    if (avg_entries) *avg_entries = table->num_buckets > 0 ? (float)total_entries / (float)table->num_buckets : 0.0f;
+    if (empty_buckets) *empty_buckets = empty_count;
+
+    d_LogDebugF("Static table stats: min=%zu, max=%zu, avg=%.2f, empty=%zu/%zu buckets", 
+                min_count, max_count, 
+                table->num_buckets > 0 ? (float)total_entries / (float)table->num_buckets : 0.0f,
+                empty_count, table->num_buckets);
+
+    return 0;
+}
+
+/**
+ * @brief Create a copy of the static hash table with a different bucket count.
+ *
+ * Creates a new static table with the same keys and values but redistributed
+ * across a different number of buckets. This is useful for optimizing performance
+ * when the ideal bucket count is determined after initial creation.
+ *
+ * @param source_table A pointer to the source static hash table
+ * @param new_num_buckets The number of buckets for the new table
+ *
+ * @return A pointer to the newly created static table, or NULL on failure
+ *
+ * @note The source table remains unchanged
+ * @note All keys and values are copied to the new table
+ * @note The caller is responsible for destroying both tables
+ * @note Useful for performance optimization without modifying original table
+ * @note The new table is always in CHAINED mode, even when the source is PERFECT
+ *
+ * Example:
+ * `dStaticTable_t* optimized = d_RebucketStaticTable(original, 64);`
+ * `// Use optimized table, destroy when done`
+ * `d_StaticTableDestroy(&optimized);`
+ */
+dStaticTable_t* d_RebucketStaticTable(const dStaticTable_t* source_table, size_t new_num_buckets)
+{
+    if (!source_table) {
+        d_LogError("Attempted to rebucket NULL static hash table.");
+        return NULL;
+    }
+
+    if (!source_table->is_initialized) {
+        d_LogError("Attempted to rebucket uninitialized static table.");
+        return NULL;
+    }
+
+    if (new_num_buckets == 0) {
+        d_LogError("Cannot rebucket to zero buckets.");
+        return NULL;
+    }
+
+    // Entries keep their stored hashes, so only the bucket index is recomputed
+    dStaticTable_t* new_table = _d_AllocStaticTable(source_table->key_size, source_table->value_size,
+                                                    source_table->hash_func, source_table->compare_func,
+                                                    new_num_buckets, D_STATIC_TABLE_MODE_CHAINED, NULL);
+    if (new_table && _d_CopyStaticEntries(source_table, new_table) != 0) {
+        d_StaticTableDestroy(&new_table);
+    }
+
+    if (new_table) {
+        d_LogInfoF("Successfully rebucketed static table from %zu to %zu buckets with %zu keys.",
+                   source_table->num_buckets, new_num_buckets, source_table->num_keys);
+    } else {
+        d_LogError("Failed to create rebucketed static table.");
+    }
+
+    return new_table;
+}
+
+/**
+ * @brief Create a deep copy of a static hash table.
+ *
+ * This function creates a new dStaticTable_t and copies all fixed key-value pairs
+ * from the source table into the new table. All keys and values are
+ * deep-copied, ensuring the new table is independent of the original.
+ *
+ * @param source_table A pointer to the dStaticTable_t to clone.
+ *
+ * @return A pointer to the newly created dStaticTable_t, or NULL on failure.
+ *
+ * @note The caller is responsible for destroying the new table with d_StaticTableDestroy.
+ * @note The source table remains unchanged.
+ *
+ * Example:
+ * `dStaticTable_t* new_table = d_CloneStaticTable(original_table);`
+ * `if (new_table) {`
+ * `    // ... use the new table`
+ * `    d_StaticTableDestroy(&new_table);`
+ * `}`
+ */
+dStaticTable_t* d_CloneStaticTable(const dStaticTable_t* source_table)
+{
+    if (!source_table) {
+        d_LogError("Attempted to clone a NULL static hash table.");
+        return NULL;
+    }
+
+    if (!source_table->is_initialized) {
+        d_LogError("Attempted to clone an uninitialized static hash table.");
+        return NULL;
+    }
+
+    dStaticTable_t* new_table = NULL;
+    if (source_table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        new_table = _d_ClonePerfectTable(source_table, NULL);
+    } else {
+        // Copy entries bucket by bucket, reusing their stored hashes
+        new_table = _d_AllocStaticTable(source_table->key_size, source_table->value_size,
+                                        source_table->hash_func, source_table->compare_func,
+                                        source_table->num_buckets, D_STATIC_TABLE_MODE_CHAINED, NULL);
+        if (new_table && _d_CopyStaticEntries(source_table, new_table) != 0) {
+            d_StaticTableDestroy(&new_table);
+        }
+    }
+
+    if (new_table) {
+        d_LogInfoF("Successfully cloned static table with %zu keys.", source_table->num_keys);
+    } else {
+        d_LogError("Failed to create new table during clone operation.");
+    }
+    
+    return new_table;
+}
+
+// =============================================================================
+// STATIC HASH TABLE FILE I/O FUNCTIONS
+// =============================================================================
+
+// Magic number for file format validation
+#define D_STATIC_TABLE_MAGIC 0xDAEDDDCD
+#define D_STATIC_TABLE_VERSION 1
+
+// Version 2 stores a PERFECT table's pilots, hashes and slots as they sit in memory,
+// each section starting on its own page so the file can be mapped and used in place
+#define D_STATIC_TABLE_PERFECT_VERSION 2
+#define D_STATIC_TABLE_PAGE_SIZE 4096
+
+// Version 3 is version 1 plus a checksum trailer; CHAINED tables are written in it
+#define D_STATIC_TABLE_CHAINED_VERSION 3
+
+/**
+ * @brief On-disk header of a version 2 (PERFECT) static table file.
+ *
+ * All offsets are from the start of the file. The two 32-bit fields come first
+ * so the header has no padding.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t word_size;      // sizeof(size_t) of the writer; slot_hashes are stored as size_t
+    uint64_t key_size;
+    uint64_t value_size;
+    uint64_t slot_size;
+    uint64_t value_offset;
+    uint64_t num_buckets;    // Pilot count
+    uint64_t num_keys;       // Slot count
+    uint64_t pilots_offset;
+    uint64_t hashes_offset;
+    uint64_t slots_offset;
+    uint64_t file_size;      // Including the checksum trailer
+} _dStaticTableFileHeader_t;
+
+/**
+ * @brief Internal helper: Round `offset` up to the next page boundary.
+ */
+static uint64_t _d_StaticPageAlign(uint64_t offset)
+{
+    return (offset + D_STATIC_TABLE_PAGE_SIZE - 1) / D_STATIC_TABLE_PAGE_SIZE * D_STATIC_TABLE_PAGE_SIZE;
+}
+
+/**
+ * @brief Internal helper: Write a PERFECT table in the version 2 format.
+ *
+ * @return 0 on success, 1 on failure
+ */
+static int _d_WritePerfectFile(dFileWriter_t* writer, const dStaticTable_t* table)
+{
+    _dStaticTableFileHeader_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = D_STATIC_TABLE_MAGIC;
+    header.version = D_STATIC_TABLE_PERFECT_VERSION;
+    header.word_size = sizeof(size_t);
+    header.key_size = table->key_size;
+    header.value_size = table->value_size;
+    header.slot_size = table->slot_size;
+    header.value_offset = table->value_offset;
+    header.num_buckets = table->num_buckets;
+    header.num_keys = table->num_keys;
+    header.pilots_offset = _d_StaticPageAlign(sizeof(header));
+    header.hashes_offset = _d_StaticPageAlign(header.pilots_offset + table->num_buckets * sizeof(uint32_t));
+    header.slots_offset = _d_StaticPageAlign(header.hashes_offset + table->num_keys * sizeof(size_t));
+    header.file_size = header.slots_offset + table->num_keys * table->slot_size + sizeof(uint64_t);
+
+    struct {
+        uint64_t offset;
+        const void* data;
+        size_t size;
+    } sections[] = {
+        { 0, &header, sizeof(header) },
+        { header.pilots_offset, table->pilots, table->num_buckets * sizeof(uint32_t) },
+        { header.hashes_offset, table->slot_hashes, table->num_keys * sizeof(size_t) },
+        { header.slots_offset, table->slots, table->num_keys * table->slot_size },
+    };
+
+    // Zero-fill the gap before each section, then write it in one call
+    for (size_t i = 0; i < sizeof(sections) / sizeof(sections[0]); i++) {
+        if (d_FileWriterWriteZeros(writer, (size_t)(sections[i].offset - d_FileWriterTell(writer))) != 0 ||
+            d_FileWriterWrite(writer, sections[i].data, sections[i].size) != 0) {
+            d_LogErrorF("Failed to write section %zu to static table file.", i);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Write the magic, version and metadata of a version 3 file.
+ *
+ * @return 0 on success, 1 on failure
+ */
+static int _d_WriteChainedHeader(dFileWriter_t* writer, size_t key_size, size_t value_size,
+                                 size_t num_buckets, size_t num_keys)
+{
+    uint32_t magic = D_STATIC_TABLE_MAGIC;
+    uint32_t version = D_STATIC_TABLE_CHAINED_VERSION;
+    if (d_FileWriterWrite(writer, &magic, sizeof(uint32_t)) != 0 ||
+        d_FileWriterWrite(writer, &version, sizeof(uint32_t)) != 0 ||
+        d_FileWriterWrite(writer, &key_size, sizeof(size_t)) != 0 ||
+        d_FileWriterWrite(writer, &value_size, sizeof(size_t)) != 0 ||
+        d_FileWriterWrite(writer, &num_buckets, sizeof(size_t)) != 0 ||
+        d_FileWriterWrite(writer, &num_keys, sizeof(size_t)) != 0) {
+        d_LogError("Failed to write table metadata to static table file.");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Check a version 2 header against this platform and the file size.
+ *
+ * @return 0 if every section lies inside the file and the layout matches, 1 otherwise
+ */
+static int _d_ValidatePerfectHeader(const _dStaticTableFileHeader_t* header, uint64_t file_size)
+{
+    if (header->magic != D_STATIC_TABLE_MAGIC || header->version != D_STATIC_TABLE_PERFECT_VERSION) {
+        d_LogError("Not a version 2 static table file.");
+        return 1;
+    }
+    if (header->word_size != sizeof(size_t)) {
+        d_LogErrorF("Static table file was written with %u-byte words; this platform uses %zu.",
+                    (unsigned)header->word_size, sizeof(size_t));
+        return 1;
+    }
+    if (header->key_size == 0 || header->value_size == 0 || header->num_keys == 0 ||
+        header->num_buckets == 0 || header->file_size != file_size || file_size < sizeof(*header) + sizeof(uint64_t)) {
+        d_LogError("Invalid table metadata in static table file.");
+        return 1;
+    }
+
+    // Checked before the section bounds below divide by slot_size
+    if (header->slot_size == 0 || header->value_offset < header->key_size ||
+        header->value_offset > header->slot_size ||
+        header->value_size > header->slot_size - header->value_offset) {
+        d_LogError("Invalid slot layout in static table file.");
+        return 1;
+    }
 
-    d_LogDebugF("Static table stats: min=%zu, max=%zu, avg=%.2f, empty=%zu/%zu buckets", 
-                min_count, max_count, 
-                table->num_buckets > 0 ? (float)total_entries / (float)table->num_buckets : 0.0f,
-                empty_count, table->num_buckets);
+    // Mapped files use the pilots in place as a uint32_t array
+    if (header->pilots_offset % sizeof(uint32_t) != 0) {
+        d_LogError("Misaligned pilot section in static table file.");
+        return 1;
+    }
 
+    // Sections must end before the checksum trailer
+    uint64_t data_end = file_size - sizeof(uint64_t);
+    if (header->pilots_offset < sizeof(*header) || header->pilots_offset > data_end ||
+        header->hashes_offset > data_end || header->slots_offset > data_end ||
+        header->num_buckets > (data_end - header->pilots_offset) / sizeof(uint32_t) ||
+        header->hashes_offset < header->pilots_offset + header->num_buckets * sizeof(uint32_t) ||
+        header->num_keys > (data_end - header->hashes_offset) / sizeof(size_t) ||
+        header->slots_offset < header->hashes_offset + header->num_keys * sizeof(size_t) ||
+        header->num_keys > (data_end - header->slots_offset) / header->slot_size ||
+        header->hashes_offset % D_STATIC_TABLE_PAGE_SIZE != 0 ||
+        header->slots_offset % D_STATIC_TABLE_PAGE_SIZE != 0) {
+        d_LogError("Static table file sections are out of bounds.");
+        return 1;
+    }
     return 0;
 }
 
 /**
- * @brief Create a copy of the static hash table with a different bucket count.
- *
- * Creates a new static table with the same keys and values but redistributed
- * across a different number of buckets. This is useful for optimizing performance
- * when the ideal bucket count is determined after initial creation.
- *
- * @param source_table A pointer to the source static hash table
- * @param new_num_buckets The number of buckets for the new table
- *
- * @return A pointer to the newly created static table, or NULL on failure
- *
- * @note The source table remains unchanged
- * @note All keys and values are copied to the new table
- * @note The caller is responsible for destroying both tables
- * @note Useful for performance optimization without modifying original table
+ * @brief Internal helper: Allocate an empty PERFECT table shaped like `header`.
  *
- * Example:
- * `dStaticTable_t* optimized = d_RebucketStaticTable(original, 64);`
- * `// Use optimized table, destroy when done`
- * `d_StaticTableDestroy(&optimized);`
+ * Fails if this build lays slots out differently from the writer.
  */
-dStaticTable_t* d_RebucketStaticTable(const dStaticTable_t* source_table, size_t new_num_buckets)
+static dStaticTable_t* _d_AllocFromPerfectHeader(const _dStaticTableFileHeader_t* header,
+                                                 dTableHashFunc hash_func, dTableCompareFunc compare_func)
 {
-    if (!source_table) {
-        d_LogError("Attempted to rebucket NULL static hash table.");
+    dStaticTable_t* table = _d_AllocStaticTable((size_t)header->key_size, (size_t)header->value_size,
+                                                hash_func, compare_func, (size_t)header->num_buckets,
+                                                D_STATIC_TABLE_MODE_PERFECT, NULL);
+    if (!table) {
         return NULL;
     }
-
-    if (!source_table->is_initialized) {
-        d_LogError("Attempted to rebucket uninitialized static table.");
+    if (table->slot_size != header->slot_size || table->value_offset != header->value_offset) {
+        d_LogError("Static table file slot layout does not match this build.");
+        d_Free(table->allocator, table);
         return NULL;
     }
+    return table;
+}
 
-    if (new_num_buckets == 0) {
-        d_LogError("Cannot rebucket to zero buckets.");
-        return NULL;
+/**
+ * @brief Snapshot handed to the background thread by d_StaticTableSaveToFileAsync().
+ *
+ * PERFECT tables are snapshotted as a clone (flat arrays, memcpy'd). CHAINED tables
+ * are gathered into `pairs`, laid out exactly as in a version 3 file body.
+ */
+typedef struct {
+    dStaticTable_t* perfect;
+    char* pairs;
+    size_t key_size;
+    size_t value_size;
+    size_t num_buckets;
+    size_t num_keys;
+} _dStaticTableSnapshot_t;
+
+static void _d_StaticTableFreeSnapshot(void* data)
+{
+    _dStaticTableSnapshot_t* snapshot = (_dStaticTableSnapshot_t*)data;
+    if (snapshot->perfect) {
+        d_StaticTableDestroy(&snapshot->perfect);
     }
+    d_Free(d_GetHeapAllocator(), snapshot->pairs);
+    d_Free(d_GetHeapAllocator(), snapshot);
+}
 
-    // Collect all current keys and values
-    dArray_t* all_keys = d_StaticTableGetAllKeys(source_table);
-    if (!all_keys) {
-        d_LogError("Failed to collect keys for rebucketing.");
-        return NULL;
+static int _d_StaticTableWriteSnapshot(const char* filename, void* data)
+{
+    _dStaticTableSnapshot_t* snapshot = (_dStaticTableSnapshot_t*)data;
+    if (snapshot->perfect) {
+        return d_StaticTableSaveToFile(filename, snapshot->perfect);
     }
 
-    dArray_t* all_values = d_StaticTableGetAllValues(source_table);
-    if (!all_values) {
-        d_LogError("Failed to collect values for rebucketing.");
-        d_ArrayDestroy(all_keys);
-        return NULL;
+    dFileWriter_t* writer = d_FileWriterOpen(filename, 0);
+    if (!writer) {
+        d_LogErrorF("Failed to open file '%s' for writing static table.", filename);
+        return 1;
     }
 
-    // Create arrays of pointers for the new table initialization
-    const void** key_ptrs = malloc(source_table->num_keys * sizeof(void*));
-    const void** value_ptrs = malloc(source_table->num_keys * sizeof(void*));
-    
-    if (!key_ptrs || !value_ptrs) {
-        d_LogError("Failed to allocate pointer arrays for rebucketing.");
-        free(key_ptrs);
-        free(value_ptrs);
-        d_ArrayDestroy(all_keys);
-        d_ArrayDestroy(all_values);
-        return NULL;
+    // The pairs are already contiguous, so the body goes out in one write
+    if (_d_WriteChainedHeader(writer, snapshot->key_size, snapshot->value_size,
+                              snapshot->num_buckets, snapshot->num_keys) != 0 ||
+        d_FileWriterWrite(writer, snapshot->pairs,
+                          snapshot->num_keys * (snapshot->key_size + snapshot->value_size)) != 0) {
+        d_LogError("Failed to write key-value pairs to static table file.");
+        d_FileWriterAbort(&writer);
+        return 1;
     }
-
-    // Set up pointer arrays - get pointers to the data in the arrays
-    for (size_t i = 0; i < source_table->num_keys; i++) {
-        void* key_data = d_ArrayGet(all_keys, i);
-        void* value_data = d_ArrayGet(all_values, i);
-        
-        if (!key_data || !value_data) {
-            d_LogError("Failed to access array data during rebucketing.");
-            free(key_ptrs);
-            free(value_ptrs);
-            d_ArrayDestroy(all_keys);
-            d_ArrayDestroy(all_values);
-            return NULL;
-        }
-        
-        key_ptrs[i] = key_data;
-        value_ptrs[i] = value_data;
-    }
-
-    // Create new table with same parameters but different bucket count
-    dStaticTable_t* new_table = d_InitStaticTable(
-        source_table->key_size,
-        source_table->value_size,
-        source_table->hash_func,
-        source_table->compare_func,
-        new_num_buckets,
-        key_ptrs,
-        value_ptrs,
-        source_table->num_keys
-    );
-
-    // Cleanup temporary arrays
-    free(key_ptrs);
-    free(value_ptrs);
-    d_ArrayDestroy(all_keys);
-    d_ArrayDestroy(all_values);
-
-    if (new_table) {
-        d_LogInfoF("Successfully rebucketed static table from %zu to %zu buckets with %zu keys.",
-                   source_table->num_buckets, new_num_buckets, source_table->num_keys);
-    } else {
-        d_LogError("Failed to create rebucketed static table.");
+    if (d_FileWriterCommit(&writer) != 0) {
+        d_LogErrorF("Failed to commit static table file '%s'.", filename);
+        return 1;
     }
 
-    return new_table;
+    d_LogInfoF("Successfully saved static table with %zu key-value pairs to file '%s'.", snapshot->num_keys, filename);
+    return 0;
 }
 
 /**
- * @brief Create a deep copy of a static hash table.
- *
- * This function creates a new dStaticTable_t and copies all fixed key-value pairs
- * from the source table into the new table. All keys and values are
- * deep-copied, ensuring the new table is independent of the original.
- *
- * @param source_table A pointer to the dStaticTable_t to clone.
+ * @brief Save a static hash table to a file on a background thread.
  *
- * @return A pointer to the newly created dStaticTable_t, or NULL on failure.
+ * Only the snapshot is taken on the calling thread; see _dStaticTableSnapshot_t.
  *
- * @note The caller is responsible for destroying the new table with d_StaticTableDestroy.
- * @note The source table remains unchanged.
+ * @param filename Path to the output file
+ * @param table Pointer to the static table to save
+ * @param callback Optional completion callback, run on the background thread
+ * @param user_data Passed to `callback`
  *
- * Example:
- * `dStaticTable_t* new_table = d_CloneStaticTable(original_table);`
- * `if (new_table) {`
- * `    // ... use the new table`
- * `    d_StaticTableDestroy(&new_table);`
- * `}`
+ * @return Save handle, or NULL on failure
  */
-dStaticTable_t* d_CloneStaticTable(const dStaticTable_t* source_table)
+dAsyncSave_t* d_StaticTableSaveToFileAsync(const char* filename, const dStaticTable_t* table,
+                                           dAsyncSaveCallback callback, void* user_data)
 {
-    if (!source_table) {
-        d_LogError("Attempted to clone a NULL static hash table.");
+    if (!filename || !table) {
+        d_LogError("Invalid parameters for saving static table to file asynchronously.");
         return NULL;
     }
 
-    if (!source_table->is_initialized) {
-        d_LogError("Attempted to clone an uninitialized static hash table.");
+    if (!table->is_initialized) {
+        d_LogError("Attempted to save uninitialized static table to file.");
         return NULL;
     }
 
-    // Use existing functions to extract all keys and values
-    dArray_t* all_keys = d_StaticTableGetAllKeys(source_table);
-    if (!all_keys) {
-        d_LogError("Failed to collect keys for cloning.");
+    // The snapshot is freed on the worker thread, so all of it lives on the heap
+    // whatever allocator the table uses (an arena may be reset before the save finishes)
+    const dAllocator_t* heap = d_GetHeapAllocator();
+    _dStaticTableSnapshot_t* snapshot = (_dStaticTableSnapshot_t*)d_Calloc(heap, 1, sizeof(_dStaticTableSnapshot_t));
+    if (!snapshot) {
+        d_LogError("Failed to allocate static table snapshot.");
         return NULL;
     }
+    snapshot->key_size = table->key_size;
+    snapshot->value_size = table->value_size;
+    snapshot->num_buckets = table->num_buckets;
+    snapshot->num_keys = table->num_keys;
 
-    dArray_t* all_values = d_StaticTableGetAllValues(source_table);
-    if (!all_values) {
-        d_LogError("Failed to collect values for cloning.");
-        d_ArrayDestroy(all_keys);
-        return NULL;
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        snapshot->perfect = _d_ClonePerfectTable(table, heap);
+        if (!snapshot->perfect) {
+            d_LogError("Failed to snapshot perfect static table.");
+            _d_StaticTableFreeSnapshot(snapshot);
+            return NULL;
+        }
+    } else {
+        size_t pair_size = table->key_size + table->value_size;
+        snapshot->pairs = (char*)d_Alloc(heap, table->num_keys * pair_size);
+        if (!snapshot->pairs) {
+            d_LogErrorF("Failed to allocate %zu key-value pairs for static table snapshot.", table->num_keys);
+            _d_StaticTableFreeSnapshot(snapshot);
+            return NULL;
+        }
+
+        char* out = snapshot->pairs;
+        dTableIter_t iter = d_StaticTableIterBegin(table);
+        const void* key;
+        void* value;
+        while (d_StaticTableIterNext(&iter, &key, &value)) {
+            memcpy(out, key, table->key_size);
+            memcpy(out + table->key_size, value, table->value_size);
+            out += pair_size;
+        }
     }
 
-    // d_InitStaticTable requires an array of pointers to the data.
-    // We create temporary arrays of pointers to the data within our collected arrays.
-    const void** key_ptrs = (const void**)malloc(source_table->num_keys * sizeof(void*));
-    const void** value_ptrs = (const void**)malloc(source_table->num_keys * sizeof(void*));
+    return d_AsyncSaveStart(filename, snapshot, _d_StaticTableWriteSnapshot, _d_StaticTableFreeSnapshot,
+                            callback, user_data);
+}
 
-    if (!key_ptrs || !value_ptrs) {
-        d_LogError("Failed to allocate pointer arrays for cloning operation.");
-        free(key_ptrs); // It's safe to free NULL
-        free(value_ptrs);
-        d_ArrayDestroy(all_keys);
-        d_ArrayDestroy(all_values);
-        return NULL;
+/**
+ * @brief Internal helper: fread that also feeds the bytes into a running checksum.
+ *
+ * @return 0 if all `size` bytes were read, 1 otherwise
+ */
+static int _d_ReadChecksummed(FILE* file, void* dest, size_t size, dChecksum_t* checksum)
+{
+    if (fread(dest, 1, size, file) != size) {
+        return 1;
     }
-    
-    // Populate the pointer arrays
-    for (size_t i = 0; i < source_table->num_keys; i++) {
-        key_ptrs[i] = d_ArrayGet(all_keys, i);
-        value_ptrs[i] = d_ArrayGet(all_values, i);
-        if (!key_ptrs[i] || !value_ptrs[i]) {
-             d_LogError("Failed to retrieve data from temporary arrays during cloning.");
-             free(key_ptrs);
-             free(value_ptrs);
-             d_ArrayDestroy(all_keys);
-             d_ArrayDestroy(all_values);
-             return NULL;
+    d_ChecksumUpdate(checksum, dest, size);
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Read and checksum the padding between two sections.
+ */
+static int _d_SkipChecksummed(FILE* file, uint64_t size, dChecksum_t* checksum)
+{
+    char scratch[D_STATIC_TABLE_PAGE_SIZE];
+    while (size > 0) {
+        size_t chunk = (size_t)MIN(size, (uint64_t)sizeof(scratch));
+        if (_d_ReadChecksummed(file, scratch, chunk, checksum) != 0) {
+            return 1;
         }
+        size -= chunk;
     }
+    return 0;
+}
 
-    // Create the new table using the collected data and original parameters
-    dStaticTable_t* new_table = d_InitStaticTable(
-        source_table->key_size,
-        source_table->value_size,
-        source_table->hash_func,
-        source_table->compare_func,
-        source_table->num_buckets,
-        key_ptrs,
-        value_ptrs,
-        source_table->num_keys
-    );
-
-    // Clean up all temporary allocations
-    free(key_ptrs);
-    free(value_ptrs);
-    d_ArrayDestroy(all_keys);
-    d_ArrayDestroy(all_values);
-
-    if (new_table) {
-        d_LogInfoF("Successfully cloned static table with %zu keys.", source_table->num_keys);
-    } else {
-        d_LogError("Failed to create new table during clone operation.");
+/**
+ * @brief Internal helper: Read the trailer and compare it with the running checksum.
+ *
+ * @return 0 if they match, 1 otherwise
+ */
+static int _d_VerifyChecksumTrailer(FILE* file, const dChecksum_t* checksum, const char* filename)
+{
+    uint64_t stored;
+    if (fread(&stored, sizeof(stored), 1, file) != 1) {
+        d_LogErrorF("Static table file '%s' is missing its checksum.", filename);
+        return 1;
     }
-    
-    return new_table;
+    if (stored != d_ChecksumFinal(checksum)) {
+        d_LogErrorF("Checksum mismatch in static table file '%s'; the file is corrupt.", filename);
+        return 1;
+    }
+    return 0;
 }
 
-// =============================================================================
-// STATIC HASH TABLE FILE I/O FUNCTIONS
-// =============================================================================
+/**
+ * @brief Internal helper: Load the body of a version 2 file into a writable PERFECT table.
+ *
+ * `file` is positioned just after the magic and version, which `checksum` already covers.
+ */
+static dStaticTable_t* _d_LoadPerfectFile(FILE* file, const char* filename, dChecksum_t* checksum,
+                                          dTableHashFunc hash_func, dTableCompareFunc compare_func)
+{
+    _dStaticTableFileHeader_t header;
+    dStaticTable_t* table = NULL;
+    long file_size = -1;
+    long body_start = ftell(file);
+    if (fseek(file, 0, SEEK_END) == 0) {
+        file_size = ftell(file);
+    }
+
+    // Read the whole file front to back, so every byte (padding included) is checksummed
+    size_t prefix = 2 * sizeof(uint32_t);
+    if (body_start != (long)prefix || file_size < 0 || fseek(file, body_start, SEEK_SET) != 0 ||
+        fread((char*)&header + prefix, sizeof(header) - prefix, 1, file) != 1) {
+        d_LogErrorF("Failed to read version 2 header from static table file '%s'.", filename);
+        return NULL;
+    }
+    header.magic = D_STATIC_TABLE_MAGIC;
+    header.version = D_STATIC_TABLE_PERFECT_VERSION;
+    d_ChecksumUpdate(checksum, (char*)&header + prefix, sizeof(header) - prefix);
 
-// Magic number for file format validation
-#define D_STATIC_TABLE_MAGIC 0xDAEDDDCD
-#define D_STATIC_TABLE_VERSION 1
+    if (_d_ValidatePerfectHeader(&header, (uint64_t)file_size) != 0 ||
+        !(table = _d_AllocFromPerfectHeader(&header, hash_func, compare_func)) ||
+        _d_PerfectAllocArrays(table, (size_t)header.num_keys) != 0) {
+        if (table) {
+            d_StaticTableDestroy(&table);
+        }
+        return NULL;
+    }
+
+    size_t pilots_size = table->num_buckets * sizeof(uint32_t);
+    size_t hashes_size = (size_t)header.num_keys * sizeof(size_t);
+    if (_d_SkipChecksummed(file, header.pilots_offset - sizeof(header), checksum) != 0 ||
+        _d_ReadChecksummed(file, table->pilots, pilots_size, checksum) != 0 ||
+        _d_SkipChecksummed(file, header.hashes_offset - header.pilots_offset - pilots_size, checksum) != 0 ||
+        _d_ReadChecksummed(file, table->slot_hashes, hashes_size, checksum) != 0 ||
+        _d_SkipChecksummed(file, header.slots_offset - header.hashes_offset - hashes_size, checksum) != 0 ||
+        _d_ReadChecksummed(file, table->slots, (size_t)header.num_keys * table->slot_size, checksum) != 0 ||
+        _d_VerifyChecksumTrailer(file, checksum, filename) != 0) {
+        d_LogErrorF("Failed to load version 2 static table file '%s'.", filename);
+        d_StaticTableDestroy(&table);
+        return NULL;
+    }
+
+    table->num_keys = (size_t)header.num_keys;
+    table->is_initialized = true;
+    return table;
+}
 
 /**
  * @brief Save a static hash table to a binary file.
@@ -953,6 +2020,10 @@ dStaticTable_t* d_CloneStaticTable(const dStaticTable_t* source_table)
  * @return 0 on success, 1 on failure
  *
  * @note The hash and compare functions cannot be saved and must be provided when loading
+ * @note PERFECT tables are written in the page-aligned version 2 format, which
+ *       d_MapStaticTableFromFile() can use in place
+ * @note The file is written through a dFileWriter_t: buffered, ended with a checksum,
+ *       and renamed into place only once complete
  */
 int d_StaticTableSaveToFile(const char* filename, const dStaticTable_t* table)
 {
@@ -966,78 +2037,52 @@ int d_StaticTableSaveToFile(const char* filename, const dStaticTable_t* table)
         return 1;
     }
 
-    FILE* file = fopen(filename, "wb");
-    if (!file) {
+    dFileWriter_t* writer = d_FileWriterOpen(filename, 0);
+    if (!writer) {
         d_LogErrorF("Failed to open file '%s' for writing static table.", filename);
         return 1;
     }
 
-    // Write file header
-    uint32_t magic = D_STATIC_TABLE_MAGIC;
-    uint32_t version = D_STATIC_TABLE_VERSION;
-    
-    if (fwrite(&magic, sizeof(uint32_t), 1, file) != 1) {
-        d_LogError("Failed to write magic number to static table file.");
-        fclose(file);
-        return 1;
-    }
-    
-    if (fwrite(&version, sizeof(uint32_t), 1, file) != 1) {
-        d_LogError("Failed to write version to static table file.");
-        fclose(file);
-        return 1;
-    }
-
-    // Write table metadata
-    if (fwrite(&table->key_size, sizeof(size_t), 1, file) != 1 ||
-        fwrite(&table->value_size, sizeof(size_t), 1, file) != 1 ||
-        fwrite(&table->num_buckets, sizeof(size_t), 1, file) != 1 ||
-        fwrite(&table->num_keys, sizeof(size_t), 1, file) != 1) {
-        d_LogError("Failed to write table metadata to static table file.");
-        fclose(file);
-        return 1;
-    }
-
-    // Write all key-value pairs
-    size_t pairs_written = 0;
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
-        if (!bucket_ptr || !*bucket_ptr) {
-            continue; // Empty bucket
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        if (_d_WritePerfectFile(writer, table) != 0) {
+            d_FileWriterAbort(&writer);
+            return 1;
+        }
+    } else {
+        if (_d_WriteChainedHeader(writer, table->key_size, table->value_size,
+                                  table->num_buckets, table->num_keys) != 0) {
+            d_FileWriterAbort(&writer);
+            return 1;
         }
 
-        dLinkedList_t* current = *bucket_ptr;
-        while (current) {
-            dTableEntry_t* entry = (dTableEntry_t*)current->data;
-            if (entry && entry->key_data && entry->value_data) {
-                // Write key data
-                if (fwrite(entry->key_data, 1, table->key_size, file) != table->key_size) {
-                    d_LogErrorF("Failed to write key data at pair %zu to static table file.", pairs_written);
-                    fclose(file);
-                    return 1;
-                }
-                
-                // Write value data
-                if (fwrite(entry->value_data, 1, table->value_size, file) != table->value_size) {
-                    d_LogErrorF("Failed to write value data at pair %zu to static table file.", pairs_written);
-                    fclose(file);
-                    return 1;
-                }
-                
-                pairs_written++;
+        // Write all key-value pairs; they land in the writer's buffer, not one syscall each
+        size_t pairs_written = 0;
+        dTableIter_t iter = d_StaticTableIterBegin(table);
+        const void* key;
+        void* value;
+        while (d_StaticTableIterNext(&iter, &key, &value)) {
+            if (d_FileWriterWrite(writer, key, table->key_size) != 0 ||
+                d_FileWriterWrite(writer, value, table->value_size) != 0) {
+                d_LogErrorF("Failed to write pair %zu to static table file.", pairs_written);
+                d_FileWriterAbort(&writer);
+                return 1;
             }
-            current = current->next;
+            pairs_written++;
         }
-    }
 
-    fclose(file);
+        if (pairs_written != table->num_keys) {
+            d_LogErrorF("Expected to write %zu key-value pairs but wrote %zu.", table->num_keys, pairs_written);
+            d_FileWriterAbort(&writer);
+            return 1;
+        }
+    }
 
-    if (pairs_written != table->num_keys) {
-        d_LogErrorF("Warning: Expected to write %zu key-value pairs but wrote %zu.", table->num_keys, pairs_written);
+    if (d_FileWriterCommit(&writer) != 0) {
+        d_LogErrorF("Failed to commit static table file '%s'.", filename);
         return 1;
     }
 
-    d_LogInfoF("Successfully saved static table with %zu key-value pairs to file '%s'.", pairs_written, filename);
+    d_LogInfoF("Successfully saved static table with %zu key-value pairs to file '%s'.", table->num_keys, filename);
     return 0;
 }
 
@@ -1053,6 +2098,8 @@ int d_StaticTableSaveToFile(const char* filename, const dStaticTable_t* table)
  * @return Pointer to the loaded static table, or NULL on failure
  *
  * @note The caller is responsible for destroying the returned table
+ * @note Version 2 files load as a writable PERFECT table, one read per section
+ * @note Versions 2 and 3 are rejected if their checksum does not match
  */
 dStaticTable_t* d_LoadStaticTableFromFile(const char* filename, dTableHashFunc hash_func, dTableCompareFunc compare_func)
 {
@@ -1067,9 +2114,12 @@ dStaticTable_t* d_LoadStaticTableFromFile(const char* filename, dTableHashFunc h
         return NULL;
     }
 
+    dChecksum_t checksum;
+    d_ChecksumReset(&checksum);
+
     // Read and validate file header
     uint32_t magic, version;
-    if (fread(&magic, sizeof(uint32_t), 1, file) != 1) {
+    if (_d_ReadChecksummed(file, &magic, sizeof(uint32_t), &checksum) != 0) {
         d_LogError("Failed to read magic number from static table file.");
         fclose(file);
         return NULL;
@@ -1081,99 +2131,77 @@ dStaticTable_t* d_LoadStaticTableFromFile(const char* filename, dTableHashFunc h
         return NULL;
     }
 
-    if (fread(&version, sizeof(uint32_t), 1, file) != 1) {
+    if (_d_ReadChecksummed(file, &version, sizeof(uint32_t), &checksum) != 0) {
         d_LogError("Failed to read version from static table file.");
         fclose(file);
         return NULL;
     }
 
-    if (version != D_STATIC_TABLE_VERSION) {
-        d_LogErrorF("Unsupported static table file version. Expected %u, got %u.", D_STATIC_TABLE_VERSION, version);
+    if (version == D_STATIC_TABLE_PERFECT_VERSION) {
+        dStaticTable_t* table = _d_LoadPerfectFile(file, filename, &checksum, hash_func, compare_func);
+        fclose(file);
+        if (table) {
+            d_LogInfoF("Successfully loaded perfect static table with %zu key-value pairs from file '%s'.",
+                       table->num_keys, filename);
+        }
+        return table;
+    }
+
+    if (version != D_STATIC_TABLE_VERSION && version != D_STATIC_TABLE_CHAINED_VERSION) {
+        d_LogErrorF("Unsupported static table file version. Expected %u or %u, got %u.",
+                    D_STATIC_TABLE_VERSION, D_STATIC_TABLE_CHAINED_VERSION, version);
         fclose(file);
         return NULL;
     }
 
     // Read table metadata
     size_t key_size, value_size, num_buckets, num_keys;
-    if (fread(&key_size, sizeof(size_t), 1, file) != 1 ||
-        fread(&value_size, sizeof(size_t), 1, file) != 1 ||
-        fread(&num_buckets, sizeof(size_t), 1, file) != 1 ||
-        fread(&num_keys, sizeof(size_t), 1, file) != 1) {
+    if (_d_ReadChecksummed(file, &key_size, sizeof(size_t), &checksum) != 0 ||
+        _d_ReadChecksummed(file, &value_size, sizeof(size_t), &checksum) != 0 ||
+        _d_ReadChecksummed(file, &num_buckets, sizeof(size_t), &checksum) != 0 ||
+        _d_ReadChecksummed(file, &num_keys, sizeof(size_t), &checksum) != 0) {
         d_LogError("Failed to read table metadata from static table file.");
         fclose(file);
         return NULL;
     }
 
     // Validate metadata
-    if (key_size == 0 || value_size == 0 || num_buckets == 0 || num_keys == 0) {
+    size_t pair_size = key_size + value_size;
+    if (key_size == 0 || value_size == 0 || num_buckets == 0 || num_keys == 0 ||
+        pair_size < key_size || num_keys > SIZE_MAX / pair_size / 2) {
         d_LogError("Invalid table metadata in static table file.");
         fclose(file);
         return NULL;
     }
 
-    // Allocate arrays for loaded keys and values
-    void** loaded_keys = malloc(num_keys * sizeof(void*));
-    void** loaded_values = malloc(num_keys * sizeof(void*));
-    
-    if (!loaded_keys || !loaded_values) {
+    // Read every pair with one call, then point the key/value arrays into that block
+    const dAllocator_t* allocator = d_GetDefaultAllocator();
+    char* pairs = (char*)d_Alloc(allocator, num_keys * pair_size);
+    const void** loaded_keys = (const void**)d_Alloc(allocator, num_keys * sizeof(void*));
+    const void** loaded_values = (const void**)d_Alloc(allocator, num_keys * sizeof(void*));
+    dStaticTable_t* new_table = NULL;
+    if (!pairs || !loaded_keys || !loaded_values) {
         d_LogError("Failed to allocate memory for loading static table keys/values.");
-        free(loaded_keys);
-        free(loaded_values);
-        fclose(file);
-        return NULL;
-    }
-
-    // Initialize all pointers to NULL for cleanup safety
-    for (size_t i = 0; i < num_keys; i++) {
-        loaded_keys[i] = NULL;
-        loaded_values[i] = NULL;
-    }
-
-    // Read all key-value pairs
-    for (size_t i = 0; i < num_keys; i++) {
-        // Allocate memory for this key and value
-        loaded_keys[i] = malloc(key_size);
-        loaded_values[i] = malloc(value_size);
-        
-        if (!loaded_keys[i] || !loaded_values[i]) {
-            d_LogErrorF("Failed to allocate memory for key-value pair %zu during loading.", i);
-            goto cleanup_and_fail;
-        }
-
-        // Read key data
-        if (fread(loaded_keys[i], 1, key_size, file) != key_size) {
-            d_LogErrorF("Failed to read key data for pair %zu from static table file.", i);
-            goto cleanup_and_fail;
+    } else if (_d_ReadChecksummed(file, pairs, num_keys * pair_size, &checksum) != 0) {
+        d_LogErrorF("Failed to read %zu key-value pairs from static table file.", num_keys);
+    } else if (version == D_STATIC_TABLE_CHAINED_VERSION &&
+               _d_VerifyChecksumTrailer(file, &checksum, filename) != 0) {
+        // Already logged
+    } else {
+        for (size_t i = 0; i < num_keys; i++) {
+            loaded_keys[i] = pairs + i * pair_size;
+            loaded_values[i] = pairs + i * pair_size + key_size;
         }
 
-        // Read value data
-        if (fread(loaded_values[i], 1, value_size, file) != value_size) {
-            d_LogErrorF("Failed to read value data for pair %zu from static table file.", i);
-            goto cleanup_and_fail;
-        }
+        // Create new static table using loaded data
+        new_table = d_InitStaticTable(key_size, value_size, hash_func, compare_func, num_buckets,
+                                      loaded_keys, loaded_values, num_keys);
     }
 
     fclose(file);
-
-    // Create new static table using loaded data
-    dStaticTable_t* new_table = d_InitStaticTable(
-        key_size,
-        value_size,
-        hash_func,
-        compare_func,
-        num_buckets,
-        (const void**)loaded_keys,
-        (const void**)loaded_values,
-        num_keys
-    );
-
-    // Clean up temporary arrays
-    for (size_t i = 0; i < num_keys; i++) {
-        if (loaded_keys[i]) free(loaded_keys[i]);
-        if (loaded_values[i]) free(loaded_values[i]);
-    }
-    free(loaded_keys);
-    free(loaded_values);
+    d_Free(allocator, pairs);
+    d_Free(allocator, loaded_keys);
+    d_Free(allocator, loaded_values);
 
     if (new_table) {
         d_LogInfoF("Successfully loaded static table with %zu key-value pairs from file '%s'.", num_keys, filename);
@@ -1182,17 +2210,80 @@ dStaticTable_t* d_LoadStaticTableFromFile(const char* filename, dTableHashFunc h
     }
 
     return new_table;
+}
 
-cleanup_and_fail:
-    // Clean up allocated memory on failure
-    for (size_t i = 0; i < num_keys; i++) {
-        if (loaded_keys[i]) free(loaded_keys[i]);
-        if (loaded_values[i]) free(loaded_values[i]);
+dStaticTable_t* d_MapStaticTableFromFile(const char* filename, dTableHashFunc hash_func, dTableCompareFunc compare_func)
+{
+    if (!filename || !hash_func || !compare_func) {
+        d_LogError("Invalid parameters for mapping static table from file.");
+        return NULL;
+    }
+
+    void* base = NULL;
+    size_t size = 0;
+#if D_STATIC_TABLE_HAS_MMAP
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        d_LogErrorF("Failed to open file '%s' for mapping static table.", filename);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(_dStaticTableFileHeader_t)) {
+        d_LogErrorF("Static table file '%s' is too small to map.", filename);
+        close(fd);
+        return NULL;
+    }
+    size = (size_t)st.st_size;
+    // Shared, read-only pages: every process mapping the file uses the same page cache
+    base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // The mapping keeps its own reference to the file
+    if (base == MAP_FAILED) {
+        d_LogErrorF("Failed to map static table file '%s'.", filename);
+        return NULL;
+    }
+#else
+    // The table below captures the same default, and frees the buffer with it
+    const dAllocator_t* allocator = d_GetDefaultAllocator();
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        d_LogErrorF("Failed to open file '%s' for mapping static table.", filename);
+        return NULL;
+    }
+    long file_size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        file_size = ftell(file);
+    }
+    if (file_size < (long)sizeof(_dStaticTableFileHeader_t) || fseek(file, 0, SEEK_SET) != 0 ||
+        !(base = d_Alloc(allocator, (size_t)file_size)) || fread(base, 1, (size_t)file_size, file) != (size_t)file_size) {
+        d_LogErrorF("Failed to read static table file '%s'.", filename);
+        d_Free(allocator, base);
+        fclose(file);
+        return NULL;
     }
-    free(loaded_keys);
-    free(loaded_values);
     fclose(file);
-    return NULL;
+    size = (size_t)file_size;
+#endif
+
+    const _dStaticTableFileHeader_t* header = (const _dStaticTableFileHeader_t*)base;
+    dStaticTable_t* table = NULL;
+    if (_d_ValidatePerfectHeader(header, size) != 0 ||
+        !(table = _d_AllocFromPerfectHeader(header, hash_func, compare_func))) {
+        d_LogErrorF("Cannot map static table file '%s'; only version 2 files can be mapped.", filename);
+        _d_StaticUnmap(d_GetDefaultAllocator(), base, size);
+        return NULL;
+    }
+
+    // Point the table straight at the file's sections; nothing is copied
+    table->mapping = base;
+    table->mapping_size = size;
+    table->pilots = (uint32_t*)((char*)base + header->pilots_offset);
+    table->slot_hashes = (size_t*)((char*)base + header->hashes_offset);
+    table->slots = (char*)base + header->slots_offset;
+    table->num_keys = (size_t)header->num_keys;
+    table->is_initialized = true;
+
+    d_LogInfoF("Mapped perfect static table with %zu key-value pairs from file '%s'.", table->num_keys, filename);
+    return table;
 }
 
 // =============================================================================
@@ -1224,24 +2315,14 @@ int d_StaticTableIterate(const dStaticTable_t* table, dTableIteratorFunc callbac
 
     size_t pairs_processed = 0;
 
-    // Iterate through all buckets
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
-        if (!bucket_ptr || !*bucket_ptr) {
-            continue; // Empty bucket
-        }
-
-        // Iterate through all entries in this bucket
-        dLinkedList_t* current_node = *bucket_ptr;
-        while (current_node != NULL) {
-            dTableEntry_t* entry = (dTableEntry_t*)current_node->data;
-            if (entry && entry->key_data && entry->value_data) {
-                // Call the callback function with the entry data
-                callback(entry->key_data, table->key_size, entry->value_data, table->value_size, user_data);
-                pairs_processed++;
-            }
-            current_node = current_node->next;
-        }
+    // Walk every entry, whatever the storage mode
+    dTableIter_t iter = d_StaticTableIterBegin(table);
+    const void* key;
+    void* value;
+    while (d_StaticTableIterNext(&iter, &key, &value)) {
+        // Call the callback function with the entry data
+        callback(key, table->key_size, value, table->value_size, user_data);
+        pairs_processed++;
     }
 
     d_LogDebugF("Iterated over %zu key-value pairs in static table (expected: %zu).", pairs_processed, table->num_keys);
@@ -1251,4 +2332,56 @@ int d_StaticTableIterate(const dStaticTable_t* table, dTableIteratorFunc callbac
     }
 
     return 0;
-}
\ No newline at end of file
+}
+
+dTableIter_t d_StaticTableIterBegin(const dStaticTable_t* table)
+{
+    dTableIter_t iter = { NULL, 0, NULL, 0 };
+    if (table && table->is_initialized) {
+        iter.table = table;
+        iter.version = table->version;
+    }
+    return iter;
+}
+
+bool _d_StaticTableIterNext_impl(dTableIter_t* iter, const void** out_key, void** out_value,
+                                 const char* file, int line, const char* func)
+{
+    if (!iter || !iter->table) {
+        return false;
+    }
+
+    const dStaticTable_t* table = (const dStaticTable_t*)iter->table;
+#ifndef NDEBUG
+    D_ASSERT(iter->version == table->version,
+             "d_StaticTableIterNext: table was cleared during iteration", file, line, func);
+#else
+    (void)file; (void)line; (void)func;
+#endif
+
+    if (table->mode == D_STATIC_TABLE_MODE_PERFECT) {
+        // Every slot is occupied, so the cursor just walks the slot array
+        if (iter->position >= table->num_keys) {
+            return false;
+        }
+        char* slot = (char*)table->slots + iter->position++ * table->slot_size;
+        if (out_key) *out_key = slot;
+        if (out_value) *out_value = slot + table->value_offset;
+        return true;
+    }
+
+    // `node` is the next node to yield; refill it from the following non-empty bucket
+    while (!iter->node && iter->position < table->num_buckets) {
+        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, iter->position++);
+        iter->node = bucket_ptr ? *bucket_ptr : NULL;
+    }
+    if (!iter->node) {
+        return false;
+    }
+
+    dTableEntry_t* entry = (dTableEntry_t*)iter->node->data;
+    iter->node = iter->node->next;
+    if (out_key) *out_key = entry->key_data;
+    if (out_value) *out_value = entry->value_data;
+    return true;
+}
@@ -19,6 +19,7 @@ dString_t* d_StringCreateFromFile(const char *filename)
   char *fileBuffer;
   FILE *file;
   dString_t* result;
+  const dAllocator_t* allocator = d_GetDefaultAllocator();
 
   if (filename == NULL) {
     printf("Error: NULL filename provided\n");
@@ -44,7 +45,7 @@ dString_t* d_StringCreateFromFile(const char *filename)
   }
 
   // Allocate temporary buffer
-  fileBuffer = (char*)malloc(fileSize + 1);
+  fileBuffer = (char*)d_Alloc(allocator, fileSize + 1);
   if (fileBuffer == NULL) {
     printf("Error allocating memory for file string: %s\n", filename);
     fclose(file);
@@ -55,7 +56,7 @@ dString_t* d_StringCreateFromFile(const char *filename)
   if (fileSize > 0 && fread(fileBuffer, fileSize, 1, file) != 1) {
     printf("Failed to read file: %s\n", filename);
     fclose(file);
-    free(fileBuffer);
+    d_Free(allocator, fileBuffer);
     return NULL;
   }
 
@@ -68,7 +69,7 @@ dString_t* d_StringCreateFromFile(const char *filename)
   result = d_StringInit();
   if (result == NULL) {
     printf("Failed to initialize dString for file: %s\n", filename);
-    free(fileBuffer);
+    d_Free(allocator, fileBuffer);
     return NULL;
   }
 
@@ -76,7 +77,7 @@ dString_t* d_StringCreateFromFile(const char *filename)
   d_StringAppend(result, fileBuffer, fileSize);
 
   // Free temporary buffer
-  free(fileBuffer);
+  d_Free(allocator, fileBuffer);
 
   return result;
 }
@@ -110,26 +111,39 @@ static void d_StringBuilderEnsureSpace(dString_t* sb, size_t add_len)
             sb->alloced--;
         }
     }
-    sb->str = realloc(sb->str, sb->alloced);
+    sb->str = d_Realloc(sb->allocator, sb->str, sb->alloced);
 }
 
 /*
  * Create a new string builder
  */
  dString_t* d_StringInit(void)
+ {
+     return d_StringInitWithAllocator(NULL);
+ }
+
+/*
+ * Create a new string builder on a specific allocator
+ */
+ dString_t* d_StringInitWithAllocator(const dAllocator_t* allocator)
  {
      dString_t* sb;
 
-     sb = calloc(1, sizeof(*sb));
+     if (allocator == NULL) {
+         allocator = d_GetDefaultAllocator();
+     }
+
+     sb = d_Calloc(allocator, 1, sizeof(*sb));
      if (sb == NULL) {
          LOG("d_StringInit: Failed to allocate memory for string builder");
          return NULL;
      }
+     sb->allocator = allocator;
 
-     sb->str = malloc(d_string_builder_min_size);
+     sb->str = d_Alloc(allocator, d_string_builder_min_size);
      if (sb->str == NULL) {
          LOG("d_StringInit: Failed to allocate memory for string builder");
-         free(sb);
+         d_Free(allocator, sb);
          return NULL;
      }
 
@@ -145,8 +159,9 @@ void _d_StringDestroy_impl(dString_t* sb, const char* file, int line, const char
     D_ASSERT(sb->str != NULL, "d_StringDestroy: sb->str is NULL (double-free or corruption?)", file, line, func);
     D_ASSERT(sb->alloced >= 32, "d_StringDestroy: sb->alloced is impossibly small (corruption?)", file, line, func);
     
-    free(sb->str);
-    free(sb);
+    const dAllocator_t* allocator = sb->allocator;
+    d_Free(allocator, sb->str);
+    d_Free(allocator, sb);
 }
 /*
  * Add a string to the string builder
@@ -1,79 +1,62 @@
 // File: src/dTables.c - Generic Hash Table Implementation for Daedalus Library
-// Uses dLinkedList_t for collision resolution via chaining
+// Uses dLinkedList_t for collision resolution via chaining (D_TABLE_MODE_CHAINED),
+// inline open-addressed slots (D_TABLE_MODE_FLAT) or an insertion-ordered dense
+// entry array behind a sparse index (D_TABLE_MODE_COMPACT)
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 #include "Daedalus.h"
+#include "dInternal.h"
 
 // =============================================================================
 // INTERNAL HELPER FUNCTIONS
 // =============================================================================
 
 /**
- * @brief Internal helper: Create a new hash table entry.
+ * @brief Internal helper: Create the chain node, entry and key/value copies for one key.
  *
- * Allocates memory for a dTableEntry_t and copies the provided key and value
- * data into it. This entry will be stored in a linked list bucket.
+ * All four live in a single block (see _d_ChainBlockFill()) from the table's node
+ * pool when it has one, or from its allocator otherwise.
  *
+ * @param table Owning table (supplies sizes, pool and allocator)
  * @param key Pointer to the key data to copy
- * @param key_size Size of the key data in bytes
  * @param value Pointer to the value data to copy
- * @param value_size Size of the value data in bytes
+ * @param hash Full hash of the key, stored in the entry
  *
- * @return Pointer to new dTableEntry_t, or NULL on failure
+ * @return Unlinked node whose `data` is the entry, or NULL on failure
  */
-static dTableEntry_t* _d_CreateTableEntry(const void* key, size_t key_size, 
-                                           const void* value, size_t value_size)
+static dLinkedList_t* _d_CreateChainNode(dTable_t* table, const void* key, const void* value, size_t hash)
 {
-    if (!key || !value || key_size == 0 || value_size == 0) {
+    if (!key || !value || table->key_size == 0 || table->value_size == 0) {
         d_LogError("Invalid parameters for creating table entry.");
         return NULL;
     }
 
-    dTableEntry_t* entry = (dTableEntry_t*)malloc(sizeof(dTableEntry_t));
-    if (!entry) {
-        d_LogError("Failed to allocate memory for table entry structure.");
-        return NULL;
-    }
-
-    // Allocate and copy key data
-    entry->key_data = malloc(key_size);
-    if (!entry->key_data) {
-        d_LogError("Failed to allocate memory for table entry key data.");
-        free(entry);
-        return NULL;
-    }
-    memcpy(entry->key_data, key, key_size);
-
-    // Allocate and copy value data
-    entry->value_data = malloc(value_size);
-    if (!entry->value_data) {
-        d_LogError("Failed to allocate memory for table entry value data.");
-        free(entry->key_data);
-        free(entry);
+    uint8_t* block = table->node_pool
+        ? (uint8_t*)d_PoolAlloc(table->node_pool)
+        : (uint8_t*)d_Alloc(table->allocator, _d_ChainBlockSize(table->key_size, table->value_size));
+    if (!block) {
+        d_LogError("Failed to allocate memory for table entry.");
         return NULL;
     }
-    memcpy(entry->value_data, value, value_size);
 
-    return entry;
+    dLinkedList_t* node = _d_ChainBlockFill(block, key, table->key_size, value, table->value_size, hash);
+    node->pool = table->node_pool;
+    return node;
 }
 
 /**
- * @brief Internal helper: Destroy a hash table entry.
- *
- * Frees all memory associated with a dTableEntry_t including the key data,
- * value data, and the entry structure itself.
- *
- * @param entry Pointer to the entry to destroy
+ * @brief Internal helper: Release a block made by _d_CreateChainNode().
  */
-static void _d_DestroyTableEntry(dTableEntry_t* entry)
+static void _d_DestroyChainNode(dTable_t* table, dLinkedList_t* node)
 {
-    if (!entry) return;
-
-    if (entry->key_data) free(entry->key_data);
-    if (entry->value_data) free(entry->value_data);
-    free(entry);
+    if (table->node_pool) {
+        d_PoolFree(table->node_pool, node);
+    } else {
+        d_Free(table->allocator, node);
+    }
 }
 
 /**
@@ -86,18 +69,20 @@ static void _d_DestroyTableEntry(dTableEntry_t* entry)
  * @param key Key to search for
  * @param key_size Size of the key
  * @param compare_func Function to compare keys
+ * @param hash Full hash of `key`; entries with a different stored hash are skipped
+ *             without calling `compare_func`
  *
  * @return Pointer to the matching dTableEntry_t, or NULL if not found
  */
 static dTableEntry_t* _d_FindEntryInBucket(dLinkedList_t* bucket_head, const void* key, 
-                                           size_t key_size, dTableCompareFunc compare_func)
+                                           size_t key_size, dTableCompareFunc compare_func, size_t hash)
 {
     if (!bucket_head || !key || !compare_func) return NULL;
 
     dLinkedList_t* current = bucket_head;
     while (current != NULL) {
         dTableEntry_t* entry = (dTableEntry_t*)current->data;
-        if (entry && compare_func(entry->key_data, key, key_size) == 0) {
+        if (entry && entry->hash == hash && compare_func(entry->key_data, key, key_size) == 0) {
             return entry;
         }
         current = current->next;
@@ -106,18 +91,661 @@ static dTableEntry_t* _d_FindEntryInBucket(dLinkedList_t* bucket_head, const voi
 }
 
 /**
- * @brief Internal helper: Generate a unique name for linked list storage.
+ * @brief Internal helper: Link `node` at the tail of a bucket chain.
+ */
+static void _d_AppendChainNode(dLinkedList_t** bucket_ptr, dLinkedList_t* node)
+{
+    while (*bucket_ptr) {
+        bucket_ptr = &(*bucket_ptr)->next;
+    }
+    *bucket_ptr = node;
+}
+
+// =============================================================================
+// CHAINED BUCKET MANAGEMENT AND INCREMENTAL REHASHING
+// =============================================================================
+
+// Upper bound on empty old buckets skipped per requested migration step, so a
+// sparse region of the old array cannot turn one step into a full scan.
+#define D_TABLE_REHASH_EMPTY_VISITS 10
+
+/**
+ * @brief Internal helper: Allocate a bucket array with every bucket set to NULL.
+ *
+ * @param num_buckets Number of buckets to allocate
+ * @param allocator Allocator of the owning table
+ *
+ * @return New dArray_t of `dLinkedList_t*`, or NULL on failure
+ */
+static dArray_t* _d_CreateBucketArray(size_t num_buckets, const dAllocator_t* allocator)
+{
+    dArray_t* buckets = d_ArrayInitWithAllocator(num_buckets, sizeof(dLinkedList_t*), allocator);
+    if (!buckets) {
+        return NULL;
+    }
+    memset(buckets->data, 0, num_buckets * sizeof(dLinkedList_t*));
+    buckets->count = num_buckets;
+    return buckets;
+}
+
+/**
+ * @brief Internal helper: Free every entry and node in a bucket array.
+ *
+ * The bucket array itself is kept; all bucket heads are reset to NULL. With a
+ * node pool the chains are not walked at all: the caller releases the pool's
+ * slabs in bulk afterwards.
+ */
+static void _d_FreeBucketChains(dTable_t* table, dArray_t* buckets, size_t num_buckets)
+{
+    if (table->node_pool) {
+        memset(buckets->data, 0, num_buckets * sizeof(dLinkedList_t*));
+        return;
+    }
+    for (size_t i = 0; i < num_buckets; i++) {
+        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(buckets, i);
+        if (bucket_ptr && *bucket_ptr) {
+            dLinkedList_t* current = *bucket_ptr;
+            while (current) {
+                dLinkedList_t* next = current->next;
+                _d_DestroyChainNode(table, current);
+                current = next;
+            }
+            *bucket_ptr = NULL;
+        }
+    }
+}
+
+/**
+ * @brief Internal helper: Bucket head by index across the live and draining arrays.
+ *
+ * Indices `[0, num_buckets)` address the live array; while an incremental rehash
+ * is in progress the following `old_num_buckets` indices address the old array.
+ */
+static dLinkedList_t* _d_ChainedBucketAt(const dTable_t* table, size_t index)
+{
+    dLinkedList_t** bucket_ptr;
+    if (index < table->num_buckets) {
+        bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, index);
+    } else if (table->old_buckets) {
+        bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->old_buckets, index - table->num_buckets);
+    } else {
+        return NULL;
+    }
+    return bucket_ptr ? *bucket_ptr : NULL;
+}
+
+static size_t _d_ChainedTotalBuckets(const dTable_t* table)
+{
+    return table->num_buckets + (table->old_buckets ? table->old_num_buckets : 0);
+}
+
+/**
+ * @brief Internal helper: Move every node of one old bucket into the live array.
+ *
+ * Nodes are relinked, not copied, so entry key/value pointers stay valid and no
+ * memory is allocated during migration.
+ */
+static void _d_MigrateBucket(dTable_t* table, dLinkedList_t** old_bucket_ptr)
+{
+    dLinkedList_t* node = *old_bucket_ptr;
+    while (node) {
+        dLinkedList_t* next = node->next;
+        dTableEntry_t* entry = (dTableEntry_t*)node->data;
+        size_t index = entry->hash % table->num_buckets;
+        dLinkedList_t** new_bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, index);
+        node->next = *new_bucket_ptr;
+        *new_bucket_ptr = node;
+        node = next;
+    }
+    *old_bucket_ptr = NULL;
+    table->version++;
+}
+
+/**
+ * @brief Internal helper: Migrate up to `max_buckets` non-empty old buckets.
+ *
+ * Releases the old bucket array once the last bucket has been drained.
+ *
+ * @return 0 if migration is finished, 1 if old buckets remain
+ */
+static int _d_ChainedRehashStep(dTable_t* table, size_t max_buckets)
+{
+    if (!table->old_buckets) {
+        return 0;
+    }
+
+    size_t empty_visits = max_buckets > SIZE_MAX / D_TABLE_REHASH_EMPTY_VISITS
+                              ? SIZE_MAX
+                              : max_buckets * D_TABLE_REHASH_EMPTY_VISITS;
+    while (max_buckets > 0 && table->rehash_index < table->old_num_buckets) {
+        dLinkedList_t** old_bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->old_buckets, table->rehash_index);
+        table->rehash_index++;
+        if (*old_bucket_ptr) {
+            _d_MigrateBucket(table, old_bucket_ptr);
+            max_buckets--;
+        } else if (--empty_visits == 0) {
+            break;
+        }
+    }
+
+    if (table->rehash_index < table->old_num_buckets) {
+        return 1;
+    }
+
+    d_ArrayDestroy(table->old_buckets);
+    table->old_buckets = NULL;
+    table->old_num_buckets = 0;
+    table->rehash_index = 0;
+    d_LogDebugF("Incremental rehash finished (%zu buckets, %zu entries).", table->num_buckets, table->count);
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Swap in a bigger bucket array and start draining the old one.
+ *
+ * @return 0 on success, 1 on allocation failure (table left untouched)
+ */
+static int _d_ChainedBeginIncrementalRehash(dTable_t* table, size_t new_num_buckets)
+{
+    dArray_t* new_buckets = _d_CreateBucketArray(new_num_buckets, table->allocator);
+    if (!new_buckets) {
+        d_LogError("Failed to allocate new buckets array for incremental rehashing.");
+        return 1;
+    }
+
+    table->old_buckets = table->buckets;
+    table->old_num_buckets = table->num_buckets;
+    table->rehash_index = 0;
+    table->buckets = new_buckets;
+    table->num_buckets = new_num_buckets;
+    table->version++;
+
+    d_LogDebugF("Started incremental rehash from %zu to %zu buckets (%zu per step).",
+                table->old_num_buckets, new_num_buckets, table->rehash_step);
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Find the bucket holding `key` while a migration is in progress.
+ *
+ * @return Pointer to the old bucket head if the key's old bucket has not been
+ *         drained yet, otherwise NULL (the key can only be in the live array)
+ */
+static dLinkedList_t** _d_OldBucketFor(const dTable_t* table, size_t hash)
+{
+    if (!table->old_buckets) {
+        return NULL;
+    }
+    size_t old_index = hash % table->old_num_buckets;
+    if (old_index < table->rehash_index) {
+        return NULL;
+    }
+    return (dLinkedList_t**)d_ArrayGet(table->old_buckets, old_index);
+}
+
+/**
+ * @brief Internal helper: Find an entry in a chained table with the key's hash precomputed.
+ *
+ * Checks the live bucket first and, during an incremental rehash, the key's old
+ * bucket if it has not been drained yet.
+ */
+static dTableEntry_t* _d_ChainedFindHashed(const dTable_t* table, const void* key, size_t hash)
+{
+    dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, hash % table->num_buckets);
+    dTableEntry_t* entry = bucket_ptr
+        ? _d_FindEntryInBucket(*bucket_ptr, key, table->key_size, table->compare_func, hash) : NULL;
+    if (!entry) {
+        dLinkedList_t** old_bucket_ptr = _d_OldBucketFor(table, hash);
+        if (old_bucket_ptr) {
+            entry = _d_FindEntryInBucket(*old_bucket_ptr, key, table->key_size, table->compare_func, hash);
+        }
+    }
+    return entry;
+}
+
+/**
+ * @brief Internal helper: Unlink and free the entry matching `key` from one bucket.
+ *
+ * @return 0 if the key was found and removed, 1 otherwise
+ */
+static int _d_RemoveFromBucket(dTable_t* table, dLinkedList_t** bucket_ptr, const void* key, size_t hash)
+{
+    dLinkedList_t* current = *bucket_ptr;
+    dLinkedList_t* previous = NULL;
+
+    while (current) {
+        dTableEntry_t* entry = (dTableEntry_t*)current->data;
+        if (entry && entry->hash == hash && table->compare_func(entry->key_data, key, table->key_size) == 0) {
+            // Remove from linked list
+            if (previous) {
+                previous->next = current->next;
+            } else {
+                // Removing the head
+                *bucket_ptr = current->next;
+            }
+
+            // Free the entry and node
+            _d_DestroyChainNode(table, current);
+
+            table->count--;
+            table->version++;
+            d_LogDebugF("Removed key from hash table (total count: %zu).", table->count);
+            return 0;
+        }
+
+        previous = current;
+        current = current->next;
+    }
+    return 1;
+}
+
+// =============================================================================
+// FLAT (OPEN ADDRESSING) STORAGE ENGINE
+// =============================================================================
+
+// Control byte values (D_TABLE_CTRL_*) live in Daedalus.h, shared with D_TABLE_DEFINE.
+
+#define D_TABLE_FLAT_MIN_CAPACITY 8
+#define D_TABLE_FLAT_LOAD_FACTOR  0.875f
+
+/**
+ * @brief Internal helper: Round a requested slot count up to a usable power of two.
+ */
+static size_t _d_FlatRoundCapacity(size_t requested)
+{
+    size_t capacity = D_TABLE_FLAT_MIN_CAPACITY;
+    while (capacity < requested) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+static inline uint8_t* _d_FlatSlotKey(const dTable_t* table, size_t index)
+{
+    return (uint8_t*)table->slots + index * table->slot_size;
+}
+
+static inline uint8_t* _d_FlatSlotValue(const dTable_t* table, size_t index)
+{
+    return (uint8_t*)table->slots + index * table->slot_size + table->value_offset;
+}
+
+/**
+ * @brief Internal helper: Allocate empty control, slot, and hash arrays for a flat table.
+ *
+ * @return 0 on success, 1 on allocation failure (table left untouched)
+ */
+static int _d_FlatAllocate(dTable_t* table, size_t capacity, uint8_t** out_ctrl, void** out_slots,
+                           size_t** out_hashes)
+{
+    uint8_t* ctrl = (uint8_t*)d_Alloc(table->allocator, capacity);
+    void* slots = d_Alloc(table->allocator, capacity * table->slot_size);
+    size_t* hashes = (size_t*)d_Alloc(table->allocator, capacity * sizeof(size_t));
+    if (!ctrl || !slots || !hashes) {
+        d_Free(table->allocator, ctrl);
+        d_Free(table->allocator, slots);
+        d_Free(table->allocator, hashes);
+        return 1;
+    }
+    memset(ctrl, D_TABLE_CTRL_EMPTY, capacity);
+    *out_ctrl = ctrl;
+    *out_slots = slots;
+    *out_hashes = hashes;
+    return 0;
+}
+
+/**
+ * @brief Internal helper: Locate the slot holding `key`.
+ *
+ * Walks the linear probe sequence starting at the slot chosen by the mixed hash.
+ * Only slots whose control byte matches the 7-bit hash tag and whose stored full
+ * hash matches are compared, so the user compare function essentially only runs
+ * on the key being looked for.
+ *
+ * @return Slot index of the key, or SIZE_MAX if the key is not present
+ */
+static size_t _d_FlatFind(const dTable_t* table, const void* key, size_t mixed_hash)
+{
+    size_t mask = table->num_buckets - 1;
+    size_t index = (mixed_hash >> 7) & mask;
+    uint8_t tag = (uint8_t)(mixed_hash & 0x7F);
+
+    for (size_t probes = 0; probes < table->num_buckets; probes++) {
+        uint8_t c = table->ctrl[index];
+        if (c == D_TABLE_CTRL_EMPTY) {
+            return SIZE_MAX;
+        }
+        if (c == tag && table->slot_hashes[index] == mixed_hash &&
+            table->compare_func(_d_FlatSlotKey(table, index), key, table->key_size) == 0) {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+    return SIZE_MAX;
+}
+
+/**
+ * @brief Internal helper: Find the first free (empty or deleted) slot for a new key.
+ *
+ * The caller guarantees the key is not already present and that at least one
+ * slot is free.
+ */
+static size_t _d_FlatFindInsertSlot(const uint8_t* ctrl, size_t capacity, size_t mixed_hash)
+{
+    size_t mask = capacity - 1;
+    size_t index = (mixed_hash >> 7) & mask;
+    while (D_TABLE_CTRL_IS_FULL(ctrl[index])) {
+        index = (index + 1) & mask;
+    }
+    return index;
+}
+
+/**
+ * @brief Internal helper: Move every live slot into freshly sized arrays.
+ *
+ * Also discards all tombstones, so calling it with the current capacity is a
+ * valid way to clean up a table that has seen many removals. Slots are placed
+ * using their stored hashes; the user hash function is not called.
+ *
+ * @return 0 on success, 1 on allocation failure (table left untouched)
+ */
+static int _d_FlatResize(dTable_t* table, size_t new_capacity)
+{
+    uint8_t* new_ctrl = NULL;
+    void* new_slots = NULL;
+    size_t* new_hashes = NULL;
+    if (_d_FlatAllocate(table, new_capacity, &new_ctrl, &new_slots, &new_hashes) != 0) {
+        d_LogError("Failed to allocate slot arrays for flat table resize.");
+        return 1;
+    }
+
+    for (size_t i = 0; i < table->num_buckets; i++) {
+        if (!D_TABLE_CTRL_IS_FULL(table->ctrl[i])) {
+            continue;
+        }
+        const uint8_t* old_slot = _d_FlatSlotKey(table, i);
+        size_t mixed = table->slot_hashes[i];
+        size_t target = _d_FlatFindInsertSlot(new_ctrl, new_capacity, mixed);
+        new_ctrl[target] = (uint8_t)(mixed & 0x7F);
+        new_hashes[target] = mixed;
+        memcpy((uint8_t*)new_slots + target * table->slot_size, old_slot, table->slot_size);
+    }
+
+    d_Free(table->allocator, table->ctrl);
+    d_Free(table->allocator, table->slots);
+    d_Free(table->allocator, table->slot_hashes);
+    table->ctrl = new_ctrl;
+    table->slots = new_slots;
+    table->slot_hashes = new_hashes;
+    table->num_buckets = new_capacity;
+    table->tombstones = 0;
+    table->version++;
+    return 0;
+}
+
+static int _d_FlatSetHashed(dTable_t* table, const void* key, const void* value, size_t mixed)
+{
+    size_t index = _d_FlatFind(table, key, mixed);
+    if (index != SIZE_MAX) {
+        memcpy(_d_FlatSlotValue(table, index), value, table->value_size);
+        return 0;
+    }
+
+    // Grow (or purge tombstones) before the insert would cross the threshold
+    float projected = (float)(table->count + table->tombstones + 1) / (float)table->num_buckets;
+    if (projected > table->load_factor_threshold) {
+        // Mostly tombstones: rebuilding at the same size is enough
+        size_t new_capacity = (table->tombstones > table->count)
+                              ? table->num_buckets : table->num_buckets * 2;
+        d_LogDebugF("Flat table resize from %zu to %zu slots (count %zu, tombstones %zu).",
+                    table->num_buckets, new_capacity, table->count, table->tombstones);
+        if (_d_FlatResize(table, new_capacity) != 0) {
+            return 1;
+        }
+    }
+
+    index = _d_FlatFindInsertSlot(table->ctrl, table->num_buckets, mixed);
+    if (table->ctrl[index] == D_TABLE_CTRL_DELETED) {
+        table->tombstones--;
+    }
+    table->ctrl[index] = (uint8_t)(mixed & 0x7F);
+    table->slot_hashes[index] = mixed;
+    memcpy(_d_FlatSlotKey(table, index), key, table->key_size);
+    memcpy(_d_FlatSlotValue(table, index), value, table->value_size);
+    table->count++;
+    table->version++;
+    return 0;
+}
+
+static int _d_FlatRemove(dTable_t* table, const void* key, size_t mixed)
+{
+    size_t index = _d_FlatFind(table, key, mixed);
+    if (index == SIZE_MAX) {
+        return 1;
+    }
+
+    // If the next slot is empty no probe sequence runs through this one,
+    // so it can go straight back to empty instead of leaving a tombstone.
+    size_t next = (index + 1) & (table->num_buckets - 1);
+    if (table->ctrl[next] == D_TABLE_CTRL_EMPTY) {
+        table->ctrl[index] = D_TABLE_CTRL_EMPTY;
+    } else {
+        table->ctrl[index] = D_TABLE_CTRL_DELETED;
+        table->tombstones++;
+    }
+    table->count--;
+    table->version++;
+    return 0;
+}
+
+// =============================================================================
+// COMPACT (INSERTION-ORDERED) STORAGE ENGINE
+// =============================================================================
+
+// Entries are appended to the dense `slots` array (same key/value slot layout as
+// FLAT mode) and found through `index`, a linearly probed array of entry numbers.
+// Index slots are 1, 2, 4 or 8 bytes wide; the two largest values of each width
+// are reserved for empty and dummy (removed) slots.
+#define D_TABLE_IX_EMPTY SIZE_MAX
+#define D_TABLE_IX_DUMMY (SIZE_MAX - 1)
+
+/**
+ * @brief Internal helper: Smallest index slot width able to number `entries_capacity` entries.
+ */
+static size_t _d_CompactIndexWidth(size_t entries_capacity)
+{
+    if (entries_capacity <= 0xFDu) return 1;
+    if (entries_capacity <= 0xFFFDu) return 2;
+    if ((uint64_t)entries_capacity <= 0xFFFFFFFDull) return 4;
+    return 8;
+}
+
+/**
+ * @brief Internal helper: Entries a compact table holds before resizing (2/3 of the index).
+ */
+static size_t _d_CompactUsable(size_t index_capacity)
+{
+    return index_capacity * 2 / 3;
+}
+
+/**
+ * @brief Internal helper: Read index slot `i`, widening the reserved values to D_TABLE_IX_*.
+ */
+static inline size_t _d_CompactIndexGet(const dTable_t* table, size_t i)
+{
+    switch (table->index_width) {
+        case 1: {
+            uint8_t v = ((const uint8_t*)table->index)[i];
+            return v == UINT8_MAX ? D_TABLE_IX_EMPTY : v == UINT8_MAX - 1 ? D_TABLE_IX_DUMMY : v;
+        }
+        case 2: {
+            uint16_t v = ((const uint16_t*)table->index)[i];
+            return v == UINT16_MAX ? D_TABLE_IX_EMPTY : v == UINT16_MAX - 1 ? D_TABLE_IX_DUMMY : v;
+        }
+        case 4: {
+            uint32_t v = ((const uint32_t*)table->index)[i];
+            return v == UINT32_MAX ? D_TABLE_IX_EMPTY : v == UINT32_MAX - 1 ? D_TABLE_IX_DUMMY : (size_t)v;
+        }
+        default:
+            return (size_t)((const uint64_t*)table->index)[i];
+    }
+}
+
+/**
+ * @brief Internal helper: Store an entry number (or D_TABLE_IX_DUMMY) in index slot `i`.
+ */
+static inline void _d_CompactIndexSet(dTable_t* table, size_t i, size_t value)
+{
+    // Truncating SIZE_MAX - 1 yields the width's own dummy value
+    switch (table->index_width) {
+        case 1:  ((uint8_t*)table->index)[i] = (uint8_t)value; break;
+        case 2:  ((uint16_t*)table->index)[i] = (uint16_t)value; break;
+        case 4:  ((uint32_t*)table->index)[i] = (uint32_t)value; break;
+        default: ((uint64_t*)table->index)[i] = (uint64_t)value; break;
+    }
+}
+
+/**
+ * @brief Internal helper: Locate `key` through the index.
  *
- * Creates a unique string name for storing entries in linked lists based on
- * memory address to ensure uniqueness.
+ * @param out_slot If non-NULL, receives the index slot that refers to the entry
  *
- * @param entry Pointer to the entry
- * @param name_buffer Buffer to store the generated name
- * @param buffer_size Size of the name buffer
+ * @return Entry number of the key, or SIZE_MAX if the key is not present
  */
-static void _d_GenerateEntryName(const dTableEntry_t* entry, char* name_buffer, size_t buffer_size)
+static size_t _d_CompactFind(const dTable_t* table, const void* key, size_t mixed_hash, size_t* out_slot)
 {
-    snprintf(name_buffer, buffer_size, "entry_%p", (void*)entry);
+    size_t mask = table->num_buckets - 1;
+    size_t slot = mixed_hash & mask;
+
+    for (size_t probes = 0; probes < table->num_buckets; probes++) {
+        size_t entry = _d_CompactIndexGet(table, slot);
+        if (entry == D_TABLE_IX_EMPTY) {
+            return SIZE_MAX;
+        }
+        if (entry != D_TABLE_IX_DUMMY && table->slot_hashes[entry] == mixed_hash &&
+            table->compare_func(_d_FlatSlotKey(table, entry), key, table->key_size) == 0) {
+            if (out_slot) *out_slot = slot;
+            return entry;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return SIZE_MAX;
+}
+
+/**
+ * @brief Internal helper: Rebuild a compact table with an index of `new_capacity` slots.
+ *
+ * Live entries are copied to fresh arrays in their original order, dropping any
+ * removed ones, and the index is rebuilt from the stored hashes.
+ *
+ * @return 0 on success, 1 on allocation failure (table left untouched)
+ */
+static int _d_CompactResize(dTable_t* table, size_t new_capacity)
+{
+    size_t new_usable = _d_CompactUsable(new_capacity);
+    size_t new_width = _d_CompactIndexWidth(new_usable);
+    uint8_t* new_ctrl = NULL;
+    void* new_slots = NULL;
+    size_t* new_hashes = NULL;
+    void* new_index = d_Alloc(table->allocator, new_capacity * new_width);
+    if (!new_index || _d_FlatAllocate(table, new_usable, &new_ctrl, &new_slots, &new_hashes) != 0) {
+        d_LogError("Failed to allocate arrays for compact table resize.");
+        d_Free(table->allocator, new_index);
+        return 1;
+    }
+    memset(new_index, 0xFF, new_capacity * new_width);
+
+    d_Free(table->allocator, table->index);
+    table->index = new_index;
+    table->index_width = new_width;
+    table->num_buckets = new_capacity;
+
+    size_t mask = new_capacity - 1;
+    size_t used = 0;
+    for (size_t i = 0; i < table->entries_used; i++) {
+        if (table->ctrl[i] == D_TABLE_CTRL_DELETED) {
+            continue;
+        }
+        size_t mixed = table->slot_hashes[i];
+        new_ctrl[used] = 0;
+        new_hashes[used] = mixed;
+        memcpy((uint8_t*)new_slots + used * table->slot_size, _d_FlatSlotKey(table, i), table->slot_size);
+
+        size_t slot = mixed & mask;
+        while (_d_CompactIndexGet(table, slot) != D_TABLE_IX_EMPTY) {
+            slot = (slot + 1) & mask;
+        }
+        _d_CompactIndexSet(table, slot, used);
+        used++;
+    }
+
+    d_Free(table->allocator, table->ctrl);
+    d_Free(table->allocator, table->slots);
+    d_Free(table->allocator, table->slot_hashes);
+    table->ctrl = new_ctrl;
+    table->slots = new_slots;
+    table->slot_hashes = new_hashes;
+    table->entries_used = used;
+    table->entries_capacity = new_usable;
+    table->tombstones = 0;
+    table->version++;
+    return 0;
+}
+
+static int _d_CompactSetHashed(dTable_t* table, const void* key, const void* value, size_t mixed)
+{
+    size_t entry = _d_CompactFind(table, key, mixed, NULL);
+    if (entry != SIZE_MAX) {
+        memcpy(_d_FlatSlotValue(table, entry), value, table->value_size);
+        return 0;
+    }
+
+    if (table->entries_used == table->entries_capacity) {
+        // Mostly removed entries: compacting at the same size is enough
+        size_t new_capacity = (table->tombstones > table->count)
+                              ? table->num_buckets : table->num_buckets * 2;
+        d_LogDebugF("Compact table resize from %zu to %zu index slots (count %zu, removed %zu).",
+                    table->num_buckets, new_capacity, table->count, table->tombstones);
+        if (_d_CompactResize(table, new_capacity) != 0) {
+            return 1;
+        }
+    }
+
+    // Removed entries leave dummies, so an empty slot always ends the probe
+    size_t mask = table->num_buckets - 1;
+    size_t slot = mixed & mask;
+    size_t current = _d_CompactIndexGet(table, slot);
+    while (current != D_TABLE_IX_EMPTY && current != D_TABLE_IX_DUMMY) {
+        slot = (slot + 1) & mask;
+        current = _d_CompactIndexGet(table, slot);
+    }
+
+    entry = table->entries_used++;
+    table->ctrl[entry] = 0;
+    table->slot_hashes[entry] = mixed;
+    memcpy(_d_FlatSlotKey(table, entry), key, table->key_size);
+    memcpy(_d_FlatSlotValue(table, entry), value, table->value_size);
+    _d_CompactIndexSet(table, slot, entry);
+    table->count++;
+    table->version++;
+    return 0;
+}
+
+static int _d_CompactRemove(dTable_t* table, const void* key, size_t mixed)
+{
+    size_t slot = 0;
+    size_t entry = _d_CompactFind(table, key, mixed, &slot);
+    if (entry == SIZE_MAX) {
+        return 1;
+    }
+
+    // The entry stays in place as a hole so later entries keep their order
+    _d_CompactIndexSet(table, slot, D_TABLE_IX_DUMMY);
+    table->ctrl[entry] = D_TABLE_CTRL_DELETED;
+    table->tombstones++;
+    table->count--;
+    table->version++;
+    return 0;
 }
 
 // =============================================================================
@@ -127,44 +755,104 @@ static void _d_GenerateEntryName(const dTableEntry_t* entry, char* name_buffer,
 dTable_t* d_TableInit(size_t key_size, size_t value_size, dTableHashFunc hash_func,
                       dTableCompareFunc compare_func, size_t initial_num_buckets
                     )
+{
+    return d_TableInitWithMode(key_size, value_size, hash_func, compare_func,
+                               initial_num_buckets, D_TABLE_MODE_CHAINED);
+}
+
+dTable_t* d_TableInitWithMode(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                              dTableCompareFunc compare_func, size_t initial_capacity,
+                              dTableMode_t mode)
+{
+    return d_TableInitWithAllocator(key_size, value_size, hash_func, compare_func,
+                                    initial_capacity, mode, NULL);
+}
+
+dTable_t* d_TableInitWithAllocator(size_t key_size, size_t value_size, dTableHashFunc hash_func,
+                                   dTableCompareFunc compare_func, size_t initial_capacity,
+                                   dTableMode_t mode, const dAllocator_t* allocator)
 {
     if (key_size == 0 || value_size == 0 || !hash_func || !compare_func || 
-        initial_num_buckets == 0) {
+        initial_capacity == 0) {
         d_LogError("Invalid parameters for hash table initialization.");
         return NULL;
     }
 
-    dTable_t* table = (dTable_t*)malloc(sizeof(dTable_t));
-    if (!table) {
-        d_LogError("Failed to allocate memory for hash table structure.");
+    if (mode != D_TABLE_MODE_CHAINED && mode != D_TABLE_MODE_FLAT && mode != D_TABLE_MODE_COMPACT) {
+        d_LogErrorF("Unknown hash table mode %d.", (int)mode);
         return NULL;
     }
 
-    // Allocate buckets array using dArray_t as per header definition
-    table->buckets = d_ArrayInit(initial_num_buckets, sizeof(dLinkedList_t*));
-    if (!table->buckets) {
-        d_LogError("Failed to allocate memory for hash table buckets array.");
-        free(table);
-        return NULL;
+    if (!allocator) {
+        allocator = d_GetDefaultAllocator();
     }
 
-    // Initialize all bucket pointers to NULL
-    for (size_t i = 0; i < initial_num_buckets; i++) {
-        dLinkedList_t* null_ptr = NULL;
-        d_ArrayAppend(table->buckets, &null_ptr);
+    dTable_t* table = (dTable_t*)d_Calloc(allocator, 1, sizeof(dTable_t));
+    if (!table) {
+        d_LogError("Failed to allocate memory for hash table structure.");
+        return NULL;
     }
 
     // Initialize table fields
-    table->num_buckets = initial_num_buckets;
+    table->allocator = allocator;
     table->count = 0;
     table->key_size = key_size;
     table->value_size = value_size;
     table->hash_func = hash_func;
     table->compare_func = compare_func;
+    table->mode = mode;
+
+    if (mode == D_TABLE_MODE_FLAT || mode == D_TABLE_MODE_COMPACT) {
+        // Lay the value out at its natural alignment right after the key
+        size_t value_align = _d_NaturalAlignment(value_size);
+        size_t slot_align = MAX(_d_NaturalAlignment(key_size), value_align);
+        table->value_offset = (key_size + value_align - 1) / value_align * value_align;
+        table->slot_size = (table->value_offset + value_size + slot_align - 1) / slot_align * slot_align;
+        table->load_factor_threshold = D_TABLE_FLAT_LOAD_FACTOR;
+    }
+
+    if (mode == D_TABLE_MODE_COMPACT) {
+        // Start from an empty table and let the resize path size every array
+        table->num_buckets = 0;
+        if (_d_CompactResize(table, _d_FlatRoundCapacity(initial_capacity)) != 0) {
+            d_LogError("Failed to allocate arrays for compact hash table.");
+            d_Free(allocator, table);
+            return NULL;
+        }
+        table->load_factor_threshold = 2.0f / 3.0f;
+
+        d_LogDebugF("Initialized compact hash table with %zu index slots of %zu bytes, %zu entries.",
+                    table->num_buckets, table->index_width, table->entries_capacity);
+        return table;
+    }
+
+    if (mode == D_TABLE_MODE_FLAT) {
+        size_t capacity = _d_FlatRoundCapacity(initial_capacity);
+        if (_d_FlatAllocate(table, capacity, &table->ctrl, &table->slots, &table->slot_hashes) != 0) {
+            d_LogError("Failed to allocate slot arrays for flat hash table.");
+            d_Free(allocator, table);
+            return NULL;
+        }
+        table->num_buckets = capacity;
+
+        d_LogDebugF("Initialized flat hash table with %zu slots of %zu bytes.",
+                    capacity, table->slot_size);
+        return table;
+    }
+
+    // Allocate buckets array using dArray_t as per header definition
+    table->buckets = _d_CreateBucketArray(initial_capacity, allocator);
+    if (!table->buckets) {
+        d_LogError("Failed to allocate memory for hash table buckets array.");
+        d_Free(allocator, table);
+        return NULL;
+    }
+
+    table->num_buckets = initial_capacity;
     table->load_factor_threshold = 0.75f;
 
     d_LogDebugF("Initialized hash table with %zu buckets, load factor threshold: %.2f",
-                initial_num_buckets, 0.75f);
+                initial_capacity, 0.75f);
 
     return table;
 }
@@ -175,29 +863,45 @@ int _d_TableDestroy_impl(dTable_t** table, const char* file, int line, const cha
     D_ASSERT(*table != NULL, "d_TableDestroy: table already NULL (double-free?)", file, line, func);
 
     dTable_t* t = *table;
+
+    if (t->mode == D_TABLE_MODE_FLAT) {
+        D_ASSERT(t->ctrl != NULL, "d_TableDestroy: ctrl is NULL (corruption?)", file, line, func);
+        d_Free(t->allocator, t->ctrl);
+        d_Free(t->allocator, t->slots);
+        d_Free(t->allocator, t->slot_hashes);
+        d_Free(t->allocator, t);
+        *table = NULL;
+        d_LogDebug("Flat hash table destroyed successfully.");
+        return 0;
+    }
+
+    if (t->mode == D_TABLE_MODE_COMPACT) {
+        D_ASSERT(t->index != NULL, "d_TableDestroy: index is NULL (corruption?)", file, line, func);
+        d_Free(t->allocator, t->index);
+        d_Free(t->allocator, t->ctrl);
+        d_Free(t->allocator, t->slots);
+        d_Free(t->allocator, t->slot_hashes);
+        d_Free(t->allocator, t);
+        *table = NULL;
+        d_LogDebug("Compact hash table destroyed successfully.");
+        return 0;
+    }
     
     // Sanity check - catch obvious corruption
     D_ASSERT(t->buckets != NULL, "d_TableDestroy: buckets is NULL (corruption?)", file, line, func);
 
-    // Destroy all buckets and their entries
-    for (size_t i = 0; i < t->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(t->buckets, i);
-        if (bucket_ptr && *bucket_ptr) {
-            dLinkedList_t* current = *bucket_ptr;
-            while (current) {
-                dTableEntry_t* entry = (dTableEntry_t*)current->data;
-                if (entry) {
-                    _d_DestroyTableEntry(entry);
-                    current->data = NULL;
-                }
-                current = current->next;
-            }
-            d_DestroyLinkedList(bucket_ptr);
-        }
+    // Destroy all buckets and their entries (including any still draining)
+    _d_FreeBucketChains(t, t->buckets, t->num_buckets);
+    if (t->old_buckets) {
+        _d_FreeBucketChains(t, t->old_buckets, t->old_num_buckets);
+        d_ArrayDestroy(t->old_buckets);
+    }
+    if (t->node_pool) {
+        d_PoolDestroy(&t->node_pool);
     }
 
     d_ArrayDestroy(t->buckets);
-    free(t);
+    d_Free(t->allocator, t);
     *table = NULL;
 
     d_LogDebug("Hash table destroyed successfully.");
@@ -208,6 +912,8 @@ int _d_TableDestroy_impl(dTable_t** table, const char* file, int line, const cha
 // HASH TABLE DATA MANAGEMENT
 // =============================================================================
 
+static int _d_ChainedSetHashed(dTable_t* table, const void* key, const void* value, size_t hash);
+
 int d_TableSet(dTable_t* table, const void* key, const void* value)
 {
     if (!table || !key || !value) {
@@ -215,8 +921,36 @@ int d_TableSet(dTable_t* table, const void* key, const void* value)
         return 1;
     }
 
-    // Compute hash and bucket index
-    size_t hash = table->hash_func(key, table->key_size);
+    return d_TableSetHashed(table, key, value, table->hash_func(key, table->key_size));
+}
+
+int d_TableSetHashed(dTable_t* table, const void* key, const void* value, size_t hash)
+{
+    if (!table || !key || !value) {
+        d_LogError("Invalid parameters for setting data to hash table.");
+        return 1;
+    }
+
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        return _d_FlatSetHashed(table, key, value, d_HashMix(hash));
+    }
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        return _d_CompactSetHashed(table, key, value, d_HashMix(hash));
+    }
+
+    // Pay down a bounded slice of any in-progress migration
+    if (table->old_buckets) {
+        _d_ChainedRehashStep(table, table->rehash_step);
+    }
+
+    return _d_ChainedSetHashed(table, key, value, hash);
+}
+
+/**
+ * @brief Internal helper: Chained-mode insert/update with the key's hash precomputed.
+ */
+static int _d_ChainedSetHashed(dTable_t* table, const void* key, const void* value, size_t hash)
+{
     size_t bucket_index = hash % table->num_buckets;
 
     // Get bucket pointer
@@ -226,51 +960,36 @@ int d_TableSet(dTable_t* table, const void* key, const void* value)
         return 1;
     }
 
-    // Check if key already exists in this bucket
-    dTableEntry_t* existing_entry = _d_FindEntryInBucket(*bucket_ptr, key, table->key_size, table->compare_func);
+    // Check if key already exists in this bucket (or its not-yet-migrated old bucket)
+    dTableEntry_t* existing_entry = _d_FindEntryInBucket(*bucket_ptr, key, table->key_size, table->compare_func, hash);
+    if (!existing_entry) {
+        dLinkedList_t** old_bucket_ptr = _d_OldBucketFor(table, hash);
+        if (old_bucket_ptr) {
+            existing_entry = _d_FindEntryInBucket(*old_bucket_ptr, key, table->key_size, table->compare_func, hash);
+        }
+    }
 
     if (existing_entry) {
         // Update existing entry's value
         d_LogDebugF("Updating existing key in hash table (bucket %zu).", bucket_index);
-        
-        // Free old value data
-        if (existing_entry->value_data) {
-            free(existing_entry->value_data);
-        }
-        
-        // Allocate and copy new value data
-        existing_entry->value_data = malloc(table->value_size);
-        if (!existing_entry->value_data) {
-            d_LogError("Failed to allocate memory for updated value data.");
-            return 1;
-        }
+
+        // value_size is fixed, so overwrite in place; pointers from d_TableGet stay valid
         memcpy(existing_entry->value_data, value, table->value_size);
         
         return 0; // Success - updated existing entry
     }
 
-    // Create new entry
-    dTableEntry_t* new_entry = _d_CreateTableEntry(key, table->key_size, value, table->value_size);
-    if (!new_entry) {
-        d_LogError("Failed to create new table entry.");
-        return 1;
-    }
-
-    // Generate unique name for linked list storage
-    char entry_name[64];
-    _d_GenerateEntryName(new_entry, entry_name, sizeof(entry_name));
-
-    // Add to bucket's linked list
-    int result = d_PushBackToLinkedList(bucket_ptr, new_entry, 
-                                       entry_name, sizeof(dTableEntry_t));
-    if (result != 0) {
+    // Create new entry and add it to the bucket's linked list
+    dLinkedList_t* node = _d_CreateChainNode(table, key, value, hash);
+    if (!node) {
         d_LogErrorF("Failed to add entry to bucket %zu linked list.", bucket_index);
-        _d_DestroyTableEntry(new_entry);
         return 1;
     }
+    _d_AppendChainNode(bucket_ptr, node);
 
     // Increment count
     table->count++;
+    table->version++;
     
     d_LogDebugF("Added new key-value pair to hash table (bucket %zu, total count: %zu).",
                 bucket_index, table->count);
@@ -282,6 +1001,16 @@ int d_TableSet(dTable_t* table, const void* key, const void* value)
         d_LogInfoF("Load factor (%.2f) exceeds threshold (%.2f). Triggering auto-rehash.",
                    current_load_factor, table->load_factor_threshold);
         
+        // Incremental mode: start draining into a doubled array instead of
+        // rebuilding everything now. A grow that arrives mid-migration falls
+        // through to d_TableRehash, which finishes the pending one first.
+        if (table->rehash_step > 0 && !table->old_buckets) {
+            if (_d_ChainedBeginIncrementalRehash(table, table->num_buckets * 2) != 0) {
+                return 1;
+            }
+            return 0;
+        }
+
         // Auto-resize by doubling the number of buckets.
         // d_TableRehash with 0 for the new size handles this automatically.
         if (d_TableRehash(table, 0) != 0) {
@@ -292,18 +1021,37 @@ int d_TableSet(dTable_t* table, const void* key, const void* value)
         }
     }
 
-    return 0;
+    return 0;
+}
+
+void* d_TableGet(dTable_t* table, const void* key)
+{
+    if (!table || !key) {
+        d_LogError("Invalid parameters for getting data from hash table.");
+        return NULL;
+    }
+
+    return d_TableGetHashed(table, key, table->hash_func(key, table->key_size));
 }
 
-void* d_TableGet(dTable_t* table, const void* key)
+void* d_TableGetHashed(dTable_t* table, const void* key, size_t hash)
 {
     if (!table || !key) {
         d_LogError("Invalid parameters for getting data from hash table.");
         return NULL;
     }
 
-    // Compute hash and bucket index
-    size_t hash = table->hash_func(key, table->key_size);
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        size_t index = _d_FlatFind(table, key, d_HashMix(hash));
+        return (index != SIZE_MAX) ? _d_FlatSlotValue(table, index) : NULL;
+    }
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        size_t entry = _d_CompactFind(table, key, d_HashMix(hash), NULL);
+        return (entry != SIZE_MAX) ? _d_FlatSlotValue(table, entry) : NULL;
+    }
+
+    // Lookups never migrate buckets: a read is legal while a cursor is open, and
+    // moving nodes under a cursor would make it skip or repeat entries
     size_t bucket_index = hash % table->num_buckets;
 
     // Get bucket pointer
@@ -313,8 +1061,14 @@ void* d_TableGet(dTable_t* table, const void* key)
         return NULL;
     }
 
-    // Find entry in bucket
-    dTableEntry_t* entry = _d_FindEntryInBucket(*bucket_ptr, key, table->key_size, table->compare_func);
+    // Find entry in bucket, falling back to the old array during migration
+    dTableEntry_t* entry = _d_FindEntryInBucket(*bucket_ptr, key, table->key_size, table->compare_func, hash);
+    if (!entry) {
+        dLinkedList_t** old_bucket_ptr = _d_OldBucketFor(table, hash);
+        if (old_bucket_ptr) {
+            entry = _d_FindEntryInBucket(*old_bucket_ptr, key, table->key_size, table->compare_func, hash);
+        }
+    }
 
     if (entry) {
         // d_LogDebugF("Found key in hash table (bucket %zu).", bucket_index);
@@ -330,8 +1084,27 @@ int _d_TableRemove_impl(dTable_t* table, const void* key, const char* file, int
     D_ASSERT(table != NULL, "d_TableRemove: NULL table", file, line, func);
     D_ASSERT(key != NULL, "d_TableRemove: NULL key", file, line, func);
 
-    // Compute hash and bucket index
-    size_t hash = table->hash_func(key, table->key_size);
+    return d_TableRemoveHashed(table, key, table->hash_func(key, table->key_size));
+}
+
+int d_TableRemoveHashed(dTable_t* table, const void* key, size_t hash)
+{
+    if (!table || !key) {
+        d_LogError("Invalid parameters for removing data from hash table.");
+        return 1;
+    }
+
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        return _d_FlatRemove(table, key, d_HashMix(hash));
+    }
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        return _d_CompactRemove(table, key, d_HashMix(hash));
+    }
+
+    if (table->old_buckets) {
+        _d_ChainedRehashStep(table, table->rehash_step);
+    }
+
     size_t bucket_index = hash % table->num_buckets;
 
     // Get bucket pointer
@@ -341,48 +1114,250 @@ int _d_TableRemove_impl(dTable_t* table, const void* key, const char* file, int
         return 1;
     }
 
-    dLinkedList_t* bucket = *bucket_ptr;
-    if (!bucket) {
-        d_LogDebugF("Key not found - bucket %zu is empty.", bucket_index);
-        return 1; // Key not found
+    if (_d_RemoveFromBucket(table, bucket_ptr, key, hash) == 0) {
+        return 0;
     }
 
-    // Find and remove the entry
-    dLinkedList_t* current = bucket;
-    dLinkedList_t* previous = NULL;
+    dLinkedList_t** old_bucket_ptr = _d_OldBucketFor(table, hash);
+    if (old_bucket_ptr && _d_RemoveFromBucket(table, old_bucket_ptr, key, hash) == 0) {
+        return 0;
+    }
 
-    while (current) {
-        dTableEntry_t* entry = (dTableEntry_t*)current->data;
-        if (entry && table->compare_func(entry->key_data, key, table->key_size) == 0) {
-            
-            // Found the entry to remove
-            d_LogDebugF("Removing key from hash table (bucket %zu).", bucket_index);
-            
-            // Remove from linked list
-            if (previous) {
-                previous->next = current->next;
+    d_LogDebugF("Key not found in hash table (bucket %zu).", bucket_index);
+    return 1; // Key not found
+}
+
+int d_TableSetIncrementalRehash(dTable_t* table, size_t buckets_per_step)
+{
+    if (!table) {
+        d_LogError("Attempted to configure incremental rehash on NULL hash table.");
+        return 1;
+    }
+
+    if (table->mode != D_TABLE_MODE_CHAINED) {
+        d_LogError("Incremental rehashing is only available for chained hash tables.");
+        return 1;
+    }
+
+    table->rehash_step = buckets_per_step;
+
+    // Turning incremental mode off must not leave a half-migrated table behind
+    if (buckets_per_step == 0 && table->old_buckets) {
+        _d_ChainedRehashStep(table, SIZE_MAX);
+    }
+    return 0;
+}
+
+int d_TableRehashStep(dTable_t* table, size_t max_buckets)
+{
+    if (!table) {
+        d_LogError("Attempted to step rehash on NULL hash table.");
+        return 0;
+    }
+
+    return _d_ChainedRehashStep(table, max_buckets);
+}
+
+int d_TableEnablePool(dTable_t* table, size_t blocks_per_slab)
+{
+    if (!table) {
+        d_LogError("Attempted to enable pooling on NULL hash table.");
+        return 1;
+    }
+    if (table->mode != D_TABLE_MODE_CHAINED) {
+        d_LogError("Entry pooling is only available for chained hash tables.");
+        return 1;
+    }
+    if (table->node_pool) {
+        return 0;
+    }
+    if (table->count > 0) {
+        d_LogError("Entry pooling must be enabled before the first insert.");
+        return 1;
+    }
+
+    table->node_pool = d_PoolCreateWithAllocator(_d_ChainBlockSize(table->key_size, table->value_size),
+                                                 blocks_per_slab, table->allocator);
+    if (!table->node_pool) {
+        d_LogError("Failed to create entry pool for hash table.");
+        return 1;
+    }
+    return 0;
+}
+
+bool d_TableIsRehashing(const dTable_t* table)
+{
+    return table != NULL && table->old_buckets != NULL;
+}
+
+// =============================================================================
+// BATCHED LOOKUP AND INSERTION
+// =============================================================================
+
+// Keys are processed in blocks: hash the whole block, prefetch every target,
+// then resolve. Large enough to cover memory latency, small enough for the
+// per-block state to live on the stack.
+#define D_TABLE_BATCH_BLOCK 16
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define D_TABLE_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+    #define D_TABLE_PREFETCH(addr) ((void)(addr))
+#endif
+
+/**
+ * @brief Internal helper: Hash one block of keys and prefetch where they will land.
+ *
+ * FLAT mode prefetches the control byte and slot at each key's home position.
+ * COMPACT mode prefetches each key's home index slot.
+ * CHAINED mode prefetches the bucket head pointers, then the first node of each
+ * non-empty chain once those heads have had the whole block's latency to arrive.
+ */
+static void _d_TableHashBlock(const dTable_t* table, const uint8_t* keys, size_t n, size_t* hashes)
+{
+    for (size_t i = 0; i < n; i++) {
+        hashes[i] = table->hash_func(keys + i * table->key_size, table->key_size);
+    }
+
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        size_t mask = table->num_buckets - 1;
+        for (size_t i = 0; i < n; i++) {
+            hashes[i] = d_HashMix(hashes[i]);
+            size_t index = (hashes[i] >> 7) & mask;
+            D_TABLE_PREFETCH(&table->ctrl[index]);
+            D_TABLE_PREFETCH((const uint8_t*)table->slots + index * table->slot_size);
+        }
+        return;
+    }
+
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        size_t mask = table->num_buckets - 1;
+        for (size_t i = 0; i < n; i++) {
+            hashes[i] = d_HashMix(hashes[i]);
+            D_TABLE_PREFETCH((const uint8_t*)table->index + (hashes[i] & mask) * table->index_width);
+        }
+        return;
+    }
+
+    dLinkedList_t** heads = (dLinkedList_t**)table->buckets->data;
+    for (size_t i = 0; i < n; i++) {
+        D_TABLE_PREFETCH(&heads[hashes[i] % table->num_buckets]);
+    }
+    for (size_t i = 0; i < n; i++) {
+        dLinkedList_t* head = heads[hashes[i] % table->num_buckets];
+        if (head) {
+            D_TABLE_PREFETCH(head);
+            D_TABLE_PREFETCH(head->data);
+        }
+    }
+}
+
+size_t d_TableGetBatch(dTable_t* table, const void* keys, size_t count, void** out_values)
+{
+    if (!table || (count > 0 && (!keys || !out_values))) {
+        d_LogError("Invalid parameters for batched lookup in hash table.");
+        return 0;
+    }
+
+    const uint8_t* key_bytes = (const uint8_t*)keys;
+    size_t hashes[D_TABLE_BATCH_BLOCK];
+    size_t found = 0;
+
+    for (size_t start = 0; start < count; start += D_TABLE_BATCH_BLOCK) {
+        size_t n = count - start < D_TABLE_BATCH_BLOCK ? count - start : D_TABLE_BATCH_BLOCK;
+        const uint8_t* block = key_bytes + start * table->key_size;
+        _d_TableHashBlock(table, block, n, hashes);
+
+        for (size_t i = 0; i < n; i++) {
+            const void* key = block + i * table->key_size;
+            void* value = NULL;
+            if (table->mode == D_TABLE_MODE_FLAT) {
+                size_t index = _d_FlatFind(table, key, hashes[i]);
+                value = (index != SIZE_MAX) ? _d_FlatSlotValue(table, index) : NULL;
+            } else if (table->mode == D_TABLE_MODE_COMPACT) {
+                size_t entry = _d_CompactFind(table, key, hashes[i], NULL);
+                value = (entry != SIZE_MAX) ? _d_FlatSlotValue(table, entry) : NULL;
             } else {
-                // Removing the head
-                *bucket_ptr = current->next;
+                dTableEntry_t* entry = _d_ChainedFindHashed(table, key, hashes[i]);
+                value = entry ? entry->value_data : NULL;
             }
-            
-            // Free the entry and node
-            _d_DestroyTableEntry(entry);
-            free(current);
-            
-            // Decrement count
-            table->count--;
-            
-            d_LogDebugF("Removed key from hash table (total count: %zu).", table->count);
-            return 0; // Success
+            out_values[start + i] = value;
+            found += (value != NULL);
         }
-        
-        previous = current;
-        current = current->next;
     }
 
-    d_LogDebugF("Key not found in hash table (bucket %zu).", bucket_index);
-    return 1; // Key not found
+    return found;
+}
+
+int d_TableSetBatch(dTable_t* table, const void* keys, const void* values, size_t count)
+{
+    if (!table || (count > 0 && (!keys || !values))) {
+        d_LogError("Invalid parameters for batched insertion into hash table.");
+        return 1;
+    }
+
+    // Grow once up front for the worst case (all keys new) instead of
+    // rehashing repeatedly in the middle of the batch.
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        size_t needed = table->count + count;
+        if ((float)(needed + table->tombstones) / (float)table->num_buckets > table->load_factor_threshold) {
+            size_t target = _d_FlatRoundCapacity((size_t)((float)needed / table->load_factor_threshold) + 1);
+            if (target > table->num_buckets && _d_FlatResize(table, target) != 0) {
+                return 1;
+            }
+        }
+    } else if (table->mode == D_TABLE_MODE_COMPACT) {
+        size_t needed = table->count + count;
+        if (table->entries_used + count > table->entries_capacity) {
+            size_t target = table->num_buckets;
+            while (_d_CompactUsable(target) < needed) {
+                target *= 2;
+            }
+            if (_d_CompactResize(table, target) != 0) {
+                return 1;
+            }
+        }
+    } else if (table->rehash_step == 0) {
+        size_t needed = table->count + count;
+        if ((float)needed / (float)table->num_buckets > table->load_factor_threshold) {
+            size_t target = table->num_buckets;
+            while ((float)needed / (float)target > table->load_factor_threshold) {
+                target *= 2;
+            }
+            if (d_TableRehash(table, target) != 0) {
+                return 1;
+            }
+        }
+    }
+
+    const uint8_t* key_bytes = (const uint8_t*)keys;
+    const uint8_t* value_bytes = (const uint8_t*)values;
+    size_t hashes[D_TABLE_BATCH_BLOCK];
+    int result = 0;
+
+    for (size_t start = 0; start < count; start += D_TABLE_BATCH_BLOCK) {
+        size_t n = count - start < D_TABLE_BATCH_BLOCK ? count - start : D_TABLE_BATCH_BLOCK;
+        const uint8_t* block = key_bytes + start * table->key_size;
+
+        if (table->old_buckets) {
+            _d_ChainedRehashStep(table, table->rehash_step);
+        }
+        _d_TableHashBlock(table, block, n, hashes);
+
+        for (size_t i = 0; i < n; i++) {
+            const void* key = block + i * table->key_size;
+            const void* value = value_bytes + (start + i) * table->value_size;
+            if (table->mode == D_TABLE_MODE_FLAT) {
+                result |= _d_FlatSetHashed(table, key, value, hashes[i]);
+            } else if (table->mode == D_TABLE_MODE_COMPACT) {
+                result |= _d_CompactSetHashed(table, key, value, hashes[i]);
+            } else {
+                result |= _d_ChainedSetHashed(table, key, value, hashes[i]);
+            }
+        }
+    }
+
+    return result;
 }
 
 // =============================================================================
@@ -396,8 +1371,23 @@ int d_TableHasKey(const dTable_t* table, const void* key)
         return 1; // Not found / error
     }
 
-    // Compute hash and bucket index
-    size_t hash = table->hash_func(key, table->key_size);
+    return d_TableHasKeyHashed(table, key, table->hash_func(key, table->key_size));
+}
+
+int d_TableHasKeyHashed(const dTable_t* table, const void* key, size_t hash)
+{
+    if (!table || !key) {
+        d_LogError("Invalid parameters for checking key existence in hash table.");
+        return 1; // Not found / error
+    }
+
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        return (_d_FlatFind(table, key, d_HashMix(hash)) != SIZE_MAX) ? 0 : 1;
+    }
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        return (_d_CompactFind(table, key, d_HashMix(hash), NULL) != SIZE_MAX) ? 0 : 1;
+    }
+
     size_t bucket_index = hash % table->num_buckets;
 
     // Get bucket pointer
@@ -407,8 +1397,14 @@ int d_TableHasKey(const dTable_t* table, const void* key)
         return 1;
     }
 
-    // Find entry in bucket
-    dTableEntry_t* entry = _d_FindEntryInBucket(*bucket_ptr, key, table->key_size, table->compare_func);
+    // Find entry in bucket, falling back to the old array during migration
+    dTableEntry_t* entry = _d_FindEntryInBucket(*bucket_ptr, key, table->key_size, table->compare_func, hash);
+    if (!entry) {
+        dLinkedList_t** old_bucket_ptr = _d_OldBucketFor(table, hash);
+        if (old_bucket_ptr) {
+            entry = _d_FindEntryInBucket(*old_bucket_ptr, key, table->key_size, table->compare_func, hash);
+        }
+    }
 
     if (entry) {
         d_LogDebugF("Key found in hash table (bucket %zu).", bucket_index);
@@ -436,23 +1432,33 @@ int d_TableClear(dTable_t* table)
         return 1;
     }
 
-    // Clear all buckets
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
-        if (bucket_ptr && *bucket_ptr) {
-            // Manually destroy entries first, then the linked list structure
-            dLinkedList_t* current = *bucket_ptr;
-            while (current) {
-                dTableEntry_t* entry = (dTableEntry_t*)current->data;
-                if (entry) {
-                    _d_DestroyTableEntry(entry);
-                    current->data = NULL; // Prevent double free by linked list
-                }
-                current = current->next;
-            }
-            // Destroy the linked list
-            d_DestroyLinkedList(bucket_ptr);
-        }
+    table->version++;
+
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        memset(table->ctrl, D_TABLE_CTRL_EMPTY, table->num_buckets);
+        table->count = 0;
+        table->tombstones = 0;
+        return 0;
+    }
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        memset(table->index, 0xFF, table->num_buckets * table->index_width);
+        table->entries_used = 0;
+        table->count = 0;
+        table->tombstones = 0;
+        return 0;
+    }
+
+    // Clear all buckets; a pending migration is simply dropped
+    _d_FreeBucketChains(table, table->buckets, table->num_buckets);
+    if (table->old_buckets) {
+        _d_FreeBucketChains(table, table->old_buckets, table->old_num_buckets);
+        d_ArrayDestroy(table->old_buckets);
+        table->old_buckets = NULL;
+        table->old_num_buckets = 0;
+        table->rehash_index = 0;
+    }
+    if (table->node_pool) {
+        d_PoolReset(table->node_pool);
     }
 
     // Reset count
@@ -473,6 +1479,11 @@ int d_TableRehash(dTable_t* table, size_t new_num_buckets)
         return 1;
     }
 
+    // An explicit rehash first completes any migration that is still draining
+    if (table->old_buckets) {
+        _d_ChainedRehashStep(table, SIZE_MAX);
+    }
+
     // Auto-size if new_num_buckets is 0
     size_t actual_new_num_buckets = new_num_buckets;
     if (actual_new_num_buckets == 0) {
@@ -487,87 +1498,54 @@ int d_TableRehash(dTable_t* table, size_t new_num_buckets)
         return 1;
     }
 
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        size_t old_capacity = table->num_buckets;
+        if (_d_FlatResize(table, _d_FlatRoundCapacity(actual_new_num_buckets)) != 0) {
+            return 1;
+        }
+        d_LogInfoF("Rehashed flat table from %zu to %zu slots. Entries: %zu.",
+                   old_capacity, table->num_buckets, table->count);
+        return 0;
+    }
+
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        size_t old_capacity = table->num_buckets;
+        if (_d_CompactResize(table, _d_FlatRoundCapacity(actual_new_num_buckets)) != 0) {
+            return 1;
+        }
+        d_LogInfoF("Rehashed compact table from %zu to %zu index slots. Entries: %zu.",
+                   old_capacity, table->num_buckets, table->count);
+        return 0;
+    }
+
     // Allocate new buckets array
-    dArray_t* new_buckets_array = d_ArrayInit(actual_new_num_buckets, sizeof(dLinkedList_t*));
+    dArray_t* new_buckets_array = _d_CreateBucketArray(actual_new_num_buckets, table->allocator);
     if (!new_buckets_array) {
         d_LogError("Failed to allocate new buckets array for rehashing.");
         return 1;
     }
 
-    // Initialize all new bucket pointers to NULL
-    for (size_t i = 0; i < actual_new_num_buckets; i++) {
-        dLinkedList_t* null_ptr = NULL;
-        d_ArrayAppend(new_buckets_array, &null_ptr);
-    }
-
     // Preserve old table state
     dArray_t* old_buckets_array = table->buckets;
     size_t old_num_buckets = table->num_buckets;
-    size_t old_count = table->count;
 
-    // Update table with new buckets (reset count as we'll rebuild it)
     table->buckets = new_buckets_array;
     table->num_buckets = actual_new_num_buckets;
-    table->count = 0;
-
-    // Re-insert all existing entries into new buckets
-    for (size_t i = 0; i < old_num_buckets; i++) {
-        dLinkedList_t** old_bucket_ptr = (dLinkedList_t**)d_ArrayGet(old_buckets_array, i);
-        if (!old_bucket_ptr || !*old_bucket_ptr) {
-            continue; // Empty bucket
-        }
-
-        dLinkedList_t* current_node = *old_bucket_ptr;
-        while (current_node != NULL) {
-            dLinkedList_t* next_node = current_node->next; // Store next before modification
+    table->version++;
 
-            dTableEntry_t* entry = (dTableEntry_t*)current_node->data;
-            if (entry) {
-                // Calculate new hash and bucket index
-                size_t new_hash = table->hash_func(entry->key_data, table->key_size);
-                size_t new_bucket_index = new_hash % table->num_buckets;
-
-                // Get pointer to new bucket's head
-                dLinkedList_t** new_bucket_head_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, new_bucket_index);
-                if (new_bucket_head_ptr) {
-                    // Generate unique name for linked list storage
-                    char temp_name[64];
-                    _d_GenerateEntryName(entry, temp_name, sizeof(temp_name));
-
-                    // Re-add entry to new bucket
-                    if (d_PushBackToLinkedList(new_bucket_head_ptr, entry, temp_name, sizeof(dTableEntry_t)) == 0) {
-                        table->count++;
-                    } else {
-                        d_LogErrorF("Failed to re-insert entry during rehashing at bucket %zu.", new_bucket_index);
-                    }
-                }
-            }
-
-            current_node = next_node;
-        }
-    }
-
-    // Cleanup old buckets - free linked list nodes without freeing entry data
+    // Relink every node into its new bucket (no per-entry allocation)
     for (size_t i = 0; i < old_num_buckets; i++) {
         dLinkedList_t** old_bucket_ptr = (dLinkedList_t**)d_ArrayGet(old_buckets_array, i);
         if (old_bucket_ptr && *old_bucket_ptr) {
-            dLinkedList_t* current_old_node = *old_bucket_ptr;
-            while (current_old_node != NULL) {
-                dLinkedList_t* temp_free = current_old_node;
-                current_old_node = current_old_node->next;
-                
-                // CRITICAL: Prevent double-free by nulling data before freeing node
-                temp_free->data = NULL;
-                free(temp_free);
-            }
+            _d_MigrateBucket(table, old_bucket_ptr);
         }
     }
 
     // Destroy old buckets array
     d_ArrayDestroy(old_buckets_array);
 
-    d_LogInfoF("Rehashed table from %zu to %zu buckets. Entries: %zu (expected: %zu).",
-               old_num_buckets, actual_new_num_buckets, table->count, old_count);
+    d_LogInfoF("Rehashed table from %zu to %zu buckets. Entries: %zu.",
+               old_num_buckets, actual_new_num_buckets, table->count);
 
     return 0;
 }
@@ -589,14 +1567,43 @@ dArray_t* d_TableGetAllKeys(const dTable_t* table)
 
     size_t keys_collected = 0;
 
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        for (size_t i = 0; i < table->num_buckets; i++) {
+            if (D_TABLE_CTRL_IS_FULL(table->ctrl[i])) {
+                if (d_ArrayAppend(all_keys_array, _d_FlatSlotKey(table, i)) != 0) {
+                    d_LogErrorF("Failed to append key to result array at slot %zu.", i);
+                    d_ArrayDestroy(all_keys_array);
+                    return NULL;
+                }
+                keys_collected++;
+            }
+        }
+        d_LogDebugF("Collected %zu keys from flat hash table (expected: %zu).", keys_collected, table->count);
+        return all_keys_array;
+    }
+
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        for (size_t i = 0; i < table->entries_used; i++) {
+            if (table->ctrl[i] != D_TABLE_CTRL_DELETED) {
+                if (d_ArrayAppend(all_keys_array, _d_FlatSlotKey(table, i)) != 0) {
+                    d_LogErrorF("Failed to append key to result array at entry %zu.", i);
+                    d_ArrayDestroy(all_keys_array);
+                    return NULL;
+                }
+                keys_collected++;
+            }
+        }
+        d_LogDebugF("Collected %zu keys from compact hash table (expected: %zu).", keys_collected, table->count);
+        return all_keys_array;
+    }
+
     // Iterate through all buckets
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
-        if (!bucket_ptr || !*bucket_ptr) {
+    for (size_t i = 0; i < _d_ChainedTotalBuckets(table); i++) {
+        dLinkedList_t* current_node = _d_ChainedBucketAt(table, i);
+        if (!current_node) {
             continue; // Empty bucket
         }
 
-        dLinkedList_t* current_node = *bucket_ptr;
         while (current_node != NULL) {
             dTableEntry_t* entry = (dTableEntry_t*)current_node->data;
             if (entry && entry->key_data) {
@@ -633,14 +1640,43 @@ dArray_t* d_TableGetAllValues(const dTable_t* table)
 
     size_t values_collected = 0;
 
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        for (size_t i = 0; i < table->num_buckets; i++) {
+            if (D_TABLE_CTRL_IS_FULL(table->ctrl[i])) {
+                if (d_ArrayAppend(all_values_array, _d_FlatSlotValue(table, i)) != 0) {
+                    d_LogErrorF("Failed to append value to result array at slot %zu.", i);
+                    d_ArrayDestroy(all_values_array);
+                    return NULL;
+                }
+                values_collected++;
+            }
+        }
+        d_LogDebugF("Collected %zu values from flat hash table (expected: %zu).", values_collected, table->count);
+        return all_values_array;
+    }
+
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        for (size_t i = 0; i < table->entries_used; i++) {
+            if (table->ctrl[i] != D_TABLE_CTRL_DELETED) {
+                if (d_ArrayAppend(all_values_array, _d_FlatSlotValue(table, i)) != 0) {
+                    d_LogErrorF("Failed to append value to result array at entry %zu.", i);
+                    d_ArrayDestroy(all_values_array);
+                    return NULL;
+                }
+                values_collected++;
+            }
+        }
+        d_LogDebugF("Collected %zu values from compact hash table (expected: %zu).", values_collected, table->count);
+        return all_values_array;
+    }
+
     // Iterate through all buckets
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
-        if (!bucket_ptr || !*bucket_ptr) {
+    for (size_t i = 0; i < _d_ChainedTotalBuckets(table); i++) {
+        dLinkedList_t* current_node = _d_ChainedBucketAt(table, i);
+        if (!current_node) {
             continue; // Empty bucket
         }
 
-        dLinkedList_t* current_node = *bucket_ptr;
         while (current_node != NULL) {
             dTableEntry_t* entry = (dTableEntry_t*)current_node->data;
             if (entry && entry->value_data) {
@@ -664,7 +1700,8 @@ dArray_t* d_TableGetAllValues(const dTable_t* table)
  * @brief Iterate over all entries in the hash table
  *
  * Calls the provided callback function for each key-value pair in the table.
- * The iteration order is not guaranteed (depends on hash distribution).
+ * The iteration order is not guaranteed (depends on hash distribution), except in
+ * COMPACT mode, which visits entries in insertion order.
  *
  * @param table The hash table to iterate
  * @param callback Function to call for each entry
@@ -688,6 +1725,28 @@ void d_TableForEach(dTable_t* table, dTableIteratorFunc callback, void* user_dat
         return;
     }
 
+    if (table->mode == D_TABLE_MODE_FLAT) {
+        for (size_t i = 0; i < table->num_buckets; i++) {
+            if (D_TABLE_CTRL_IS_FULL(table->ctrl[i])) {
+                callback(_d_FlatSlotKey(table, i), table->key_size,
+                         _d_FlatSlotValue(table, i), table->value_size,
+                         user_data);
+            }
+        }
+        return;
+    }
+
+    if (table->mode == D_TABLE_MODE_COMPACT) {
+        for (size_t i = 0; i < table->entries_used; i++) {
+            if (table->ctrl[i] != D_TABLE_CTRL_DELETED) {
+                callback(_d_FlatSlotKey(table, i), table->key_size,
+                         _d_FlatSlotValue(table, i), table->value_size,
+                         user_data);
+            }
+        }
+        return;
+    }
+
     if (table->buckets == NULL) {
         d_LogWarning("Cannot iterate: table buckets are NULL.");
         return;
@@ -698,15 +1757,13 @@ void d_TableForEach(dTable_t* table, dTableIteratorFunc callback, void* user_dat
     size_t entries_visited = 0;
 
     // Iterate through each bucket
-    for (size_t i = 0; i < table->num_buckets; i++) {
-        dLinkedList_t** bucket_ptr = (dLinkedList_t**)d_ArrayGet(table->buckets, i);
+    for (size_t i = 0; i < _d_ChainedTotalBuckets(table); i++) {
+        dLinkedList_t* current_node = _d_ChainedBucketAt(table, i);
 
-        if (bucket_ptr == NULL || *bucket_ptr == NULL) {
+        if (current_node == NULL) {
             continue; // Empty bucket
         }
 
-        dLinkedList_t* current_node = *bucket_ptr;
-
         // Walk the linked list in this bucket
         while (current_node != NULL) {
             dTableEntry_t* entry = (dTableEntry_t*)current_node->data;
@@ -727,3 +1784,59 @@ void d_TableForEach(dTable_t* table, dTableIteratorFunc callback, void* user_dat
                 entries_visited, table->count);
 }
 
+
+// =============================================================================
+// CURSOR ITERATION
+// =============================================================================
+
+dTableIter_t d_TableIterBegin(const dTable_t* table)
+{
+    dTableIter_t iter = { table, 0, NULL, table ? table->version : 0 };
+    return iter;
+}
+
+bool _d_TableIterNext_impl(dTableIter_t* iter, const void** out_key, void** out_value,
+                           const char* file, int line, const char* func)
+{
+    if (!iter || !iter->table) {
+        return false;
+    }
+
+    const dTable_t* table = (const dTable_t*)iter->table;
+#ifndef NDEBUG
+    D_ASSERT(iter->version == table->version,
+             "d_TableIterNext: table was modified during iteration", file, line, func);
+#else
+    (void)file; (void)line; (void)func;
+#endif
+
+    if (table->mode == D_TABLE_MODE_FLAT || table->mode == D_TABLE_MODE_COMPACT) {
+        bool compact = (table->mode == D_TABLE_MODE_COMPACT);
+        size_t end = compact ? table->entries_used : table->num_buckets;
+        while (iter->position < end) {
+            size_t i = iter->position++;
+            bool live = compact ? table->ctrl[i] != D_TABLE_CTRL_DELETED : D_TABLE_CTRL_IS_FULL(table->ctrl[i]);
+            if (live) {
+                if (out_key) *out_key = _d_FlatSlotKey(table, i);
+                if (out_value) *out_value = _d_FlatSlotValue(table, i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // `node` is the next node to yield; refill it from the following non-empty bucket
+    size_t total = _d_ChainedTotalBuckets(table);
+    while (!iter->node && iter->position < total) {
+        iter->node = _d_ChainedBucketAt(table, iter->position++);
+    }
+    if (!iter->node) {
+        return false;
+    }
+
+    dTableEntry_t* entry = (dTableEntry_t*)iter->node->data;
+    iter->node = iter->node->next;
+    if (out_key) *out_key = entry->key_data;
+    if (out_value) *out_value = entry->value_data;
+    return true;
+}
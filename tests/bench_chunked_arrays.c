@@ -0,0 +1,62 @@
+/* bench_chunked_arrays.c - Append latency of a doubling dArray_t vs dChunkedArray_t */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Worst single append shows the copy spike a doubling dArray_t pays when it grows
+static void bench_chunked_array(void)
+{
+    enum { APPENDS = 20000000 };
+    double t0, t1, worst;
+
+    dArray_t* array = d_ArrayInit(16, sizeof(int));
+    worst = 0.0;
+    double start = now_seconds();
+    for (int i = 0; i < APPENDS; i++) {
+        t0 = now_seconds();
+        d_ArrayAppend(array, &i);
+        t1 = now_seconds();
+        worst = MAX(worst, t1 - t0);
+    }
+    double array_time = now_seconds() - start;
+    double array_worst = worst;
+    d_ArrayDestroy(array);
+
+    dChunkedArray_t* chunked = d_ChunkedArrayInit(sizeof(int), 0);
+    worst = 0.0;
+    start = now_seconds();
+    for (int i = 0; i < APPENDS; i++) {
+        t0 = now_seconds();
+        d_ChunkedArrayAppend(chunked, &i);
+        t1 = now_seconds();
+        worst = MAX(worst, t1 - t0);
+    }
+    double chunked_time = now_seconds() - start;
+    double chunked_worst = worst;
+    d_ChunkedArrayDestroy(&chunked);
+
+    printf("append:        %7.1f ms dArray (worst %6.3f ms), %7.1f ms chunked (worst %6.3f ms), %d ints\n",
+           array_time * 1e3, array_worst * 1e3, chunked_time * 1e3, chunked_worst * 1e3, APPENDS);
+}
+
+int main(void)
+{
+    printf("=== dChunkedArray Benchmark ===\n\n");
+
+    // Quiet the per-operation debug logging so it doesn't dominate the timings
+    d_SetLoggingEnabled(false);
+
+    bench_chunked_array();
+    return 0;
+}
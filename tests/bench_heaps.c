@@ -0,0 +1,92 @@
+/* bench_heaps.c - Binary vs 4-ary dHeap_t under an A*-shaped workload */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// xorshift32; deterministic so runs are comparable
+static unsigned int rng_state = 0x9E3779B9u;
+static unsigned int next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+typedef struct {
+    float cost;
+    uint32_t id;
+} bench_heap_node_t;
+
+static int bench_heap_compare(const void* a, const void* b, void* user_data)
+{
+    (void)user_data;
+    float ca = ((const bench_heap_node_t*)a)->cost;
+    float cb = ((const bench_heap_node_t*)b)->cost;
+    return (ca > cb) - (ca < cb);
+}
+
+// A*-shaped load: every pop pushes a few successors and lowers the cost of an open node
+static double bench_heap_run(unsigned arity, dSlotHandle_t* handles)
+{
+    enum { HEAP_NODES = 1000000 };
+    dHeap_t* heap = d_HeapInit(sizeof(bench_heap_node_t), 1024, arity, bench_heap_compare, NULL);
+    bench_heap_node_t node = { 0.0f, 0 };
+    uint32_t next_id = 1;
+    handles[0] = d_HeapPush(heap, &node);
+
+    double t0 = now_seconds();
+    while (d_HeapPop(heap, &node) == 0) {
+        for (int s = 0; s < 3 && next_id < HEAP_NODES; s++) {
+            bench_heap_node_t successor = { node.cost + (float)(next_random() % 1000), next_id };
+            handles[next_id++] = d_HeapPush(heap, &successor);
+        }
+        uint32_t target = next_random() % next_id;
+        bench_heap_node_t* open = (bench_heap_node_t*)d_HeapGet(heap, handles[target]);
+        if (open) {
+            bench_heap_node_t lowered = { open->cost - (float)(next_random() % 100), target };
+            if (lowered.cost >= node.cost) {
+                d_HeapDecreaseKey(heap, handles[target], &lowered);
+            }
+        }
+    }
+    double t1 = now_seconds();
+    d_HeapDestroy(&heap);
+    return t1 - t0;
+}
+
+static void bench_heap(void)
+{
+    dSlotHandle_t* handles = (dSlotHandle_t*)malloc(1000000 * sizeof(dSlotHandle_t));
+    if (!handles) {
+        fprintf(stderr, "allocation failed\n");
+        return;
+    }
+    double binary_time = bench_heap_run(2, handles);
+    double quaternary_time = bench_heap_run(4, handles);
+    printf("heap:          %7.1f ms binary, %7.1f ms 4-ary (1M nodes, push/pop/decrease-key)\n",
+           binary_time * 1e3, quaternary_time * 1e3);
+    free(handles);
+}
+
+int main(void)
+{
+    printf("=== dHeap Benchmark ===\n\n");
+
+    // Quiet the per-operation debug logging so it doesn't dominate the timings
+    d_SetLoggingEnabled(false);
+
+    bench_heap();
+    return 0;
+}
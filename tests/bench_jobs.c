@@ -0,0 +1,79 @@
+/* bench_jobs.c - Serial vs job-system parallel-for over a dArray_t of bodies */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Per-frame entity update over a 200k-element dArray_t, serial vs spread over the job system
+static void bench_update_bodies(void* elements, size_t first, size_t count, void* user_data)
+{
+    (void)first;
+    const float dt = *(const float*)user_data;
+    dKinematicBody_t* bodies = (dKinematicBody_t*)elements;
+    for (size_t i = 0; i < count; i++) {
+        dKinematicBody_t* b = &bodies[i];
+        b->acceleration.x = b->force.x / b->mass;
+        b->acceleration.y = b->force.y / b->mass;
+        b->acceleration.z = b->force.z / b->mass;
+        b->velocity.x += b->acceleration.x * dt;
+        b->velocity.y += b->acceleration.y * dt;
+        b->velocity.z += b->acceleration.z * dt;
+        b->position.x += b->velocity.x * dt;
+        b->position.y += b->velocity.y * dt;
+        b->position.z += b->velocity.z * dt;
+    }
+}
+
+static void bench_parallel_for(void)
+{
+    enum { ENTITIES = 200000, FRAMES = 100 };
+    float dt = 1.0f / 60.0f;
+    double t0, t1;
+
+    dArray_t* bodies = d_ArrayInit(ENTITIES, sizeof(dKinematicBody_t));
+    for (int i = 0; i < ENTITIES; i++) {
+        dKinematicBody_t body = { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 1.0f, (float)(i % 7), 0.5f }, 2.0f };
+        d_ArrayAppend(bodies, &body);
+    }
+
+    t0 = now_seconds();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        d_ArrayParallelFor(NULL, bodies, 0, bench_update_bodies, &dt);
+    }
+    t1 = now_seconds();
+    double serial_time = t1 - t0;
+
+    dJobSystem_t* jobs = d_JobSystemInit(0);
+    t0 = now_seconds();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        d_ArrayParallelFor(jobs, bodies, 0, bench_update_bodies, &dt);
+    }
+    t1 = now_seconds();
+    double parallel_time = t1 - t0;
+
+    printf("parallel for:  %7.3f ms serial, %7.3f ms on %zu workers + caller (per frame, %d bodies)\n",
+           serial_time * 1e3 / FRAMES, parallel_time * 1e3 / FRAMES, d_JobSystemGetWorkerCount(jobs), ENTITIES);
+    d_JobSystemDestroy(&jobs);
+    d_ArrayDestroy(bodies);
+}
+
+int main(void)
+{
+    printf("=== dJobSystem Benchmark ===\n\n");
+
+    // Quiet the per-operation debug logging so it doesn't dominate the timings
+    d_SetLoggingEnabled(false);
+
+    bench_parallel_for();
+    return 0;
+}
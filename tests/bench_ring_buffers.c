@@ -0,0 +1,102 @@
+/* bench_ring_buffers.c - Cross-thread message throughput of SPSC and MPMC dRingBuffer_t queues */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Cross-thread handoff through a ring buffer, one message or one batch per call
+enum { RING_BENCH_MESSAGES = 10000000, RING_BENCH_BATCH = 64 };
+
+typedef struct {
+    dRingBuffer_t* ring;
+    size_t batch;
+    size_t messages;
+} ring_bench_t;
+
+static void* ring_bench_producer(void* arg)
+{
+    ring_bench_t* b = (ring_bench_t*)arg;
+    uint64_t values[RING_BENCH_BATCH];
+    for (size_t sent = 0; sent < b->messages;) {
+        size_t n = MIN(b->batch, b->messages - sent);
+        for (size_t i = 0; i < n; i++) {
+            values[i] = sent + i;
+        }
+        size_t done = d_RingBufferEnqueueBatch(b->ring, values, n);
+        if (done == 0) {
+            sched_yield();  // Full: let the consumer run
+        }
+        sent += done;
+    }
+    return NULL;
+}
+
+static void* ring_bench_consumer(void* arg)
+{
+    ring_bench_t* b = (ring_bench_t*)arg;
+    uint64_t values[RING_BENCH_BATCH];
+    uint64_t sum = 0;
+    for (size_t received = 0; received < b->messages;) {
+        size_t n = d_RingBufferDequeueBatch(b->ring, values, MIN(b->batch, b->messages - received));
+        if (n == 0) {
+            sched_yield();  // Empty: let the producer run
+        }
+        for (size_t i = 0; i < n; i++) {
+            sum += values[i];
+        }
+        received += n;
+    }
+    return (void*)(uintptr_t)sum;
+}
+
+static double ring_bench_run(dRingBufferMode_t mode, size_t batch, int pairs)
+{
+    dRingBuffer_t* ring = d_RingBufferInit(4096, sizeof(uint64_t), mode);
+    ring_bench_t work = { ring, batch, RING_BENCH_MESSAGES / pairs };
+    pthread_t producers[2], consumers[2];
+    double t0 = now_seconds();
+    for (int p = 0; p < pairs; p++) {
+        pthread_create(&producers[p], NULL, ring_bench_producer, &work);
+        pthread_create(&consumers[p], NULL, ring_bench_consumer, &work);
+    }
+    for (int p = 0; p < pairs; p++) {
+        pthread_join(producers[p], NULL);
+        pthread_join(consumers[p], NULL);
+    }
+    double elapsed = now_seconds() - t0;
+    d_RingBufferDestroy(&ring);
+    return (double)work.messages * pairs / elapsed / 1e6;
+}
+
+static void bench_ring(void)
+{
+    printf("ring spsc:     %7.1f M msg/s single, %7.1f M msg/s batch of %d\n",
+           ring_bench_run(D_RING_BUFFER_SPSC, 1, 1), ring_bench_run(D_RING_BUFFER_SPSC, RING_BENCH_BATCH, 1),
+           RING_BENCH_BATCH);
+    printf("ring mpmc 2x2: %7.1f M msg/s single, %7.1f M msg/s batch of %d\n",
+           ring_bench_run(D_RING_BUFFER_MPMC, 1, 2), ring_bench_run(D_RING_BUFFER_MPMC, RING_BENCH_BATCH, 2),
+           RING_BENCH_BATCH);
+}
+
+int main(void)
+{
+    printf("=== dRingBuffer Benchmark ===\n\n");
+
+    // Quiet the per-operation debug logging so it doesn't dominate the timings
+    d_SetLoggingEnabled(false);
+
+    bench_ring();
+    return 0;
+}
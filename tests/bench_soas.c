@@ -0,0 +1,86 @@
+/* bench_soas.c - Position integration over array-of-structs vs dSoA_t columns */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// xorshift32; deterministic so runs are comparable
+static unsigned int rng_state = 0x9E3779B9u;
+static unsigned int next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Integrate positions from velocities: the same pass over dKinematicBody_t structs and over dSoA_t columns
+static void bench_soa(void)
+{
+    enum { BODIES = 1 << 20, PASSES = 20 };
+    const float dt = 1.0f / 60.0f;
+    double t0, t1;
+
+    dKinematicBody_t* bodies = (dKinematicBody_t*)calloc(BODIES, sizeof(dKinematicBody_t));
+    dSoAField_t fields[] = { { sizeof(dVec3_t), 0 }, { sizeof(dVec3_t), 0 }, { sizeof(dVec3_t), 0 },
+                             { sizeof(dVec3_t), 0 }, { sizeof(float), 0 } };
+    dSoA_t* soa = d_SoAInit(fields, 5, BODIES);
+    for (int i = 0; i < BODIES; i++) {
+        bodies[i].velocity.x = (float)(next_random() % 100);
+        bodies[i].mass = 1.0f;
+        const void* row[] = { &bodies[i].position, &bodies[i].velocity, &bodies[i].acceleration,
+                              &bodies[i].force, &bodies[i].mass };
+        d_SoAAppend(soa, row);
+    }
+
+    t0 = now_seconds();
+    for (int pass = 0; pass < PASSES; pass++) {
+        for (int i = 0; i < BODIES; i++) {
+            bodies[i].position.x += bodies[i].velocity.x * dt;
+            bodies[i].position.y += bodies[i].velocity.y * dt;
+            bodies[i].position.z += bodies[i].velocity.z * dt;
+        }
+    }
+    t1 = now_seconds();
+    double aos_time = t1 - t0;
+
+    t0 = now_seconds();
+    for (int pass = 0; pass < PASSES; pass++) {
+        dVec3_t* pos = (dVec3_t*)d_SoAGetColumn(soa, 0);
+        const dVec3_t* vel = (const dVec3_t*)d_SoAGetColumn(soa, 1);
+        for (int i = 0; i < BODIES; i++) {
+            pos[i].x += vel[i].x * dt;
+            pos[i].y += vel[i].y * dt;
+            pos[i].z += vel[i].z * dt;
+        }
+    }
+    t1 = now_seconds();
+    double soa_time = t1 - t0;
+
+    int mismatch = ((dVec3_t*)d_SoAGet(soa, 0, BODIES - 1))->x != bodies[BODIES - 1].position.x;
+    printf("position pass: %7.3f ms AoS structs, %7.3f ms SoA columns (per pass, %d bodies)%s\n",
+           aos_time * 1e3 / PASSES, soa_time * 1e3 / PASSES, BODIES, mismatch ? " MISMATCH" : "");
+    d_SoADestroy(&soa);
+    free(bodies);
+}
+
+int main(void)
+{
+    printf("=== dSoA Benchmark ===\n\n");
+
+    // Quiet the per-operation debug logging so it doesn't dominate the timings
+    d_SetLoggingEnabled(false);
+
+    bench_soa();
+    return 0;
+}
@@ -0,0 +1,101 @@
+/* bench_sorts.c - qsort vs comparator, parallel and radix array sorts */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// xorshift32; deterministic so runs are comparable
+static unsigned int rng_state = 0x9E3779B9u;
+static unsigned int next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static int bench_compare_u64(const void* a, const void* b)
+{
+    uint64_t ka = *(const uint64_t*)a;
+    uint64_t kb = *(const uint64_t*)b;
+    return (ka > kb) - (ka < kb);
+}
+
+static int bench_sort_compare_u64(const void* a, const void* b, void* user_data)
+{
+    (void)user_data;
+    return bench_compare_u64(a, b);
+}
+
+static void bench_sort(void)
+{
+    enum { SORT_KEYS = 10000000 };
+    double t0, t1;
+
+    uint64_t* source = (uint64_t*)malloc(SORT_KEYS * sizeof(uint64_t));
+    dArray_t* array = d_ArrayInit(SORT_KEYS, sizeof(uint64_t));
+    if (!source || !array) {
+        fprintf(stderr, "allocation failed\n");
+        free(source);
+        return;
+    }
+    // Render-key shaped: a few high bits of layer/material, the rest depth
+    for (size_t i = 0; i < SORT_KEYS; i++) {
+        source[i] = (uint64_t)(next_random() & 0xFFFF) << 32 | next_random();
+    }
+    array->count = SORT_KEYS;
+
+    memcpy(array->data, source, SORT_KEYS * sizeof(uint64_t));
+    t0 = now_seconds();
+    qsort(array->data, SORT_KEYS, sizeof(uint64_t), bench_compare_u64);
+    t1 = now_seconds();
+    double qsort_time = t1 - t0;
+
+    memcpy(array->data, source, SORT_KEYS * sizeof(uint64_t));
+    t0 = now_seconds();
+    d_ArraySort(array, bench_sort_compare_u64, NULL);
+    t1 = now_seconds();
+    double merge_time = t1 - t0;
+
+    dJobSystem_t* jobs = d_JobSystemInit(0);
+    memcpy(array->data, source, SORT_KEYS * sizeof(uint64_t));
+    t0 = now_seconds();
+    d_ArraySortParallel(jobs, array, bench_sort_compare_u64, NULL);
+    t1 = now_seconds();
+    double parallel_time = t1 - t0;
+
+    memcpy(array->data, source, SORT_KEYS * sizeof(uint64_t));
+    t0 = now_seconds();
+    d_ArrayRadixSort(array, d_SortKeyUInt64, NULL);
+    t1 = now_seconds();
+    double radix_time = t1 - t0;
+
+    printf("sort:          %7.1f ms qsort, %7.1f ms merge, %7.1f ms merge on %zu workers + caller, "
+           "%7.1f ms radix (%d keys)\n",
+           qsort_time * 1e3, merge_time * 1e3, parallel_time * 1e3, d_JobSystemGetWorkerCount(jobs),
+           radix_time * 1e3, SORT_KEYS);
+    d_JobSystemDestroy(&jobs);
+    d_ArrayDestroy(array);
+    free(source);
+}
+
+int main(void)
+{
+    printf("=== Sort Benchmark ===\n\n");
+
+    // Quiet the per-operation debug logging so it doesn't dominate the timings
+    d_SetLoggingEnabled(false);
+
+    bench_sort();
+    return 0;
+}
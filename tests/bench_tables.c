@@ -0,0 +1,279 @@
+/* bench_tables.c - Throughput of batched vs single-key, typed vs generic dTable operations and static table modes */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_KEYS (1u << 20)  // 1M keys
+#define BENCH_LOOKUP_BATCH 256 // Keys resolved per d_TableGetBatch call
+
+D_TABLE_DEFINE(BenchIntMap, int, int, D_TABLE_HASH_INT, D_TABLE_EQ_VALUE)
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// xorshift32; deterministic so runs are comparable
+static unsigned int rng_state = 0x9E3779B9u;
+static unsigned int next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void bench_mode(const char* name, dTableMode_t mode, const int* keys, const int* lookups, void** out)
+{
+    double t0, t1;
+    long long checksum = 0;
+
+    // --- Insert ---
+    dTable_t* single = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 16, mode);
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        d_TableSet(single, &keys[i], &keys[i]);
+    }
+    t1 = now_seconds();
+    double set_single = t1 - t0;
+
+    dTable_t* batch = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 16, mode);
+    t0 = now_seconds();
+    d_TableSetBatch(batch, keys, keys, BENCH_KEYS);
+    t1 = now_seconds();
+    double set_batch = t1 - t0;
+
+    // --- Lookup (random order, so nearly every probe misses cache) ---
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        int* value = (int*)d_TableGet(single, &lookups[i]);
+        checksum += value ? *value : 0;
+    }
+    t1 = now_seconds();
+    double get_single = t1 - t0;
+
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i += BENCH_LOOKUP_BATCH) {
+        d_TableGetBatch(single, &lookups[i], BENCH_LOOKUP_BATCH, out);
+        for (size_t j = 0; j < BENCH_LOOKUP_BATCH; j++) {
+            checksum -= out[j] ? *(int*)out[j] : 0;
+        }
+    }
+    t1 = now_seconds();
+    double get_batch = t1 - t0;
+
+    printf("%-8s set: %7.1f ns/key single, %7.1f ns/key batch (%.2fx)\n", name,
+           set_single * 1e9 / BENCH_KEYS, set_batch * 1e9 / BENCH_KEYS, set_single / set_batch);
+    printf("%-8s get: %7.1f ns/key single, %7.1f ns/key batch (%.2fx)\n", name,
+           get_single * 1e9 / BENCH_KEYS, get_batch * 1e9 / BENCH_KEYS, get_single / get_batch);
+    if (checksum != 0) {
+        printf("  !! batch and single lookups disagree\n");
+    }
+
+    d_TableDestroy(&single);
+    d_TableDestroy(&batch);
+}
+
+static void bench_typed(const int* keys, const int* lookups)
+{
+    double t0, t1;
+    long long checksum = 0;
+
+    dTable_t* generic = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 16, D_TABLE_MODE_FLAT);
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        d_TableSet(generic, &keys[i], &keys[i]);
+    }
+    t1 = now_seconds();
+    double set_generic = t1 - t0;
+
+    BenchIntMap_t* typed = BenchIntMap_Init(16);
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        BenchIntMap_Set(typed, keys[i], keys[i]);
+    }
+    t1 = now_seconds();
+    double set_typed = t1 - t0;
+
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        int* value = (int*)d_TableGet(generic, &lookups[i]);
+        checksum += value ? *value : 0;
+    }
+    t1 = now_seconds();
+    double get_generic = t1 - t0;
+
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        int* value = BenchIntMap_Get(typed, lookups[i]);
+        checksum -= value ? *value : 0;
+    }
+    t1 = now_seconds();
+    double get_typed = t1 - t0;
+
+    printf("typed    set: %7.1f ns/key generic, %7.1f ns/key typed (%.2fx)\n",
+           set_generic * 1e9 / BENCH_KEYS, set_typed * 1e9 / BENCH_KEYS, set_generic / set_typed);
+    printf("typed    get: %7.1f ns/key generic, %7.1f ns/key typed (%.2fx)\n",
+           get_generic * 1e9 / BENCH_KEYS, get_typed * 1e9 / BENCH_KEYS, get_generic / get_typed);
+    if (checksum != 0) {
+        printf("  !! typed and generic lookups disagree\n");
+    }
+
+    d_TableDestroy(&generic);
+    BenchIntMap_Destroy(&typed);
+}
+
+static void bench_static(const int* lookups)
+{
+    double t0, t1;
+    long long checksum = 0;
+
+    // Static tables reject duplicates, so use distinct keys; lookups[] indexes into them
+    int* keys = (int*)malloc(BENCH_KEYS * sizeof(int));
+    const void** key_ptrs = (const void**)malloc(BENCH_KEYS * sizeof(void*));
+    if (!keys || !key_ptrs) {
+        fprintf(stderr, "allocation failed\n");
+        free(keys);
+        free(key_ptrs);
+        return;
+    }
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        keys[i] = (int)(i * 7919u);
+        key_ptrs[i] = &keys[i];
+    }
+
+    t0 = now_seconds();
+    dStaticTable_t* chained = d_InitStaticTable(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, BENCH_KEYS,
+                                                key_ptrs, key_ptrs, BENCH_KEYS);
+    t1 = now_seconds();
+    double build_chained = t1 - t0;
+
+    t0 = now_seconds();
+    dStaticTable_t* parallel = d_InitStaticTableParallel(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                         BENCH_KEYS, key_ptrs, key_ptrs, BENCH_KEYS, 0);
+    t1 = now_seconds();
+    double build_parallel = t1 - t0;
+    d_StaticTableDestroy(&parallel);
+
+    t0 = now_seconds();
+    dStaticTable_t* perfect = d_InitStaticTablePerfect(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                       key_ptrs, key_ptrs, BENCH_KEYS);
+    t1 = now_seconds();
+    double build_perfect = t1 - t0;
+
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        int* value = (int*)d_StaticTableGet(chained, &keys[(unsigned)lookups[i] % BENCH_KEYS]);
+        checksum += value ? *value : 0;
+    }
+    t1 = now_seconds();
+    double get_chained = t1 - t0;
+
+    t0 = now_seconds();
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        int* value = (int*)d_StaticTableGet(perfect, &keys[(unsigned)lookups[i] % BENCH_KEYS]);
+        checksum -= value ? *value : 0;
+    }
+    t1 = now_seconds();
+    double get_perfect = t1 - t0;
+
+    printf("static build: %7.1f ns/key chained, %7.1f ns/key chained parallel, %7.1f ns/key perfect\n",
+           build_chained * 1e9 / BENCH_KEYS, build_parallel * 1e9 / BENCH_KEYS, build_perfect * 1e9 / BENCH_KEYS);
+    printf("static   get: %7.1f ns/key chained, %7.1f ns/key perfect (%.2fx)\n",
+           get_chained * 1e9 / BENCH_KEYS, get_perfect * 1e9 / BENCH_KEYS, get_chained / get_perfect);
+    if (checksum != 0) {
+        printf("  !! chained and perfect lookups disagree\n");
+    }
+
+    // --- Disk: chained files are re-inserted on load, perfect (version 2) files are mapped ---
+    const char* chained_path = "/tmp/daedalus_bench_chained.bin";
+    const char* perfect_path = "/tmp/daedalus_bench_perfect.bin";
+    t0 = now_seconds();
+    d_StaticTableSaveToFile(chained_path, chained);
+    t1 = now_seconds();
+    double save_chained = t1 - t0;
+
+    t0 = now_seconds();
+    d_StaticTableSaveToFile(perfect_path, perfect);
+    t1 = now_seconds();
+    double save_perfect = t1 - t0;
+
+    t0 = now_seconds();
+    dStaticTable_t* loaded = d_LoadStaticTableFromFile(chained_path, d_HashInt, d_CompareInt);
+    t1 = now_seconds();
+    double load_chained = t1 - t0;
+
+    t0 = now_seconds();
+    dStaticTable_t* mapped = d_MapStaticTableFromFile(perfect_path, d_HashInt, d_CompareInt);
+    t1 = now_seconds();
+    double load_mapped = t1 - t0;
+
+    // Async: the caller only pays for the snapshot
+    t0 = now_seconds();
+    dAsyncSave_t* async_chained = d_StaticTableSaveToFileAsync(chained_path, chained, NULL, NULL);
+    t1 = now_seconds();
+    double async_chained_cost = t1 - t0;
+    d_AsyncSaveDestroy(&async_chained);
+
+    t0 = now_seconds();
+    dAsyncSave_t* async_perfect = d_StaticTableSaveToFileAsync(perfect_path, perfect, NULL, NULL);
+    t1 = now_seconds();
+    double async_perfect_cost = t1 - t0;
+    d_AsyncSaveDestroy(&async_perfect);
+
+    printf("static  save: %7.1f ms chained, %7.1f ms perfect (buffered, checksummed, fsync + rename)\n",
+           save_chained * 1e3, save_perfect * 1e3);
+    printf("static async: %7.1f ms chained, %7.1f ms perfect on the calling thread\n",
+           async_chained_cost * 1e3, async_perfect_cost * 1e3);
+    printf("static  load: %7.1f ms chained, %7.3f ms mapped perfect\n", load_chained * 1e3, load_mapped * 1e3);
+
+    d_StaticTableDestroy(&loaded);
+    d_StaticTableDestroy(&mapped);
+    remove(chained_path);
+    remove(perfect_path);
+    d_StaticTableDestroy(&chained);
+    d_StaticTableDestroy(&perfect);
+    free(keys);
+    free(key_ptrs);
+}
+
+int main(void)
+{
+    printf("=== dTable Benchmark (%u keys) ===\n\n", BENCH_KEYS);
+
+    // Quiet the per-operation debug logging so it doesn't dominate the timings
+    d_SetLoggingEnabled(false);
+
+    int* keys = (int*)malloc(BENCH_KEYS * sizeof(int));
+    int* lookups = (int*)malloc(BENCH_KEYS * sizeof(int));
+    void** out = (void**)malloc(BENCH_LOOKUP_BATCH * sizeof(void*));
+    if (!keys || !lookups || !out) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        keys[i] = (int)(next_random() & 0x7FFFFFFF);
+    }
+    for (size_t i = 0; i < BENCH_KEYS; i++) {
+        lookups[i] = keys[next_random() % BENCH_KEYS];
+    }
+
+    // Flat first: tearing down a million chained nodes leaves the heap fragmented,
+    // which would otherwise inflate the flat table's growth timings
+    bench_mode("flat", D_TABLE_MODE_FLAT, keys, lookups, out);
+    bench_typed(keys, lookups);
+    bench_static(lookups);
+    bench_mode("chained", D_TABLE_MODE_CHAINED, keys, lookups, out);
+
+    free(keys);
+    free(lookups);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,244 @@
+/* test_allocators.c - Test program for dAllocator_t and the containers that allocate through it */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+typedef struct {
+    long live;
+    long calls;
+} counting_alloc_t;
+
+static void* counting_alloc(void* context, size_t size)
+{
+    void* ptr = malloc(size);
+    if (ptr) {
+        ((counting_alloc_t*)context)->live++;
+        ((counting_alloc_t*)context)->calls++;
+    }
+    return ptr;
+}
+
+static void* counting_realloc(void* context, void* ptr, size_t size)
+{
+    void* grown = realloc(ptr, size);
+    if (grown && !ptr) {
+        ((counting_alloc_t*)context)->live++;
+    }
+    ((counting_alloc_t*)context)->calls++;
+    return grown;
+}
+
+static void counting_free(void* context, void* ptr)
+{
+    if (ptr) {
+        ((counting_alloc_t*)context)->live--;
+    }
+    free(ptr);
+}
+
+void test_allocator(void)
+{
+    printf("Testing pluggable allocators...\n");
+
+    counting_alloc_t stats = {0, 0};
+    dAllocator_t counting = {counting_alloc, counting_realloc, counting_free, &stats};
+
+    dArray_t* array = d_ArrayInitWithAllocator(2, sizeof(int), &counting);
+    for (int i = 0; i < 100; i++) {
+        assert(d_ArrayAppend(array, &i) == 0);
+    }
+    assert(array->allocator == &counting && stats.live == 2);
+    d_ArrayDestroy(array);
+
+    dStaticArray_t* static_array = d_InitStaticArrayWithAllocator(16, sizeof(int), &counting);
+    assert(static_array != NULL && stats.live == 2);
+    d_StaticArrayDestroy(static_array);
+
+    dString_t* str = d_StringInitWithAllocator(&counting);
+    for (int i = 0; i < 200; i++) {
+        d_StringAppend(str, "daedalus", 0);
+    }
+    assert(d_StringGetLength(str) == 1600);
+    d_StringDestroy(str);
+    assert(stats.live == 0);
+    printf("  ✓ arrays and strings allocate and free through their allocator\n");
+
+    dTableMode_t modes[] = {D_TABLE_MODE_CHAINED, D_TABLE_MODE_FLAT, D_TABLE_MODE_COMPACT};
+    for (int m = 0; m < 3; m++) {
+        dTable_t* table = d_TableInitWithAllocator(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                   8, modes[m], &counting);
+        assert(table != NULL);
+        for (int i = 0; i < 1000; i++) {
+            assert(d_TableSet(table, &i, &i) == 0);
+        }
+        for (int i = 0; i < 1000; i += 2) {
+            assert(d_TableRemove(table, &i) == 0);
+        }
+        int k = 999;
+        assert(*(int*)d_TableGet(table, &k) == 999);
+        assert(stats.live > 0);
+        d_TableDestroy(&table);
+        assert(stats.live == 0);
+    }
+    printf("  ✓ chained, flat and compact tables return every block\n");
+
+    int small_keys[64];
+    const void* small_key_ptrs[64];
+    for (int i = 0; i < 64; i++) {
+        small_keys[i] = i * 3 + 2;
+        small_key_ptrs[i] = &small_keys[i];
+    }
+    dStaticTable_t* explicit_chained = d_InitStaticTableWithAllocator(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                                      16, small_key_ptrs, small_key_ptrs, 64, &counting);
+    dStaticTable_t* explicit_perfect = d_InitStaticTablePerfectWithAllocator(sizeof(int), sizeof(int), d_HashInt,
+                                                                             d_CompareInt, small_key_ptrs,
+                                                                             small_key_ptrs, 64, &counting);
+    dStaticTable_t* explicit_parallel = d_InitStaticTableParallelWithAllocator(sizeof(int), sizeof(int), d_HashInt,
+                                                                               d_CompareInt, 16, small_key_ptrs,
+                                                                               small_key_ptrs, 64, 4, &counting);
+    dLRUCache_t* explicit_cache = d_LRUCacheInitWithAllocator(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                              32, 0, &counting);
+    dConcurrentTable_t* explicit_concurrent = d_ConcurrentTableInitWithAllocator(sizeof(int), sizeof(int), d_HashInt,
+                                                                                 d_CompareInt, 4, 8, &counting);
+    assert(explicit_chained && explicit_chained->allocator == &counting);
+    assert(explicit_perfect && explicit_perfect->allocator == &counting);
+    assert(explicit_parallel && explicit_parallel->allocator == &counting);
+    assert(explicit_cache && explicit_cache->allocator == &counting);
+    assert(explicit_concurrent && explicit_concurrent->allocator == &counting);
+    assert(d_GetDefaultAllocator() == d_GetHeapAllocator());
+    d_StaticTableDestroy(&explicit_chained);
+    d_StaticTableDestroy(&explicit_perfect);
+    d_StaticTableDestroy(&explicit_parallel);
+    d_LRUCacheDestroy(&explicit_cache);
+    d_ConcurrentTableDestroy(&explicit_concurrent);
+    assert(stats.live == 0);
+    printf("  ✓ static tables, LRU caches and concurrent tables take an explicit allocator\n");
+
+    // Chain blocks come from one slab per thread, all allocated on the building thread
+    enum { BUILD_KEYS = 20000 };
+    static int build_keys[BUILD_KEYS];
+    static const void* build_key_ptrs[BUILD_KEYS];
+    for (int i = 0; i < BUILD_KEYS; i++) {
+        build_keys[i] = i * 7 + 1;
+        build_key_ptrs[i] = &build_keys[i];
+    }
+    long build_calls = stats.calls;
+    dStaticTable_t* slab_built = d_InitStaticTableParallelWithAllocator(sizeof(int), sizeof(int), d_HashInt,
+                                                                        d_CompareInt, 4096, build_key_ptrs,
+                                                                        build_key_ptrs, BUILD_KEYS, 4, &counting);
+    assert(slab_built != NULL && d_StaticTableGetKeyCount(slab_built) == BUILD_KEYS);
+    assert(stats.calls - build_calls < 16);
+    assert(*(int*)d_StaticTableGet(slab_built, &build_keys[BUILD_KEYS - 1]) == build_keys[BUILD_KEYS - 1]);
+    d_StaticTableDestroy(&slab_built);
+    assert(stats.live == 0);
+    printf("  ✓ parallel static builds allocate per partition, not per key\n");
+
+    // Containers without an allocator argument capture the default when created
+    d_SetDefaultAllocator(&counting);
+    assert(d_GetDefaultAllocator() == &counting);
+    long calls_before = stats.calls;
+
+    enum { N = 500 };
+    static int keys[N], values[N];
+    static const void* key_ptrs[N];
+    static const void* value_ptrs[N];
+    for (int i = 0; i < N; i++) {
+        keys[i] = i * 7 + 1;
+        values[i] = i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+    dStaticTable_t* chained = d_InitStaticTable(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 32, key_ptrs, value_ptrs, N);
+    dStaticTable_t* perfect = d_InitStaticTablePerfect(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, key_ptrs, value_ptrs, N);
+    dLRUCache_t* cache = d_LRUCacheInit(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 64, 0);
+    dConcurrentTable_t* concurrent = d_ConcurrentTableInit(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 64, 4);
+    dLinkedList_t* list = d_InitLinkedList(&keys[0], "first", sizeof(int));
+    dArray_t* tokens = d_DUFLex("@item { name: \"sword\" damage: 12 }");
+    assert(tokens != NULL && tokens->allocator == &counting);
+
+    // Restoring the heap default does not move existing containers off `counting`
+    d_SetDefaultAllocator(NULL);
+    assert(d_GetDefaultAllocator() == d_GetHeapAllocator());
+    for (int i = 0; i < 200; i++) {
+        assert(d_LRUCachePut(cache, &i, &i) == 0);
+        assert(d_ConcurrentTableSet(concurrent, &i, &i) == 0);
+    }
+    assert(*(int*)d_StaticTableGet(chained, &keys[N - 1]) == N - 1);
+    assert(*(int*)d_StaticTableGet(perfect, &keys[N - 1]) == N - 1);
+    assert(stats.calls > calls_before && stats.live > 0);
+
+    d_StaticTableDestroy(&chained);
+    d_StaticTableDestroy(&perfect);
+    d_LRUCacheDestroy(&cache);
+    d_ConcurrentTableDestroy(&concurrent);
+    assert(d_PushBackToLinkedList(&list, &keys[1], "second", sizeof(int)) == 0);
+    assert(list->allocator == &counting && list->next->allocator == d_GetHeapAllocator());
+    d_DestroyLinkedList(&list);
+    d_DUFLexFree(tokens);
+    assert(stats.live == 0);
+    printf("  ✓ static tables, LRU caches, concurrent tables, lists and tokens use the default\n");
+
+    dAllocator_t incomplete = {counting_alloc, NULL, counting_free, &stats};
+    d_SetDefaultAllocator(&incomplete);
+    assert(d_GetDefaultAllocator() == d_GetHeapAllocator());
+    printf("  ✓ an allocator missing a callback is rejected\n");
+    printf("\n");
+}
+
+void test_async_save_allocator(void)
+{
+    printf("Testing that async saves stay off the default allocator...\n");
+
+    // The counting allocator is not thread-safe; the save worker must never call it
+    counting_alloc_t stats = {0, 0};
+    dAllocator_t counting = {counting_alloc, counting_realloc, counting_free, &stats};
+    d_SetDefaultAllocator(&counting);
+
+    int keys[64], values[64];
+    const void* key_ptrs[64];
+    const void* value_ptrs[64];
+    for (int i = 0; i < 64; i++) {
+        keys[i] = i * 5 + 1;
+        values[i] = i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+    dStaticTable_t* table = d_InitStaticTable(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 16,
+                                              key_ptrs, value_ptrs, 64);
+    dStaticArray_t* array = d_InitStaticArray(64, sizeof(int));
+    assert(table != NULL && array != NULL);
+    long calls = stats.calls;
+
+    dAsyncSave_t* table_save = d_StaticTableSaveToFileAsync("/tmp/daedalus_alloc_table.bin", table, NULL, NULL);
+    dAsyncSave_t* array_save = d_StaticArraySaveToFileAsync("/tmp/daedalus_alloc_array.bin", array, NULL, NULL);
+    int table_result = d_AsyncSaveWait(table_save);
+    int array_result = d_AsyncSaveWait(array_save);
+    assert(table_result == 0 && array_result == 0);
+    d_AsyncSaveDestroy(&table_save);
+    d_AsyncSaveDestroy(&array_save);
+    assert(stats.calls == calls);
+    printf("  ✓ snapshots, save handles and file writers come from the heap\n");
+
+    d_StaticTableDestroy(&table);
+    d_StaticArrayDestroy(array);
+    d_SetDefaultAllocator(NULL);
+    assert(stats.live == 0);
+    remove("/tmp/daedalus_alloc_table.bin");
+    remove("/tmp/daedalus_alloc_array.bin");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dAllocator Tests ===\n\n");
+
+    test_allocator();
+    test_async_save_allocator();
+
+    printf("=== All dAllocator tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,144 @@
+/* test_arenas.c - Test program for dArena_t linear allocators */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+typedef struct {
+    long live;
+    long calls;
+} counting_alloc_t;
+
+static void* counting_alloc(void* context, size_t size)
+{
+    void* ptr = malloc(size);
+    if (ptr) {
+        ((counting_alloc_t*)context)->live++;
+        ((counting_alloc_t*)context)->calls++;
+    }
+    return ptr;
+}
+
+static void* counting_realloc(void* context, void* ptr, size_t size)
+{
+    void* grown = realloc(ptr, size);
+    if (grown && !ptr) {
+        ((counting_alloc_t*)context)->live++;
+    }
+    ((counting_alloc_t*)context)->calls++;
+    return grown;
+}
+
+static void counting_free(void* context, void* ptr)
+{
+    if (ptr) {
+        ((counting_alloc_t*)context)->live--;
+    }
+    free(ptr);
+}
+
+void test_arena(void)
+{
+    printf("Testing arena allocator...\n");
+
+    counting_alloc_t stats = {0, 0};
+    dAllocator_t counting = {counting_alloc, counting_realloc, counting_free, &stats};
+    d_SetDefaultAllocator(&counting);
+    dArena_t* arena = d_ArenaCreate(1024);
+    d_SetDefaultAllocator(NULL);
+    assert(arena != NULL && arena->backing == &counting && stats.live == 2);
+
+    void* a = d_ArenaAlloc(arena, 3);
+    void* b = d_ArenaAlloc(arena, 0);
+    void* c = d_ArenaAlloc(arena, 40);
+    assert(a && b && c && a != b && b != c);
+    assert(((uintptr_t)a % 16) == 0 && ((uintptr_t)b % 16) == 0 && ((uintptr_t)c % 16) == 0);
+    assert(d_ArenaGetUsed(arena) == 16 + 16 + 48);
+
+    // Oversized requests get a dedicated chunk
+    void* big = d_ArenaAlloc(arena, 5000);
+    assert(big != NULL && arena->chunk_count == 2 && arena->current->capacity >= 5000);
+    memset(big, 0xAB, 5000);
+    printf("  ✓ bump allocation is aligned and grows by chunks\n");
+
+    // Markers rewind nested scratch work
+    dArenaMarker_t marker = d_ArenaGetMarker(arena);
+    size_t used = d_ArenaGetUsed(arena);
+    for (int i = 0; i < 100; i++) {
+        assert(d_ArenaAlloc(arena, 100) != NULL);
+    }
+    assert(d_ArenaGetUsed(arena) > used);
+    d_ArenaRestore(arena, marker);
+    assert(d_ArenaGetUsed(arena) == used);
+    printf("  ✓ markers release everything allocated after them\n");
+
+    // Reset is O(1) and keeps chunks, so later frames allocate nothing new
+    d_ArenaReset(arena);
+    assert(d_ArenaGetUsed(arena) == 0);
+    long backing_calls = 0;
+    for (int frame = 0; frame < 50; frame++) {
+        for (int i = 0; i < 200; i++) {
+            assert(d_ArenaAlloc(arena, 100) != NULL);
+        }
+        d_ArenaReset(arena);
+        if (frame == 0) {
+            backing_calls = stats.calls;
+        }
+    }
+    assert(stats.calls == backing_calls && arena->chunk_count > 2);
+    d_ArenaTrim(arena);
+    assert(arena->chunk_count == 1 && stats.live == 2);
+    printf("  ✓ reset reuses kept chunks and trim returns them\n");
+
+    // Containers placed in the arena: the newest block grows in place
+    const dAllocator_t* scratch = d_ArenaGetAllocator(arena);
+    dString_t* str = d_StringInitWithAllocator(scratch);
+    assert(str != NULL && str->allocator == scratch);
+    char* first_buffer = str->str;
+    for (int i = 0; i < 20; i++) {
+        d_StringAppend(str, "0123456789", 0);
+    }
+    assert(d_StringGetLength(str) == 200 && str->str == first_buffer);
+    assert(strncmp(d_StringPeek(str), "01234567890123456789", 20) == 0);
+
+    dArray_t* array = d_ArrayInitWithAllocator(4, sizeof(int), scratch);
+    for (int i = 0; i < 1000; i++) {
+        assert(d_ArrayAppend(array, &i) == 0);
+    }
+    for (int i = 0; i < 1000; i++) {
+        assert(*(int*)d_ArrayGet(array, i) == i);
+    }
+    // The string was not the newest block, so its growth moves and copies
+    d_StringAppend(str, "tail", 0);
+    assert(d_StringGetLength(str) == 204 && strcmp(d_StringPeek(str) + 200, "tail") == 0);
+
+    dTable_t* table = d_TableInitWithAllocator(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                               8, D_TABLE_MODE_CHAINED, scratch);
+    for (int i = 0; i < 500; i++) {
+        assert(d_TableSet(table, &i, &i) == 0);
+    }
+    int k = 321;
+    assert(*(int*)d_TableGet(table, &k) == 321);
+    printf("  ✓ strings, arrays and tables run on the arena allocator\n");
+
+    // Nothing has to be destroyed individually; the reset takes it all
+    d_ArenaReset(arena);
+    assert(d_ArenaGetUsed(arena) == 0);
+    assert(d_ArenaDestroy(&arena) == 0 && arena == NULL);
+    assert(stats.live == 0);
+    printf("  ✓ destroy returns every chunk to the backing allocator\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dArena Tests ===\n\n");
+
+    test_arena();
+
+    printf("=== All dArena tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,81 @@
+/* test_chunked_arrays.c - Test program for dChunkedArray_t segmented arrays */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+void test_chunked_array(void)
+{
+    printf("Testing chunked arrays...\n");
+
+    // Small chunks so the test crosses many chunk boundaries
+    dChunkedArray_t* array = d_ChunkedArrayInit(sizeof(int), 100);
+    assert(array && array->chunk_mask + 1 == 128);
+    int* first = NULL;
+    int* boundary = NULL;
+    for (int i = 0; i < 10000; i++) {
+        int* stored = (int*)d_ChunkedArrayAppend(array, &i);
+        assert(stored && *stored == i);
+        if (i == 0) {
+            first = stored;
+        } else if (i == 128) {
+            boundary = stored;
+        }
+    }
+    assert(d_ChunkedArrayGetCount(array) == 10000);
+    assert(array->chunks->count == 79);
+
+    // Growth never moved earlier elements
+    assert(first == d_ChunkedArrayGet(array, 0) && *first == 0);
+    assert(boundary == d_ChunkedArrayGet(array, 128) && *boundary == 128);
+    for (int i = 0; i < 10000; i++) {
+        assert(*(int*)d_ChunkedArrayGet(array, (size_t)i) == i);
+    }
+    assert(d_ChunkedArrayGet(array, 10000) == NULL);
+
+    size_t n, seen = 0;
+    int* chunk;
+    for (size_t c = 0; (chunk = (int*)d_ChunkedArrayGetChunk(array, c, &n)); c++) {
+        for (size_t j = 0; j < n; j++) {
+            assert(chunk[j] == (int)(seen + j));
+        }
+        seen += n;
+    }
+    assert(seen == 10000 && n == 0);
+    printf("  ✓ appends keep element addresses stable across chunk boundaries\n");
+
+    // Shrinking frees trailing chunks, keeping one spare
+    int last;
+    assert(d_ChunkedArrayPop(array, &last) == 0 && last == 9999);
+    assert(d_ChunkedArrayResize(array, 300) == 0 && array->chunks->count == 4);
+    assert(*(int*)d_ChunkedArrayGet(array, 299) == 299);
+    assert(d_ChunkedArrayResize(array, 1000) == 0 && d_ChunkedArrayGetCount(array) == 1000);
+    assert(*(int*)d_ChunkedArrayGet(array, 299) == 299 && *(int*)d_ChunkedArrayGet(array, 999) == 0);
+    assert(first == d_ChunkedArrayGet(array, 0));
+    assert(d_ChunkedArrayReserve(array, 5000) == 0 && array->chunks->count == 40);
+    assert(d_ChunkedArrayClear(array) == 0 && array->chunks->count == 0);
+    assert(d_ChunkedArrayPop(array, NULL) == 1 && d_ChunkedArrayAppend(array, NULL) != NULL);
+    assert(d_ChunkedArrayDestroy(&array) == 0 && array == NULL);
+
+    // Default chunks stay within the byte budget
+    array = d_ChunkedArrayInit(12, 0);
+    assert((array->chunk_mask + 1) * 12 <= D_CHUNKED_ARRAY_DEFAULT_CHUNK_BYTES);
+    assert((array->chunk_mask + 1) * 24 > D_CHUNKED_ARRAY_DEFAULT_CHUNK_BYTES);
+    d_ChunkedArrayDestroy(&array);
+    assert(d_ChunkedArrayInit(0, 0) == NULL);
+    printf("  ✓ resize, reserve and clear release trailing chunks\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dChunkedArray Tests ===\n\n");
+
+    test_chunked_array();
+
+    printf("=== All dChunkedArray tests passed! ===\n");
+    return 0;
+}
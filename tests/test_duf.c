@@ -266,6 +266,70 @@ void test_error_handling(void)
     printf("\n");
 }
 
+void test_arena_parse(void)
+{
+    printf("Testing DUF parsing into an arena...\n");
+
+    dArena_t* arena = d_ArenaCreate(4096);
+    assert(arena != NULL);
+    const char* source = "@goblin { hp: 30 name: \"Grik\" speed: 2.5 tags: [\"small\", \"green\"] }";
+
+    // Parse the same document every "frame"; one reset releases the whole tree
+    size_t high_water = 0;
+    for (int frame = 0; frame < 100; frame++) {
+        dDUFValue_t* data = NULL;
+        dDUFError_t* err = d_DUFParseStringWithAllocator(source, &data, d_ArenaGetAllocator(arena));
+        assert(err == NULL && data != NULL);
+        assert(data->allocator == d_ArenaGetAllocator(arena));
+
+        dDUFValue_t* goblin = d_DUFGetObjectItem(data, "goblin");
+        assert(goblin != NULL && goblin->allocator == data->allocator);
+        assert(d_DUFGetObjectItem(goblin, "hp")->value_int == 30);
+        assert(strcmp(d_DUFGetObjectItem(goblin, "name")->value_string, "Grik") == 0);
+        assert(d_DUFGetObjectItem(goblin, "speed")->value_double == 2.5);
+
+        if (frame == 0) {
+            high_water = d_ArenaGetUsed(arena);
+            assert(high_water > 0);
+        }
+        assert(d_ArenaGetUsed(arena) == high_water);
+        d_ArenaReset(arena);
+    }
+    assert(arena->chunk_count == 1);
+    printf("  ✓ Value tree lives in the arena and is released by one reset\n");
+
+    d_ArenaDestroy(&arena);
+    printf("\n");
+}
+
+void test_node_pool(void)
+{
+    printf("Testing DUF node pool...\n");
+
+    dPool_t* pool = d_PoolCreate(sizeof(dDUFValue_t), 16);
+    d_DUFSetNodePool(pool);
+
+    dDUFValue_t* data = NULL;
+    dDUFError_t* err = d_DUFParseString("@orc { hp: 80 name: \"Ugg\" }", &data);
+    assert(err == NULL && data != NULL);
+    d_DUFSetNodePool(NULL);
+
+    dDUFValue_t* orc = d_DUFGetObjectItem(data, "orc");
+    assert(data->pool == pool && orc->pool == pool);
+    assert(d_DUFGetObjectItem(orc, "hp")->value_int == 80);
+    assert(strcmp(d_DUFGetObjectItem(orc, "name")->value_string, "Ugg") == 0);
+    printf("  ✓ Parsed nodes come from the configured pool\n");
+
+    // Nodes go back to their pool even though pooling is now off
+    d_DUFFree(data);
+    dDUFValue_t* plain = d_DUFCreateInt(7);
+    assert(plain->pool == NULL);
+    d_DUFFree(plain);
+    d_PoolDestroy(&pool);
+    printf("  ✓ Freed nodes return to the pool they came from\n");
+    printf("\n");
+}
+
 int main(void)
 {
     printf("=== DUF Parser Tests (AUF-style API) ===\n\n");
@@ -273,6 +337,8 @@ int main(void)
     test_parse_enemies();
     test_serialization();
     test_error_handling();
+    test_arena_parse();
+    test_node_pool();
 
     printf("=== All tests passed! ===\n");
     return 0;
@@ -0,0 +1,120 @@
+/* test_heaps.c - Test program for dHeap_t priority queues */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+typedef struct {
+    float cost;
+    uint32_t id;
+} heap_node_t;
+
+static int heap_node_compare(const void* a, const void* b, void* user_data)
+{
+    int* compares = (int*)user_data;
+    if (compares) {
+        (*compares)++;
+    }
+    float ca = ((const heap_node_t*)a)->cost;
+    float cb = ((const heap_node_t*)b)->cost;
+    return (ca > cb) - (ca < cb);
+}
+
+void test_heap(void)
+{
+    printf("Testing heaps...\n");
+
+    unsigned arities[] = { 2, 4 };
+    for (int a = 0; a < 2; a++) {
+        dHeap_t* heap = d_HeapInit(sizeof(heap_node_t), 4, arities[a], heap_node_compare, NULL);
+        assert(heap && d_HeapPeek(heap) == NULL && d_HeapPop(heap, NULL) == 1);
+
+        // Push out of order, pop in cost order
+        dSlotHandle_t handles[1000];
+        uint32_t state = 777u;
+        for (uint32_t i = 0; i < 1000; i++) {
+            state = state * 1664525u + 1013904223u;
+            heap_node_t node = { (float)(state >> 16), i };
+            handles[i] = d_HeapPush(heap, &node);
+            assert(handles[i] != D_SLOT_HANDLE_NULL);
+        }
+        assert(d_HeapGetCount(heap) == 1000);
+
+        // Decrease-key moves an element to the top; raising a key is rejected
+        heap_node_t lowered = { -1.0f, 500 };
+        assert(d_HeapDecreaseKey(heap, handles[500], &lowered) == 0);
+        assert(((heap_node_t*)d_HeapPeek(heap))->id == 500);
+        heap_node_t raised = { 1e9f, 500 };
+        assert(d_HeapDecreaseKey(heap, handles[500], &raised) == 1);
+        assert(((heap_node_t*)d_HeapGet(heap, handles[500]))->cost == -1.0f);
+
+        // Remove from the middle by handle; the handle goes stale
+        heap_node_t removed;
+        assert(d_HeapRemove(heap, handles[123], &removed) == 0 && removed.id == 123);
+        assert(!d_HeapContains(heap, handles[123]) && d_HeapGet(heap, handles[123]) == NULL);
+        assert(d_HeapRemove(heap, handles[123], NULL) == 1);
+
+        heap_node_t prev, next;
+        assert(d_HeapPop(heap, &prev) == 0 && prev.id == 500);
+        assert(!d_HeapContains(heap, handles[500]));
+        size_t popped = 1;
+        while (d_HeapPop(heap, &next) == 0) {
+            assert(prev.cost <= next.cost && next.id != 123);
+            prev = next;
+            popped++;
+        }
+        assert(popped == 999 && d_HeapGetCount(heap) == 0);
+
+        // Freed slots are reused with new generations
+        heap_node_t node = { 1.0f, 1 };
+        dSlotHandle_t reused = d_HeapPush(heap, &node);
+        assert(reused != handles[(uint32_t)reused] && d_HeapContains(heap, reused));
+        assert(d_HeapClear(heap) == 0 && !d_HeapContains(heap, reused) && d_HeapGetCount(heap) == 0);
+        assert(d_HeapDestroy(&heap) == 0 && heap == NULL);
+    }
+    assert(d_HeapInit(sizeof(heap_node_t), 4, 3, heap_node_compare, NULL) == NULL);
+    printf("  ✓ push, pop, peek, decrease-key and remove for binary and 4-ary layouts\n");
+
+    // Bottom-up construction returns handles in input order and costs O(n) comparisons
+    dArray_t* nodes = d_ArrayInit(4096, sizeof(heap_node_t));
+    for (uint32_t i = 0; i < 4096; i++) {
+        heap_node_t node = { (float)((i * 2654435761u) >> 20), i };
+        d_ArrayAppend(nodes, &node);
+    }
+    dSlotHandle_t* built = (dSlotHandle_t*)malloc(4096 * sizeof(dSlotHandle_t));
+    for (int a = 0; a < 2; a++) {
+        int compares = 0;
+        dHeap_t* heap = d_HeapInitFromArray(nodes, sizeof(heap_node_t), arities[a], heap_node_compare,
+                                            &compares, built);
+        assert(heap && d_HeapGetCount(heap) == 4096);
+        assert(compares < 3 * 4096);
+        for (uint32_t i = 0; i < 4096; i += 97) {
+            assert(((heap_node_t*)d_HeapGet(heap, built[i]))->id == i);
+        }
+        heap_node_t prev, next;
+        assert(d_HeapPop(heap, &prev) == 0);
+        while (d_HeapPop(heap, &next) == 0) {
+            assert(prev.cost <= next.cost);
+            prev = next;
+        }
+        d_HeapDestroy(&heap);
+    }
+    assert(d_HeapInitFromArray(nodes, sizeof(float), 2, heap_node_compare, NULL, NULL) == NULL);
+    free(built);
+    d_ArrayDestroy(nodes);
+    printf("  ✓ heapify from an array in linear time with per-element handles\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dHeap Tests ===\n\n");
+
+    test_heap();
+
+    printf("=== All dHeap tests passed! ===\n");
+    return 0;
+}
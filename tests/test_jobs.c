@@ -0,0 +1,248 @@
+/* test_jobs.c - Test program for dJobSystem_t and parallel-for over arrays */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <sched.h>
+
+#define JOB_STAGE 256
+
+typedef struct {
+    int stage_a[JOB_STAGE];
+    int stage_b[JOB_STAGE];
+    size_t ran;
+    int order_failures;
+} job_graph_t;
+
+typedef struct {
+    job_graph_t* graph;
+    int index;
+} job_arg_t;
+
+static void job_count(void* data)
+{
+    __atomic_add_fetch((size_t*)data, 1, __ATOMIC_RELAXED);
+}
+
+static void job_gate(void* data)
+{
+    while (!__atomic_load_n((int*)data, __ATOMIC_ACQUIRE)) {
+        sched_yield();
+    }
+}
+
+static void job_stage_a(void* data)
+{
+    job_arg_t* arg = (job_arg_t*)data;
+    arg->graph->stage_a[arg->index] = arg->index + 1;
+}
+
+static void job_stage_b(void* data)
+{
+    // Every stage A job has finished before any stage B job starts
+    job_arg_t* arg = (job_arg_t*)data;
+    job_graph_t* graph = arg->graph;
+    int sum = 0;
+    for (int i = 0; i < JOB_STAGE; i++) {
+        sum += graph->stage_a[i] != 0;
+    }
+    if (sum != JOB_STAGE) {
+        __atomic_add_fetch(&graph->order_failures, 1, __ATOMIC_RELAXED);
+    }
+    graph->stage_b[arg->index] = graph->stage_a[arg->index] * 2;
+}
+
+typedef struct {
+    dJobSystem_t* jobs;
+    size_t count;
+} job_parent_t;
+
+static void job_parent(void* data)
+{
+    // Jobs may fan out and wait on their children without blocking the worker
+    job_parent_t* parent = (job_parent_t*)data;
+    dJobCounter_t children = {0};
+    for (int i = 0; i < 64; i++) {
+        d_JobSystemSubmit(parent->jobs, job_count, &parent->count, &children, NULL);
+    }
+    d_JobSystemWait(parent->jobs, &children);
+}
+
+typedef struct {
+    dJobSystem_t* jobs;
+    int arrived;
+    size_t count;
+    dJobCounter_t children;
+} job_rendezvous_t;
+
+static void job_rendezvous(void* data)
+{
+    // Holds a worker until every worker has arrived, then submits a child from it
+    job_rendezvous_t* meet = (job_rendezvous_t*)data;
+    __atomic_add_fetch(&meet->arrived, 1, __ATOMIC_ACQ_REL);
+    while (__atomic_load_n(&meet->arrived, __ATOMIC_ACQUIRE) < (int)d_JobSystemGetWorkerCount(meet->jobs)) {
+        sched_yield();
+    }
+    d_JobSystemSubmit(meet->jobs, job_count, &meet->count, &meet->children, NULL);
+}
+
+typedef struct {
+    size_t element_size;
+    size_t chunks;
+    int misaligned;
+} parallel_stats_t;
+
+static void parallel_add_index(void* elements, size_t first, size_t count, void* user_data)
+{
+    parallel_stats_t* stats = (parallel_stats_t*)user_data;
+    if ((first * stats->element_size) % 64 != 0) {
+        __atomic_add_fetch(&stats->misaligned, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_add_fetch(&stats->chunks, 1, __ATOMIC_RELAXED);
+    int* values = (int*)elements;
+    for (size_t i = 0; i < count; i++) {
+        values[i] += (int)(first + i);
+    }
+}
+
+typedef struct { float x, y, z; } parallel_vec_t;
+
+static void parallel_scale(void* elements, size_t first, size_t count, void* user_data)
+{
+    parallel_stats_t* stats = (parallel_stats_t*)user_data;
+    if ((first * stats->element_size) % 64 != 0) {
+        __atomic_add_fetch(&stats->misaligned, 1, __ATOMIC_RELAXED);
+    }
+    parallel_vec_t* v = (parallel_vec_t*)elements;
+    for (size_t i = 0; i < count; i++) {
+        v[i].x *= 2.0f;
+    }
+}
+
+void test_job_system(void)
+{
+    printf("Testing job system...\n");
+
+    dJobSystem_t* jobs = d_JobSystemInit(4);
+    assert(jobs != NULL && d_JobSystemGetWorkerCount(jobs) == 4);
+    size_t ran = 0;
+    dJobCounter_t done = {0};
+    for (int i = 0; i < 10000; i++) {
+        assert(d_JobSystemSubmit(jobs, job_count, &ran, &done, NULL) == 0);
+    }
+    d_JobSystemWait(jobs, &done);
+    assert(ran == 10000 && d_JobCounterIsDone(&done));
+    assert(d_JobSystemSubmit(jobs, NULL, NULL, NULL, NULL) == 1);
+    printf("  ✓ submitted jobs all run before the counter reaches zero\n");
+
+    // Stage A waits behind a gate job and stage B behind stage A, so both stages are
+    // held back when submitted and released in order once the gate opens
+    job_graph_t graph;
+    memset(&graph, 0, sizeof(graph));
+    job_arg_t args[JOB_STAGE];
+    dJobCounter_t a_done = {0}, b_done = {0}, gate = {0};
+    int open = 0;
+    assert(d_JobSystemSubmit(jobs, job_gate, &open, &gate, NULL) == 0);
+    for (int i = 0; i < JOB_STAGE; i++) {
+        args[i] = (job_arg_t){ &graph, i };
+        assert(d_JobSystemSubmit(jobs, job_stage_a, &args[i], &a_done, &gate) == 0);
+    }
+    for (int i = 0; i < JOB_STAGE; i++) {
+        assert(d_JobSystemSubmit(jobs, job_stage_b, &args[i], &b_done, &a_done) == 0);
+    }
+    assert(!d_JobCounterIsDone(&a_done) && graph.stage_a[0] == 0);
+    __atomic_store_n(&open, 1, __ATOMIC_RELEASE);
+    d_JobSystemWait(jobs, &b_done);
+    assert(graph.order_failures == 0);
+    for (int i = 0; i < JOB_STAGE; i++) {
+        assert(graph.stage_b[i] == 2 * (i + 1));
+    }
+    assert(d_JobCounterIsDone(&a_done) && d_JobCounterIsDone(&gate));
+
+    job_parent_t parents[8];
+    dJobCounter_t parents_done = {0};
+    for (int p = 0; p < 8; p++) {
+        parents[p] = (job_parent_t){ jobs, 0 };
+        assert(d_JobSystemSubmit(jobs, job_parent, &parents[p], &parents_done, NULL) == 0);
+    }
+    d_JobSystemWait(jobs, &parents_done);
+    for (int p = 0; p < 8; p++) {
+        assert(parents[p].count == 64);
+    }
+    printf("  ✓ dependencies hold jobs back; jobs can spawn and wait on children\n");
+
+    // Every worker submits a child, yet job records never land in a worker's pool cache
+    job_rendezvous_t meet = { jobs, 0, 0, {0} };
+    dJobCounter_t met = {0};
+    for (int w = 0; w < 4; w++) {
+        assert(d_JobSystemSubmit(jobs, job_rendezvous, &meet, &met, NULL) == 0);
+    }
+    while (__atomic_load_n(&meet.arrived, __ATOMIC_ACQUIRE) < 4) {
+        sched_yield();
+    }
+    d_JobSystemWait(jobs, &met);
+    d_JobSystemWait(jobs, &meet.children);
+    assert(meet.count == 4);
+    size_t cached_threads = 0;
+    for (size_t slot = 0; slot < 64; slot++) {
+        void* head = *(void**)((unsigned char*)jobs->job_pool->caches + slot * 64);
+        cached_threads += head != NULL;
+    }
+    assert(cached_threads <= 1);
+    printf("  ✓ workers take job records without claiming pool cache slots\n");
+
+    // Parallel-for covers every element once, in cache-line aligned chunks
+    dArray_t* values = d_ArrayInit(200000, sizeof(int));
+    int zero = 0;
+    for (int i = 0; i < 200000; i++) {
+        d_ArrayAppend(values, &zero);
+    }
+    parallel_stats_t stats = { sizeof(int), 0, 0 };
+    assert(d_ArrayParallelFor(jobs, values, 0, parallel_add_index, &stats) == 0);
+    assert(stats.chunks > 1 && stats.misaligned == 0);
+    for (int i = 0; i < 200000; i++) {
+        assert(((int*)values->data)[i] == i);
+    }
+    stats.chunks = 0;
+    assert(d_ArrayParallelFor(NULL, values, 0, parallel_add_index, &stats) == 0);
+    assert(stats.chunks == 1 && ((int*)values->data)[199999] == 2 * 199999);
+    d_ArrayDestroy(values);
+
+    dStaticArray_t* vecs = d_InitStaticArray(10007, sizeof(parallel_vec_t));
+    for (int i = 0; i < 10007; i++) {
+        parallel_vec_t v = { (float)i, 0.0f, 0.0f };
+        d_StaticArrayAppend(vecs, &v);
+    }
+    stats = (parallel_stats_t){ sizeof(parallel_vec_t), 0, 0 };
+    assert(d_StaticArrayParallelFor(jobs, vecs, 100, parallel_scale, &stats) == 0);
+    assert(stats.misaligned == 0);
+    for (int i = 0; i < 10007; i++) {
+        assert(((parallel_vec_t*)vecs->data)[i].x == 2.0f * (float)i);
+    }
+    d_StaticArrayDestroy(vecs);
+    assert(d_ArrayParallelFor(jobs, NULL, 0, parallel_add_index, &stats) == 1);
+    printf("  ✓ parallel-for over dynamic and static arrays\n");
+
+    // Jobs left queued at destroy still run
+    ran = 0;
+    for (int i = 0; i < 100; i++) {
+        d_JobSystemSubmit(jobs, job_count, &ran, NULL, NULL);
+    }
+    assert(d_JobSystemDestroy(&jobs) == 0 && jobs == NULL);
+    assert(ran == 100);
+    printf("  ✓ destroy drains queued jobs\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dJobSystem Tests ===\n\n");
+
+    test_job_system();
+
+    printf("=== All dJobSystem tests passed! ===\n");
+    return 0;
+}
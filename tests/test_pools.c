@@ -0,0 +1,199 @@
+/* test_pools.c - Test program for dPool_t block pools and the containers that draw from them */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <pthread.h>
+
+typedef struct {
+    long live;
+    long calls;
+} counting_alloc_t;
+
+static void* counting_alloc(void* context, size_t size)
+{
+    void* ptr = malloc(size);
+    if (ptr) {
+        ((counting_alloc_t*)context)->live++;
+        ((counting_alloc_t*)context)->calls++;
+    }
+    return ptr;
+}
+
+static void* counting_realloc(void* context, void* ptr, size_t size)
+{
+    void* grown = realloc(ptr, size);
+    if (grown && !ptr) {
+        ((counting_alloc_t*)context)->live++;
+    }
+    ((counting_alloc_t*)context)->calls++;
+    return grown;
+}
+
+static void counting_free(void* context, void* ptr)
+{
+    if (ptr) {
+        ((counting_alloc_t*)context)->live--;
+    }
+    free(ptr);
+}
+
+enum { POOL_THREADS = 4, POOL_ROUNDS = 200, POOL_LIVE = 500 };
+
+static void* pool_worker(void* arg)
+{
+    dPool_t* pool = (dPool_t*)arg;
+    static __thread void* held[POOL_LIVE];
+    uintptr_t tag = (uintptr_t)&held[0];
+    long failures = 0;
+    for (int round = 0; round < POOL_ROUNDS; round++) {
+        for (int i = 0; i < POOL_LIVE; i++) {
+            held[i] = d_PoolAlloc(pool);
+            *(uintptr_t*)held[i] = tag + (uintptr_t)i;
+        }
+        for (int i = 0; i < POOL_LIVE; i++) {
+            failures += *(uintptr_t*)held[i] != tag + (uintptr_t)i;
+            d_PoolFree(pool, held[i]);
+        }
+    }
+    return (void*)failures;
+}
+
+static void* pool_short_lived(void* arg)
+{
+    d_PoolFree((dPool_t*)arg, d_PoolAlloc((dPool_t*)arg));
+    return NULL;
+}
+
+void test_pool(void)
+{
+    printf("Testing object pools...\n");
+
+    dPool_t* pool = d_PoolCreate(24, 64);
+    assert(pool != NULL && pool->block_size == 32 && pool->slab_count == 0);
+    void* blocks[200];
+    for (int i = 0; i < 200; i++) {
+        blocks[i] = d_PoolAlloc(pool);
+        assert(blocks[i] != NULL && ((uintptr_t)blocks[i] % 16) == 0);
+        memset(blocks[i], i, 24);
+    }
+    for (int i = 0; i < 200; i++) {
+        assert(((unsigned char*)blocks[i])[23] == (unsigned char)i);
+    }
+    assert(pool->slab_count == 4);
+    for (int i = 0; i < 200; i++) {
+        d_PoolFree(pool, blocks[i]);
+    }
+    // Freed blocks are handed out again before any new slab is carved
+    for (int i = 0; i < 200; i++) {
+        blocks[i] = d_PoolAlloc(pool);
+    }
+    assert(pool->slab_count == 4);
+    d_PoolReset(pool);
+    for (int i = 0; i < 256; i++) {
+        assert(d_PoolAlloc(pool) != NULL);
+    }
+    assert(pool->slab_count == 4);
+    assert(d_PoolGetAllocator(pool)->alloc_func(pool, 64) == NULL);
+    d_PoolDestroy(&pool);
+    assert(pool == NULL);
+    printf("  ✓ blocks are aligned, recycled, and reset without new slabs\n");
+
+    // Threads churn through their caches; blocks are never handed to two owners
+    pool = d_PoolCreate(sizeof(uintptr_t), 0);
+    pthread_t threads[POOL_THREADS];
+    for (int t = 0; t < POOL_THREADS; t++) {
+        assert(pthread_create(&threads[t], NULL, pool_worker, pool) == 0);
+    }
+    for (int t = 0; t < POOL_THREADS; t++) {
+        void* failures = NULL;
+        pthread_join(threads[t], &failures);
+        assert(failures == NULL);
+    }
+    // Live blocks never exceed each thread's working set plus a full cache
+    assert((pool->slab_count - 1) * pool->blocks_per_slab < POOL_THREADS * (POOL_LIVE + 2 * 32));
+    d_PoolDestroy(&pool);
+    printf("  ✓ concurrent alloc/free through per-thread caches\n");
+
+    // Exiting threads flush their caches and free their slots: many more short-lived
+    // threads than cache slots never strand blocks, so one slab serves them all
+    pool = d_PoolCreate(sizeof(uintptr_t), 64);
+    for (int t = 0; t < 300; t++) {
+        pthread_t thread;
+        int started = pthread_create(&thread, NULL, pool_short_lived, pool);
+        assert(started == 0);
+        pthread_join(thread, NULL);
+    }
+    assert(pool->slab_count == 1);
+    d_PoolDestroy(&pool);
+    printf("  ✓ thread exit returns cached blocks and recycles the cache slot\n");
+
+    // A pooled chained table releases whole slabs on clear and destroy
+    counting_alloc_t stats = {0, 0};
+    dAllocator_t counting = {counting_alloc, counting_realloc, counting_free, &stats};
+    dTable_t* table = d_TableInitWithAllocator(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                               16, D_TABLE_MODE_CHAINED, &counting);
+    assert(d_TableEnablePool(table, 256) == 0 && table->node_pool != NULL);
+    for (int i = 0; i < 10000; i++) {
+        assert(d_TableSet(table, &i, &i) == 0);
+    }
+    size_t slabs = table->node_pool->slab_count;
+    for (int i = 0; i < 10000; i += 2) {
+        assert(d_TableRemove(table, &i) == 0);
+    }
+    for (int i = 0; i < 10000; i += 2) {
+        int v = -i;
+        assert(d_TableSet(table, &i, &v) == 0);
+    }
+    assert(table->node_pool->slab_count == slabs);
+    int k = 4242;
+    assert(*(int*)d_TableGet(table, &k) == -4242);
+    assert(d_TableClear(table) == 0 && table->count == 0);
+    for (int i = 0; i < 10000; i++) {
+        assert(d_TableSet(table, &i, &i) == 0);
+    }
+    assert(table->node_pool->slab_count == slabs);
+    assert(stats.live < 100);
+    d_TableDestroy(&table);
+    assert(stats.live == 0);
+
+    dTable_t* flat = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 16, D_TABLE_MODE_FLAT);
+    assert(d_TableEnablePool(flat, 0) == 1);
+    d_TableDestroy(&flat);
+    printf("  ✓ pooled chained tables recycle entries and free whole slabs\n");
+
+    // List nodes come from the configured pool and go back to it when freed
+    dPool_t* nodes = d_PoolCreate(sizeof(dLinkedList_t), 8);
+    int value = 1;
+    d_LinkedListSetNodePool(nodes);
+    dLinkedList_t* list = d_InitLinkedList(&value, "a", sizeof(int));
+    for (int i = 0; i < 20; i++) {
+        assert(d_PushBackToLinkedList(&list, &i, "n", sizeof(int)) == 0);
+    }
+    d_LinkedListSetNodePool(NULL);
+    size_t node_slabs = nodes->slab_count;
+    assert(list->pool == nodes && node_slabs >= 3);
+    assert(d_GetLengthOfLinkedList(list) == 21);
+    d_DestroyLinkedList(&list);
+    d_LinkedListSetNodePool(nodes);
+    list = d_InitLinkedList(&value, "b", sizeof(int));
+    assert(list->pool == nodes && nodes->slab_count == node_slabs);
+    d_DestroyLinkedList(&list);
+    d_LinkedListSetNodePool(NULL);
+    d_PoolDestroy(&nodes);
+    printf("  ✓ linked list nodes use the configured node pool\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dPool Tests ===\n\n");
+
+    test_pool();
+
+    printf("=== All dPool tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,191 @@
+/* test_ring_buffers.c - Test program for SPSC and MPMC dRingBuffer_t queues */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define RING_MESSAGES 200000
+#define RING_THREADS 4
+
+static void* ring_spsc_producer(void* arg)
+{
+    dRingBuffer_t* ring = (dRingBuffer_t*)arg;
+    uint64_t next = 0;
+    uint64_t batch[37];
+    while (next < RING_MESSAGES) {
+        if (next % 3 == 0) {
+            if (d_RingBufferEnqueue(ring, &next) == 0) {
+                next++;
+            } else {
+                sched_yield();
+            }
+            continue;
+        }
+        size_t n = 0;
+        while (n < 37 && next + n < RING_MESSAGES) {
+            batch[n] = next + n;
+            n++;
+        }
+        size_t done = d_RingBufferEnqueueBatch(ring, batch, n);
+        if (done == 0) {
+            sched_yield();
+        }
+        next += done;
+    }
+    return NULL;
+}
+
+static void* ring_spsc_consumer(void* arg)
+{
+    dRingBuffer_t* ring = (dRingBuffer_t*)arg;
+    uintptr_t failures = 0;
+    uint64_t expected = 0;
+    uint64_t batch[23];
+    while (expected < RING_MESSAGES) {
+        size_t n = d_RingBufferDequeueBatch(ring, batch, 1 + expected % 23);
+        if (n == 0) {
+            sched_yield();
+        }
+        for (size_t i = 0; i < n; i++) {
+            failures += batch[i] != expected++;
+        }
+    }
+    return (void*)failures;
+}
+
+typedef struct {
+    dRingBuffer_t* ring;
+    int id;
+    size_t* consumed;
+    unsigned char* seen;
+} ring_worker_t;
+
+static void* ring_mpmc_producer(void* arg)
+{
+    ring_worker_t* w = (ring_worker_t*)arg;
+    uint32_t base = (uint32_t)w->id * RING_MESSAGES;
+    uint32_t next = 0;
+    uint32_t batch[16];
+    while (next < RING_MESSAGES) {
+        size_t n = 0;
+        while (n < 1 + next % 16 && next + n < RING_MESSAGES) {
+            batch[n] = base + next + (uint32_t)n;
+            n++;
+        }
+        size_t done = d_RingBufferEnqueueBatch(w->ring, batch, n);
+        if (done == 0) {
+            sched_yield();
+        }
+        next += (uint32_t)done;
+    }
+    return NULL;
+}
+
+static void* ring_mpmc_consumer(void* arg)
+{
+    ring_worker_t* w = (ring_worker_t*)arg;
+    uintptr_t failures = 0;
+    uint32_t last[RING_THREADS];
+    memset(last, 0xFF, sizeof(last));
+    uint32_t batch[8];
+    while (__atomic_load_n(w->consumed, __ATOMIC_RELAXED) < (size_t)RING_THREADS * RING_MESSAGES) {
+        size_t n = d_RingBufferDequeueBatch(w->ring, batch, 1 + (size_t)w->id * 2);
+        if (n == 0) {
+            sched_yield();
+        }
+        for (size_t i = 0; i < n; i++) {
+            uint32_t producer = batch[i] / RING_MESSAGES;
+            uint32_t index = batch[i] % RING_MESSAGES;
+            // Each producer's messages reach any one consumer in order
+            failures += last[producer] != UINT32_MAX && index <= last[producer];
+            last[producer] = index;
+            failures += __atomic_fetch_add(&w->seen[batch[i]], 1, __ATOMIC_RELAXED) != 0;
+        }
+        __atomic_add_fetch(w->consumed, n, __ATOMIC_RELAXED);
+    }
+    return (void*)failures;
+}
+
+void test_ring_buffer(void)
+{
+    printf("Testing ring buffers...\n");
+
+    // Single-threaded semantics shared by both modes
+    dRingBufferMode_t modes[] = { D_RING_BUFFER_SPSC, D_RING_BUFFER_MPMC };
+    for (int m = 0; m < 2; m++) {
+        dRingBuffer_t* ring = d_RingBufferInit(5, sizeof(int), modes[m]);
+        assert(ring != NULL && d_RingBufferGetCapacity(ring) == 8 && d_RingBufferGetCount(ring) == 0);
+        int value = 0;
+        assert(d_RingBufferDequeue(ring, &value) == 1);
+        for (int i = 0; i < 8; i++) {
+            assert(d_RingBufferEnqueue(ring, &i) == 0);
+        }
+        assert(d_RingBufferEnqueue(ring, &value) == 1 && d_RingBufferGetCount(ring) == 8);
+        for (int i = 0; i < 5; i++) {
+            assert(d_RingBufferDequeue(ring, &value) == 0 && value == i);
+        }
+
+        // Batches wrap around the end of the storage and stop at full/empty
+        int in[10] = { 100, 101, 102, 103, 104, 105, 106, 107, 108, 109 };
+        int out[10] = { 0 };
+        assert(d_RingBufferEnqueueBatch(ring, in, 10) == 5);
+        assert(d_RingBufferDequeueBatch(ring, out, 10) == 8);
+        assert(out[0] == 5 && out[2] == 7 && out[3] == 100 && out[7] == 104);
+        assert(d_RingBufferDequeueBatch(ring, out, 10) == 0 && d_RingBufferGetCount(ring) == 0);
+        assert(d_RingBufferDestroy(&ring) == 0 && ring == NULL);
+    }
+    assert(d_RingBufferInit(8, 0, D_RING_BUFFER_SPSC) == NULL);
+    printf("  ✓ FIFO order, full/empty detection and wrapping batches in both modes\n");
+
+    // One producer and one consumer hand over every message in order
+    dRingBuffer_t* spsc = d_RingBufferInit(64, sizeof(uint64_t), D_RING_BUFFER_SPSC);
+    pthread_t producer, consumer;
+    assert(pthread_create(&producer, NULL, ring_spsc_producer, spsc) == 0);
+    assert(pthread_create(&consumer, NULL, ring_spsc_consumer, spsc) == 0);
+    void* failures = NULL;
+    pthread_join(producer, NULL);
+    pthread_join(consumer, &failures);
+    assert(failures == NULL && d_RingBufferGetCount(spsc) == 0);
+    d_RingBufferDestroy(&spsc);
+    printf("  ✓ SPSC threads pass %d messages in order\n", RING_MESSAGES);
+
+    // Many producers and consumers: every message arrives exactly once
+    dRingBuffer_t* mpmc = d_RingBufferInit(128, sizeof(uint32_t), D_RING_BUFFER_MPMC);
+    unsigned char* seen = (unsigned char*)calloc((size_t)RING_THREADS * RING_MESSAGES, 1);
+    size_t consumed = 0;
+    ring_worker_t workers[RING_THREADS];
+    pthread_t producers[RING_THREADS], consumers[RING_THREADS];
+    for (int t = 0; t < RING_THREADS; t++) {
+        workers[t] = (ring_worker_t){ mpmc, t, &consumed, seen };
+        assert(pthread_create(&producers[t], NULL, ring_mpmc_producer, &workers[t]) == 0);
+        assert(pthread_create(&consumers[t], NULL, ring_mpmc_consumer, &workers[t]) == 0);
+    }
+    for (int t = 0; t < RING_THREADS; t++) {
+        pthread_join(producers[t], NULL);
+        pthread_join(consumers[t], &failures);
+        assert(failures == NULL);
+    }
+    assert(consumed == (size_t)RING_THREADS * RING_MESSAGES);
+    for (size_t i = 0; i < (size_t)RING_THREADS * RING_MESSAGES; i++) {
+        assert(seen[i] == 1);
+    }
+    free(seen);
+    d_RingBufferDestroy(&mpmc);
+    printf("  ✓ MPMC threads deliver every message exactly once\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dRingBuffer Tests ===\n\n");
+
+    test_ring_buffer();
+
+    printf("=== All dRingBuffer tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,95 @@
+/* test_slot_maps.c - Test program for dSlotMap_t generational handles */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+void test_slot_map(void)
+{
+    printf("Testing slot maps...\n");
+
+    typedef struct { int id; float x; } Entity;
+    dSlotMap_t* map = d_SlotMapInit(sizeof(Entity), 4);
+    assert(map != NULL && d_SlotMapGetCount(map) == 0);
+    dSlotHandle_t handles[100];
+    for (int i = 0; i < 100; i++) {
+        Entity e = { i, (float)i * 0.5f };
+        handles[i] = d_SlotMapInsert(map, &e);
+        assert(handles[i] != D_SLOT_HANDLE_NULL);
+    }
+    assert(d_SlotMapGetCount(map) == 100);
+    assert(!d_SlotMapContains(map, D_SLOT_HANDLE_NULL));
+
+    // Removing every third element keeps the other handles pointing at the same entities
+    for (int i = 0; i < 100; i += 3) {
+        assert(d_SlotMapRemove(map, handles[i]) == 0);
+    }
+    assert(d_SlotMapGetCount(map) == 66);
+    for (int i = 0; i < 100; i++) {
+        Entity* e = (Entity*)d_SlotMapGet(map, handles[i]);
+        if (i % 3 == 0) {
+            assert(e == NULL && !d_SlotMapContains(map, handles[i]));
+            assert(d_SlotMapRemove(map, handles[i]) == 1);
+        } else {
+            assert(e != NULL && e->id == i && e->x == (float)i * 0.5f);
+        }
+    }
+    printf("  ✓ handles survive swap-and-pop removal; stale handles are rejected\n");
+
+    // Reused slots hand out a new generation, so old handles to them stay stale
+    Entity fresh = { 1000, 0.0f };
+    dSlotHandle_t reused = d_SlotMapInsert(map, &fresh);
+    assert((uint32_t)reused == (uint32_t)handles[99] && reused != handles[99]);
+    assert(d_SlotMapGet(map, handles[99]) == NULL);
+    assert(((Entity*)d_SlotMapGet(map, reused))->id == 1000);
+    dSlotHandle_t zeroed = d_SlotMapInsert(map, NULL);
+    assert(((Entity*)d_SlotMapGet(map, zeroed))->id == 0);
+    assert(d_SlotMapRemove(map, zeroed) == 0);
+
+    // The dense scan sees every live element once, and can remove as it goes
+    int seen = 0;
+    for (size_t i = 0; i < d_SlotMapGetCount(map); i++) {
+        Entity* e = (Entity*)d_SlotMapGetDense(map, i);
+        assert(d_SlotMapGet(map, d_SlotMapHandleAt(map, i)) == e);
+        seen++;
+    }
+    assert(seen == 67 && d_SlotMapGetDense(map, 67) == NULL);
+    for (size_t i = 0; i < d_SlotMapGetCount(map);) {
+        Entity* e = (Entity*)d_SlotMapGetDense(map, i);
+        if (e->id % 2 == 0) {
+            assert(d_SlotMapRemove(map, d_SlotMapHandleAt(map, i)) == 0);
+        } else {
+            i++;
+        }
+    }
+    for (size_t i = 0; i < d_SlotMapGetCount(map); i++) {
+        assert(((Entity*)d_SlotMapGetDense(map, i))->id % 2 == 1);
+    }
+    assert(d_SlotMapGet(map, handles[1]) != NULL && d_SlotMapGet(map, handles[2]) == NULL);
+    printf("  ✓ slots are reused with new generations; dense iteration covers live elements\n");
+
+    assert(d_SlotMapClear(map) == 0 && d_SlotMapGetCount(map) == 0);
+    assert(d_SlotMapGet(map, handles[1]) == NULL && d_SlotMapGet(map, reused) == NULL);
+    size_t slots = map->slots->count;
+    for (int i = 0; i < 50; i++) {
+        assert(d_SlotMapInsert(map, &fresh) != D_SLOT_HANDLE_NULL);
+    }
+    assert(map->slots->count == slots);
+    assert(d_SlotMapDestroy(&map) == 0 && map == NULL);
+    assert(d_SlotMapInit(0, 4) == NULL);
+    printf("  ✓ clear invalidates every handle and keeps the slots\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dSlotMap Tests ===\n\n");
+
+    test_slot_map();
+
+    printf("=== All dSlotMap tests passed! ===\n");
+    return 0;
+}
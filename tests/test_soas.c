@@ -0,0 +1,79 @@
+/* test_soas.c - Test program for dSoA_t struct-of-arrays containers */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+void test_soa(void)
+{
+    printf("Testing struct-of-arrays containers...\n");
+
+    dSoAField_t fields[] = { { sizeof(dVec3_t), 0 }, { sizeof(float), 0 }, { sizeof(uint8_t), 0 } };
+    dSoA_t* soa = d_SoAInit(fields, 3, 0);
+    assert(soa != NULL && d_SoAGetCount(soa) == 0 && d_SoAGetColumn(soa, 0) == NULL);
+    for (int i = 0; i < 1000; i++) {
+        dVec3_t pos = { (float)i, (float)-i, 1.0f };
+        float mass = (float)i * 2.0f;
+        uint8_t flag = (uint8_t)(i & 0xFF);
+        const void* row[] = { &pos, &mass, &flag };
+        assert(d_SoAAppend(soa, row) == 0);
+    }
+    assert(d_SoAGetCount(soa) == 1000 && soa->capacity >= 1000);
+    for (size_t f = 0; f < 3; f++) {
+        assert(((uintptr_t)d_SoAGetColumn(soa, f) % D_SOA_COLUMN_ALIGNMENT) == 0);
+    }
+    assert(d_SoAGetColumn(soa, 3) == NULL && d_SoAGet(soa, 0, 1000) == NULL);
+
+    // Columns are dense arrays of their field type
+    dVec3_t* pos = (dVec3_t*)d_SoAGetColumn(soa, 0);
+    float* mass = (float*)d_SoAGetColumn(soa, 1);
+    for (int i = 0; i < 1000; i++) {
+        assert(pos[i].x == (float)i && pos[i].y == (float)-i && mass[i] == (float)i * 2.0f);
+        assert(*(uint8_t*)d_SoAGet(soa, 2, i) == (uint8_t)(i & 0xFF));
+    }
+    printf("  ✓ appended rows land in aligned, packed columns\n");
+
+    // Swap-remove moves the last row into the hole in every column
+    assert(d_SoASwapRemove(soa, 10) == 0);
+    assert(d_SoAGetCount(soa) == 999);
+    assert(((dVec3_t*)d_SoAGet(soa, 0, 10))->x == 999.0f);
+    assert(*(float*)d_SoAGet(soa, 1, 10) == 1998.0f);
+    assert(*(uint8_t*)d_SoAGet(soa, 2, 10) == (uint8_t)(999 & 0xFF));
+    assert(d_SoASwapRemove(soa, 998) == 0 && d_SoAGetCount(soa) == 998);
+    assert(d_SoASwapRemove(soa, 998) == 1);
+
+    assert(d_SoAAppend(soa, NULL) == 0);
+    assert(((dVec3_t*)d_SoAGet(soa, 0, 998))->x == 0.0f && *(float*)d_SoAGet(soa, 1, 998) == 0.0f);
+
+    // Growth keeps the data and alignment
+    size_t capacity = soa->capacity;
+    assert(d_SoAReserve(soa, capacity * 4) == 0 && soa->capacity == capacity * 4);
+    assert(((dVec3_t*)d_SoAGet(soa, 0, 500))->y == -500.0f);
+    assert(((uintptr_t)d_SoAGetColumn(soa, 1) % D_SOA_COLUMN_ALIGNMENT) == 0);
+    assert(d_SoAClear(soa) == 0 && d_SoAGetCount(soa) == 0 && soa->capacity == capacity * 4);
+    assert(d_SoADestroy(&soa) == 0 && soa == NULL);
+    printf("  ✓ swap-remove, zero-filled rows, reserve and clear\n");
+
+    // Over-aligned fields get their own column alignment; bad schemas are rejected
+    dSoAField_t wide[] = { { 128, 128 }, { sizeof(int), 0 } };
+    soa = d_SoAInit(wide, 2, 3);
+    assert(soa != NULL && ((uintptr_t)d_SoAGetColumn(soa, 0) % 128) == 0);
+    d_SoADestroy(&soa);
+    dSoAField_t bad[] = { { 4, 3 } };
+    assert(d_SoAInit(bad, 1, 0) == NULL && d_SoAInit(fields, 0, 0) == NULL);
+    printf("  ✓ over-aligned fields and invalid schemas\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dSoA Tests ===\n\n");
+
+    test_soa();
+
+    printf("=== All dSoA tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,152 @@
+/* test_sorts.c - Test program for comparator, radix and parallel array sorts */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+typedef struct {
+    uint32_t key;
+    uint32_t seq;
+} sort_record_t;
+
+static int sort_record_compare(const void* a, const void* b, void* user_data)
+{
+    (void)user_data;
+    uint32_t ka = ((const sort_record_t*)a)->key;
+    uint32_t kb = ((const sort_record_t*)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+static uint64_t sort_record_key(const void* element, void* user_data)
+{
+    (void)user_data;
+    return ((const sort_record_t*)element)->key;
+}
+
+static int sort_float_compare(const void* a, const void* b, void* user_data)
+{
+    (void)user_data;
+    float fa = *(const float*)a;
+    float fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+// Ordered by key, and equal keys keep their insertion order
+static void assert_sorted_records(const sort_record_t* records, size_t count)
+{
+    for (size_t i = 1; i < count; i++) {
+        assert(records[i - 1].key <= records[i].key);
+        if (records[i - 1].key == records[i].key) {
+            assert(records[i - 1].seq < records[i].seq);
+        }
+    }
+}
+
+static void fill_sort_records(dArray_t* records, size_t count, uint32_t key_range)
+{
+    uint32_t state = 12345u;
+    records->count = 0;
+    for (size_t i = 0; i < count; i++) {
+        state = state * 1664525u + 1013904223u;
+        sort_record_t r = { (state >> 8) % key_range, (uint32_t)i };
+        d_ArrayAppend(records, &r);
+    }
+}
+
+void test_sort(void)
+{
+    printf("Testing array sorts...\n");
+
+    // Comparator sort: stable, handles run/merge boundaries and already-sorted input
+    dArray_t* records = d_ArrayInit(100000, sizeof(sort_record_t));
+    size_t sizes[] = { 0, 1, 31, 32, 33, 1000, 10007 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        fill_sort_records(records, sizes[s], 97);
+        assert(d_ArraySort(records, sort_record_compare, NULL) == 0);
+        assert(records->count == sizes[s]);
+        assert_sorted_records((sort_record_t*)records->data, records->count);
+        assert(d_ArraySort(records, sort_record_compare, NULL) == 0);
+        assert_sorted_records((sort_record_t*)records->data, records->count);
+    }
+    assert(d_ArraySort(NULL, sort_record_compare, NULL) == 1);
+    assert(d_ArraySort(records, NULL, NULL) == 1);
+    printf("  ✓ comparator sort is ordered and stable\n");
+
+    // Radix sort gives exactly the stable order
+    fill_sort_records(records, 10007, 1u << 20);
+    dArray_t* expected = d_ArrayInit(10007, sizeof(sort_record_t));
+    memcpy(expected->data, records->data, records->count * sizeof(sort_record_t));
+    expected->count = records->count;
+    assert(d_ArraySort(expected, sort_record_compare, NULL) == 0);
+    assert(d_ArrayRadixSort(records, sort_record_key, NULL) == 0);
+    assert(memcmp(records->data, expected->data, records->count * sizeof(sort_record_t)) == 0);
+    d_ArrayDestroy(expected);
+
+    dStaticArray_t* ints = d_InitStaticArray(9, sizeof(int32_t));
+    int32_t int_values[] = { 5, -1, INT32_MAX, 0, INT32_MIN, -300, 7, 0, -1 };
+    int32_t int_sorted[] = { INT32_MIN, -300, -1, -1, 0, 0, 5, 7, INT32_MAX };
+    for (int i = 0; i < 9; i++) {
+        d_StaticArrayAppend(ints, &int_values[i]);
+    }
+    assert(d_StaticArrayRadixSort(ints, d_SortKeyInt32, NULL) == 0);
+    assert(memcmp(ints->data, int_sorted, sizeof(int_sorted)) == 0);
+    d_StaticArrayDestroy(ints);
+
+    dArray_t* floats = d_ArrayInit(8, sizeof(float));
+    float float_values[] = { 2.5f, -0.0f, -INFINITY, 1e-30f, -2.5f, INFINITY, 0.0f, -1e30f };
+    for (int i = 0; i < 8; i++) {
+        d_ArrayAppend(floats, &float_values[i]);
+    }
+    assert(d_ArrayRadixSort(floats, d_SortKeyFloat, NULL) == 0);
+    const float* f = (const float*)floats->data;
+    for (int i = 1; i < 8; i++) {
+        assert(f[i - 1] <= f[i]);
+    }
+    assert(signbit(f[3]) && !signbit(f[4]));
+    d_ArrayDestroy(floats);
+    assert(d_SortKeyFromDouble(-1.0) < d_SortKeyFromDouble(-0.5));
+    assert(d_SortKeyFromDouble(-0.5) < d_SortKeyFromDouble(0.0));
+    assert(d_SortKeyFromInt64(-1) < d_SortKeyFromInt64(0));
+    assert(d_ArrayRadixSort(records, NULL, NULL) == 1);
+    printf("  ✓ radix sort matches the stable order for integer and float keys\n");
+
+    // Parallel sort splits merges across threads and matches the serial result
+    dJobSystem_t* jobs = d_JobSystemInit(3);
+    fill_sort_records(records, 100000, 1000);
+    assert(d_ArraySortParallel(jobs, records, sort_record_compare, NULL) == 0);
+    assert(records->count == 100000);
+    assert_sorted_records((sort_record_t*)records->data, records->count);
+    fill_sort_records(records, 100000, 1u << 30);
+    assert(d_ArraySortParallel(NULL, records, sort_record_compare, NULL) == 0);
+    assert_sorted_records((sort_record_t*)records->data, records->count);
+
+    dStaticArray_t* values = d_InitStaticArray(50000, sizeof(float));
+    for (int i = 0; i < 50000; i++) {
+        float v = (float)((i * 7919) % 50000) - 25000.0f;
+        d_StaticArrayAppend(values, &v);
+    }
+    assert(d_StaticArraySortParallel(jobs, values, sort_float_compare, NULL) == 0);
+    for (int i = 0; i < 50000; i++) {
+        assert(((float*)values->data)[i] == (float)i - 25000.0f);
+    }
+    assert(d_StaticArraySort(values, sort_float_compare, NULL) == 0);
+    assert(((float*)values->data)[49999] == 24999.0f);
+    d_StaticArrayDestroy(values);
+    d_JobSystemDestroy(&jobs);
+    d_ArrayDestroy(records);
+    printf("  ✓ parallel sort on a job system matches the serial order\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== Sort Tests ===\n\n");
+
+    test_sort();
+
+    printf("=== All Sort tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,1453 @@
+/* test_tables.c - Test program for dTable_t storage modes and the containers built on it */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "Daedalus.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+static void sum_entry(const void* key, size_t key_size, const void* value, size_t value_size, void* user_data)
+{
+    (void)key; (void)key_size; (void)value_size;
+    *(long long*)user_data += *(const int*)value;
+}
+
+D_TABLE_DEFINE(IntVecMap, int, dVec3_t, D_TABLE_HASH_INT, D_TABLE_EQ_VALUE)
+D_TABLE_DEFINE(NameMap, const char*, int, D_TABLE_HASH_STRING, D_TABLE_EQ_STRING)
+
+static size_t hash_calls = 0;
+static size_t compare_calls = 0;
+
+static size_t counting_hash(const void* key, size_t key_size)
+{
+    hash_calls++;
+    return d_HashString(key, key_size);
+}
+
+static int counting_compare(const void* a, const void* b, size_t size)
+{
+    compare_calls++;
+    return d_CompareString(a, b, size);
+}
+
+void test_flat_basic(void)
+{
+    printf("Testing flat table basic operations...\n");
+
+    dTable_t* table = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 4, D_TABLE_MODE_FLAT);
+    assert(table != NULL);
+    assert(table->mode == D_TABLE_MODE_FLAT);
+    assert(table->buckets == NULL);
+
+    for (int i = 0; i < 1000; i++) {
+        int value = i * 3;
+        assert(d_TableSet(table, &i, &value) == 0);
+    }
+    assert(d_TableGetCount(table) == 1000);
+    printf("  ✓ 1000 inserts with growth\n");
+
+    for (int i = 0; i < 1000; i++) {
+        int* value = (int*)d_TableGet(table, &i);
+        assert(value != NULL);
+        assert(*value == i * 3);
+    }
+    int missing = 5000;
+    assert(d_TableGet(table, &missing) == NULL);
+    assert(d_TableHasKey(table, &missing) == 1);
+    printf("  ✓ lookups hit and miss correctly\n");
+
+    int key = 7, updated = -1;
+    assert(d_TableSet(table, &key, &updated) == 0);
+    assert(*(int*)d_TableGet(table, &key) == -1);
+    assert(d_TableGetCount(table) == 1000);
+    printf("  ✓ upsert updates in place\n");
+
+    d_TableDestroy(&table);
+    assert(table == NULL);
+    printf("\n");
+}
+
+void test_flat_remove_and_tombstones(void)
+{
+    printf("Testing flat table removal...\n");
+
+    dTable_t* table = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 16, D_TABLE_MODE_FLAT);
+    assert(table != NULL);
+
+    // Churn far more keys than the capacity to exercise tombstone cleanup
+    for (int round = 0; round < 50; round++) {
+        for (int i = 0; i < 100; i++) {
+            int k = round * 100 + i;
+            assert(d_TableSet(table, &k, &i) == 0);
+        }
+        for (int i = 0; i < 100; i++) {
+            int k = round * 100 + i;
+            assert(d_TableRemove(table, &k) == 0);
+        }
+    }
+    assert(d_TableGetCount(table) == 0);
+    assert(table->num_buckets <= 512);
+    printf("  ✓ insert/remove churn keeps capacity bounded\n");
+
+    for (int i = 0; i < 64; i++) {
+        assert(d_TableSet(table, &i, &i) == 0);
+    }
+    for (int i = 0; i < 64; i += 2) {
+        assert(d_TableRemove(table, &i) == 0);
+    }
+    for (int i = 0; i < 64; i++) {
+        assert((d_TableHasKey(table, &i) == 0) == (i % 2 == 1));
+    }
+    int gone = 0;
+    assert(d_TableRemove(table, &gone) == 1);
+    printf("  ✓ removed keys vanish, neighbours survive\n");
+
+    long long sum = 0;
+    d_TableForEach(table, sum_entry, &sum);
+    assert(sum == 32 * 32); // sum of odd numbers below 64
+    dArray_t* keys = d_TableGetAllKeys(table);
+    assert(keys != NULL && keys->count == 32);
+    d_ArrayDestroy(keys);
+    printf("  ✓ iteration visits only live slots\n");
+
+    assert(d_TableClear(table) == 0);
+    assert(d_TableGetCount(table) == 0);
+    assert(d_TableGet(table, &(int){1}) == NULL);
+    printf("  ✓ clear empties the table\n");
+
+    d_TableDestroy(&table);
+    printf("\n");
+}
+
+void test_flat_string_keys(void)
+{
+    printf("Testing flat table with string keys and wide values...\n");
+
+    dTable_t* table = d_TableInitWithMode(sizeof(char*), sizeof(dVec3_t), d_HashString, d_CompareString, 8, D_TABLE_MODE_FLAT);
+    assert(table != NULL);
+    assert(table->value_offset % sizeof(float) == 0);
+
+    const char* names[] = { "sword", "shield", "potion", "arrow", "helmet" };
+    for (int i = 0; i < 5; i++) {
+        dVec3_t v = { (float)i, (float)i * 2.0f, 1.0f };
+        assert(d_TableSet(table, &names[i], &v) == 0);
+    }
+
+    // Look up through a different pointer with equal contents
+    char buffer[16];
+    strcpy(buffer, "potion");
+    char* lookup = buffer;
+    dVec3_t* found = (dVec3_t*)d_TableGet(table, &lookup);
+    assert(found != NULL && found->x == 2.0f && found->y == 4.0f);
+    printf("  ✓ string keys compare by content\n");
+
+    assert(d_TableRehash(table, 1024) == 0);
+    assert(table->num_buckets == 1024);
+    for (int i = 0; i < 5; i++) {
+        assert(d_TableHasKey(table, &names[i]) == 0);
+    }
+    printf("  ✓ explicit rehash keeps every entry\n");
+
+    d_TableDestroy(&table);
+    printf("\n");
+}
+
+void test_incremental_rehash(void)
+{
+    printf("Testing incremental rehash of chained table...\n");
+
+    dTable_t* table = d_TableInit(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 8);
+    assert(table != NULL);
+    assert(d_TableSetIncrementalRehash(table, 1) == 0);
+
+    // Insert until growth starts, then keep going while old buckets drain
+    int seen_rehashing = 0;
+    int* first_value = NULL;
+    for (int i = 0; i < 2000; i++) {
+        int value = i + 100;
+        assert(d_TableSet(table, &i, &value) == 0);
+        if (i == 0) {
+            first_value = (int*)d_TableGet(table, &i);
+        }
+        if (d_TableIsRehashing(table)) {
+            seen_rehashing = 1;
+            // Every key inserted so far must stay reachable mid-migration
+            for (int j = 0; j <= i; j += 97) {
+                int* found = (int*)d_TableGet(table, &j);
+                assert(found != NULL && *found == j + 100);
+                assert(d_TableHasKey(table, &j) == 0);
+            }
+        }
+    }
+    assert(seen_rehashing);
+    assert(d_TableGetCount(table) == 2000);
+    assert(first_value == d_TableGet(table, &(int){0}));
+    printf("  ✓ lookups succeed while old buckets drain\n");
+
+    // Updates and removals must reach entries still sitting in the old array
+    while (!d_TableIsRehashing(table)) {
+        int k = (int)d_TableGetCount(table) + 10000;
+        assert(d_TableSet(table, &k, &k) == 0);
+    }
+    int key = 1, updated = -5;
+    assert(d_TableSet(table, &key, &updated) == 0);
+    assert(*(int*)d_TableGet(table, &key) == -5);
+    size_t before = d_TableGetCount(table);
+    for (int i = 0; i < 2000; i += 2) {
+        assert(d_TableRemove(table, &i) == 0);
+    }
+    assert(d_TableGetCount(table) == before - 1000);
+    dArray_t* keys = d_TableGetAllKeys(table);
+    assert(keys != NULL && keys->count == d_TableGetCount(table));
+    d_ArrayDestroy(keys);
+    printf("  ✓ update, remove and iteration span both bucket arrays\n");
+
+    while (d_TableRehashStep(table, 16)) { }
+    assert(!d_TableIsRehashing(table));
+    for (int i = 1; i < 2000; i += 2) {
+        assert(d_TableHasKey(table, &i) == 0);
+    }
+    printf("  ✓ explicit steps finish the migration\n");
+
+    // Disabling mid-migration drains immediately
+    while (!d_TableIsRehashing(table)) {
+        int k = (int)d_TableGetCount(table) + 50000;
+        assert(d_TableSet(table, &k, &k) == 0);
+    }
+    assert(d_TableSetIncrementalRehash(table, 0) == 0);
+    assert(!d_TableIsRehashing(table));
+
+    dTable_t* flat = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 8, D_TABLE_MODE_FLAT);
+    assert(d_TableSetIncrementalRehash(flat, 4) == 1);
+    d_TableDestroy(&flat);
+    printf("  ✓ step 0 drains, flat tables reject incremental mode\n");
+
+    // Destroying mid-migration must release both arrays
+    while (!d_TableIsRehashing(table)) {
+        assert(d_TableSetIncrementalRehash(table, 1) == 0);
+        int k = (int)d_TableGetCount(table) + 90000;
+        assert(d_TableSet(table, &k, &k) == 0);
+    }
+    d_TableDestroy(&table);
+    printf("\n");
+}
+
+#define CONCURRENT_THREADS 4
+#define CONCURRENT_KEYS_PER_THREAD 5000
+
+typedef struct {
+    dConcurrentTable_t* table;
+    int thread_index;
+    int failures;
+} concurrent_worker_t;
+
+static void* concurrent_writer(void* arg)
+{
+    concurrent_worker_t* w = (concurrent_worker_t*)arg;
+    int base = w->thread_index * CONCURRENT_KEYS_PER_THREAD;
+    for (int i = 0; i < CONCURRENT_KEYS_PER_THREAD; i++) {
+        int key = base + i, value = key * 2;
+        if (d_ConcurrentTableSet(w->table, &key, &value) != 0) {
+            w->failures++;
+        }
+    }
+    return NULL;
+}
+
+static void* concurrent_reader(void* arg)
+{
+    concurrent_worker_t* w = (concurrent_worker_t*)arg;
+    int total = CONCURRENT_THREADS * CONCURRENT_KEYS_PER_THREAD;
+    for (int i = 0; i < total; i++) {
+        int key = (i * 7 + w->thread_index) % total, value = 0;
+        if (d_ConcurrentTableGet(w->table, &key, &value) != 0 || value != key * 2) {
+            w->failures++;
+        }
+    }
+    return NULL;
+}
+
+void test_concurrent_table(void)
+{
+    printf("Testing sharded concurrent table...\n");
+
+    dConcurrentTable_t* table = d_ConcurrentTableInit(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 12, 4);
+    assert(table != NULL);
+    assert(table->num_shards == 16 && table->shard_bits == 4);
+    printf("  ✓ shard count rounds up to a power of two\n");
+
+    pthread_t threads[CONCURRENT_THREADS];
+    concurrent_worker_t workers[CONCURRENT_THREADS];
+    for (int t = 0; t < CONCURRENT_THREADS; t++) {
+        workers[t] = (concurrent_worker_t){ table, t, 0 };
+        assert(pthread_create(&threads[t], NULL, concurrent_writer, &workers[t]) == 0);
+    }
+    for (int t = 0; t < CONCURRENT_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+        assert(workers[t].failures == 0);
+    }
+    assert(d_ConcurrentTableGetCount(table) == CONCURRENT_THREADS * CONCURRENT_KEYS_PER_THREAD);
+    printf("  ✓ parallel writers grow shards independently\n");
+
+    for (int t = 0; t < CONCURRENT_THREADS; t++) {
+        workers[t].failures = 0;
+        assert(pthread_create(&threads[t], NULL, concurrent_reader, &workers[t]) == 0);
+    }
+    for (int t = 0; t < CONCURRENT_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+        assert(workers[t].failures == 0);
+    }
+    printf("  ✓ parallel readers see every value\n");
+
+    int key = 42, value = 0, missing = -1;
+    assert(d_ConcurrentTableHasKey(table, &key) == 0);
+    assert(d_ConcurrentTableGet(table, &missing, &value) == 1);
+    assert(d_ConcurrentTableRemove(table, &key) == 0);
+    assert(d_ConcurrentTableHasKey(table, &key) == 1);
+    long long sum = 0;
+    d_ConcurrentTableForEach(table, sum_entry, &sum);
+    long long n = CONCURRENT_THREADS * CONCURRENT_KEYS_PER_THREAD;
+    assert(sum == n * (n - 1) - 84);
+    assert(d_ConcurrentTableClear(table) == 0);
+    assert(d_ConcurrentTableGetCount(table) == 0);
+    printf("  ✓ remove, iterate and clear across shards\n");
+
+    d_ConcurrentTableDestroy(&table);
+    assert(table == NULL);
+
+    // The shard is chosen from the same hash the shard's table probes with
+    const char* names[] = { "alpha", "beta", "gamma" };
+    table = d_ConcurrentTableInit(sizeof(char*), sizeof(int), counting_hash, counting_compare, 8, 4);
+    hash_calls = 0;
+    for (int i = 0; i < 3; i++) {
+        assert(d_ConcurrentTableSet(table, &names[i], &i) == 0);
+    }
+    assert(hash_calls == 3);
+    assert(d_ConcurrentTableGet(table, &names[1], &value) == 0 && value == 1);
+    assert(d_ConcurrentTableHasKey(table, &names[2]) == 0);
+    assert(d_ConcurrentTableRemove(table, &names[0]) == 0);
+    assert(hash_calls == 6);
+    d_ConcurrentTableDestroy(&table);
+    printf("  ✓ each operation hashes its key once\n");
+    printf("\n");
+}
+
+void test_batch_operations(void)
+{
+    printf("Testing batched get/set...\n");
+
+    dTableMode_t modes[] = { D_TABLE_MODE_CHAINED, D_TABLE_MODE_FLAT, D_TABLE_MODE_COMPACT };
+    for (int m = 0; m < 3; m++) {
+        dTable_t* table = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 8, modes[m]);
+        assert(table != NULL);
+
+        enum { N = 1000 };
+        int keys[N], values[N];
+        for (int i = 0; i < N; i++) {
+            keys[i] = i * 13;
+            values[i] = i;
+        }
+        assert(d_TableSetBatch(table, keys, values, N) == 0);
+        assert(d_TableGetCount(table) == N);
+
+        // Mix hits and misses; odd entries are never inserted
+        int lookup[N + 5];
+        void* out[N + 5];
+        for (int i = 0; i < N + 5; i++) {
+            lookup[i] = (i % 2 == 0) ? i * 13 : -i;
+        }
+        assert(d_TableGetBatch(table, lookup, N + 5, out) == N / 2);
+        for (int i = 0; i < N + 5; i++) {
+            if (i % 2 == 0 && i < N) {
+                assert(out[i] == d_TableGet(table, &lookup[i]) && *(int*)out[i] == i);
+            } else {
+                assert(out[i] == NULL);
+            }
+        }
+
+        // Updating through the batch path keeps the count
+        for (int i = 0; i < N; i++) {
+            values[i] = -i;
+        }
+        assert(d_TableSetBatch(table, keys, values, N) == 0);
+        assert(d_TableGetCount(table) == N);
+        assert(*(int*)d_TableGet(table, &keys[N - 1]) == -(N - 1));
+        assert(d_TableGetBatch(table, keys, 0, NULL) == 0);
+
+        d_TableDestroy(&table);
+    }
+    printf("  ✓ batch results match single-key calls in every mode\n");
+    printf("\n");
+}
+
+void test_stored_hashes(void)
+{
+    printf("Testing stored entry hashes...\n");
+
+    static char names[64][16];
+    const char* keys[64];
+    const void* key_ptrs[64];
+    const void* value_ptrs[64];
+    int values[64];
+    for (int i = 0; i < 64; i++) {
+        snprintf(names[i], sizeof(names[i]), "asset_%d", i);
+        keys[i] = names[i];
+        values[i] = i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+
+    dTableMode_t modes[] = { D_TABLE_MODE_CHAINED, D_TABLE_MODE_FLAT, D_TABLE_MODE_COMPACT };
+    for (int m = 0; m < 3; m++) {
+        // Few buckets so chains are long and every lookup passes other keys
+        dTable_t* table = d_TableInitWithMode(sizeof(char*), sizeof(int), counting_hash, counting_compare, 4, modes[m]);
+        assert(table != NULL);
+        for (int i = 0; i < 64; i++) {
+            assert(d_TableSet(table, &keys[i], &values[i]) == 0);
+        }
+
+        hash_calls = 0;
+        assert(d_TableRehash(table, 512) == 0);
+        assert(hash_calls == 0);
+
+        compare_calls = 0;
+        for (int i = 0; i < 64; i++) {
+            assert(*(int*)d_TableGet(table, &keys[i]) == i);
+        }
+        assert(compare_calls == 64);
+        d_TableDestroy(&table);
+    }
+    printf("  ✓ rehash reuses hashes, lookups compare only on a hash match\n");
+
+    dStaticTable_t* static_table = d_InitStaticTable(sizeof(char*), sizeof(int), counting_hash, counting_compare,
+                                                     2, key_ptrs, value_ptrs, 64);
+    assert(static_table != NULL);
+
+    compare_calls = 0;
+    for (int i = 0; i < 64; i++) {
+        assert(*(int*)d_StaticTableGet(static_table, &keys[i]) == i);
+    }
+    assert(compare_calls == 64);
+
+    hash_calls = 0;
+    dStaticTable_t* rebucketed = d_RebucketStaticTable(static_table, 97);
+    dStaticTable_t* cloned = d_CloneStaticTable(static_table);
+    assert(rebucketed != NULL && cloned != NULL);
+    assert(hash_calls == 0);
+    for (int i = 0; i < 64; i++) {
+        assert(*(int*)d_StaticTableGet(rebucketed, &keys[i]) == i);
+        assert(*(int*)d_StaticTableGet(cloned, &keys[i]) == i);
+    }
+    assert(d_StaticTableGetKeyCount(rebucketed) == 64);
+    printf("  ✓ static rebucket and clone reuse stored hashes\n");
+
+    d_StaticTableDestroy(&static_table);
+    d_StaticTableDestroy(&rebucketed);
+    d_StaticTableDestroy(&cloned);
+    printf("\n");
+}
+
+void test_typed_table(void)
+{
+    printf("Testing D_TABLE_DEFINE typed tables...\n");
+
+    IntVecMap_t* map = IntVecMap_Init(4);
+    assert(map != NULL && map->capacity == 8);
+    for (int i = 0; i < 1000; i++) {
+        dVec3_t v = { (float)i, 0.0f, 1.0f };
+        assert(IntVecMap_Set(map, i, v) == 0);
+    }
+    assert(IntVecMap_Count(map) == 1000);
+    for (int i = 0; i < 1000; i++) {
+        dVec3_t* v = IntVecMap_Get(map, i);
+        assert(v != NULL && v->x == (float)i);
+    }
+    assert(IntVecMap_Get(map, 5000) == NULL);
+    assert(IntVecMap_HasKey(map, 5000) == 1);
+    printf("  ✓ inserts with growth and lookups\n");
+
+    for (int i = 0; i < 1000; i += 2) {
+        assert(IntVecMap_Remove(map, i) == 0);
+    }
+    assert(IntVecMap_Remove(map, 0) == 1);
+    assert(IntVecMap_Count(map) == 500);
+    for (int i = 0; i < 1000; i++) {
+        assert(IntVecMap_HasKey(map, i) == ((i % 2 == 0) ? 1 : 0));
+    }
+    assert(IntVecMap_Rehash(map, 4096) == 0);
+    assert(IntVecMap_Rehash(map, 1000) == 1);
+    assert(IntVecMap_Get(map, 999)->x == 999.0f);
+    IntVecMap_Clear(map);
+    assert(IntVecMap_Count(map) == 0 && IntVecMap_Get(map, 999) == NULL);
+    printf("  ✓ remove, rehash and clear\n");
+    IntVecMap_Destroy(&map);
+    assert(map == NULL);
+
+    NameMap_t* names = NameMap_Init(16);
+    assert(names != NULL);
+    assert(NameMap_Set(names, "sword", 1) == 0);
+    assert(NameMap_Set(names, "shield", 2) == 0);
+    char buffer[16];
+    strcpy(buffer, "shield");
+    assert(*NameMap_Get(names, buffer) == 2);
+    assert(NameMap_Set(names, buffer, 3) == 0);
+    assert(NameMap_Count(names) == 2 && *NameMap_Get(names, "shield") == 3);
+    printf("  ✓ string keys hash and compare by content\n");
+    NameMap_Destroy(&names);
+
+    // Struct and slots come from the allocator the table was created with
+    dArena_t* arena = d_ArenaCreate(0);
+    const dAllocator_t* scratch = d_ArenaGetAllocator(arena);
+    map = IntVecMap_InitWithAllocator(4, scratch);
+    assert(map != NULL && map->allocator == scratch && d_ArenaGetUsed(arena) > 0);
+    size_t used = d_ArenaGetUsed(arena);
+    for (int i = 0; i < 100; i++) {
+        dVec3_t v = { (float)i, 0.0f, 0.0f };
+        assert(IntVecMap_Set(map, i, v) == 0);
+    }
+    assert(d_ArenaGetUsed(arena) > used && IntVecMap_Get(map, 99)->x == 99.0f);
+    IntVecMap_Destroy(&map);
+    d_ArenaDestroy(&arena);
+    map = IntVecMap_Init(4);
+    assert(map->allocator == d_GetDefaultAllocator());
+    IntVecMap_Destroy(&map);
+    printf("  ✓ typed tables allocate through their recorded allocator\n");
+    printf("\n");
+}
+
+static void collect_keys(const void* key, size_t key_size, const void* value, size_t value_size, void* user_data)
+{
+    (void)key_size; (void)value; (void)value_size;
+    dArray_t* out = (dArray_t*)user_data;
+    d_ArrayAppend(out, (void*)key);
+}
+
+void test_compact_mode(void)
+{
+    printf("Testing compact insertion-ordered table...\n");
+
+    dTable_t* table = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 8, D_TABLE_MODE_COMPACT);
+    assert(table != NULL);
+    assert(table->mode == D_TABLE_MODE_COMPACT && table->index_width == 1);
+
+    // Scrambled keys, so hash order and insertion order disagree
+    enum { N = 1000 };
+    for (int i = 0; i < N; i++) {
+        int key = (i * 7919) % 10007;
+        assert(d_TableSet(table, &key, &i) == 0);
+    }
+    assert(d_TableGetCount(table) == N);
+    assert(table->index_width == 2);
+    dArray_t* keys = d_TableGetAllKeys(table);
+    dArray_t* values = d_TableGetAllValues(table);
+    for (int i = 0; i < N; i++) {
+        assert(*(int*)d_ArrayGet(keys, i) == (i * 7919) % 10007);
+        assert(*(int*)d_ArrayGet(values, i) == i);
+    }
+    d_ArrayDestroy(keys);
+    d_ArrayDestroy(values);
+    printf("  ✓ keys and values come back in insertion order across growth\n");
+
+    // Update keeps position; remove + re-add moves to the end
+    int first = 0, second = 7919, updated = -1;
+    assert(d_TableSet(table, &first, &updated) == 0);
+    assert(d_TableRemove(table, &second) == 0);
+    assert(d_TableRemove(table, &second) == 1);
+    assert(d_TableHasKey(table, &second) == 1);
+    assert(d_TableSet(table, &second, &updated) == 0);
+    dArray_t* order = d_ArrayInit(N, sizeof(int));
+    d_TableForEach(table, collect_keys, order);
+    assert(order->count == N);
+    assert(*(int*)d_ArrayGet(order, 0) == first);
+    assert(*(int*)d_ArrayGet(order, 1) == (2 * 7919) % 10007);
+    assert(*(int*)d_ArrayGet(order, N - 1) == second);
+    d_ArrayDestroy(order);
+    printf("  ✓ update keeps position, re-insert moves to the end\n");
+
+    // Churn: removed holes are compacted away without losing order
+    for (int round = 0; round < 5; round++) {
+        for (int i = 0; i < N; i += 2) {
+            int key = (i * 7919) % 10007;
+            d_TableRemove(table, &key);
+            assert(d_TableSet(table, &key, &i) == 0);
+        }
+    }
+    assert(d_TableGetCount(table) == N);
+    assert(d_TableRehash(table, 8192) == 0);
+    assert(table->tombstones == 0 && table->entries_used == N);
+    for (int i = 1; i < N; i += 2) {
+        int key = (i * 7919) % 10007;
+        assert(*(int*)d_TableGet(table, &key) == i || key == second);
+    }
+    printf("  ✓ removal churn and explicit rehash\n");
+
+    assert(d_TableClear(table) == 0);
+    assert(d_TableGetCount(table) == 0 && d_TableGet(table, &first) == NULL);
+    for (int i = 0; i < 70000; i++) {
+        assert(d_TableSet(table, &i, &i) == 0);
+    }
+    assert(table->index_width == 4);
+    int probe = 69999;
+    assert(*(int*)d_TableGet(table, &probe) == 69999);
+    printf("  ✓ clear, then widen the index past 16 bits\n");
+
+    d_TableDestroy(&table);
+    assert(table == NULL);
+    printf("\n");
+}
+
+void test_cursor_iteration(void)
+{
+    printf("Testing cursor iteration...\n");
+
+    dTableMode_t modes[] = { D_TABLE_MODE_CHAINED, D_TABLE_MODE_FLAT, D_TABLE_MODE_COMPACT };
+    for (int m = 0; m < 3; m++) {
+        dTable_t* table = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 8, modes[m]);
+        for (int i = 0; i < 500; i++) {
+            assert(d_TableSet(table, &i, &i) == 0);
+        }
+        if (modes[m] == D_TABLE_MODE_CHAINED) {
+            // Walk both bucket arrays of a half-finished migration
+            assert(d_TableSetIncrementalRehash(table, 1) == 0);
+            int extra = 500;
+            for (; extra < 800; extra++) {
+                assert(d_TableSet(table, &extra, &extra) == 0);
+            }
+            assert(d_TableIsRehashing(table));
+        }
+
+        long long expected = 0;
+        d_TableForEach(table, sum_entry, &expected);
+
+        // Doubling values in place is allowed mid-iteration
+        dTableIter_t it = d_TableIterBegin(table);
+        const void* key;
+        void* value;
+        size_t visited = 0;
+        long long sum = 0;
+        while (d_TableIterNext(&it, &key, &value)) {
+            assert(*(const int*)key == *(int*)value);
+            sum += *(int*)value;
+            *(int*)value *= 2;
+            visited++;
+        }
+        assert(visited == d_TableGetCount(table));
+        assert(sum == expected);
+        assert(d_TableIterNext(&it, &key, &value) == false);
+        long long doubled = 0;
+        d_TableForEach(table, sum_entry, &doubled);
+        assert(doubled == 2 * expected);
+        d_TableDestroy(&table);
+    }
+
+    dTableIter_t empty = d_TableIterBegin(NULL);
+    assert(d_TableIterNext(&empty, NULL, NULL) == false);
+    printf("  ✓ every mode yields each entry once, values writable in place\n");
+
+    int keys[32], values[32];
+    const void* key_ptrs[32];
+    const void* value_ptrs[32];
+    for (int i = 0; i < 32; i++) {
+        keys[i] = i * 3;
+        values[i] = i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+    dStaticTable_t* static_table = d_InitStaticTable(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                     7, key_ptrs, value_ptrs, 32);
+    dTableIter_t sit = d_StaticTableIterBegin(static_table);
+    const void* skey;
+    void* svalue;
+    int seen = 0;
+    while (d_StaticTableIterNext(&sit, &skey, &svalue)) {
+        assert(*(const int*)skey == *(int*)svalue * 3);
+        int bumped = *(int*)svalue;
+        assert(d_StaticTableSet(static_table, skey, &bumped) == 0);
+        seen++;
+    }
+    assert(seen == 32);
+    printf("  ✓ static table cursor, d_StaticTableSet allowed while iterating\n");
+
+    // Lookups mid-migration leave the cursor valid and every entry is yielded once
+    dTable_t* growing = d_TableInit(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 8);
+    assert(d_TableSetIncrementalRehash(growing, 1) == 0);
+    int inserted = 0;
+    while (!d_TableIsRehashing(growing) || inserted < 100) {
+        assert(d_TableSet(growing, &inserted, &inserted) == 0);
+        inserted++;
+    }
+    static unsigned char yielded[4096];
+    assert(inserted <= 4096);
+    memset(yielded, 0, sizeof(yielded));
+    dTableIter_t git = d_TableIterBegin(growing);
+    const void* gkey;
+    void* gvalue;
+    seen = 0;
+    while (d_TableIterNext(&git, &gkey, &gvalue)) {
+        int k = *(const int*)gkey;
+        assert(yielded[k]++ == 0 && *(int*)gvalue == k);
+        int probe = (k * 7) % inserted;
+        assert(d_TableGet(growing, &probe) != NULL && d_TableHasKey(growing, &probe) == 0);
+        void* batch[1];
+        assert(d_TableGetBatch(growing, &probe, 1, batch) == 1);
+        seen++;
+    }
+    assert(seen == inserted && d_TableIsRehashing(growing));
+    d_TableDestroy(&growing);
+    printf("  ✓ gets during an incremental rehash do not disturb an open cursor\n");
+
+#ifndef NDEBUG
+    // Inserting a new key mid-iteration must abort the next step
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        dTable_t* table = d_TableInitWithMode(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 8, D_TABLE_MODE_FLAT);
+        int k = 1;
+        d_TableSet(table, &k, &k);
+        dTableIter_t it = d_TableIterBegin(table);
+        d_TableIterNext(&it, NULL, NULL);
+        k = 2;
+        d_TableSet(table, &k, &k);
+        freopen("/dev/null", "w", stderr);
+        d_TableIterNext(&it, NULL, NULL);
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    assert(WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT);
+    printf("  ✓ modification during iteration aborts in debug builds\n");
+#endif
+
+    d_StaticTableDestroy(&static_table);
+    printf("\n");
+}
+
+static void count_evicted(const void* key, const void* value, void* user_data)
+{
+    (void)key;
+    *(long long*)user_data += *(const int*)value;
+}
+
+void test_lru_cache(void)
+{
+    printf("Testing LRU cache...\n");
+
+    dLRUCache_t* cache = d_LRUCacheInit(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 3, 0);
+    assert(cache != NULL);
+    long long evicted_sum = 0;
+    d_LRUCacheSetEvictCallback(cache, count_evicted, &evicted_sum);
+
+    for (int i = 1; i <= 3; i++) {
+        int v = i * 10;
+        assert(d_LRUCachePut(cache, &i, &v) == 0);
+    }
+    // Touch 1 so 2 becomes least recently used
+    int k = 1;
+    assert(*(int*)d_LRUCacheGet(cache, &k) == 10);
+    int k4 = 4, v4 = 40;
+    assert(d_LRUCachePut(cache, &k4, &v4) == 0);
+    assert(d_LRUCacheGetCount(cache) == 3);
+    k = 2;
+    assert(d_LRUCacheGet(cache, &k) == NULL);
+    assert(evicted_sum == 20);
+    k = 3;
+    assert(d_LRUCachePeek(cache, &k) != NULL);
+    printf("  ✓ least recently used entry is evicted first\n");
+
+    // Replacing a value reports the old one; removal reports too but is not an eviction
+    int v1 = 11;
+    k = 1;
+    assert(d_LRUCachePut(cache, &k, &v1) == 0);
+    assert(evicted_sum == 30);
+    assert(d_LRUCacheRemove(cache, &k) == 0);
+    assert(d_LRUCacheRemove(cache, &k) == 1);
+    assert(evicted_sum == 41);
+
+    size_t hits, misses, evictions;
+    d_LRUCacheGetStats(cache, &hits, &misses, &evictions);
+    assert(hits == 1 && misses == 1 && evictions == 1);
+    printf("  ✓ evict callback and hit/miss/eviction counters\n");
+
+    // Heavy churn stays inside the preallocated nodes
+    void* nodes = cache->nodes;
+    for (int i = 0; i < 10000; i++) {
+        assert(d_LRUCachePut(cache, &i, &i) == 0);
+    }
+    assert(cache->nodes == nodes && d_LRUCacheGetCount(cache) == 3);
+    k = 9999;
+    assert(*(int*)d_LRUCacheGet(cache, &k) == 9999);
+    assert(d_LRUCacheClear(cache) == 0);
+    assert(d_LRUCacheGetCount(cache) == 0 && d_LRUCacheGet(cache, &k) == NULL);
+    d_LRUCacheDestroy(&cache);
+    assert(cache == NULL);
+    printf("  ✓ churn reuses nodes, clear empties the cache\n");
+
+    // Byte budget with explicit per-entry costs
+    cache = d_LRUCacheInit(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 0, 1000);
+    assert(cache != NULL);
+    for (int i = 0; i < 100; i++) {
+        assert(d_LRUCachePutWithCost(cache, &i, &i, 300) == 0);
+        assert(cache->total_bytes <= 1000);
+    }
+    assert(d_LRUCacheGetCount(cache) == 3);
+    int big = 500;
+    assert(d_LRUCachePutWithCost(cache, &big, &big, 2000) == 1);
+    assert(d_LRUCachePutWithCost(cache, &big, &big, 900) == 0);
+    assert(d_LRUCacheGetCount(cache) == 1 && cache->total_bytes == 900);
+    d_LRUCacheDestroy(&cache);
+
+    assert(d_LRUCacheInit(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 0, 0) == NULL);
+    printf("  ✓ byte budget evicts by cost\n");
+    printf("\n");
+}
+
+static size_t constant_hash(const void* key, size_t key_size)
+{
+    (void)key; (void)key_size;
+    return 7;
+}
+
+void test_perfect_static_table(void)
+{
+    printf("Testing perfect-hash static table...\n");
+
+    enum { N = 5000 };
+    static int keys[N], values[N];
+    static const void* key_ptrs[N];
+    static const void* value_ptrs[N];
+    for (int i = 0; i < N; i++) {
+        keys[i] = i * 7919 + 13;
+        values[i] = i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+
+    dStaticTable_t* table = d_InitStaticTablePerfect(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                     key_ptrs, value_ptrs, N);
+    assert(table != NULL);
+    assert(table->mode == D_STATIC_TABLE_MODE_PERFECT);
+    assert(table->buckets == NULL);
+    assert(d_StaticTableGetKeyCount(table) == N);
+    for (int i = 0; i < N; i++) {
+        int* value = (int*)d_StaticTableGet(table, &keys[i]);
+        assert(value != NULL && *value == i);
+    }
+    int missing = 2;
+    assert(d_StaticTableGet(table, &missing) == NULL);
+    assert(d_StaticTableHasKey(table, &missing) == 1);
+    assert(d_StaticTableHasKey(table, &keys[N - 1]) == 0);
+    printf("  ✓ %d keys, every lookup hits, misses return NULL\n", N);
+
+    int updated = -1;
+    assert(d_StaticTableSet(table, &keys[42], &updated) == 0);
+    assert(*(int*)d_StaticTableGet(table, &keys[42]) == -1);
+    assert(d_StaticTableSet(table, &missing, &updated) == 1);
+    assert(d_StaticTableSet(table, &keys[42], &values[42]) == 0);
+
+    size_t min = 0, max = 0, empty = 1;
+    float avg = 0.0f;
+    assert(d_StaticTableGetStats(table, &min, &max, &avg, &empty) == 0);
+    assert(min == 1 && max == 1 && empty == 0);
+    printf("  ✓ set in place, one key per slot\n");
+
+    long long sum = 0;
+    assert(d_StaticTableIterate(table, sum_entry, &sum) == 0);
+    assert(sum == (long long)N * (N - 1) / 2);
+    dArray_t* all_keys = d_StaticTableGetAllKeys(table);
+    dArray_t* all_values = d_StaticTableGetAllValues(table);
+    assert(all_keys->count == N && all_values->count == N);
+    d_ArrayDestroy(all_keys);
+    d_ArrayDestroy(all_values);
+
+    dStaticTable_t* cloned = d_CloneStaticTable(table);
+    dStaticTable_t* rebucketed = d_RebucketStaticTable(table, 257);
+    assert(cloned != NULL && cloned->mode == D_STATIC_TABLE_MODE_PERFECT);
+    assert(rebucketed != NULL && rebucketed->mode == D_STATIC_TABLE_MODE_CHAINED);
+    for (int i = 0; i < N; i += 97) {
+        assert(*(int*)d_StaticTableGet(cloned, &keys[i]) == i);
+        assert(*(int*)d_StaticTableGet(rebucketed, &keys[i]) == i);
+    }
+    d_StaticTableDestroy(&cloned);
+    d_StaticTableDestroy(&rebucketed);
+    printf("  ✓ iterate, collect, clone and rebucket\n");
+
+    const char* path = "/tmp/daedalus_perfect_table.bin";
+    assert(d_StaticTableSaveToFile(path, table) == 0);
+    dStaticTable_t* loaded = d_LoadStaticTableFromFile(path, d_HashInt, d_CompareInt);
+    assert(loaded != NULL && d_StaticTableGetKeyCount(loaded) == N);
+    assert(*(int*)d_StaticTableGet(loaded, &keys[N / 2]) == N / 2);
+    d_StaticTableDestroy(&loaded);
+    remove(path);
+
+    assert(d_StaticTableClear(table) == 0);
+    assert(d_StaticTableGet(table, &keys[0]) == NULL);
+    d_StaticTableDestroy(&table);
+    printf("  ✓ save/load round trip and clear\n");
+
+    const char* names[] = { "sword", "shield", "potion", "scroll", "arrow" };
+    const void* name_ptrs[] = { &names[0], &names[1], &names[2], &names[3], &names[4] };
+    table = d_InitStaticTablePerfect(sizeof(char*), sizeof(int), d_HashString, d_CompareString,
+                                     name_ptrs, value_ptrs, 5);
+    assert(table != NULL);
+    for (int i = 0; i < 5; i++) {
+        assert(*(int*)d_StaticTableGet(table, &names[i]) == i);
+    }
+    d_StaticTableDestroy(&table);
+    printf("  ✓ string keys\n");
+
+    const void* dup_ptrs[] = { &keys[0], &keys[1], &keys[0] };
+    assert(d_InitStaticTablePerfect(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                    dup_ptrs, value_ptrs, 3) == NULL);
+    assert(d_InitStaticTablePerfect(sizeof(int), sizeof(int), constant_hash, d_CompareInt,
+                                    key_ptrs, value_ptrs, 3) == NULL);
+    printf("  ✓ duplicate keys and colliding hashes are rejected\n");
+    printf("\n");
+}
+
+// Overwrite one 64-bit header field of a saved table file in place
+static void patch_u64_at(const char* path, long offset, uint64_t value)
+{
+    FILE* file = fopen(path, "r+b");
+    assert(file != NULL);
+    assert(fseek(file, offset, SEEK_SET) == 0);
+    assert(fwrite(&value, sizeof(value), 1, file) == 1);
+    fclose(file);
+}
+
+void test_mapped_static_table(void)
+{
+    printf("Testing memory-mapped static table files...\n");
+
+    enum { N = 3000 };
+    static int keys[N], values[N];
+    static const void* key_ptrs[N];
+    static const void* value_ptrs[N];
+    for (int i = 0; i < N; i++) {
+        keys[i] = i * 31 + 5;
+        values[i] = i * 2;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+
+    const char* path = "/tmp/daedalus_mapped_table.bin";
+    dStaticTable_t* table = d_InitStaticTablePerfect(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                     key_ptrs, value_ptrs, N);
+    assert(table != NULL);
+    assert(d_StaticTableSaveToFile(path, table) == 0);
+    d_StaticTableDestroy(&table);
+
+    dStaticTable_t* mapped = d_MapStaticTableFromFile(path, d_HashInt, d_CompareInt);
+    assert(mapped != NULL);
+    assert(mapped->mapping != NULL && mapped->mode == D_STATIC_TABLE_MODE_PERFECT);
+    assert((char*)mapped->slots >= (char*)mapped->mapping);
+    for (int i = 0; i < N; i++) {
+        assert(*(int*)d_StaticTableGet(mapped, &keys[i]) == i * 2);
+    }
+    int missing = 1;
+    assert(d_StaticTableGet(mapped, &missing) == NULL);
+    long long sum = 0;
+    assert(d_StaticTableIterate(mapped, sum_entry, &sum) == 0);
+    assert(sum == (long long)N * (N - 1));
+    printf("  ✓ mapped table answers every lookup from the file pages\n");
+
+    int updated = 7;
+    assert(d_StaticTableSet(mapped, &keys[0], &updated) == 1);
+    dStaticTable_t* writable = d_CloneStaticTable(mapped);
+    assert(writable != NULL && writable->mapping == NULL);
+    assert(d_StaticTableSet(writable, &keys[0], &updated) == 0);
+    assert(*(int*)d_StaticTableGet(writable, &keys[0]) == 7);
+    assert(*(int*)d_StaticTableGet(mapped, &keys[0]) == 0);
+    d_StaticTableDestroy(&writable);
+    d_StaticTableDestroy(&mapped);
+    printf("  ✓ mapped table is read-only, clone makes a writable copy\n");
+
+    dStaticTable_t* loaded = d_LoadStaticTableFromFile(path, d_HashInt, d_CompareInt);
+    assert(loaded != NULL && loaded->mode == D_STATIC_TABLE_MODE_PERFECT && loaded->mapping == NULL);
+    assert(d_StaticTableSet(loaded, &keys[1], &updated) == 0);
+    assert(*(int*)d_StaticTableGet(loaded, &keys[N - 1]) == (N - 1) * 2);
+    d_StaticTableDestroy(&loaded);
+    printf("  ✓ version 2 files also load as writable tables\n");
+
+    // Chained tables write version 3, which cannot be mapped
+    table = d_InitStaticTable(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 64, key_ptrs, value_ptrs, 100);
+    assert(d_StaticTableSaveToFile(path, table) == 0);
+    assert(d_MapStaticTableFromFile(path, d_HashInt, d_CompareInt) == NULL);
+    d_StaticTableDestroy(&table);
+
+    FILE* truncated = fopen(path, "wb");
+    assert(truncated != NULL);
+    fputs("DAED", truncated);
+    fclose(truncated);
+    assert(d_MapStaticTableFromFile(path, d_HashInt, d_CompareInt) == NULL);
+    assert(d_MapStaticTableFromFile("/tmp/daedalus_no_such_table.bin", d_HashInt, d_CompareInt) == NULL);
+    printf("  ✓ chained, truncated and missing files are rejected\n");
+
+    // Corrupt slot size, slot layout and pilot alignment fail cleanly on both load paths
+    struct { long offset; uint64_t value; } corruptions[] = {
+        { 32, 0 },                      // slot_size of zero
+        { 32, sizeof(int) },            // slot too small for key and value
+        { 40, 1 },                      // value_offset overlapping the key
+        { 64, 4096 + 2 },               // pilots_offset not uint32_t aligned
+    };
+    table = d_InitStaticTablePerfect(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, key_ptrs, value_ptrs, 64);
+    for (size_t c = 0; c < sizeof(corruptions) / sizeof(corruptions[0]); c++) {
+        assert(d_StaticTableSaveToFile(path, table) == 0);
+        patch_u64_at(path, corruptions[c].offset, corruptions[c].value);
+        assert(d_MapStaticTableFromFile(path, d_HashInt, d_CompareInt) == NULL);
+        assert(d_LoadStaticTableFromFile(path, d_HashInt, d_CompareInt) == NULL);
+    }
+    d_StaticTableDestroy(&table);
+    remove(path);
+    printf("  ✓ corrupt header layouts are rejected without faulting\n");
+    printf("\n");
+}
+
+void test_parallel_static_build(void)
+{
+    printf("Testing parallel static table construction...\n");
+
+    enum { N = 40000 };
+    static int keys[N], values[N];
+    static const void* key_ptrs[N];
+    static const void* value_ptrs[N];
+    for (int i = 0; i < N; i++) {
+        keys[i] = (int)((unsigned int)i * 104729u + 1u);
+        values[i] = i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+
+    dStaticTable_t* serial = d_InitStaticTable(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                               1021, key_ptrs, value_ptrs, N);
+    dStaticTable_t* parallel = d_InitStaticTableParallel(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                                         1021, key_ptrs, value_ptrs, N, 4);
+    assert(serial != NULL && parallel != NULL);
+    assert(d_StaticTableGetKeyCount(parallel) == N);
+    for (int i = 0; i < N; i++) {
+        assert(*(int*)d_StaticTableGet(parallel, &keys[i]) == i);
+    }
+
+    // Same chains in the same order, so both cursors yield identical sequences
+    dTableIter_t a = d_StaticTableIterBegin(serial);
+    dTableIter_t b = d_StaticTableIterBegin(parallel);
+    const void* key_a;
+    const void* key_b;
+    size_t walked = 0;
+    while (d_StaticTableIterNext(&a, &key_a, NULL)) {
+        assert(d_StaticTableIterNext(&b, &key_b, NULL));
+        assert(*(const int*)key_a == *(const int*)key_b);
+        walked++;
+    }
+    assert(walked == N && !d_StaticTableIterNext(&b, &key_b, NULL));
+    d_StaticTableDestroy(&serial);
+    d_StaticTableDestroy(&parallel);
+    printf("  ✓ 4 threads build the same table as the serial path\n");
+
+    parallel = d_InitStaticTableParallel(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                         4096, key_ptrs, value_ptrs, N, 0);
+    assert(parallel != NULL && d_StaticTableGetKeyCount(parallel) == N);
+    d_StaticTableDestroy(&parallel);
+    parallel = d_InitStaticTableParallel(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                         16, key_ptrs, value_ptrs, 100, 8);
+    assert(parallel != NULL && d_StaticTableGetKeyCount(parallel) == 100);
+    d_StaticTableDestroy(&parallel);
+    printf("  ✓ automatic thread count and small key sets\n");
+
+    // An arena is not thread-safe; its slabs are reserved before any thread starts
+    dArena_t* arena = d_ArenaCreate(0);
+    d_SetDefaultAllocator(d_ArenaGetAllocator(arena));
+    parallel = d_InitStaticTableParallel(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                         1021, key_ptrs, value_ptrs, N, 4);
+    d_SetDefaultAllocator(NULL);
+    assert(parallel != NULL && parallel->allocator == d_ArenaGetAllocator(arena));
+    for (int i = 0; i < N; i += 101) {
+        assert(*(int*)d_StaticTableGet(parallel, &keys[i]) == i);
+    }
+    d_StaticTableDestroy(&parallel);
+    d_ArenaDestroy(&arena);
+    printf("  ✓ non-heap allocators are only called from the building thread\n");
+
+    key_ptrs[N - 1] = &keys[N / 3];
+    assert(d_InitStaticTableParallel(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                     1021, key_ptrs, value_ptrs, N, 4) == NULL);
+    key_ptrs[N - 1] = NULL;
+    assert(d_InitStaticTableParallel(sizeof(int), sizeof(int), d_HashInt, d_CompareInt,
+                                     1021, key_ptrs, value_ptrs, N, 4) == NULL);
+    key_ptrs[N - 1] = &keys[N - 1];
+    printf("  ✓ duplicate and NULL keys are rejected\n");
+    printf("\n");
+}
+
+#define SEQLOCK_KEYS 8
+#define SEQLOCK_WRITES 20000
+
+typedef struct {
+    int fields[32];  // Writers keep every field equal; a torn read would mix two writes
+} seqlock_value_t;
+
+typedef struct {
+    dStaticTable_t* table;
+    int* done;       // Set by the writer with __atomic_store_n, polled by readers
+    int torn;
+    int reads;
+} seqlock_worker_t;
+
+static void* seqlock_writer(void* arg)
+{
+    seqlock_worker_t* w = (seqlock_worker_t*)arg;
+    seqlock_value_t value;
+    for (int n = 1; n <= SEQLOCK_WRITES; n++) {
+        int key = n % SEQLOCK_KEYS;
+        for (int f = 0; f < 32; f++) {
+            value.fields[f] = n;
+        }
+        int result = d_StaticTableSet(w->table, &key, &value);
+        assert(result == 0);
+        (void)result;
+    }
+    __atomic_store_n(w->done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void* seqlock_reader(void* arg)
+{
+    seqlock_worker_t* w = (seqlock_worker_t*)arg;
+    seqlock_value_t value;
+    for (int n = 0; !__atomic_load_n(w->done, __ATOMIC_ACQUIRE) || n < 1000; n++) {
+        int key = n % SEQLOCK_KEYS;
+        int result = d_StaticTableGetConcurrent(w->table, &key, &value);
+        assert(result == 0);
+        (void)result;
+        for (int f = 1; f < 32; f++) {
+            if (value.fields[f] != value.fields[0]) {
+                w->torn++;
+                break;
+            }
+        }
+        w->reads++;
+    }
+    return NULL;
+}
+
+void test_static_table_seqlock(void)
+{
+    printf("Testing seqlock concurrent static table...\n");
+
+    int keys[SEQLOCK_KEYS];
+    seqlock_value_t initial;
+    memset(&initial, 0, sizeof(initial));
+    const void* key_ptrs[SEQLOCK_KEYS];
+    const void* value_ptrs[SEQLOCK_KEYS];
+    for (int i = 0; i < SEQLOCK_KEYS; i++) {
+        keys[i] = i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &initial;
+    }
+
+    dStaticTable_t* tables[2] = {
+        d_InitStaticTable(sizeof(int), sizeof(seqlock_value_t), d_HashInt, d_CompareInt, 3,
+                          key_ptrs, value_ptrs, SEQLOCK_KEYS),
+        d_InitStaticTablePerfect(sizeof(int), sizeof(seqlock_value_t), d_HashInt, d_CompareInt,
+                                 key_ptrs, value_ptrs, SEQLOCK_KEYS),
+    };
+
+    for (int t = 0; t < 2; t++) {
+        dStaticTable_t* table = tables[t];
+        assert(table != NULL);
+        int enabled = d_StaticTableEnableConcurrent(table);
+        int enabled_again = d_StaticTableEnableConcurrent(table);
+        assert(enabled == 0 && enabled_again == 0 && table->seqs != NULL);
+
+        int done = 0;
+        pthread_t threads[3];
+        seqlock_worker_t workers[3];
+        for (int w = 0; w < 3; w++) {
+            workers[w] = (seqlock_worker_t){ table, &done, 0, 0 };
+        }
+        int started = pthread_create(&threads[0], NULL, seqlock_writer, &workers[0]);
+        started |= pthread_create(&threads[1], NULL, seqlock_reader, &workers[1]);
+        started |= pthread_create(&threads[2], NULL, seqlock_reader, &workers[2]);
+        assert(started == 0);
+        for (int w = 0; w < 3; w++) {
+            pthread_join(threads[w], NULL);
+        }
+        assert(workers[1].torn == 0 && workers[2].torn == 0);
+        assert(workers[1].reads > 0 && workers[2].reads > 0);
+
+        // Every counter is even again, and the last write of each key is visible
+        size_t counters = table->mode == D_STATIC_TABLE_MODE_PERFECT ? table->num_keys : table->num_buckets;
+        for (size_t c = 0; c < counters; c++) {
+            assert((table->seqs[c] & 1) == 0);
+        }
+        seqlock_value_t last;
+        int key = SEQLOCK_WRITES % SEQLOCK_KEYS;
+        int found = d_StaticTableGetConcurrent(table, &key, &last);
+        assert(found == 0 && last.fields[31] == SEQLOCK_WRITES);
+
+        int missing = 99;
+        found = d_StaticTableGetConcurrent(table, &missing, &last);
+        assert(found == 1);
+        d_StaticTableDestroy(&table);
+    }
+    printf("  ✓ readers never see a torn value in chained or perfect mode\n");
+    printf("\n");
+}
+
+static long file_size_of(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+static void flip_byte_at(const char* path, long offset)
+{
+    FILE* file = fopen(path, "r+b");
+    assert(file != NULL);
+    fseek(file, offset, SEEK_SET);
+    int byte = fgetc(file);
+    fseek(file, offset, SEEK_SET);
+    fputc(byte ^ 0x40, file);
+    fclose(file);
+}
+
+void test_file_writer(void)
+{
+    printf("Testing buffered atomic file writer...\n");
+
+    // The checksum must not depend on how the data was split across updates
+    char data[1000];
+    for (int i = 0; i < (int)sizeof(data); i++) {
+        data[i] = (char)(i * 7 + 3);
+    }
+    dChecksum_t whole, pieces;
+    d_ChecksumReset(&whole);
+    d_ChecksumUpdate(&whole, data, sizeof(data));
+    d_ChecksumReset(&pieces);
+    for (size_t off = 0, step = 1; off < sizeof(data); off += step, step = step % 13 + 1) {
+        d_ChecksumUpdate(&pieces, data + off, MIN(step, sizeof(data) - off));
+    }
+    assert(d_ChecksumFinal(&whole) == d_ChecksumFinal(&pieces));
+    d_ChecksumUpdate(&pieces, "\0", 1);
+    assert(d_ChecksumFinal(&whole) != d_ChecksumFinal(&pieces));
+    printf("  ✓ checksum is split-invariant and length-sensitive\n");
+
+    // Small buffer so writes both stage and bypass it
+    const char* path = "/tmp/daedalus_writer.bin";
+    dFileWriter_t* writer = d_FileWriterOpen(path, 64);
+    assert(writer != NULL);
+    char temp_path[256];
+    snprintf(temp_path, sizeof(temp_path), "%s", writer->temp_path);
+    assert(strncmp(temp_path, path, strlen(path)) == 0 && strcmp(temp_path, path) != 0);
+    assert(d_FileWriterWrite(writer, data, 10) == 0);
+    assert(d_FileWriterWriteZeros(writer, 100) == 0);
+    assert(d_FileWriterWrite(writer, data, sizeof(data)) == 0);
+    assert(d_FileWriterTell(writer) == 10 + 100 + sizeof(data));
+    assert(file_size_of(temp_path) >= 0);
+    assert(d_FileWriterCommit(&writer) == 0 && writer == NULL);
+    assert(file_size_of(path) == (long)(10 + 100 + sizeof(data) + sizeof(uint64_t)));
+    assert(file_size_of(temp_path) < 0);
+
+    char readback[1110];
+    uint64_t trailer;
+    FILE* file = fopen(path, "rb");
+    assert(fread(readback, 1, sizeof(readback), file) == sizeof(readback));
+    assert(fread(&trailer, sizeof(trailer), 1, file) == 1);
+    fclose(file);
+    assert(memcmp(readback, data, 10) == 0 && readback[50] == 0 && memcmp(readback + 110, data, sizeof(data)) == 0);
+    dChecksum_t check;
+    d_ChecksumReset(&check);
+    d_ChecksumUpdate(&check, readback, sizeof(readback));
+    assert(trailer == d_ChecksumFinal(&check));
+    printf("  ✓ committed file holds the data plus its checksum, temp file is gone\n");
+
+    // Two writers on one path get separate temp files
+    writer = d_FileWriterOpen(path, 0);
+    dFileWriter_t* other = d_FileWriterOpen(path, 0);
+    assert(writer != NULL && other != NULL && strcmp(writer->temp_path, other->temp_path) != 0);
+    snprintf(temp_path, sizeof(temp_path), "%s", writer->temp_path);
+    assert(d_FileWriterWrite(writer, "partial", 7) == 0);
+    d_FileWriterAbort(&writer);
+    d_FileWriterAbort(&other);
+    assert(writer == NULL);
+    assert(file_size_of(path) == (long)(1110 + sizeof(uint64_t)));
+    assert(file_size_of(temp_path) < 0);
+    assert(d_FileWriterOpen("/tmp/daedalus_no_such_dir/file.bin", 0) == NULL);
+    remove(path);
+    printf("  ✓ abort leaves the previous file untouched, temp files are per writer\n");
+
+    // Static arrays store only the used elements and reject a damaged file
+    const char* array_path = "/tmp/daedalus_writer_array.bin";
+    dStaticArray_t* array = d_InitStaticArray(10000, sizeof(int));
+    for (int i = 0; i < 25; i++) {
+        d_StaticArrayAppend(array, &i);
+    }
+    assert(d_StaticArraySaveToFile(array_path, array) == 0);
+    assert(file_size_of(array_path) == (long)(2 * sizeof(uint32_t) + 3 * sizeof(size_t) +
+                                              25 * sizeof(int) + sizeof(uint64_t)));
+    dStaticArray_t* loaded_array = d_LoadStaticArrayFromFile(array_path);
+    assert(loaded_array != NULL && loaded_array->capacity == 10000 && loaded_array->count == 25);
+    assert(*(int*)d_StaticArrayGet(loaded_array, 24) == 24);
+    d_StaticArrayDestroy(loaded_array);
+    flip_byte_at(array_path, 40);
+    assert(d_LoadStaticArrayFromFile(array_path) == NULL);
+    d_StaticArrayDestroy(array);
+    remove(array_path);
+    printf("  ✓ static array files are count-only and checksummed\n");
+
+    // Both static table formats round-trip and reject a flipped byte
+    enum { N = 500 };
+    static int keys[N], values[N];
+    static const void* key_ptrs[N];
+    static const void* value_ptrs[N];
+    for (int i = 0; i < N; i++) {
+        keys[i] = i * 13 + 1;
+        values[i] = -i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+    const char* table_path = "/tmp/daedalus_writer_table.bin";
+    for (int perfect = 0; perfect < 2; perfect++) {
+        dStaticTable_t* table = perfect
+            ? d_InitStaticTablePerfect(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, key_ptrs, value_ptrs, N)
+            : d_InitStaticTable(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 64, key_ptrs, value_ptrs, N);
+        assert(table != NULL);
+        assert(d_StaticTableSaveToFile(table_path, table) == 0);
+        dStaticTable_t* loaded = d_LoadStaticTableFromFile(table_path, d_HashInt, d_CompareInt);
+        assert(loaded != NULL && loaded->num_keys == N);
+        for (int i = 0; i < N; i++) {
+            assert(*(int*)d_StaticTableGet(loaded, &keys[i]) == -i);
+        }
+        d_StaticTableDestroy(&loaded);
+
+        flip_byte_at(table_path, file_size_of(table_path) - 20);
+        assert(d_LoadStaticTableFromFile(table_path, d_HashInt, d_CompareInt) == NULL);
+        d_StaticTableDestroy(&table);
+    }
+    remove(table_path);
+    printf("  ✓ chained and perfect table files round-trip and detect corruption\n");
+    printf("\n");
+}
+
+static int async_results[2];
+
+static void count_async_result(const char* filename, int result, void* user_data)
+{
+    (void)filename; (void)user_data;
+    __atomic_add_fetch(&async_results[result], 1, __ATOMIC_RELAXED);
+}
+
+void test_async_save(void)
+{
+    printf("Testing background saves...\n");
+
+    // The array is changed and destroyed right away; the file holds the snapshot
+    const char* array_path = "/tmp/daedalus_async_array.bin";
+    dStaticArray_t* array = d_InitStaticArray(1000, sizeof(int));
+    for (int i = 0; i < 600; i++) {
+        d_StaticArrayAppend(array, &i);
+    }
+    dAsyncSave_t* save = d_StaticArraySaveToFileAsync(array_path, array, count_async_result, NULL);
+    assert(save != NULL);
+    *(int*)d_StaticArrayGet(array, 0) = -1;
+    d_StaticArrayDestroy(array);
+    assert(d_AsyncSaveWait(save) == 0);
+    assert(d_AsyncSavePoll(save) == D_ASYNC_SAVE_DONE);
+    assert(async_results[0] == 1);
+    d_AsyncSaveDestroy(&save);
+    assert(save == NULL);
+
+    dStaticArray_t* loaded_array = d_LoadStaticArrayFromFile(array_path);
+    assert(loaded_array != NULL && loaded_array->count == 600 && loaded_array->capacity == 1000);
+    assert(*(int*)d_StaticArrayGet(loaded_array, 0) == 0 && *(int*)d_StaticArrayGet(loaded_array, 599) == 599);
+    d_StaticArrayDestroy(loaded_array);
+    remove(array_path);
+    printf("  ✓ static array save uses a snapshot and reports completion\n");
+
+    enum { N = 2000 };
+    static int keys[N], values[N];
+    static const void* key_ptrs[N];
+    static const void* value_ptrs[N];
+    for (int i = 0; i < N; i++) {
+        keys[i] = i * 17 + 3;
+        values[i] = i;
+        key_ptrs[i] = &keys[i];
+        value_ptrs[i] = &values[i];
+    }
+    const char* table_path = "/tmp/daedalus_async_table.bin";
+    for (int perfect = 0; perfect < 2; perfect++) {
+        dStaticTable_t* table = perfect
+            ? d_InitStaticTablePerfect(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, key_ptrs, value_ptrs, N)
+            : d_InitStaticTable(sizeof(int), sizeof(int), d_HashInt, d_CompareInt, 128, key_ptrs, value_ptrs, N);
+        save = d_StaticTableSaveToFileAsync(table_path, table, count_async_result, NULL);
+        assert(save != NULL);
+        int changed = -5;
+        assert(d_StaticTableSet(table, &keys[0], &changed) == 0);
+        d_StaticTableDestroy(&table);
+        while (d_AsyncSavePoll(save) == D_ASYNC_SAVE_PENDING) {
+            sched_yield();
+        }
+        assert(d_AsyncSavePoll(save) == D_ASYNC_SAVE_DONE);
+        d_AsyncSaveDestroy(&save);
+
+        dStaticTable_t* loaded = d_LoadStaticTableFromFile(table_path, d_HashInt, d_CompareInt);
+        assert(loaded != NULL && loaded->num_keys == N);
+        assert(loaded->mode == (perfect ? D_STATIC_TABLE_MODE_PERFECT : D_STATIC_TABLE_MODE_CHAINED));
+        for (int i = 0; i < N; i++) {
+            assert(*(int*)d_StaticTableGet(loaded, &keys[i]) == i);
+        }
+        d_StaticTableDestroy(&loaded);
+    }
+    remove(table_path);
+    assert(async_results[0] == 3);
+    printf("  ✓ chained and perfect table saves write the state at call time\n");
+
+    dStaticArray_t* small = d_InitStaticArray(4, sizeof(int));
+    save = d_StaticArraySaveToFileAsync("/tmp/daedalus_no_such_dir/array.bin", small, count_async_result, NULL);
+    assert(save != NULL);
+    assert(d_AsyncSaveWait(save) == 1);
+    assert(d_AsyncSavePoll(save) == D_ASYNC_SAVE_FAILED);
+    assert(async_results[1] == 1);
+    d_AsyncSaveDestroy(&save);
+    d_StaticArrayDestroy(small);
+    assert(d_StaticTableSaveToFileAsync(table_path, NULL, NULL, NULL) == NULL);
+    printf("  ✓ failed saves are reported through the callback and the handle\n");
+    printf("\n");
+}
+
+int main(void)
+{
+    printf("=== dTable Tests ===\n\n");
+
+    test_flat_basic();
+    test_flat_remove_and_tombstones();
+    test_flat_string_keys();
+    test_incremental_rehash();
+    test_concurrent_table();
+    test_batch_operations();
+    test_stored_hashes();
+    test_typed_table();
+    test_compact_mode();
+    test_cursor_iteration();
+    test_lru_cache();
+    test_perfect_static_table();
+    test_mapped_static_table();
+    test_parallel_static_build();
+    test_static_table_seqlock();
+    test_file_writer();
+    test_async_save();
+
+    printf("=== All table tests passed! ===\n");
+    return 0;
+}